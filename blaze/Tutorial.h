@@ -2781,7 +2781,7 @@
 // demonstrates the use of the \a select() function:
 
    \code
-   blaze::DynamicVector<bool> cond{ true, false, true false };
+   blaze::DynamicVector<bool> cond{ true, false, true, false };
    blaze::DynamicVector<int> a{ 1, -1, 1, -1 };
    blaze::DynamicVector<int> b{ -2, 2, -2, 2 };
    blaze::DynamicVector<int> c;
@@ -2790,6 +2790,34 @@
    c = select( cond, a, b );  // Results in ( 1, 2, 1, 2 )
    \endcode
 
+// In case the conditions are the result of an elementwise comparison via one of the \c Less,
+// \c LessEqual, \c Greater, or \c GreaterEqual functors, the comparison and the selection are
+// fused into a single operation. For single and double precision floating point vectors both
+// the comparison and the selection are vectorized. The same applies to conditions of the same
+// floating point type as the selected elements, where all non-zero elements select from \c a:
+
+   \code
+   blaze::DynamicVector<double> x, y, a, b, c;
+   // ... Resizing and initialization
+
+   c = select( map( x, y, blaze::Less() ), a, b );  // Vectorized ( x < y ) ? a : b
+   c = select( x, a, b );                           // Vectorized ( x != 0 ) ? a : b
+   \endcode
+
+// \n \subsection vector_operations_masked_assign maskedAssign()
+//
+// The \c maskedAssign() function assigns the elements of a dense vector only where the according
+// condition evaluates to \a true and leaves all other elements untouched. The assignment is
+// performed in-place and is vectorized and parallelized in the same way as the \c select()
+// function:
+
+   \code
+   blaze::DynamicVector<double> a{ 1.0, -2.0, 3.0, -4.0 };
+   blaze::DynamicVector<double> b{ 0.0, 0.0, 0.0, 0.0 };
+
+   maskedAssign( a, map( a, b, blaze::Less() ), b );  // Results in ( 1, 0, 3, 0 )
+   \endcode
+
 // \n \section vector_operations_reduction_operations Reduction Operations
 // <hr>
 //
@@ -2845,6 +2873,24 @@
 
 // Please note that the evaluation order of the \c sum() function is unspecified.
 //
+// For long dense vectors with floating point elements, the rounding errors of the default
+// summation may become significant. Via the \c pairwise and \c compensated summation flags
+// it is possible to select a more accurate summation algorithm for both the \c sum() and the
+// \c dot() function:
+
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+
+   const double s1 = sum<blaze::pairwise>( a );        // Rounding error grows with log(n)
+   const double s2 = sum<blaze::compensated>( a );     // Accuracy close to twice the precision
+   const double s3 = dot<blaze::compensated>( a, b );  // Exact products and compensated sum
+   \endcode
+
+// Both algorithms are vectorized and parallelized. The pairwise summation is almost as fast as
+// the default summation. The compensated summation is approximately 1.5 times slower for long
+// vectors and 3 to 5 times slower for vectors that fit into the cache.
+//
 // \n \subsection vector_operations_reduction_operations_prod prod()
 //
 // The \c prod() function reduces the elements of the given dense vector or the non-zero elements
@@ -5971,13 +6017,13 @@
 // \n \subsection matrix_operations_select select()
 //
 // The \c select() function performs a componentwise, conditional selection of elements. Given
-// the three dense matrices \c cond, \c A, and \c B, in case an element in the \c cond vector
+// the three dense matrices \c cond, \c A, and \c B, in case an element in the \c cond matrix
 // evaluates to \a true, the according element of \a A is selected, in case the \a cond element
 // evaluates to \a false, the according element of \a B is selected. The following example
 // demonstrates the use of the \a select() function:
 
    \code
-   blaze::DynamicMatrix<bool> cond{ { true, false }, { true false } };
+   blaze::DynamicMatrix<bool> cond{ { true, false }, { true, false } };
    blaze::DynamicMatrix<int> A{ { 1, -1 }, { 1, -1 } };
    blaze::DynamicMatrix<int> B{ { -2, 2 }, { -2, 2 } };
    blaze::DynamicMatrix<int> C;
@@ -5986,6 +6032,34 @@
    C = select( cond, A, B );  // Results in ( 1, 2 ) ( 1, 2 )
    \endcode
 
+// In case the conditions are the result of an elementwise comparison via one of the \c Less,
+// \c LessEqual, \c Greater, or \c GreaterEqual functors, the comparison and the selection are
+// fused into a single operation. For single and double precision floating point matrices both
+// the comparison and the selection are vectorized. The same applies to conditions of the same
+// floating point type as the selected elements, where all non-zero elements select from \c A:
+
+   \code
+   blaze::DynamicMatrix<double> X, Y, A, B, C;
+   // ... Resizing and initialization
+
+   C = select( map( X, Y, blaze::Greater() ), A, B );  // Vectorized ( X > Y ) ? A : B
+   C = select( X, A, B );                              // Vectorized ( X != 0 ) ? A : B
+   \endcode
+
+// \n \subsection matrix_operations_masked_assign maskedAssign()
+//
+// The \c maskedAssign() function assigns the elements of a dense matrix only where the according
+// condition evaluates to \a true and leaves all other elements untouched. The assignment is
+// performed in-place and is vectorized and parallelized in the same way as the \c select()
+// function:
+
+   \code
+   blaze::DynamicMatrix<double> A{ { 1.0, -2.0 }, { -3.0, 4.0 } };
+   blaze::DynamicMatrix<double> B( 2UL, 2UL, 0.0 );
+
+   maskedAssign( A, map( A, B, blaze::Less() ), B );  // Results in ( 1, 0 ) ( 0, 4 )
+   \endcode
+
 // \n \section matrix_operations_reduction_operations Reduction Operations
 // <hr>
 //
@@ -13994,8 +14068,27 @@
 // When any of the shared memory parallelization techniques is activated, all arithmetic
 // operations on dense vectors and matrices (including additions, subtractions, multiplications,
 // divisions, and all componentwise arithmetic operations) and most operations on sparse vectors
-// and matrices are automatically run in parallel. However, in addition, \b Blaze provides means
-// to enforce the serial execution of specific operations:
+// and matrices are automatically run in parallel. This includes the total reductions of dense
+// vectors and matrices (as for instance the sum(), prod(), min() and max() functions), the norms
+// of dense vectors and the inner product of two dense vectors. For these, each thread reduces
+// one contiguous block of elements and the partial results of all threads are combined in a
+// fixed order. Thus for a given number of threads the result of a parallel reduction is always
+// the same, but it may differ in the last bits from the result with a different number of
+// threads. In case bitwise identical results are required for any number of threads (e.g. for
+// regression tests or for comparing runs on different machines), the reproducible reduction
+// mode can be enabled via the \c BLAZE_SMP_REPRODUCIBLE_REDUCTION switch in the configuration
+// file <tt><blaze/config/SMP.h></tt>:
+
+   \code
+   #define BLAZE_SMP_REPRODUCIBLE_REDUCTION 1
+   \endcode
+
+// In this mode the elements are split into blocks of a fixed size, which are combined by a fixed
+// pairwise tree. Its additional cost is a single partial result per block of 4096 elements and
+// is usually not measurable. Note that parallel dense matrix/vector multiplications are always
+// reproducible in this sense, since every element of the result is computed by a single thread.
+// However, in addition, \b Blaze provides means to enforce the serial execution of
+// specific operations:
 //
 //  - \ref serial_execution
 //
@@ -14134,6 +14227,106 @@
 // threads.
 //
 //
+// \n \section cpp_threads_affinity C++11 Thread Affinity
+// <hr>
+//
+// By default, the operating system is free to move the C++11 threads between all cores. On
+// systems with several NUMA nodes (e.g. multi-socket systems) this may result in threads that
+// process data located in the memory of a different NUMA node. For that reason the threads can
+// be pinned to specific CPUs, either via the environment variable \c BLAZE_THREAD_AFFINITY
+
+   \code
+   export BLAZE_THREAD_AFFINITY=spread  // Unix systems
+   \endcode
+
+// or alternatively via the \c setThreadAffinity() function:
+
+   \code
+   blaze::setThreadAffinity( "compact" );     // Filling one NUMA node after another
+   blaze::setThreadAffinity( "spread" );      // Distributing the threads across all NUMA nodes
+   blaze::setThreadAffinity( "0-7,16-23" );   // Pinning the i-th thread to the i-th given CPU
+   blaze::setThreadAffinity( "none" );        // Unpinning all threads
+   \endcode
+
+// The \f$ i \f$-th block of every parallel operation is always executed by the \f$ i \f$-th
+// thread. Therefore, in combination with pinned threads, the data of repeated operations on the
+// same operands stays local to the same core and NUMA node. Please note that thread pinning is
+// currently only supported on Linux systems. The same functionality is available for the Boost
+// thread parallelization.
+//
+// Since the operating system places a memory page on the NUMA node of the thread that first
+// writes to it, the memory of large dense vectors and matrices should also be initialized by
+// the threads that later process it. This parallel first-touch initialization of DynamicVector
+// and DynamicMatrix can be enabled via the \c BLAZE_SMP_FIRST_TOUCH switch in the configuration
+// file <tt><blaze/config/SMP.h></tt>:
+
+   \code
+   #define BLAZE_SMP_FIRST_TOUCH 1  // Same block partitioning as the parallel assignment
+   #define BLAZE_SMP_FIRST_TOUCH 2  // Memory pages interleaved across all threads
+   \endcode
+//
+//
+// \n \section cpp_threads_async Asynchronous Evaluation
+// <hr>
+//
+// Every assignment blocks the calling thread until all of its blocks have been computed. In
+// order to overlap independent operations, an assignment can also be started asynchronously
+// via the \c asyncAssign() function. Arbitrary code (e.g. the solution of a linear system) can
+// be started asynchronously via the \c asyncCall() function. Both functions immediately return
+// a \c blaze::Future, which can be waited for and which can be passed as dependency to further
+// asynchronous evaluations:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, X;
+   blaze::DynamicVector<double> d, y, z;
+   // ... Resizing and initialization
+
+   blaze::Future fx = blaze::asyncAssign( X, A * B );
+   blaze::Future fy = blaze::asyncCall( [&]() { y = inv( C ) * d; } );
+
+   // Started as soon as both X and y have been computed
+   blaze::Future fz = blaze::asyncCall( [&]() { z = X * y; }, { fx, fy } );
+
+   fz.wait();  // Rethrows any exception of the three evaluations
+   \endcode
+
+// All asynchronous evaluations are executed by the thread pool and are parallelized by means
+// of all threads that are not busy with other evaluations, i.e. concurrently executed
+// evaluations share the threads of the pool. Note that all operands must not be destroyed or
+// modified before the evaluation has been completed and that an expression involving the
+// results of dependencies has to be created within the dependent evaluation (as in the example
+// above). The same functionality is available for the Boost thread parallelization. In case of
+// the HPX or OpenMP parallelization, the evaluation is executed synchronously.
+//
+//
+// \n \section cpp_threads_teams C++11 Thread Teams
+// <hr>
+//
+// By default, every parallel operation uses all threads of \b Blaze. In case several threads
+// (as for instance the request handling threads of a service) concurrently run parallel
+// operations, the available cores are oversubscribed. In order to avoid this, every thread can
+// use a separate team of threads via a \c blaze::ThreadTeam. All parallel operations within a
+// team section are executed by the threads of the given team only:
+
+   \code
+   // Executed by every request handling thread
+   blaze::ThreadTeam team( 4UL );           // Four unpinned threads
+   // blaze::ThreadTeam team( 4UL, "0-3" ); // Four threads pinned to the CPUs 0 to 3
+
+   BLAZE_TEAM_SECTION( team )
+   {
+      y = A * x;  // Executed by the four threads of the team
+   }
+   \endcode
+
+// Since creating a team creates the according number of threads, a team should be created once
+// per thread and be reused for all subsequent team sections. Within a team section the function
+// \c blaze::getNumThreads() returns the size of the team and all asynchronous evaluations
+// started within a team section are executed by the team as well. The same functionality is
+// available for the Boost thread parallelization. In case of the OpenMP parallelization, a team
+// section sets the number of OpenMP threads of the calling thread to the size of the team.
+//
+//
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
 //
@@ -15000,6 +15193,34 @@
 // the operations. Note that deactivating the vectorization may pose a severe performance
 // limitation for a large number of operations!
 //
+// On x86-64 platforms \b Blaze additionally compiles the most performance critical kernels (the
+// dense matrix/dense matrix multiplication, the dense matrix/dense vector multiplication, the
+// sparse matrix/dense vector multiplication, the element-wise dense vector addition, subtraction
+// and multiplication, and the dense reductions via sum() and dot()) for the AVX2 and AVX-512
+// instruction sets. At runtime the most capable instruction set supported by the CPU is detected
+// and used, even if the remaining code has been compiled for an older instruction set, e.g. for
+// SSE2. The runtime dispatch applies to \c float and \c double operands with contiguous storage
+// and can be (de-)activated via the \c BLAZE_USE_RUNTIME_DISPATCH switch in the configuration
+// file <tt>./blaze/config/Vectorization.h</tt>:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   \endcode
+
+// The currently used instruction set can be queried and restricted at runtime, for instance to
+// compare the performance of different instruction sets on the same machine:
+
+   \code
+   if( blaze::getInstructionSet() == blaze::InstructionSet::avx512 ) { ... }
+
+   blaze::setInstructionSet( blaze::InstructionSet::avx2 );  // Restricting to AVX2
+   blaze::resetInstructionSet();  // Using the most capable instruction set again
+   \endcode
+
+// Please note that the result of reductions (such as sum(), dot(), or the multiplication of
+// dense matrices) may differ in the last bits between different instruction sets, since the
+// order of the floating point operations depends on the SIMD width.
+//
 //
 // \n \section thresholds Thresholds
 // <hr>
@@ -15018,6 +15239,32 @@
 // thread-based parallelization, are contained within the configuration file
 // <tt><blaze/config/Thresholds.h></tt>.
 //
+// The configured values only serve as defaults, which are used until they are replaced at
+// runtime. Via the blaze::calibrateThresholds() function \b Blaze measures the crossover points
+// of the most important dense operations on the executing machine and replaces the according
+// thresholds. The resulting threshold profile can be saved to a file and loaded again in later
+// runs of the program, such that the calibration has to be performed only once per machine:
+
+   \code
+   // Calibration on the executing machine (takes several seconds)
+   blaze::calibrateThresholds();
+   blaze::saveThresholds( "blaze.profile" );
+
+   // Loading the threshold profile in later runs of the program
+   blaze::loadThresholds( "blaze.profile" );
+   \endcode
+
+// Additionally, individual thresholds can be queried and adjusted via the blaze::getThreshold()
+// and blaze::setThreshold() functions and reset to their configured defaults via the
+// blaze::resetThresholds() function:
+
+   \code
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 20000UL );
+   blaze::setThreshold( "SMP_DMATDVECMULT_THRESHOLD", 500UL );
+   \endcode
+
+// Note that the adjustment of a threshold does not affect operations that are already running.
+//
 //
 // \n \section alignment Alignment
 // <hr>
@@ -58,3 +58,130 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Spin time of idle threads of the C++11 and Boost thread parallelization.
+// \ingroup config
+//
+// This value specifies the time in microseconds an idle thread of the C++11 or Boost thread
+// parallelization actively waits for new tasks before it is put to sleep. Similarly, a thread
+// waiting for the completion of a parallel operation first helps executing the operation and
+// then actively waits for the given time. Active waiting avoids the latency of waking sleeping
+// threads, which dominates the runtime of small parallel operations, at the cost of occupying
+// the cores for the given time after each operation. On a dedicated machine a longer spin time
+// (e.g. 1000) in combination with lower SMP thresholds (see <tt>./blaze/config/Thresholds.h</tt>)
+// can considerably improve the performance of small operations. A value of 0 puts idle threads
+// to sleep immediately. The default value is 100.
+//
+// The spin time can also be specified at runtime via the \c BLAZE_SPIN_TIME environment
+// variable, which takes precedence over this setting.
+//
+// \note It is possible to specify the spin time via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SPIN_TIME 1000
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SPIN_TIME
+#define BLAZE_SMP_SPIN_TIME 100
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parallel first-touch initialization of large dense vectors and matrices.
+// \ingroup config
+//
+// On systems with several NUMA nodes (e.g. multi-socket systems) a memory page is placed on the
+// NUMA node of the thread that first writes to it. This switch specifies whether the memory of
+// large DynamicVector and DynamicMatrix instances is initialized in parallel, such that every
+// thread of the shared memory parallelization first touches the pages it later processes:
+//
+//  - 0: The memory is initialized by the allocating thread (default).
+//  - 1: The memory is initialized in parallel, using the same block partitioning as the SMP
+//       assignment of dense vectors and matrices. In combination with pinned threads (see the
+//       \c BLAZE_THREAD_AFFINITY environment variable) every thread works on local memory.
+//  - 2: The memory pages are initialized round-robin by all threads, i.e. the pages are
+//       interleaved across all NUMA nodes. This evenly distributes the memory bandwidth for
+//       operations that do not follow the SMP block partitioning.
+//
+// Only vectors and matrices of vectorizable element types that are large enough to be assigned
+// in parallel (see <tt>./blaze/config/Thresholds.h</tt>) are affected. Note that in mode 1 and 2
+// the elements of a vector or matrix created without an initial value are default initialized.
+//
+// \note It is possible to specify the first-touch mode via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_FIRST_TOUCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_FIRST_TOUCH
+#define BLAZE_SMP_FIRST_TOUCH 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reproducible total reductions.
+// \ingroup config
+//
+// This switch specifies whether the result of total reductions (as for instance sum(), prod(),
+// min(), max(), norm(), and the dense inner product) and of the reductions of the fused Krylov
+// kernels is independent of the number of threads:
+//
+//  - 0: The elements are split into one block per thread. The partial results are combined in
+//       a fixed order, i.e. the result is reproducible for a given number of threads (default).
+//  - 1: The elements are split into blocks of a fixed size (see \c BLAZE_SMP_REDUCTION_BLOCK_SIZE)
+//       and the partial results of all blocks are combined by a fixed pairwise tree. The result
+//       is bitwise identical for any number of threads, for serial and parallel execution, and
+//       for all SMP backends.
+//
+// The additional cost of the reproducible mode is one partial result and one combination step
+// per block. For the sum of 10^5 (in cache) and 10^7 (in main memory) double precision values
+// the runtime difference to mode 0 was below the measurement noise of approximately 5%. Note
+// that in the reproducible mode also serially executed reductions of more than one block are
+// split into blocks, which changes their result in comparison to mode 0. Note
+// that the element-wise results of parallel dense matrix/vector multiplications do not depend
+// on the number of threads in either mode, since every element of the result is computed by a
+// single thread.
+//
+// \note It is possible to specify the reduction mode via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_REPRODUCIBLE_REDUCTION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_REPRODUCIBLE_REDUCTION
+#define BLAZE_SMP_REPRODUCIBLE_REDUCTION 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Block size of reproducible total reductions.
+// \ingroup config
+//
+// This value specifies the number of elements per block of a reproducible total reduction (see
+// \c BLAZE_SMP_REPRODUCIBLE_REDUCTION). Changing the block size changes the result of reductions
+// in the reproducible mode, i.e. all processes that should compute bitwise identical results
+// must use the same block size. The default value is 4096.
+//
+// \note It is possible to specify the block size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_REDUCTION_BLOCK_SIZE 8192
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_REDUCTION_BLOCK_SIZE
+#define BLAZE_SMP_REDUCTION_BLOCK_SIZE 4096
+#endif
+//*************************************************************************************************
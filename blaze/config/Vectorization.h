@@ -62,3 +62,66 @@
 #define BLAZE_USE_VECTORIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for (de-)activation of the portable SIMD elementary functions.
+// \ingroup config
+//
+// This compilation switch enables/disables the portable, polynomial-based SIMD implementation
+// of the exponential function, the natural logarithm, the sine and cosine, the hyperbolic
+// tangent, the error function, and the power function for single and double precision values.
+// The portable implementation is used for SSE2, AVX, AVX2, and AVX-512 in case the Intel SVML
+// is not available (i.e. for all compilers except the Intel compiler). In case the switch is
+// set to 1, operations as for instance \c exp(), \c map(), or \c softmax() are vectorized
+// by means of the portable kernels. In case the switch is set to 0, the Blaze library falls
+// back to the scalar standard library functions in case the SVML is not available.
+//
+// Possible settings for the switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// \note It is possible to (de-)activate the portable SIMD elementary functions via command line
+// or by defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_PORTABLE_SIMD_MATH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_PORTABLE_SIMD_MATH
+#define BLAZE_USE_PORTABLE_SIMD_MATH 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!rief Compilation switch for (de-)activation of the runtime dispatch of compute kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime dispatch of selected compute kernels
+// (the GEMM micro-kernels, the dense matrix/vector multiplication, the sparse matrix/vector
+// multiplication, element-wise vector operations, and dense reductions). In case the switch
+// is set to 1, these kernels are additionally compiled for AVX2/FMA and AVX-512 and the best
+// variant supported by the executing CPU is selected once at runtime via CPUID. This allows a
+// single executable that is compiled for a baseline instruction set (for instance SSE2) to
+// take advantage of wider SIMD units. The runtime dispatch is only available for the GNU and
+// Clang compilers on x86-64 platforms and is not required if Blaze is already compiled for
+// AVX-512. In case the switch is set to 0, only the compile time instruction set is used.
+//
+// Possible settings for the switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// \note It is possible to (de-)activate the runtime dispatch via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#define BLAZE_USE_RUNTIME_DISPATCH 1
+#endif
+//*************************************************************************************************
@@ -89,6 +89,7 @@
 #include <blaze/math/functors/Exp10.h>
 #include <blaze/math/functors/Floor.h>
 #include <blaze/math/functors/Greater.h>
+#include <blaze/math/functors/GreaterEqual.h>
 #include <blaze/math/functors/Hypot.h>
 #include <blaze/math/functors/Imag.h>
 #include <blaze/math/functors/Inv.h>
@@ -103,6 +104,7 @@
 #include <blaze/math/functors/L4Norm.h>
 #include <blaze/math/functors/LeftShiftAssign.h>
 #include <blaze/math/functors/Less.h>
+#include <blaze/math/functors/LessEqual.h>
 #include <blaze/math/functors/Log.h>
 #include <blaze/math/functors/Log2.h>
 #include <blaze/math/functors/Log10.h>
@@ -131,6 +133,8 @@
 #include <blaze/math/functors/RightShiftAssign.h>
 #include <blaze/math/functors/Round.h>
 #include <blaze/math/functors/Schur.h>
+#include <blaze/math/functors/Select.h>
+#include <blaze/math/functors/SelectIf.h>
 #include <blaze/math/functors/Serial.h>
 #include <blaze/math/functors/ShiftLI.h>
 #include <blaze/math/functors/ShiftLV.h>
@@ -110,6 +110,13 @@
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/sparse/AMD.h>
+#include <blaze/math/sparse/EliminationTree.h>
+#include <blaze/math/sparse/IncompleteCholesky.h>
+#include <blaze/math/sparse/IncompleteLU.h>
+#include <blaze/math/sparse/LSE.h>
+#include <blaze/math/sparse/Reordering.h>
+#include <blaze/math/sparse/SparseCholesky.h>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
@@ -0,0 +1,99 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SummationFlag.h
+//  \brief Header file for the dense vector summation flags
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SUMMATIONFLAG_H_
+#define _BLAZE_MATH_SUMMATIONFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SUMMATION FLAG
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Summation flag for the selection of a summation algorithm.
+// \ingroup math
+//
+// Via these flags it is possible to select the summation algorithm of the sum() and dot()
+// functions for dense vectors with floating point elements. The following example demonstrates
+// this by means of the sum() function:
+
+   \code
+   using blaze::compensated;
+   using blaze::pairwise;
+
+   blaze::DynamicVector<double> a( 100000000UL );
+   // ... Initialization
+
+   const double s1 = sum( a );               // Default SIMD summation
+   const double s2 = sum<pairwise>( a );     // Pairwise summation
+   const double s3 = sum<compensated>( a );  // Compensated summation
+   \endcode
+
+// The pairwise summation recursively splits the range into halves. It runs at almost the speed
+// of the default summation and reduces the growth of the rounding error from \f$ O(n) \f$ to
+// \f$ O(\log n) \f$. The compensated summation additionally accumulates the exact rounding error
+// of every addition (and in case of dot() of every multiplication), which results in an accuracy
+// close to twice the working precision. For vectors exceeding the cache it is approximately 1.5
+// times slower than the default summation, for vectors in cache approximately 3 to 5 times, but
+// still considerably faster than a scalar summation in \c long \c double precision. Without
+// fused multiply-add instructions the compensated dot() is about twice as expensive.
+*/
+enum class SummationFlag
+{
+   pairwise    = 0,  //!< Flag for the pairwise summation.
+   compensated = 1   //!< Flag for the compensated summation.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Summation flag for the pairwise summation.
+*/
+constexpr SummationFlag pairwise = SummationFlag::pairwise;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Summation flag for the compensated summation.
+*/
+constexpr SummationFlag compensated = SummationFlag::compensated;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -91,8 +91,10 @@
 #include <blaze/math/typetraits/HasSIMDBitand.h>
 #include <blaze/math/typetraits/HasSIMDBitor.h>
 #include <blaze/math/typetraits/HasSIMDBitxor.h>
+#include <blaze/math/typetraits/HasSIMDBlend.h>
 #include <blaze/math/typetraits/HasSIMDCbrt.h>
 #include <blaze/math/typetraits/HasSIMDCeil.h>
+#include <blaze/math/typetraits/HasSIMDCompare.h>
 #include <blaze/math/typetraits/HasSIMDConj.h>
 #include <blaze/math/typetraits/HasSIMDCos.h>
 #include <blaze/math/typetraits/HasSIMDCosh.h>
@@ -110,6 +112,7 @@
 #include <blaze/math/typetraits/HasSIMDLog.h>
 #include <blaze/math/typetraits/HasSIMDLog2.h>
 #include <blaze/math/typetraits/HasSIMDLog10.h>
+#include <blaze/math/typetraits/HasSIMDMaskload.h>
 #include <blaze/math/typetraits/HasSIMDMax.h>
 #include <blaze/math/typetraits/HasSIMDMin.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
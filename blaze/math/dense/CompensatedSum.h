@@ -0,0 +1,247 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CompensatedSum.h
+//  \brief Header file for the error-free transformations of the compensated summation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_COMPENSATEDSUM_H_
+#define _BLAZE_MATH_DENSE_COMPENSATEDSUM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/simd/Set.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ERROR-FREE TRANSFORMATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Error-free addition of a value to a running sum (TwoSum).
+// \ingroup dense_vector
+//
+// \param sum The running sum, which is replaced by the rounded sum of \a sum and \a x.
+// \param x The value to be added.
+// \param error The accumulated rounding error, which is incremented by the exact error.
+// \return void
+//
+// This function adds \a x to \a sum and accumulates the exact rounding error of this addition
+// in \a error (Knuth's TwoSum). In contrast to the Kahan summation the result does not depend
+// on the relative magnitude of \a sum and \a x and no comparison is required, such that the
+// function can be applied to floating point values and SIMD vectors alike.
+*/
+template< typename T >  // Type of the operands
+BLAZE_ALWAYS_INLINE void twoSum( T& sum, const T& x, T& error )
+{
+   const T s ( sum + x );
+   const T bp( s - sum );
+   error += ( sum - ( s - bp ) ) + ( x - bp );
+   sum = s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Split factor of the Veltkamp splitting of floating point values.
+// \ingroup dense_vector
+*/
+template< typename T >  // Type of the floating point values
+constexpr T veltkampFactor = T( 134217729.0 );  // 2^27 + 1
+
+template<>
+constexpr float veltkampFactor<float> = 4097.0F;  // 2^12 + 1
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Exact rounding error of a product computed via Dekker's algorithm.
+// \ingroup dense_vector
+//
+// \param a The left-hand side operand of the product.
+// \param b The right-hand side operand of the product.
+// \param p The rounded product of \a a and \a b.
+// \param factor The Veltkamp split factor.
+// \return The exact rounding error \f$ a \cdot b - p \f$.
+*/
+template< typename T >  // Type of the operands
+BLAZE_ALWAYS_INLINE const T dekkerError( const T& a, const T& b, const T& p, const T& factor )
+{
+   const T ta( factor * a );
+   const T ahi( ta - ( ta - a ) );
+   const T alo( a - ahi );
+   const T tb( factor * b );
+   const T bhi( tb - ( tb - b ) );
+   const T blo( b - bhi );
+
+   return ( ( ( ahi * bhi - p ) + ahi * blo ) + alo * bhi ) + alo * blo;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Error-free multiplication of two floating point values (TwoProduct).
+// \ingroup dense_vector
+//
+// \param a The left-hand side operand of the product.
+// \param b The right-hand side operand of the product.
+// \param error The exact rounding error of the product.
+// \return The rounded product of \a a and \a b.
+//
+// In case fused multiply-add operations are available, the rounding error is computed by a
+// single FMA operation. Otherwise Dekker's algorithm based on the Veltkamp splitting is used.
+*/
+template< typename T >  // Type of the operands
+BLAZE_ALWAYS_INLINE auto twoProduct( const T& a, const T& b, T& error )
+   -> EnableIf_t< IsFloatingPoint_v<T>, T >
+{
+   const T p( a * b );
+#if BLAZE_FMA_MODE
+   error = std::fma( a, b, -p );
+#else
+   error = dekkerError( a, b, p, veltkampFactor<T> );
+#endif
+   return p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Error-free multiplication of two SIMD vectors (TwoProduct).
+// \ingroup dense_vector
+//
+// \param a The left-hand side operand of the product.
+// \param b The right-hand side operand of the product.
+// \param error The exact rounding errors of the product.
+// \return The rounded product of \a a and \a b.
+//
+// In case fused multiply-add operations are available, the rounding error is computed by a
+// single FMA operation. Otherwise Dekker's algorithm based on the Veltkamp splitting is used.
+*/
+template< typename T >  // Type of the SIMD operands
+BLAZE_ALWAYS_INLINE auto twoProduct( const T& a, const T& b, T& error )
+   -> EnableIf_t< !IsFloatingPoint_v<T>, T >
+{
+   const T p( a * b );
+#if BLAZE_FMA_MODE
+   error = a * b - p;
+#else
+   error = dekkerError( a, b, p, T( set( veltkampFactor<typename T::ValueType> ) ) );
+#endif
+   return p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS COMPENSATEDSUM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partial result of a compensated summation.
+// \ingroup dense_vector
+//
+// The CompensatedSum class represents the partial result of a compensated summation, consisting
+// of the rounded sum and of the accumulated rounding errors. Two partial results are combined
+// via the addition operator, which allows to combine the partial results of parallel blocks
+// (see the smpReduce() function) without losing the accumulated rounding errors.
+*/
+template< typename T >  // Type of the floating point values
+struct CompensatedSum
+{
+   //**Value function******************************************************************************
+   /*!\brief Returns the compensated result of the summation.
+   //
+   // \return The sum of the rounded sum and the accumulated rounding errors.
+   */
+   T value() const
+   {
+      return sum + error;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   T sum  {};  //!< The rounded sum.
+   T error{};  //!< The accumulated rounding errors.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combination of two partial results of a compensated summation.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side partial result.
+// \param rhs The right-hand side partial result.
+// \return The combined partial result.
+*/
+template< typename T >  // Type of the floating point values
+inline CompensatedSum<T> operator+( const CompensatedSum<T>& lhs, const CompensatedSum<T>& rhs )
+{
+   CompensatedSum<T> res{ lhs.sum, lhs.error + rhs.error };
+   twoSum( res.sum, rhs.sum, res.error );
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
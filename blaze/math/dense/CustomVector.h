@@ -5281,14 +5281,14 @@ struct IsAligned< CustomVector<T,aligned,PF,TF,RT> >
 
 //=================================================================================================
 //
-//  ISALIGNED SPECIALIZATIONS
+//  ISCONTIGUOUS SPECIALIZATIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, PaddingFlag PF, bool TF, typename RT >
-struct IsContiguous< CustomVector<T,aligned,PF,TF,RT> >
+template< typename T, AlignmentFlag AF, PaddingFlag PF, bool TF, typename RT >
+struct IsContiguous< CustomVector<T,AF,PF,TF,RT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -1255,6 +1255,14 @@ bool isIdentity( const DenseMatrix<MT,SO>& dm );
 
 template< typename MT, bool SO >
 bool isPositiveDefinite( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT1, typename MT2, typename MT3, bool SO >
+MT1& maskedAssign( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,SO>& cond,
+                   const DenseMatrix<MT3,SO>& rhs );
+
+template< typename MT1, typename MT2, typename MT3, bool SO >
+MT1& maskedAssign( DenseMatrix<MT1,SO>&& lhs, const DenseMatrix<MT2,SO>& cond,
+                   const DenseMatrix<MT3,SO>& rhs );
 //@}
 //*************************************************************************************************
 
@@ -2614,6 +2622,93 @@ size_t rank( const DenseMatrix<MT,SO>& dm )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Masked assignment of a dense matrix to a dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side dense matrix to be assigned to.
+// \param cond The dense matrix containing the assignment conditions.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return Reference to the dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to restricted matrix.
+//
+// This function assigns the elements of the dense matrix \a rhs to the dense matrix \a lhs,
+// but only at the positions where the according element of \a cond evaluates to \a true. All
+// other elements of \a lhs remain unchanged. The following example demonstrates the masked
+// assignment of zeros to all negative elements of a matrix:
+
+   \code
+   blaze::DynamicMatrix<double> A{ { 1.0, -2.0 }, { -3.0, 4.0 } };
+   blaze::DynamicMatrix<double> B( 2UL, 2UL, 0.0 );
+
+   maskedAssign( A, map( A, B, blaze::Less() ), B );  // Results in ( ( 1, 0 ), ( 0, 4 ) )
+   \endcode
+
+// The masked assignment is performed in-place as the elementwise selection between \a rhs and the
+// current elements of \a lhs (see the select() function), i.e. it is vectorized and parallelized
+// whenever the according selection is. In case \a cond or \a rhs may alias with \a lhs (for
+// instance in case of overlapping views), the selection is evaluated into a temporary matrix first.
+// In case the current sizes of the three given matrices don't match, a \a std::invalid_argument is
+// thrown. In case the matrix \a MT1 is restricted and the assignment would violate an invariant of
+// the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the conditional dense matrix
+        , typename MT3  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order
+inline MT1& maskedAssign( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,SO>& cond,
+                          const DenseMatrix<MT3,SO>& rhs )
+{
+   if( IsRestricted_v<MT1> ) {
+      if( !tryAssign( ~lhs, select( ~cond, ~rhs, ~lhs ), 0UL, 0UL ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to restricted matrix" );
+      }
+   }
+
+   decltype(auto) left( derestrict( ~lhs ) );
+
+   if( (~cond).canAlias( &~lhs ) || (~rhs).canAlias( &~lhs ) ) {
+      const ResultType_t<MT1> tmp( select( ~cond, ~rhs, left ) );
+      smpAssign( left, tmp );
+   }
+   else {
+      smpAssign( left, select( ~cond, ~rhs, left ) );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~lhs ), "Invariant violation detected" );
+
+   return ~lhs;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked assignment of a dense matrix to a temporary dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side temporary dense matrix to be assigned to.
+// \param cond The dense matrix containing the assignment conditions.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return Reference to the dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to restricted matrix.
+//
+// In case the matrix \a MT1 is restricted and the assignment would violate an invariant of the
+// matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the conditional dense matrix
+        , typename MT3  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order
+inline MT1& maskedAssign( DenseMatrix<MT1,SO>&& lhs, const DenseMatrix<MT2,SO>& cond,
+                          const DenseMatrix<MT3,SO>& rhs )
+{
+   return maskedAssign( ~lhs, ~cond, ~rhs );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -1125,6 +1125,14 @@ bool isUniform( const DenseVector<VT,TF>& dv );
 
 template< RelaxationFlag RF, typename VT, bool TF >
 bool isZero( const DenseVector<VT,TF>& dv );
+
+template< typename VT1, typename VT2, typename VT3, bool TF >
+VT1& maskedAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& cond,
+                   const DenseVector<VT3,TF>& rhs );
+
+template< typename VT1, typename VT2, typename VT3, bool TF >
+VT1& maskedAssign( DenseVector<VT1,TF>&& lhs, const DenseVector<VT2,TF>& cond,
+                   const DenseVector<VT3,TF>& rhs );
 //@}
 //*************************************************************************************************
 
@@ -1300,6 +1308,93 @@ bool isZero( const DenseVector<VT,TF>& dv )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Masked assignment of a dense vector to a dense vector.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector to be assigned to.
+// \param cond The dense vector containing the assignment conditions.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return Reference to the dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::invalid_argument Invalid assignment to restricted vector.
+//
+// This function assigns the elements of the dense vector \a rhs to the dense vector \a lhs,
+// but only at the positions where the according element of \a cond evaluates to \a true. All
+// other elements of \a lhs remain unchanged. The following example demonstrates the masked
+// assignment of zeros to all negative elements of a vector:
+
+   \code
+   blaze::DynamicVector<double> a{ 1.0, -2.0, 3.0, -4.0 };
+   blaze::DynamicVector<double> b{ 0.0, 0.0, 0.0, 0.0 };
+
+   maskedAssign( a, map( a, b, blaze::Less() ), b );  // Results in ( 1, 0, 3, 0 )
+   \endcode
+
+// The masked assignment is performed in-place as the elementwise selection between \a rhs and the
+// current elements of \a lhs (see the select() function), i.e. it is vectorized and parallelized
+// whenever the according selection is. In case \a cond or \a rhs may alias with \a lhs (for
+// instance in case of overlapping views), the selection is evaluated into a temporary vector first.
+// In case the current sizes of the three given vectors don't match, a \a std::invalid_argument is
+// thrown. In case the vector \a VT1 is restricted and the assignment would violate an invariant of
+// the vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the conditional dense vector
+        , typename VT3  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline VT1& maskedAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& cond,
+                          const DenseVector<VT3,TF>& rhs )
+{
+   if( IsRestricted_v<VT1> ) {
+      if( !tryAssign( ~lhs, select( ~cond, ~rhs, ~lhs ), 0UL ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to restricted vector" );
+      }
+   }
+
+   decltype(auto) left( derestrict( ~lhs ) );
+
+   if( (~cond).canAlias( &~lhs ) || (~rhs).canAlias( &~lhs ) ) {
+      const ResultType_t<VT1> tmp( select( ~cond, ~rhs, left ) );
+      smpAssign( left, tmp );
+   }
+   else {
+      smpAssign( left, select( ~cond, ~rhs, left ) );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~lhs ), "Invariant violation detected" );
+
+   return ~lhs;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked assignment of a dense vector to a temporary dense vector.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side temporary dense vector to be assigned to.
+// \param cond The dense vector containing the assignment conditions.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return Reference to the dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::invalid_argument Invalid assignment to restricted vector.
+//
+// In case the vector \a VT1 is restricted and the assignment would violate an invariant of the
+// vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the conditional dense vector
+        , typename VT3  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline VT1& maskedAssign( DenseVector<VT1,TF>&& lhs, const DenseVector<VT2,TF>& cond,
+                          const DenseVector<VT3,TF>& rhs )
+{
+   return maskedAssign( ~lhs, ~cond, ~rhs );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -62,6 +62,7 @@
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -606,7 +607,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable_v<Type> ) {
+   if( IsVectorizable_v<Type> && !smpFirstTouch<SO>( v_, m_, n_, nn_, Type() ) ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -633,9 +634,11 @@ template< typename Type  // Data type of the matrix
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
    : DynamicMatrix( m, n )
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         v_[i*nn_+j] = init;
+   if( !smpFirstTouch<SO>( v_, m_, n_, nn_, init ) ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            v_[i*nn_+j] = init;
+         }
       }
    }
 
@@ -1803,12 +1806,16 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    const size_t nn( addPadding( n ) );
 
+   bool touched( false );
+
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
+      touched = smpFirstTouch<SO>( v, m, n, nn, Type() );
+
       for( size_t i=0UL; i<min_m; ++i ) {
          transfer( v_+i*nn_, v_+i*nn_+min_n, v+i*nn );
       }
@@ -1819,12 +1826,13 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    }
    else if( m*nn > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      touched = smpFirstTouch<SO>( v, m, n, nn, Type() );
       swap( v_, v );
       deallocate( v );
       capacity_ = m*nn;
    }
 
-   if( IsVectorizable_v<Type> ) {
+   if( IsVectorizable_v<Type> && !touched ) {
       for( size_t i=0UL; i<m; ++i )
          for( size_t j=n; j<nn; ++j )
             v_[i*nn+j] = Type();
@@ -3627,7 +3635,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable_v<Type> ) {
+   if( IsVectorizable_v<Type> && !smpFirstTouch<true>( v_, m_, n_, mm_, Type() ) ) {
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3655,9 +3663,11 @@ template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
    : DynamicMatrix( m, n )
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         v_[i+j*mm_] = init;
+   if( !smpFirstTouch<true>( v_, m_, n_, mm_, init ) ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            v_[i+j*mm_] = init;
+         }
       }
    }
 
@@ -4837,12 +4847,16 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    const size_t mm( addPadding( m ) );
 
+   bool touched( false );
+
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
+      touched = smpFirstTouch<true>( v, m, n, mm, Type() );
+
       for( size_t j=0UL; j<min_n; ++j ) {
          transfer( v_+j*mm_, v_+min_m+j*mm_, v+j*mm );
       }
@@ -4853,12 +4867,13 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    }
    else if( mm*n > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      touched = smpFirstTouch<true>( v, m, n, mm, Type() );
       swap( v_, v );
       deallocate( v );
       capacity_ = mm*n;
    }
 
-   if( IsVectorizable_v<Type> ) {
+   if( IsVectorizable_v<Type> && !touched ) {
       for( size_t j=0UL; j<n; ++j )
          for( size_t i=m; i<mm; ++i )
             v_[i+j*mm] = Type();
@@ -62,6 +62,7 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/BandTrait.h>
@@ -570,7 +571,7 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , capacity_( addPadding( n ) )              // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   if( IsVectorizable_v<Type> ) {
+   if( IsVectorizable_v<Type> && !smpFirstTouch( v_, size_, capacity_, Type() ) ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
    }
@@ -593,8 +594,10 @@ template< typename Type  // Data type of the vector
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    : DynamicVector( n )
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( !smpFirstTouch( v_, size_, capacity_, init ) ) {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -1553,11 +1556,13 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
       Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
 
       // Initializing the new array
+      const bool touched( smpFirstTouch( tmp, n, newCapacity, Type() ) );
+
       if( preserve ) {
          transfer( v_, v_+size_, tmp );
       }
 
-      if( IsVectorizable_v<Type> ) {
+      if( IsVectorizable_v<Type> && !touched ) {
          for( size_t i=size_; i<newCapacity; ++i )
             tmp[i] = Type();
       }
@@ -56,12 +56,14 @@
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsUpper.h>
@@ -71,12 +73,121 @@
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  RUNTIME DISPATCHED BLOCK KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatch of the dense matrix multiplication.
+// \ingroup dense_matrix
+*/
+template< typename MT1    // Type of the left-hand side target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3 >  // Type of the right-hand side matrix operand
+struct MMMDispatchHelper
+{
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( HasMutableDataAccess_v<MT1> &&
+        IsDispatchable_v< ElementType_t<MT1> > &&
+        IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > &&
+        IsSame_v< ElementType_t<MT1>, ElementType_t<MT3> > );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched multiplication of two packed blocks (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param row The row index of the first element of the target block.
+// \param column The column index of the first element of the target block.
+// \param A The packed row-major block of the left-hand side multiplication operand.
+// \param B The packed column-major block of the right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return \a true in case the block has been computed by a dispatched kernel, \a false if not.
+//
+// This function adds the scaled product of the two packed blocks \a A and \a B to the block
+// of \a C starting at the given \a row and \a column via the kernel for the instruction set
+// selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH switch). Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case all three matrices have the same single or double precision element type and \a C
+// provides direct access to its elements.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix block
+        , typename MT3   // Type of the right-hand side matrix block
+        , typename ST >  // Type of the scaling factor
+inline auto mmm_dispatch( DenseMatrix<MT1,SO>& C, size_t row, size_t column,
+                          const MT2& A, const MT3& B, ST alpha )
+   -> EnableIf_t< MMMDispatchHelper<MT1,MT2,MT3>::value, bool >
+{
+   using ET = ElementType_t<MT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT3 );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+
+   const auto* kernels( getKernelTable<ET>() );
+
+   if( kernels == nullptr )
+      return false;
+
+   const size_t rowStride   ( SO ? 1UL : (~C).spacing() );
+   const size_t columnStride( SO ? (~C).spacing() : 1UL );
+
+   kernels->gemm( A.rows(), B.columns(), A.columns(), A.data(), A.spacing(), B.data(), B.spacing(),
+                  &(~C)(row,column), rowStride, columnStride, ET( alpha ) );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched multiplication of two packed blocks (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \return \a false.
+//
+// This function is selected in case the given blocks cannot be multiplied by a dispatched kernel.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix block
+        , typename MT3   // Type of the right-hand side matrix block
+        , typename ST >  // Type of the scaling factor
+inline auto mmm_dispatch( DenseMatrix<MT1,SO>& /*C*/, size_t /*row*/, size_t /*column*/,
+                          const MT2& /*A*/, const MT3& /*B*/, ST /*alpha*/ )
+   -> DisableIf_t< MMMDispatchHelper<MT1,MT2,MT3>::value, bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GENERAL DENSE MATRIX MULTIPLICATION KERNELS
@@ -127,6 +238,8 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool scalarTail( remainder && !( IsPadded_v< DynamicMatrix<ET2,false> > &&
+                                              IsPadded_v< DynamicMatrix<ET3,true> > ) );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -153,9 +266,9 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
    size_t kk( 0UL );
    size_t kblock( 0UL );
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
+   while( kk + ( scalarTail ? SIMDSIZE-1UL : 0UL ) < K )
    {
-      if( remainder ) {
+      if( scalarTail ) {
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( prevMultiple( K - kk, SIMDSIZE ) ) );
       }
       else {
@@ -183,6 +296,11 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
          B2 = serial( submatrix< remainder ? unaligned : aligned >( B, kk, jj, kblock, jblock, unchecked ) );
 
+         if( mmm_dispatch( C, ibegin, jj, A2, B2, alpha ) ) {
+            jj += jblock;
+            continue;
+         }
+
          size_t i( 0UL );
 
          if( IsFloatingPoint_v<ET1> )
@@ -449,7 +567,7 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
       kk += kblock;
    }
 
-   if( remainder && kk < K )
+   if( scalarTail && kk < K )
    {
       const size_t ksize( K - kk );
 
@@ -627,6 +745,8 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool scalarTail( remainder && !( IsPadded_v< DynamicMatrix<ET2,false> > &&
+                                              IsPadded_v< DynamicMatrix<ET3,true> > ) );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -653,9 +773,9 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
    size_t kk( 0UL );
    size_t kblock( 0UL );
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
+   while( kk + ( scalarTail ? SIMDSIZE-1UL : 0UL ) < K )
    {
-      if( remainder ) {
+      if( scalarTail ) {
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( prevMultiple( K - kk, SIMDSIZE ) ) );
       }
       else {
@@ -683,6 +803,11 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 
          A2 = serial( submatrix< remainder ? unaligned : aligned >( A, ii, kk, iblock, kblock, unchecked ) );
 
+         if( mmm_dispatch( C, ii, jbegin, A2, B2, alpha ) ) {
+            ii += iblock;
+            continue;
+         }
+
          size_t j( 0UL );
 
          if( IsFloatingPoint_v<ET3> )
@@ -933,7 +1058,7 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
       kk += kblock;
    }
 
-   if( remainder && kk < K )
+   if( scalarTail && kk < K )
    {
       const size_t ksize( K - kk );
 
@@ -1155,6 +1280,8 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool scalarTail( remainder && !( IsPadded_v< DynamicMatrix<ET2,false> > &&
+                                              IsPadded_v< DynamicMatrix<ET3,true> > ) );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -1183,9 +1310,9 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
    size_t kk( 0UL );
    size_t kblock( 0UL );
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
+   while( kk + ( scalarTail ? SIMDSIZE-1UL : 0UL ) < K )
    {
-      if( remainder ) {
+      if( scalarTail ) {
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( prevMultiple( K - kk, SIMDSIZE ) ) );
       }
       else {
@@ -1489,7 +1616,7 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
       kk += kblock;
    }
 
-   if( remainder && kk < K )
+   if( scalarTail && kk < K )
    {
       const size_t ksize( K - kk );
 
@@ -1681,6 +1808,8 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool scalarTail( remainder && !( IsPadded_v< DynamicMatrix<ET2,false> > &&
+                                              IsPadded_v< DynamicMatrix<ET3,true> > ) );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -1709,9 +1838,9 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
    size_t kk( 0UL );
    size_t kblock( 0UL );
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
+   while( kk + ( scalarTail ? SIMDSIZE-1UL : 0UL ) < K )
    {
-      if( remainder ) {
+      if( scalarTail ) {
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( prevMultiple( K - kk, SIMDSIZE ) ) );
       }
       else {
@@ -1995,7 +2124,7 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
       kk += kblock;
    }
 
-   if( remainder && kk < K )
+   if( scalarTail && kk < K )
    {
       const size_t ksize( K - kk );
 
@@ -2225,6 +2354,8 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool scalarTail( remainder && !( IsPadded_v< DynamicMatrix<ET2,false> > &&
+                                              IsPadded_v< DynamicMatrix<ET3,true> > ) );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -2253,9 +2384,9 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
    size_t kk( 0UL );
    size_t kblock( 0UL );
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
+   while( kk + ( scalarTail ? SIMDSIZE-1UL : 0UL ) < K )
    {
-      if( remainder ) {
+      if( scalarTail ) {
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( prevMultiple( K - kk, SIMDSIZE ) ) );
       }
       else {
@@ -2555,7 +2686,7 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
       kk += kblock;
    }
 
-   if( remainder && kk < K )
+   if( scalarTail && kk < K )
    {
       const size_t ksize( K - kk );
 
@@ -2743,6 +2874,8 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool scalarTail( remainder && !( IsPadded_v< DynamicMatrix<ET2,false> > &&
+                                              IsPadded_v< DynamicMatrix<ET3,true> > ) );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -2771,9 +2904,9 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
    size_t kk( 0UL );
    size_t kblock( 0UL );
 
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
+   while( kk + ( scalarTail ? SIMDSIZE-1UL : 0UL ) < K )
    {
-      if( remainder ) {
+      if( scalarTail ) {
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( prevMultiple( K - kk, SIMDSIZE ) ) );
       }
       else {
@@ -3061,7 +3194,7 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
       kk += kblock;
    }
 
-   if( remainder && kk < K )
+   if( scalarTail && kk < K )
    {
       const size_t ksize( K - kk );
 
@@ -0,0 +1,312 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/AVX512.h
+//  \brief Header file for the AVX-512 compute kernels of the runtime dispatch
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_AVX512_H_
+#define _BLAZE_MATH_DISPATCH_AVX512_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+#include <immintrin.h>
+#include <blaze/math/dispatch/KernelTable.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_CLANG_COMPILER
+#  pragma clang attribute push ( __attribute__(( target( "avx512f,avx2,fma" ) )), apply_to = function )
+#else
+#  pragma GCC push_options
+#  pragma GCC target( "avx512f,avx2,fma" )
+#endif
+
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace avx512 {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE PACK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 packs of single and double precision values.
+// \ingroup dispatch
+*/
+template< typename T >
+struct Pack;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Pack class template for double precision values.
+// \ingroup dispatch
+*/
+template<>
+struct Pack<double>
+{
+   using Type = __m512d;
+
+   static constexpr size_t size = 8UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm512_setzero_pd(); }
+   static BLAZE_ALWAYS_INLINE Type set( double a ) noexcept { return _mm512_set1_pd( a ); }
+   static BLAZE_ALWAYS_INLINE Type load( const double* p ) noexcept { return _mm512_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void store( double* p, Type a ) noexcept { _mm512_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type maskload( const double* p, size_t n ) noexcept {
+      return _mm512_maskz_loadu_pd( static_cast<__mmask8>( ( 1U << n ) - 1U ), p );
+   }
+
+   static BLAZE_ALWAYS_INLINE void maskstore( double* p, Type a, size_t n ) noexcept {
+      _mm512_mask_storeu_pd( p, static_cast<__mmask8>( ( 1U << n ) - 1U ), a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type add ( Type a, Type b ) noexcept { return _mm512_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub ( Type a, Type b ) noexcept { return _mm512_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mult( Type a, Type b ) noexcept { return _mm512_mul_pd( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept {
+      return _mm512_fmadd_pd( a, b, c );
+   }
+
+   static BLAZE_ALWAYS_INLINE double sum( Type a ) noexcept {
+      const __m256d b( _mm256_add_pd( _mm512_maskz_extractf64x4_pd( 0xFF, a, 0 ),
+                                      _mm512_maskz_extractf64x4_pd( 0xFF, a, 1 ) ) );
+      const __m128d c( _mm_add_pd( _mm256_castpd256_pd128( b ), _mm256_extractf128_pd( b, 1 ) ) );
+      return _mm_cvtsd_f64( _mm_add_sd( c, _mm_unpackhi_pd( c, c ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Pack class template for single precision values.
+// \ingroup dispatch
+*/
+template<>
+struct Pack<float>
+{
+   using Type = __m512;
+
+   static constexpr size_t size = 16UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm512_setzero_ps(); }
+   static BLAZE_ALWAYS_INLINE Type set( float a ) noexcept { return _mm512_set1_ps( a ); }
+   static BLAZE_ALWAYS_INLINE Type load( const float* p ) noexcept { return _mm512_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void store( float* p, Type a ) noexcept { _mm512_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type maskload( const float* p, size_t n ) noexcept {
+      return _mm512_maskz_loadu_ps( static_cast<__mmask16>( ( 1U << n ) - 1U ), p );
+   }
+
+   static BLAZE_ALWAYS_INLINE void maskstore( float* p, Type a, size_t n ) noexcept {
+      _mm512_mask_storeu_ps( p, static_cast<__mmask16>( ( 1U << n ) - 1U ), a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type add ( Type a, Type b ) noexcept { return _mm512_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub ( Type a, Type b ) noexcept { return _mm512_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mult( Type a, Type b ) noexcept { return _mm512_mul_ps( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept {
+      return _mm512_fmadd_ps( a, b, c );
+   }
+
+   static BLAZE_ALWAYS_INLINE float sum( Type a ) noexcept {
+      const __m512d d( _mm512_castps_pd( a ) );
+      const __m256 b( _mm256_add_ps( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xFF, d, 0 ) ),
+                                     _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xFF, d, 1 ) ) ) );
+      __m128 c( _mm_add_ps( _mm256_castps256_ps128( b ), _mm256_extractf128_ps( b, 1 ) ) );
+      c = _mm_add_ps( c, _mm_movehl_ps( c, c ) );
+      return _mm_cvtss_f32( _mm_add_ss( c, _mm_movehdup_ps( c ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPARSEPACK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 packs for the gathering of sparse elements.
+// \ingroup dispatch
+//
+// The SparsePack class template provides the values of a range of sparse elements and gathers
+// the according elements of a dense array. The elements are gathered by scalar loads instead of
+// the gather instructions, which on many CPUs are not faster than the scalar loads and which are
+// considerably slower on CPUs with microcode mitigations for the gather data sampling issue.
+*/
+template< typename T >
+struct SparsePack;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparsePack class template for double precision values.
+// \ingroup dispatch
+*/
+template<>
+struct SparsePack<double>
+   : public Pack<double>
+{
+   static BLAZE_ALWAYS_INLINE Type values( const ValueIndexPair<double>* a ) noexcept {
+      return _mm512_set_pd( a[7].value(), a[6].value(), a[5].value(), a[4].value(),
+                            a[3].value(), a[2].value(), a[1].value(), a[0].value() );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type gather( const ValueIndexPair<double>* a, const double* b ) noexcept {
+      return _mm512_set_pd( b[a[7].index()], b[a[6].index()], b[a[5].index()], b[a[4].index()],
+                            b[a[3].index()], b[a[2].index()], b[a[1].index()], b[a[0].index()] );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparsePack class template for single precision values.
+// \ingroup dispatch
+*/
+template<>
+struct SparsePack<float>
+{
+   using Type = __m256;
+
+   static constexpr size_t size = 8UL;
+
+   static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm256_setzero_ps(); }
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm256_add_ps( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept {
+      return _mm256_fmadd_ps( a, b, c );
+   }
+
+   static BLAZE_ALWAYS_INLINE float sum( Type a ) noexcept {
+      __m128 b( _mm_add_ps( _mm256_castps256_ps128( a ), _mm256_extractf128_ps( a, 1 ) ) );
+      b = _mm_add_ps( b, _mm_movehl_ps( b, b ) );
+      return _mm_cvtss_f32( _mm_add_ss( b, _mm_movehdup_ps( b ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type values( const ValueIndexPair<float>* a ) noexcept {
+      return _mm256_set_ps( a[7].value(), a[6].value(), a[5].value(), a[4].value(),
+                            a[3].value(), a[2].value(), a[1].value(), a[0].value() );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type gather( const ValueIndexPair<float>* a, const float* b ) noexcept {
+      return _mm256_set_ps( b[a[7].index()], b[a[6].index()], b[a[5].index()], b[a[4].index()],
+                            b[a[3].index()], b[a[2].index()], b[a[1].index()], b[a[0].index()] );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPUTE KERNELS
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+#include <blaze/math/dispatch/KernelTemplates.h>
+/*! \endcond */
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the table of the AVX-512 compute kernels for the given element type.
+// \ingroup dispatch
+//
+// \return Reference to the kernel table.
+*/
+template< typename T >  // Type of the elements
+inline const KernelTable<T>& kernels() noexcept
+{
+   static const KernelTable<T> table{ &add<T>, &sub<T>, &mult<T>, &sum<T>, &dot<T>, &sparseDot<T>,
+                                      &gemv<T>, &tgemv<T>, &gemm<T> };
+   return table;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace avx512
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#if BLAZE_CLANG_COMPILER
+#  pragma clang attribute pop
+#else
+#  pragma GCC pop_options
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,264 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/InstructionSet.h
+//  \brief Header file for the runtime detection of the SIMD instruction set
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+#define _BLAZE_MATH_DISPATCH_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  include <cpuid.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Instruction sets for the runtime dispatch of compute kernels.
+// \ingroup dispatch
+//
+// The InstructionSet enumeration lists the instruction sets that can be selected at runtime
+// for the dispatched compute kernels of Blaze (see the BLAZE_USE_RUNTIME_DISPATCH switch). The
+// \a baseline instruction set represents the instruction set Blaze has been compiled for.
+*/
+enum class InstructionSet : int
+{
+   baseline = 0,  //!< The instruction set selected at compile time.
+   avx2     = 1,  //!< The AVX2 instruction set in combination with FMA.
+   avx512   = 2   //!< The AVX-512F instruction set in combination with AVX2 and FMA.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Instruction set functions */
+//@{
+inline InstructionSet detectInstructionSet() noexcept;
+inline InstructionSet getInstructionSet() noexcept;
+inline void setInstructionSet( InstructionSet isa ) noexcept;
+inline void resetInstructionSet() noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Detects the most capable instruction set supported by the executing CPU.
+// \ingroup dispatch
+//
+// \return The most capable instruction set supported by both the CPU and the operating system.
+//
+// This function queries the CPU via CPUID and the operating system via XGETBV and returns the
+// most capable instruction set that can be used for the dispatched compute kernels. In case
+// the runtime dispatch is not available (see the BLAZE_USE_RUNTIME_DISPATCH switch), the
+// function returns \a InstructionSet::baseline.
+*/
+inline InstructionSet detectInstructionSet() noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   unsigned int eax( 0U ), ebx( 0U ), ecx( 0U ), edx( 0U );
+
+   if( !__get_cpuid( 1U, &eax, &ebx, &ecx, &edx ) )
+      return InstructionSet::baseline;
+
+   const bool fma    ( ( ecx & ( 1U << 12 ) ) != 0U );
+   const bool osxsave( ( ecx & ( 1U << 27 ) ) != 0U );
+   const bool avx    ( ( ecx & ( 1U << 28 ) ) != 0U );
+
+   if( !osxsave || !avx )
+      return InstructionSet::baseline;
+
+   unsigned int xcr0( 0U ), xcr0hi( 0U );
+   __asm__ __volatile__ ( "xgetbv" : "=a"( xcr0 ), "=d"( xcr0hi ) : "c"( 0U ) );
+
+   // The operating system has to preserve the XMM and YMM registers
+   if( ( xcr0 & 0x06U ) != 0x06U || __get_cpuid_max( 0U, nullptr ) < 7U )
+      return InstructionSet::baseline;
+
+   __cpuid_count( 7U, 0U, eax, ebx, ecx, edx );
+
+   const bool avx2   ( ( ebx & ( 1U <<  5 ) ) != 0U );
+   const bool avx512f( ( ebx & ( 1U << 16 ) ) != 0U );
+
+   // The operating system additionally has to preserve the opmask and ZMM registers
+   if( avx2 && fma && avx512f && ( xcr0 & 0xE6U ) == 0xE6U )
+      return InstructionSet::avx512;
+   else if( avx2 && fma )
+      return InstructionSet::avx2;
+#endif
+
+   return InstructionSet::baseline;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the instruction set the Blaze library has been compiled for.
+// \ingroup dispatch
+//
+// \return The compile time instruction set in terms of the dispatch instruction sets.
+*/
+constexpr InstructionSet compiledInstructionSet() noexcept
+{
+   return ( BLAZE_AVX512F_MODE )
+          ?( InstructionSet::avx512 )
+          :( ( BLAZE_AVX2_MODE && BLAZE_FMA_MODE )?( InstructionSet::avx2 ):( InstructionSet::baseline ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selects the instruction set for the dispatched compute kernels.
+// \ingroup dispatch
+//
+// \param limit The most capable instruction set to be used.
+// \return The selected instruction set.
+//
+// This function selects the most capable instruction set that is supported by the CPU, does
+// not exceed the given \a limit, and is more capable than the compile time instruction set.
+// In case no such instruction set exists, the function returns \a InstructionSet::baseline.
+*/
+inline InstructionSet selectInstructionSet( InstructionSet limit ) noexcept
+{
+   static const InstructionSet detected( detectInstructionSet() );
+
+   const InstructionSet isa( ( limit < detected )?( limit ):( detected ) );
+
+   return ( isa > compiledInstructionSet() )?( isa ):( InstructionSet::baseline );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the currently active instruction set.
+// \ingroup dispatch
+//
+// \return Reference to the storage of the active instruction set.
+//
+// The active instruction set is determined once, on first use.
+*/
+inline std::atomic<InstructionSet>& activeInstructionSet() noexcept
+{
+   static std::atomic<InstructionSet> isa( selectInstructionSet( InstructionSet::avx512 ) );
+   return isa;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set used by the dispatched compute kernels.
+// \ingroup dispatch
+//
+// \return The active instruction set.
+//
+// This function returns the instruction set that is currently used by the dispatched compute
+// kernels of Blaze. In case the CPU does not support an instruction set that is more capable
+// than the compile time instruction set or in case the runtime dispatch is not available, the
+// function returns \a InstructionSet::baseline:
+
+   \code
+   if( blaze::getInstructionSet() == blaze::InstructionSet::avx512 ) {
+      // The dispatched kernels use AVX-512
+   }
+   \endcode
+*/
+inline InstructionSet getInstructionSet() noexcept
+{
+   return activeInstructionSet().load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restricts the instruction set used by the dispatched compute kernels.
+// \ingroup dispatch
+//
+// \param isa The most capable instruction set to be used.
+// \return void
+//
+// This function restricts the dispatched compute kernels to the given instruction set. It is
+// primarily intended for testing and benchmarking purposes, for instance to compare the results
+// of different instruction sets on the same machine. Instruction sets that are not supported by
+// the CPU are never selected, i.e. the request is limited to the capabilities of the CPU. In
+// case the resulting instruction set is not more capable than the compile time instruction set,
+// the compile time kernels are used. Note that operations that are already being executed are
+// not affected by the change.
+*/
+inline void setInstructionSet( InstructionSet isa ) noexcept
+{
+   activeInstructionSet().store( selectInstructionSet( isa ), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the instruction set to the most capable instruction set of the CPU.
+// \ingroup dispatch
+//
+// \return void
+*/
+inline void resetInstructionSet() noexcept
+{
+   setInstructionSet( InstructionSet::avx512 );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
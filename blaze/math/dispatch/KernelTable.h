@@ -0,0 +1,96 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/KernelTable.h
+//  \brief Header file for the table of runtime dispatched compute kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_KERNELTABLE_H_
+#define _BLAZE_MATH_DISPATCH_KERNELTABLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of the runtime dispatched compute kernels for a specific instruction set.
+// \ingroup dispatch
+//
+// The KernelTable class template holds the compute kernels that are compiled for a specific
+// instruction set (see the InstructionSet enumeration). All kernels operate on raw, contiguous
+// arrays of single or double precision values and do not require any alignment:
+//
+//  - \c add, \c sub, and \c mult compute the element-wise operation \f$ c_i = a_i \circ b_i \f$.
+//  - \c sum and \c dot compute the sum of the elements and the scalar product.
+//  - \c sparseDot computes the scalar product of a range of sparse elements and a dense array.
+//  - \c gemv computes \f$ \vec{y} = \alpha A \vec{x} + \beta \vec{y} \f$ for a row-major matrix
+//    \a A, \c tgemv the same operation for a column-major matrix \a A. In case \a beta is 0,
+//    \a y is not read.
+//  - \c gemm computes \f$ C = C + \alpha A B \f$ for a row-major \a m x \a k block \a A and a
+//    column-major \a k x \a n block \a B (the packed blocks of the mmm() kernel). The element
+//    \f$ C_{ij} \f$ is located at \f$ C[i*rsc+j*csc] \f$.
+*/
+template< typename T >  // Type of the elements
+struct KernelTable
+{
+   void (*add )( size_t n, const T* a, const T* b, T* c );
+   void (*sub )( size_t n, const T* a, const T* b, T* c );
+   void (*mult)( size_t n, const T* a, const T* b, T* c );
+
+   T (*sum      )( size_t n, const T* a );
+   T (*dot      )( size_t n, const T* a, const T* b );
+   T (*sparseDot)( size_t nnz, const ValueIndexPair<T>* a, const T* b );
+
+   void (*gemv )( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta );
+   void (*tgemv)( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta );
+
+   void (*gemm)( size_t m, size_t n, size_t k, const T* A, size_t lda, const T* B, size_t ldb,
+                 T* C, size_t rsc, size_t csc, T alpha );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
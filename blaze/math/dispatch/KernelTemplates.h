@@ -0,0 +1,552 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/KernelTemplates.h
+//  \brief Header file for the instruction set independent compute kernel templates
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+// This file is deliberately not protected by an include guard. It is included by the instruction
+// set specific dispatch headers (see <blaze/math/dispatch/AVX2.h>) within a namespace that
+// provides the Pack and SparsePack class templates and within a region that is compiled for the
+// according instruction set. Each inclusion creates an independent set of compute kernels.
+
+
+//=================================================================================================
+//
+//  ELEMENT-WISE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Element-wise addition operation.
+// \ingroup dispatch
+*/
+struct AddOperation
+{
+   template< typename P >
+   static BLAZE_ALWAYS_INLINE typename P::Type apply( typename P::Type a, typename P::Type b ) noexcept {
+      return P::add( a, b );
+   }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T apply( T a, T b ) noexcept {
+      return a + b;
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise subtraction operation.
+// \ingroup dispatch
+*/
+struct SubOperation
+{
+   template< typename P >
+   static BLAZE_ALWAYS_INLINE typename P::Type apply( typename P::Type a, typename P::Type b ) noexcept {
+      return P::sub( a, b );
+   }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T apply( T a, T b ) noexcept {
+      return a - b;
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise multiplication operation.
+// \ingroup dispatch
+*/
+struct MultOperation
+{
+   template< typename P >
+   static BLAZE_ALWAYS_INLINE typename P::Type apply( typename P::Type a, typename P::Type b ) noexcept {
+      return P::mult( a, b );
+   }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T apply( T a, T b ) noexcept {
+      return a * b;
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of elements in front of the first fully aligned pack.
+// \ingroup dispatch
+//
+// \param p Pointer to the first element of the array.
+// \param n The number of elements of the array.
+// \return The number of leading elements that have to be processed individually.
+//
+// The arrays of Blaze are aligned for the instruction set selected at compile time, which may
+// be smaller than the width of the dispatched packs. Since loads and stores that cross a cache
+// line boundary are considerably slower, the kernels process the leading elements individually.
+*/
+template< typename T >  // Type of the elements
+BLAZE_ALWAYS_INLINE size_t peel( const T* p, size_t n ) noexcept
+{
+   constexpr size_t bytes( sizeof( typename Pack<T>::Type ) );
+
+   const size_t offset( reinterpret_cast<size_t>( p ) % bytes );
+
+   if( offset == 0UL || offset % sizeof(T) != 0UL )
+      return 0UL;
+
+   const size_t count( ( bytes - offset ) / sizeof(T) );
+   return ( count < n )?( count ):( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise kernel for two dense arrays (\f$ c_i = a_i \circ b_i \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements.
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \param c The target array.
+// \return void
+*/
+template< typename T     // Type of the elements
+        , typename OP >  // Type of the element-wise operation
+BLAZE_ALWAYS_INLINE void elementwise( size_t n, const T* a, const T* b, T* c ) noexcept
+{
+   using P = Pack<T>;
+
+   const size_t ibegin( peel( c, n ) );
+
+   for( size_t i=0UL; i<ibegin; ++i ) {
+      c[i] = OP::apply( a[i], b[i] );
+   }
+
+   size_t i( ibegin );
+
+   for( ; (i+P::size*2UL) <= n; i+=P::size*2UL ) {
+      const typename P::Type c1( OP::template apply<P>( P::load( a+i         ), P::load( b+i         ) ) );
+      const typename P::Type c2( OP::template apply<P>( P::load( a+i+P::size ), P::load( b+i+P::size ) ) );
+      P::store( c+i        , c1 );
+      P::store( c+i+P::size, c2 );
+   }
+   for( ; (i+P::size) <= n; i+=P::size ) {
+      P::store( c+i, OP::template apply<P>( P::load( a+i ), P::load( b+i ) ) );
+   }
+   if( i < n ) {
+      const size_t rest( n - i );
+      const typename P::Type a1( P::maskload( a+i, rest ) );
+      const typename P::Type b1( P::maskload( b+i, rest ) );
+      P::maskstore( c+i, OP::template apply<P>( a1, b1 ), rest );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise addition of two dense arrays (\f$ c_i = a_i + b_i \f$).
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+void add( size_t n, const T* a, const T* b, T* c )
+{
+   elementwise<T,AddOperation>( n, a, b, c );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise subtraction of two dense arrays (\f$ c_i = a_i - b_i \f$).
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+void sub( size_t n, const T* a, const T* b, T* c )
+{
+   elementwise<T,SubOperation>( n, a, b, c );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise multiplication of two dense arrays (\f$ c_i = a_i * b_i \f$).
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+void mult( size_t n, const T* a, const T* b, T* c )
+{
+   elementwise<T,MultOperation>( n, a, b, c );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Summation of the elements of a dense array.
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+T sum( size_t n, const T* a )
+{
+   using P = Pack<T>;
+
+   typename P::Type xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+P::size*4UL) <= n; i+=P::size*4UL ) {
+      xmm1 = P::add( xmm1, P::load( a+i             ) );
+      xmm2 = P::add( xmm2, P::load( a+i+P::size     ) );
+      xmm3 = P::add( xmm3, P::load( a+i+P::size*2UL ) );
+      xmm4 = P::add( xmm4, P::load( a+i+P::size*3UL ) );
+   }
+   for( ; (i+P::size) <= n; i+=P::size ) {
+      xmm1 = P::add( xmm1, P::load( a+i ) );
+   }
+   if( i < n ) {
+      xmm2 = P::add( xmm2, P::maskload( a+i, n-i ) );
+   }
+
+   return P::sum( P::add( P::add( xmm1, xmm2 ), P::add( xmm3, xmm4 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar product of two dense arrays.
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+T dot( size_t n, const T* a, const T* b )
+{
+   using P = Pack<T>;
+
+   typename P::Type xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+P::size*4UL) <= n; i+=P::size*4UL ) {
+      xmm1 = P::fmadd( P::load( a+i             ), P::load( b+i             ), xmm1 );
+      xmm2 = P::fmadd( P::load( a+i+P::size     ), P::load( b+i+P::size     ), xmm2 );
+      xmm3 = P::fmadd( P::load( a+i+P::size*2UL ), P::load( b+i+P::size*2UL ), xmm3 );
+      xmm4 = P::fmadd( P::load( a+i+P::size*3UL ), P::load( b+i+P::size*3UL ), xmm4 );
+   }
+   for( ; (i+P::size) <= n; i+=P::size ) {
+      xmm1 = P::fmadd( P::load( a+i ), P::load( b+i ), xmm1 );
+   }
+   if( i < n ) {
+      xmm2 = P::fmadd( P::maskload( a+i, n-i ), P::maskload( b+i, n-i ), xmm2 );
+   }
+
+   return P::sum( P::add( P::add( xmm1, xmm2 ), P::add( xmm3, xmm4 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar product of a range of sparse elements and a dense array.
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+T sparseDot( size_t nnz, const ValueIndexPair<T>* a, const T* b )
+{
+   using P = SparsePack<T>;
+
+   typename P::Type xmm1( P::zero() ), xmm2( P::zero() );
+   size_t k( 0UL );
+
+   for( ; (k+P::size*2UL) <= nnz; k+=P::size*2UL ) {
+      xmm1 = P::fmadd( P::values( a+k         ), P::gather( a+k         , b ), xmm1 );
+      xmm2 = P::fmadd( P::values( a+k+P::size ), P::gather( a+k+P::size , b ), xmm2 );
+   }
+   for( ; (k+P::size) <= nnz; k+=P::size ) {
+      xmm1 = P::fmadd( P::values( a+k ), P::gather( a+k, b ), xmm1 );
+   }
+
+   T sp( P::sum( P::add( xmm1, xmm2 ) ) );
+
+   for( ; k<nnz; ++k ) {
+      sp += a[k].value() * b[a[k].index()];
+   }
+
+   return sp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Row-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y} = \alpha A \vec{x} + \beta \vec{y} \f$).
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+void gemv( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using P = Pack<T>;
+
+   const size_t jpos( n - n % P::size );
+
+   const auto update = [y,alpha,beta]( size_t i, T value ) {
+      y[i] = ( beta == T(0) )?( alpha*value ):( alpha*value + beta*y[i] );
+   };
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + (i    )*lda );
+      const T* a2( A + (i+1UL)*lda );
+      const T* a3( A + (i+2UL)*lda );
+      const T* a4( A + (i+3UL)*lda );
+
+      typename P::Type xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+
+      for( size_t j=0UL; j<jpos; j+=P::size ) {
+         const typename P::Type x1( P::load( x+j ) );
+         xmm1 = P::fmadd( P::load( a1+j ), x1, xmm1 );
+         xmm2 = P::fmadd( P::load( a2+j ), x1, xmm2 );
+         xmm3 = P::fmadd( P::load( a3+j ), x1, xmm3 );
+         xmm4 = P::fmadd( P::load( a4+j ), x1, xmm4 );
+      }
+
+      if( jpos < n ) {
+         const size_t rest( n - jpos );
+         const typename P::Type x1( P::maskload( x+jpos, rest ) );
+         xmm1 = P::fmadd( P::maskload( a1+jpos, rest ), x1, xmm1 );
+         xmm2 = P::fmadd( P::maskload( a2+jpos, rest ), x1, xmm2 );
+         xmm3 = P::fmadd( P::maskload( a3+jpos, rest ), x1, xmm3 );
+         xmm4 = P::fmadd( P::maskload( a4+jpos, rest ), x1, xmm4 );
+      }
+
+      update( i    , P::sum( xmm1 ) );
+      update( i+1UL, P::sum( xmm2 ) );
+      update( i+2UL, P::sum( xmm3 ) );
+      update( i+3UL, P::sum( xmm4 ) );
+   }
+
+   for( ; i<m; ++i ) {
+      update( i, dot( n, A + i*lda, x ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Column-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y} = \alpha A \vec{x} + \beta \vec{y} \f$).
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+void tgemv( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using P = Pack<T>;
+
+   const size_t ipos( m - m % P::size );
+
+   if( beta == T(0) ) {
+      for( size_t i=0UL; i<m; ++i )
+         y[i] = T(0);
+   }
+   else if( beta != T(1) ) {
+      for( size_t i=0UL; i<m; ++i )
+         y[i] *= beta;
+   }
+
+   size_t j( 0UL );
+
+   for( ; (j+4UL) <= n; j+=4UL )
+   {
+      const T* a1( A + (j    )*lda );
+      const T* a2( A + (j+1UL)*lda );
+      const T* a3( A + (j+2UL)*lda );
+      const T* a4( A + (j+3UL)*lda );
+
+      const T s1( alpha*x[j] ), s2( alpha*x[j+1UL] ), s3( alpha*x[j+2UL] ), s4( alpha*x[j+3UL] );
+      const typename P::Type x1( P::set( s1 ) ), x2( P::set( s2 ) ), x3( P::set( s3 ) ), x4( P::set( s4 ) );
+
+      for( size_t i=0UL; i<ipos; i+=P::size ) {
+         typename P::Type y1( P::load( y+i ) );
+         y1 = P::fmadd( P::load( a1+i ), x1, y1 );
+         y1 = P::fmadd( P::load( a2+i ), x2, y1 );
+         y1 = P::fmadd( P::load( a3+i ), x3, y1 );
+         y1 = P::fmadd( P::load( a4+i ), x4, y1 );
+         P::store( y+i, y1 );
+      }
+      if( ipos < m ) {
+         const size_t rest( m - ipos );
+         typename P::Type y1( P::maskload( y+ipos, rest ) );
+         y1 = P::fmadd( P::maskload( a1+ipos, rest ), x1, y1 );
+         y1 = P::fmadd( P::maskload( a2+ipos, rest ), x2, y1 );
+         y1 = P::fmadd( P::maskload( a3+ipos, rest ), x3, y1 );
+         y1 = P::fmadd( P::maskload( a4+ipos, rest ), x4, y1 );
+         P::maskstore( y+ipos, y1, rest );
+      }
+   }
+
+   for( ; j<n; ++j )
+   {
+      const T* a1( A + j*lda );
+      const T s1( alpha*x[j] );
+      const typename P::Type x1( P::set( s1 ) );
+
+      for( size_t i=0UL; i<ipos; i+=P::size ) {
+         P::store( y+i, P::fmadd( P::load( a1+i ), x1, P::load( y+i ) ) );
+      }
+      if( ipos < m ) {
+         const size_t rest( m - ipos );
+         const typename P::Type y1( P::maskload( y+ipos, rest ) );
+         P::maskstore( y+ipos, P::fmadd( P::maskload( a1+ipos, rest ), x1, y1 ), rest );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Micro-kernel for the multiplication of two packed dense matrix blocks
+//        (\f$ C = C + \alpha A B \f$).
+// \ingroup dispatch
+//
+// The kernel computes 4x2 blocks of \a C as scalar products of four rows of the row-major
+// block \a A and two columns of the column-major block \a B.
+*/
+template< typename T >  // Type of the elements
+void gemm( size_t m, size_t n, size_t k, const T* A, size_t lda, const T* B, size_t ldb,
+           T* C, size_t rsc, size_t csc, T alpha )
+{
+   using P = Pack<T>;
+
+   const size_t kpos( k - k % P::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + (i    )*lda );
+      const T* a2( A + (i+1UL)*lda );
+      const T* a3( A + (i+2UL)*lda );
+      const T* a4( A + (i+3UL)*lda );
+
+      size_t j( 0UL );
+
+      for( ; (j+2UL) <= n; j+=2UL )
+      {
+         const T* b1( B + (j    )*ldb );
+         const T* b2( B + (j+1UL)*ldb );
+
+         typename P::Type xmm1( P::zero() ), xmm2( P::zero() ), xmm3( P::zero() ), xmm4( P::zero() );
+         typename P::Type xmm5( P::zero() ), xmm6( P::zero() ), xmm7( P::zero() ), xmm8( P::zero() );
+
+         for( size_t l=0UL; l<kpos; l+=P::size ) {
+            const typename P::Type y1( P::load( b1+l ) );
+            const typename P::Type y2( P::load( b2+l ) );
+            const typename P::Type x1( P::load( a1+l ) );
+            xmm1 = P::fmadd( x1, y1, xmm1 );
+            xmm2 = P::fmadd( x1, y2, xmm2 );
+            const typename P::Type x2( P::load( a2+l ) );
+            xmm3 = P::fmadd( x2, y1, xmm3 );
+            xmm4 = P::fmadd( x2, y2, xmm4 );
+            const typename P::Type x3( P::load( a3+l ) );
+            xmm5 = P::fmadd( x3, y1, xmm5 );
+            xmm6 = P::fmadd( x3, y2, xmm6 );
+            const typename P::Type x4( P::load( a4+l ) );
+            xmm7 = P::fmadd( x4, y1, xmm7 );
+            xmm8 = P::fmadd( x4, y2, xmm8 );
+         }
+
+         if( kpos < k ) {
+            const size_t rest( k - kpos );
+            const typename P::Type y1( P::maskload( b1+kpos, rest ) );
+            const typename P::Type y2( P::maskload( b2+kpos, rest ) );
+            const typename P::Type x1( P::maskload( a1+kpos, rest ) );
+            xmm1 = P::fmadd( x1, y1, xmm1 );
+            xmm2 = P::fmadd( x1, y2, xmm2 );
+            const typename P::Type x2( P::maskload( a2+kpos, rest ) );
+            xmm3 = P::fmadd( x2, y1, xmm3 );
+            xmm4 = P::fmadd( x2, y2, xmm4 );
+            const typename P::Type x3( P::maskload( a3+kpos, rest ) );
+            xmm5 = P::fmadd( x3, y1, xmm5 );
+            xmm6 = P::fmadd( x3, y2, xmm6 );
+            const typename P::Type x4( P::maskload( a4+kpos, rest ) );
+            xmm7 = P::fmadd( x4, y1, xmm7 );
+            xmm8 = P::fmadd( x4, y2, xmm8 );
+         }
+
+         T* c( C + i*rsc + j*csc );
+         c[0UL        ] += alpha * P::sum( xmm1 );
+         c[csc        ] += alpha * P::sum( xmm2 );
+         c[rsc        ] += alpha * P::sum( xmm3 );
+         c[rsc+csc    ] += alpha * P::sum( xmm4 );
+         c[rsc*2UL    ] += alpha * P::sum( xmm5 );
+         c[rsc*2UL+csc] += alpha * P::sum( xmm6 );
+         c[rsc*3UL    ] += alpha * P::sum( xmm7 );
+         c[rsc*3UL+csc] += alpha * P::sum( xmm8 );
+      }
+
+      if( j < n )
+      {
+         const T* b1( B + j*ldb );
+         T* c( C + i*rsc + j*csc );
+         c[0UL    ] += alpha * dot( k, a1, b1 );
+         c[rsc    ] += alpha * dot( k, a2, b1 );
+         c[rsc*2UL] += alpha * dot( k, a3, b1 );
+         c[rsc*3UL] += alpha * dot( k, a4, b1 );
+      }
+   }
+
+   for( ; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         C[i*rsc+j*csc] += alpha * dot( k, A + i*lda, B + j*ldb );
+      }
+   }
+}
+//*************************************************************************************************
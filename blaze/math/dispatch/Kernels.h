@@ -0,0 +1,129 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Kernels.h
+//  \brief Selection of the runtime dispatched compute kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_KERNELS_H_
+#define _BLAZE_MATH_DISPATCH_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dispatch/AVX2.h>
+#include <blaze/math/dispatch/AVX512.h>
+#include <blaze/math/dispatch/InstructionSet.h>
+#include <blaze/math/dispatch/KernelTable.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for element types of the runtime dispatched compute kernels.
+// \ingroup dispatch
+//
+// This type trait tests whether or not the given element type is supported by the runtime
+// dispatched compute kernels of Blaze. In case the runtime dispatch is active (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch) and \a T is either \c float or \c double, the \a value
+// member constant is set to \a true and the class derives from \a TrueType. Otherwise \a value
+// is set to \a false and the class derives from \a FalseType.
+*/
+template< typename T >  // Type of the elements
+struct IsDispatchable
+   : public BoolConstant< BLAZE_RUNTIME_DISPATCH_MODE && ( IsFloat_v<T> || IsDouble_v<T> ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the IsDispatchable type trait.
+// \ingroup dispatch
+*/
+template< typename T >  // Type of the elements
+constexpr bool IsDispatchable_v = IsDispatchable<T>::value;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the table of the compute kernels for the active instruction set.
+// \ingroup dispatch
+//
+// \return Pointer to the kernel table, \a nullptr in case the compile time kernels are used.
+//
+// This function returns the kernels for the instruction set that is currently selected via
+// getInstructionSet(). In case the active instruction set is the baseline instruction set, the
+// function returns \a nullptr, which indicates that the compile time kernels should be used.
+// Note that the function must only be used for element types with IsDispatchable_v<T> == true.
+*/
+template< typename T >  // Type of the elements
+inline const KernelTable<T>* getKernelTable() noexcept
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   switch( getInstructionSet() ) {
+      case InstructionSet::avx512: return &dispatch::avx512::kernels<T>();
+      case InstructionSet::avx2  : return &dispatch::avx2::kernels<T>();
+      default                    : return nullptr;
+   }
+#else
+   return nullptr;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
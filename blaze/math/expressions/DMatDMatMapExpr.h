@@ -63,6 +63,8 @@
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Or.h>
 #include <blaze/math/functors/Pow.h>
+#include <blaze/math/functors/Select.h>
+#include <blaze/math/functors/SelectIf.h>
 #include <blaze/math/functors/ShiftLV.h>
 #include <blaze/math/functors/ShiftRV.h>
 #include <blaze/math/shims/Serial.h>
@@ -1500,10 +1502,10 @@ inline decltype(auto)
 // according element of \a lhs is selected, in case the \a cond element evaluates to \a false, the
 // according element of \a rhs is selected. The function returns an expression representing this
 // operation.\n
-// The following example demonstrates the use of the \a selec() function:
+// The following example demonstrates the use of the \a select() function:
 
    \code
-   blaze::DynamicMatrix<bool> cond{ { true, false }, { true false } };
+   blaze::DynamicMatrix<bool> cond{ { true, false }, { true, false } };
    blaze::DynamicMatrix<int> A{ { 1, -1 }, { 1, -1 } };
    blaze::DynamicMatrix<int> B{ { -2, 2 }, { -2, 2 } };
    blaze::DynamicMatrix<int> C;
@@ -1524,7 +1526,7 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
-   return map( cond, lhs, rhs, []( bool c, const auto& a, const auto& b ) { return c ? a : b; } );
+   return map( ~cond, ~lhs, ~rhs, Select() );
 }
 //*************************************************************************************************
 
@@ -1709,6 +1711,51 @@ inline decltype(auto)
 
 
 
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Elementwise conditional selection of values from the dense matrices \a lhs and \a rhs
+//        based on an elementwise comparison (\f$ A=select(B<C,D,E) \f$).
+// \ingroup dense_matrix
+//
+// \param cond The dense matrix map expression representing the selection conditions.
+// \param lhs The true-case dense matrix.
+// \param rhs The false-case dense matrix.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function implements a performance optimized treatment of the elementwise conditional
+// selection based on a binary map expression (as for instance an elementwise comparison). The
+// binary operation and the selection are fused into a single 4-ary operation, which enables
+// the vectorization of the complete selection in case all operands have the same floating
+// point element type.
+*/
+template< typename MT1   // Type of the left-hand side operand of the condition
+        , typename MT2   // Type of the right-hand side operand of the condition
+        , typename OP    // Type of the binary predicate
+        , typename MT3   // Type of the true-case dense matrix
+        , typename MT4   // Type of the false-case dense matrix
+        , bool SO >      // Storage order
+inline decltype(auto)
+   select( const DMatDMatMapExpr<MT1,MT2,OP,SO>& cond,
+           const DenseMatrix<MT3,SO>& lhs, const DenseMatrix<MT4,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( cond.leftOperand(), cond.rightOperand(), ~lhs, ~rhs,
+               SelectIf<OP>( cond.operation() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL RESTRUCTURING BINARY ARITHMETIC OPERATORS
@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -178,6 +179,24 @@ class DMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a runtime
+       dispatched kernel (see the BLAZE_USE_RUNTIME_DISPATCH switch), the variable will be set
+       to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseDispatchKernel_v =
+      ( IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsTriangular_v<T2> &&
+        IsDispatchable_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -1110,7 +1129,7 @@ class DMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based assignment to dense vectors (default)********************************************
+   //**Dispatch-based assignment to dense vectors (default)****************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense vector multiplication
    //        (\f$ \vec{y}=A*\vec{x} \f$).
@@ -1124,13 +1143,73 @@ class DMatDVecMultExpr
    // This function relays to the default implementation of the assignment of a large dense
    // matrix-dense vector multiplication expression to a dense vector.
    */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      selectLargeAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dispatch-based assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH switch). In
+   // case the CPU does not provide a more capable instruction set than the one selected at compile
+   // time, the function relays to the default implementation.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      if( const auto* kernels = getKernelTable<ET>() ) {
+         kernels->gemv( A.rows(), A.columns(), A.data(), A.spacing(),
+                        x.data(), y.data(), ET(1), ET(0) );
+      }
+      else {
+         selectLargeAssignKernel( y, A, x );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**BLAS-based assignment to dense vectors (default)********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the runtime dispatched implementation of the assignment of a large
+   // dense matrix-dense vector multiplication expression to a dense vector.
+   */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
    {
-      selectLargeAssignKernel( y, A, x );
+      selectDispatchAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1918,7 +1997,7 @@ class DMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based addition assignment to dense vectors (default)***********************************
+   //**Dispatch-based addition assignment to dense vectors (default)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a dense matrix-dense vector multiplication
    //        (\f$ \vec{y}+=A*\vec{x} \f$).
@@ -1932,13 +2011,73 @@ class DMatDVecMultExpr
    // This function relays to the default implementation of the addition assignment of a large
    // dense matrix-dense vector multiplication expression to a dense vector.
    */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      selectLargeAddAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dispatch-based addition assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH switch). In
+   // case the CPU does not provide a more capable instruction set than the one selected at compile
+   // time, the function relays to the default implementation.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      if( const auto* kernels = getKernelTable<ET>() ) {
+         kernels->gemv( A.rows(), A.columns(), A.data(), A.spacing(),
+                        x.data(), y.data(), ET(1), ET(1) );
+      }
+      else {
+         selectLargeAddAssignKernel( y, A, x );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**BLAS-based addition assignment to dense vectors (default)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the runtime dispatched implementation of the addition assignment of
+   // a large dense matrix-dense vector multiplication expression to a dense vector.
+   */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
    {
-      selectLargeAddAssignKernel( y, A, x );
+      selectDispatchAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2702,7 +2841,7 @@ class DMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based subtraction assignment to dense vectors (default)********************************
+   //**Dispatch-based subtraction assignment to dense vectors (default)****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense matrix-dense vector multiplication
    //        (\f$ \vec{y}-=A*\vec{x} \f$).
@@ -2716,13 +2855,73 @@ class DMatDVecMultExpr
    // This function relays to the default implementation of the subtraction assignment of a large
    // dense matrix-dense vector multiplication expression to a dense vector.
    */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      selectLargeSubAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dispatch-based subtraction assignment to dense vectors**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the kernel
+   // for the instruction set selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH switch). In
+   // case the CPU does not provide a more capable instruction set than the one selected at compile
+   // time, the function relays to the default implementation.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      if( const auto* kernels = getKernelTable<ET>() ) {
+         kernels->gemv( A.rows(), A.columns(), A.data(), A.spacing(),
+                        x.data(), y.data(), ET(-1), ET(1) );
+      }
+      else {
+         selectLargeSubAssignKernel( y, A, x );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**BLAS-based subtraction assignment to dense vectors (default)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the runtime dispatched implementation of the subtraction assignment
+   // of a large dense matrix-dense vector multiplication expression to a dense vector.
+   */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
    {
-      selectLargeSubAssignKernel( y, A, x );
+      selectDispatchSubAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2769,8 +2968,8 @@ class DMatDVecMultExpr
 
    //**Multiplication assignment to dense vectors**************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Multiplication assignment of a dense matrix-dense vector multiplication to a dense vector
-   //        (\f$ \vec{y}*=A*\vec{x} \f$).
+   /*!\brief Multiplication assignment of a dense matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}*=A*\vec{x} \f$).
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side dense vector.
@@ -2915,8 +3114,8 @@ class DMatDVecMultExpr
 
    //**SMP addition assignment to dense vectors****************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP addition assignment of a dense matrix-dense vector multiplication to a dense vector
-   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   /*!\brief SMP addition assignment of a dense matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side dense vector.
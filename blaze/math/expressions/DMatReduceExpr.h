@@ -63,6 +63,7 @@
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -1543,49 +1544,49 @@ struct DMatReduceExprHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the reduction of a row-major dense matrix.
+/*!\brief Default backend implementation of the reduction of a range of rows of a row-major
+//        dense matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the reduction computation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a row-major dense
-// matrix. Due to the explicit application of the SFINAE principle, this function can only be
-// selected by the compiler in case vectorization cannot be applied.
+// This function implements the performance optimized reduction operation for the non-empty row
+// range \f$ [ibegin..iend) \f$ of a row-major dense matrix with at least one column. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization cannot be applied.
 */
 template< typename MT    // Type of the dense matrix
         , typename OP >  // Type of the reduction operation
-inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+inline auto dmatreduce_backend( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend,
+                                OP op )
    -> DisableIf_t< DMatReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
 {
-   using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
-   const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
 
-   if( M == 0UL || N == 0UL ) return ET{};
-   if( M == 1UL && N == 1UL ) return (~dm)(0UL,0UL);
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
 
-   CT tmp( ~dm );
-
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+   const MT& tmp( ~dm );
 
    ET redux0{};
 
    {
-      redux0 = tmp(0UL,0UL);
+      redux0 = tmp(ibegin,0UL);
 
       for( size_t j=1UL; j<N; ++j ) {
-         redux0 = op( redux0, tmp(0UL,j) );
+         redux0 = op( redux0, tmp(ibegin,j) );
       }
    }
 
-   size_t i( 1UL );
+   size_t i( ibegin+1UL );
 
-   for( ; (i+2UL) <= M; i+=2UL )
+   for( ; (i+2UL) <= iend; i+=2UL )
    {
       ET redux1( tmp(i    ,0UL) );
       ET redux2( tmp(i+1UL,0UL) );
@@ -1599,7 +1600,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
       redux0 = op( redux0, redux1 );
    }
 
-   if( i < M )
+   if( i < iend )
    {
       ET redux1( tmp(i,0UL) );
 
@@ -1618,34 +1619,35 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the reduction of a row-major dense matrix.
+/*!\brief SIMD optimized backend implementation of the reduction of a range of rows of a
+//        row-major dense matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the reduction computation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a row-major dense
-// matrix. Due to the explicit application of the SFINAE principle, this function can only be
-// selected by the compiler in case vectorization can be applied.
+// This function implements the performance optimized reduction operation for the non-empty row
+// range \f$ [ibegin..iend) \f$ of a row-major dense matrix with at least one column. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization can be applied.
 */
 template< typename MT    // Type of the dense matrix
         , typename OP >  // Type of the reduction operation
-inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+inline auto dmatreduce_backend( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend,
+                                OP op )
    -> EnableIf_t< DMatReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
 {
-   using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
-   const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
 
-   if( M == 0UL || N == 0UL ) return ET{};
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
 
-   CT tmp( ~dm );
-
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+   const MT& tmp( ~dm );
 
    constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
@@ -1664,11 +1666,11 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
       SIMDTrait_t<ET> xmm1;
 
       {
-         xmm1 = tmp.load(0UL,0UL);
+         xmm1 = tmp.load(ibegin,0UL);
          size_t j( SIMDSIZE );
 
          for( ; j<jpos; j+=SIMDSIZE ) {
-            xmm1 = op( xmm1, tmp.load(0UL,j) );
+            xmm1 = op( xmm1, tmp.load(ibegin,j) );
          }
 
          if( jpos < N )
@@ -1676,16 +1678,16 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
             storea( array1, xmm1 );
 
             for( ; j<N; ++j ) {
-               array1[0UL] = op( array1[0UL], tmp(0UL,j) );
+               array1[0UL] = op( array1[0UL], tmp(ibegin,j) );
             }
 
             xmm1 = loada( array1 );
          }
       }
 
-      size_t i( 1UL );
+      size_t i( ibegin+1UL );
 
-      for( ; (i+4UL) <= M; i+=4UL )
+      for( ; (i+4UL) <= iend; i+=4UL )
       {
          xmm1 = op( xmm1, tmp.load(i,0UL) );
          SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
@@ -1725,7 +1727,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
          xmm1 = op( xmm1, xmm3 );
       }
 
-      if( i+2UL <= M )
+      if( i+2UL <= iend )
       {
          xmm1 = op( xmm1, tmp.load(i,0UL) );
          SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
@@ -1755,7 +1757,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
          i += 2UL;
       }
 
-      if( i < M )
+      if( i < iend )
       {
          xmm1 = op( xmm1, tmp.load(i,0UL) );
          size_t j( SIMDSIZE );
@@ -1781,12 +1783,12 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
    else
    {
       {
-         redux = tmp(0UL,0UL);
+         redux = tmp(ibegin,0UL);
          for( size_t j=1UL; j<N; ++j ) {
-            redux = op( redux, tmp(0UL,j) );
+            redux = op( redux, tmp(ibegin,j) );
          }
       }
-      for( size_t i=1UL; i<M; ++i ) {
+      for( size_t i=ibegin+1UL; i<iend; ++i ) {
          for( size_t j=0UL; j<N; ++j ) {
             redux = op( redux, tmp(i,j) );
          }
@@ -1801,34 +1803,35 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the summation of a row-major dense matrix.
+/*!\brief SIMD optimized backend implementation of the summation of a range of rows of a
+//        row-major dense matrix.
 // \ingroup dense_matrix
 //
 // \param dm The given row-major dense matrix for the summation.
+// \param ibegin The index of the first row of the range.
+// \param iend The index one past the last row of the range.
 // \return The result of the summation.
 //
-// This function implements the performance optimized summation for a row-major dense matrix.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization can be applied.
+// This function implements the performance optimized summation for the non-empty row range
+// \f$ [ibegin..iend) \f$ of a row-major dense matrix with at least one column. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization can be applied.
 */
 template< typename MT >  // Type of the dense matrix
-inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
+inline auto dmatreduce_backend( const DenseMatrix<MT,false>& dm, size_t ibegin, size_t iend,
+                                Add /*op*/ )
    -> EnableIf_t< DMatReduceExprHelper<MT,Add>::value, ElementType_t<MT> >
 {
-   using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
-   const size_t M( (~dm).rows()    );
    const size_t N( (~dm).columns() );
 
-   if( M == 0UL || N == 0UL ) return ET{};
+   BLAZE_INTERNAL_ASSERT( ibegin < iend && iend <= (~dm).rows(), "Invalid row range" );
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid number of columns" );
 
-   CT tmp( ~dm );
-
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+   const MT& tmp( ~dm );
 
-   constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
+   constexpr bool remainder( !IsPadded_v<MT> );
    constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
    ET redux{};
@@ -1839,9 +1842,9 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
       BLAZE_INTERNAL_ASSERT( jpos <= N, "Invalid end calculation" );
 
       SIMDTrait_t<ET> xmm1;
-      size_t i( 0UL );
+      size_t i( ibegin );
 
-      for( ; (i+4UL) <= M; i+=4UL )
+      for( ; (i+4UL) <= iend; i+=4UL )
       {
          xmm1 += tmp.load(i,0UL);
          SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
@@ -1867,7 +1870,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
          xmm1 += xmm3;
       }
 
-      if( i+2UL <= M )
+      if( i+2UL <= iend )
       {
          xmm1 += tmp.load(i,0UL);
          SIMDTrait_t<ET> xmm2( tmp.load(i+1UL,0UL) );
@@ -1887,7 +1890,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
          i += 2UL;
       }
 
-      if( i < M )
+      if( i < iend )
       {
          xmm1 += tmp.load(i,0UL);
          size_t j( SIMDSIZE );
@@ -1904,7 +1907,7 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
    }
    else
    {
-      for( size_t i=0UL; i<M; ++i ) {
+      for( size_t i=ibegin; i<iend; ++i ) {
          for( size_t j=0UL; j<N; ++j ) {
             redux += tmp(i,j);
          }
@@ -1918,6 +1921,50 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function evaluates the given row-major dense matrix and reduces it by means of the given
+// reduction operation. In case the total number of elements of the matrix reaches the
+// \a SMP_DMATTOTALREDUCE_THRESHOLD and shared memory parallelization is active, the rows of the
+// matrix are split into one block per thread, each thread reduces its block by the serial (SIMD)
+// kernel and the partial results are combined in block order (see the smpReduce() function).
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET{};
+
+   CT tmp( ~dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   const auto kernel = [&tmp,&op]( size_t ibegin, size_t iend ) {
+      return dmatreduce_backend( tmp, ibegin, iend, op );
+   };
+
+   const bool parallel( isSMPReduceActive( M*N, SMP_DMATTOTALREDUCE_THRESHOLD ) );
+
+   return smpReduce<ET>( M, N, 1UL, parallel, kernel, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Optimized backend implementation of the minimum evaluation of a uniform dense matrix.
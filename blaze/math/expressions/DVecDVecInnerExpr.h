@@ -41,21 +41,32 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CompensatedSum.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/SummationFlag.h>
+#include <blaze/math/smp/ParallelReduce.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsStatic.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -98,6 +109,28 @@ struct DVecDVecInnerExprHelper
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatch of the dense vector/dense vector
+//        scalar multiplication.
+// \ingroup dense_vector
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+struct DVecDVecInnerDispatchHelper
+{
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( !IsStatic_v<VT1> && IsContiguous_v<VT1> && HasConstDataAccess_v<VT1> &&
+        !IsStatic_v<VT2> && IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> &&
+        IsDispatchable_v< ElementType_t<VT1> > &&
+        IsSame_v< ElementType_t<VT1>, ElementType_t<VT2> > );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -108,51 +141,55 @@ struct DVecDVecInnerExprHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the scalar product (inner product) of two dense
-//        vectors (\f$ s=\vec{a}*\vec{b} \f$).
+/*!\brief Default backend implementation of the scalar product (inner product) of a range of two
+//        dense vectors.
 // \ingroup dense_vector
 //
 // \param lhs The left-hand side dense vector for the inner product.
 // \param rhs The right-hand side dense vector for the inner product.
-// \return The scalar product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The scalar product of the given range.
 //
-// This function implements the performance optimized scalar product of two dense vectors.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization cannot be applied.
+// This function implements the performance optimized scalar product of the non-empty index
+// range \f$ [begin..end) \f$ of two dense vectors. Due to the explicit application of the
+// SFINAE principle, this function can only be selected by the compiler in case vectorization
+// cannot be applied.
 */
-template< typename VT1    // Type of the left-hand side dense vector
-        , typename VT2 >  // Type of the right-hand side dense vector
-inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline auto
+   dvecdvecinner_backend( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs,
+                          size_t begin, size_t end )
    -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
-                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+                 , MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
-   using CT1      = CompositeType_t<VT1>;
-   using CT2      = CompositeType_t<VT2>;
    using ET1      = ElementType_t<VT1>;
    using ET2      = ElementType_t<VT2>;
    using MultType = MultTrait_t<ET1,ET2>;
 
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   if( (~lhs).size() == 0UL ) return MultType();
-
-   CT1 left ( ~lhs );
-   CT2 right( ~rhs );
+   const VT1& left ( ~lhs );
+   const VT2& right( ~rhs );
 
-   MultType sp( left[0UL] * right[0UL] );
-   size_t i( 1UL );
+   MultType sp( left[begin] * right[begin] );
+   size_t i( begin+1UL );
 
-   for( ; (i+4UL) <= left.size(); i+=4UL ) {
+   for( ; (i+4UL) <= end; i+=4UL ) {
       sp += left[i    ] * right[i    ] +
             left[i+1UL] * right[i+1UL] +
             left[i+2UL] * right[i+2UL] +
             left[i+3UL] * right[i+3UL];
    }
-   for( ; (i+2UL) <= left.size(); i+=2UL ) {
+   for( ; (i+2UL) <= end; i+=2UL ) {
       sp += left[i    ] * right[i    ] +
             left[i+1UL] * right[i+1UL];
    }
-   for( ; i<left.size(); ++i ) {
+   for( ; i<end; ++i ) {
       sp += left[i] * right[i];
    }
 
@@ -164,49 +201,121 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the scalar product (inner product) of two
-//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+/*!\brief Runtime dispatched scalar product (inner product) of a range of two dense vectors.
 // \ingroup dense_vector
 //
 // \param lhs The left-hand side dense vector for the inner product.
 // \param rhs The right-hand side dense vector for the inner product.
-// \return The scalar product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param sp The resulting scalar product.
+// \return \a true if the scalar product has been computed by a dispatched kernel, \a false if not.
 //
-// This function implements the performance optimized scalar product of two dense vectors.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization can be applied.
+// This function computes the scalar product of the non-empty index range \f$ [begin..end) \f$
+// of two dense vectors via the kernel for the instruction set selected at runtime (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch). Due to the explicit application of the SFINAE principle,
+// this function can only be selected by the compiler in case both dense vectors provide direct
+// access to contiguous single or double precision elements.
 */
-template< typename VT1    // Type of the left-hand side dense vector
-        , typename VT2 >  // Type of the right-hand side dense vector
-inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline auto
+   dvecdvecinner_dispatch( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs,
+                           size_t begin, size_t end, ElementType_t<VT1>& sp )
+   -> EnableIf_t< DVecDVecInnerDispatchHelper<VT1,VT2>::value, bool >
+{
+   const auto* kernels( getKernelTable< ElementType_t<VT1> >() );
+
+   if( kernels == nullptr )
+      return false;
+
+   sp = kernels->dot( end - begin, (~lhs).data() + begin, (~rhs).data() + begin );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched scalar product (inner product) of a range of two dense vectors.
+// \ingroup dense_vector
+//
+// \return \a false.
+//
+// This function is selected in case the scalar product of the given dense vectors cannot be
+// computed by a dispatched kernel.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline auto
+   dvecdvecinner_dispatch( const DenseVector<VT1,TF1>& /*lhs*/, const DenseVector<VT2,TF2>& /*rhs*/,
+                           size_t /*begin*/, size_t /*end*/,
+                           MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >& /*sp*/ )
+   -> DisableIf_t< DVecDVecInnerDispatchHelper<VT1,VT2>::value, bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the scalar product (inner product) of a
+//        range of two dense vectors.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The scalar product of the given range.
+//
+// This function implements the performance optimized scalar product of the non-empty index
+// range \f$ [begin..end) \f$ of two dense vectors. The index \a begin is required to be a
+// multiple of the SIMD width. Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case vectorization can be applied.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline auto
+   dvecdvecinner_backend( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs,
+                          size_t begin, size_t end )
    -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
-                , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+                , MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
-   using CT1      = CompositeType_t<VT1>;
-   using CT2      = CompositeType_t<VT2>;
-   using XT1      = RemoveReference_t<CT1>;
-   using XT2      = RemoveReference_t<CT2>;
    using ET1      = ElementType_t<VT1>;
    using ET2      = ElementType_t<VT2>;
    using MultType = MultTrait_t<ET1,ET2>;
 
+   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
+   constexpr bool remainder( !IsPadded_v<VT1> || !IsPadded_v<VT2> );
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
-   if( (~lhs).size() == 0UL ) return MultType();
+   MultType sp{};
 
-   CT1 left ( ~lhs );
-   CT2 right( ~rhs );
-
-   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
-   constexpr bool remainder( !IsPadded_v<XT1> || !IsPadded_v<XT2> );
+   if( dvecdvecinner_dispatch( ~lhs, ~rhs, begin, end, sp ) ) {
+      return sp;
+   }
 
-   const size_t N( left.size() );
+   const VT1& left ( ~lhs );
+   const VT2& right( ~rhs );
 
-   const size_t ipos( remainder ? prevMultiple( N, SIMDSIZE ): N );
-   BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+   const size_t ipos( remainder ? begin + prevMultiple( end-begin, SIMDSIZE ) : end );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
 
    SIMDTrait_t<MultType> xmm1, xmm2, xmm3, xmm4;
-   size_t i( 0UL );
+   size_t i( begin );
 
    for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
       xmm1 = xmm1 + ( left.load(i             ) * right.load(i             ) );
@@ -222,9 +331,9 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
       xmm1 = xmm1 + ( left.load(i) * right.load(i) );
    }
 
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+   sp = sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
-   for( ; remainder && i<N; ++i ) {
+   for( ; remainder && i<end; ++i ) {
       sp += left[i] * right[i];
    }
 
@@ -234,6 +343,369 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the scalar product (inner product) of two dense vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function evaluates the two given dense vectors and computes their scalar product. In
+// case the size of the vectors reaches the \a SMP_DVECREDUCE_THRESHOLD and shared memory
+// parallelization is active, the scalar product is computed in parallel (see the smpReduce()
+// function).
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >
+   dvecdvecinner( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( (~lhs).size() );
+
+   if( N == 0UL ) return MultType();
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   const auto kernel = [&left,&right]( size_t begin, size_t end ) {
+      return dvecdvecinner_backend( left, right, begin, end );
+   };
+
+   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
+
+   const bool parallel( isSMPReduceActive( N, SMP_DVECREDUCE_THRESHOLD ) );
+
+   return smpReduce<MultType>( N, 1UL, SIMDSIZE, parallel, kernel, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the compensated scalar product of a range of two
+//        dense vectors.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The rounded scalar product and the accumulated rounding errors of the range.
+//
+// This function implements the compensated scalar product of the non-empty index range
+// \f$ [begin..end) \f$ of two dense vectors. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization cannot
+// be applied.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline auto
+   dvecdveccompdot_backend( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs,
+                            size_t begin, size_t end )
+   -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
+                 , CompensatedSum< MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > > >
+{
+   using MultType = MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const VT1& left ( ~lhs );
+   const VT2& right( ~rhs );
+
+   CompensatedSum<MultType> sp;
+   MultType error{};
+
+   for( size_t i=begin; i<end; ++i ) {
+      const MultType product( twoProduct( MultType( left[i] ), MultType( right[i] ), error ) );
+      twoSum( sp.sum, product, sp.error );
+      sp.error += error;
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the compensated scalar product of a range of
+//        two dense vectors.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The rounded scalar product and the accumulated rounding errors of the range.
+//
+// This function implements the performance optimized compensated scalar product of the
+// non-empty index range \f$ [begin..end) \f$ of two dense vectors (Ogita, Rump and Oishi's
+// Dot2 algorithm). Every SIMD lane of two independent accumulators computes the products via
+// the error-free TwoProduct transformation and sums them via the error-free TwoSum
+// transformation. The index \a begin is required to be a multiple of the SIMD width. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization can be applied.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline auto
+   dvecdveccompdot_backend( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs,
+                            size_t begin, size_t end )
+   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
+                , CompensatedSum< MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > > >
+{
+   using MultType = MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >;
+   using SIMDType = SIMDTrait_t<MultType>;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
+   constexpr bool remainder( !IsPadded_v<VT1> || !IsPadded_v<VT2> );
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const VT1& left ( ~lhs );
+   const VT2& right( ~rhs );
+
+   const size_t ipos( remainder ? begin + prevMultiple( end-begin, SIMDSIZE ) : end );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
+
+   SIMDType xmm1, xmm2, err1, err2, tmp1, tmp2;
+   size_t i( begin );
+
+   for( ; (i+SIMDSIZE) < ipos; i+=SIMDSIZE*2UL ) {
+      const SIMDType p1( twoProduct( SIMDType( left.load(i) ), SIMDType( right.load(i) ), tmp1 ) );
+      const SIMDType p2( twoProduct( SIMDType( left.load(i+SIMDSIZE) ),
+                                     SIMDType( right.load(i+SIMDSIZE) ), tmp2 ) );
+      twoSum( xmm1, p1, err1 );
+      twoSum( xmm2, p2, err2 );
+      err1 += tmp1;
+      err2 += tmp2;
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      const SIMDType p1( twoProduct( SIMDType( left.load(i) ), SIMDType( right.load(i) ), tmp1 ) );
+      twoSum( xmm1, p1, err1 );
+      err1 += tmp1;
+   }
+
+   CompensatedSum<MultType> sp;
+
+   for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+      twoSum( sp.sum, xmm1[k], sp.error );
+      twoSum( sp.sum, xmm2[k], sp.error );
+   }
+
+   sp.error += sum( err1 + err2 );
+
+   MultType error{};
+
+   for( ; remainder && i<end; ++i ) {
+      const MultType product( twoProduct( MultType( left[i] ), MultType( right[i] ), error ) );
+      twoSum( sp.sum, product, sp.error );
+      sp.error += error;
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the pairwise scalar product of a range of two dense vectors.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The scalar product of the given range.
+//
+// This function recursively splits the non-empty index range \f$ [begin..end) \f$ into two
+// halves until the range contains at most 128 SIMD vectors, which are processed by the (SIMD)
+// scalar product kernel. The index \a begin is required to be a multiple of the SIMD width.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >
+   dvecdvecpairdot_backend( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs,
+                            size_t begin, size_t end )
+{
+   using MultType = MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<MultType>::size );
+   constexpr size_t BLOCKSIZE( SIMDSIZE*128UL );
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~lhs).size(), "Invalid index range" );
+
+   if( end - begin <= BLOCKSIZE ) {
+      return dvecdvecinner_backend( ~lhs, ~rhs, begin, end );
+   }
+
+   const size_t mid( begin + prevMultiple( ( end - begin ) / 2UL, SIMDSIZE ) );
+
+   return dvecdvecpairdot_backend( ~lhs, ~rhs, begin, mid ) +
+          dvecdvecpairdot_backend( ~lhs, ~rhs, mid, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compensated scalar product of two dense vectors with floating point elements.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function evaluates the two given dense vectors and computes their scalar product via the
+// compensated summation of the exact products. In case the size of the vectors reaches the
+// \a SMP_DVECREDUCE_THRESHOLD and shared memory parallelization is active, the partial results
+// of all blocks are combined without losing their rounding errors (see the smpReduce() function).
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT1      // Type of the left-hand side dense vector
+        , bool TF1          // Transpose flag of the left-hand side dense vector
+        , typename VT2      // Type of the right-hand side dense vector
+        , bool TF2 >        // Transpose flag of the right-hand side dense vector
+inline auto dvecdvecdot( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+   -> EnableIf_t< SF == compensated &&
+                  IsFloatingPoint_v< MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+                , MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using MultType = MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( (~lhs).size() );
+
+   if( N == 0UL ) return MultType();
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   const auto kernel = [&left,&right]( size_t begin, size_t end ) {
+      return dvecdveccompdot_backend( left, right, begin, end );
+   };
+
+   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
+
+   const bool parallel( isSMPReduceActive( N, SMP_DVECREDUCE_THRESHOLD ) );
+
+   const CompensatedSum<MultType> sp(
+      smpReduce< CompensatedSum<MultType> >( N, 1UL, SIMDSIZE, parallel, kernel, Add() ) );
+
+   return sp.value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pairwise scalar product of two dense vectors with floating point elements.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function evaluates the two given dense vectors and computes their scalar product via the
+// pairwise summation of the products. In case the size of the vectors reaches the
+// \a SMP_DVECREDUCE_THRESHOLD and shared memory parallelization is active, every block is
+// summed pairwise (see the smpReduce() function).
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT1      // Type of the left-hand side dense vector
+        , bool TF1          // Transpose flag of the left-hand side dense vector
+        , typename VT2      // Type of the right-hand side dense vector
+        , bool TF2 >        // Transpose flag of the right-hand side dense vector
+inline auto dvecdvecdot( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+   -> EnableIf_t< SF == pairwise &&
+                  IsFloatingPoint_v< MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+                , MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using MultType = MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( (~lhs).size() );
+
+   if( N == 0UL ) return MultType();
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   const auto kernel = [&left,&right]( size_t begin, size_t end ) {
+      return dvecdvecpairdot_backend( left, right, begin, end );
+   };
+
+   constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
+
+   const bool parallel( isSMPReduceActive( N, SMP_DVECREDUCE_THRESHOLD ) );
+
+   return smpReduce<MultType>( N, 1UL, SIMDSIZE, parallel, kernel, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar product of two dense vectors with non-floating point elements.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// For integral and complex element types the compensated and the pairwise scalar product fall
+// back to the default scalar product.
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT1      // Type of the left-hand side dense vector
+        , bool TF1          // Transpose flag of the left-hand side dense vector
+        , typename VT2      // Type of the right-hand side dense vector
+        , bool TF2 >        // Transpose flag of the right-hand side dense vector
+inline auto dvecdvecdot( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+   -> DisableIf_t< IsFloatingPoint_v< MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+                 , MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   return dvecdvecinner( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
 //        (\f$ s=\vec{a}*\vec{b} \f$).
@@ -275,6 +747,61 @@ inline decltype(auto)
 }
 //*************************************************************************************************
 
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the scalar product of two dense vectors by means of the given summation
+//        algorithm.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the scalar product.
+// \param rhs The right-hand side dense vector for the scalar product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the scalar product (inner product) of two dense vectors by means of
+// the pairwise or the compensated summation (see the SummationFlag):
+
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+
+   const double s1 = dot<blaze::pairwise>( a, b );
+   const double s2 = dot<blaze::compensated>( a, b );
+   \endcode
+
+// Both algorithms are vectorized and parallelized in the same way as the default scalar product.
+// The compensated scalar product computes every product and every addition without rounding
+// error (Dot2 algorithm), which results in an accuracy close to twice the working precision. For
+// vectors with integral or complex elements both flags result in the default scalar product.
+// In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT1      // Type of the left-hand side dense vector
+        , bool TF1          // Transpose flag of the left-hand side dense vector
+        , typename VT2      // Type of the right-hand side dense vector
+        , bool TF2 >        // Transpose flag of the right-hand side dense vector
+inline decltype(auto) dot( const DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return dvecdvecdot<SF>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
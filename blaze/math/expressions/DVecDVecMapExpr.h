@@ -63,6 +63,8 @@
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Or.h>
 #include <blaze/math/functors/Pow.h>
+#include <blaze/math/functors/Select.h>
+#include <blaze/math/functors/SelectIf.h>
 #include <blaze/math/functors/ShiftLV.h>
 #include <blaze/math/functors/ShiftRV.h>
 #include <blaze/math/shims/Serial.h>
@@ -1452,10 +1454,10 @@ inline decltype(auto)
 // according element of \a lhs is selected, in case the \a cond element evaluates to \a false, the
 // according element of \a rhs is selected. The function returns an expression representing this
 // operation.\n
-// The following example demonstrates the use of the \a selec() function:
+// The following example demonstrates the use of the \a select() function:
 
    \code
-   blaze::DynamicVector<bool> cond{ true, false, true false };
+   blaze::DynamicVector<bool> cond{ true, false, true, false };
    blaze::DynamicVector<int> a{ 1, -1, 1, -1 };
    blaze::DynamicVector<int> b{ -2, 2, -2, 2 };
    blaze::DynamicVector<int> c;
@@ -1476,7 +1478,7 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
-   return map( cond, lhs, rhs, []( bool c, const auto& a, const auto& b ) { return c ? a : b; } );
+   return map( ~cond, ~lhs, ~rhs, Select() );
 }
 //*************************************************************************************************
 
@@ -1656,6 +1658,52 @@ inline decltype(auto)
 
 
 
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Elementwise conditional selection of values from the dense vectors \a lhs and \a rhs
+//        based on an elementwise comparison
+//        (\f$ \vec{a}=select(\vec{b}<\vec{c},\vec{d},\vec{e}) \f$).
+// \ingroup dense_vector
+//
+// \param cond The dense vector map expression representing the selection conditions.
+// \param lhs The true-case dense vector.
+// \param rhs The false-case dense vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function implements a performance optimized treatment of the elementwise conditional
+// selection based on a binary map expression (as for instance an elementwise comparison). The
+// binary operation and the selection are fused into a single 4-ary operation, which enables
+// the vectorization of the complete selection in case all operands have the same floating
+// point element type.
+*/
+template< typename VT1   // Type of the left-hand side operand of the condition
+        , typename VT2   // Type of the right-hand side operand of the condition
+        , typename OP    // Type of the binary predicate
+        , typename VT3   // Type of the true-case dense vector
+        , typename VT4   // Type of the false-case dense vector
+        , bool TF >      // Transpose flag
+inline decltype(auto)
+   select( const DVecDVecMapExpr<VT1,VT2,OP,TF>& cond,
+           const DenseVector<VT3,TF>& lhs, const DenseVector<VT4,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( cond.leftOperand(), cond.rightOperand(), ~lhs, ~rhs,
+               SelectIf<OP>( cond.operation() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL RESTRUCTURING BINARY ARITHMETIC OPERATORS
@@ -47,19 +47,26 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/VecVecSubExpr.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/VecVecSubExpr.h>
+#include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDMaskload.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsStatic.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/system/HostDevice.h>
@@ -72,6 +79,7 @@
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -153,6 +161,49 @@ class DVecDVecSubExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Dispatch evaluation strategy****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the runtime dispatched compute
+       kernels (see the BLAZE_USE_RUNTIME_DISPATCH switch). In case neither operand requires an
+       intermediate evaluation and both operands as well as the non-static target vector provide
+       direct access to contiguous elements of the same single or double precision type, the
+       variable is set to 1 and the subtraction is computed by the dispatched kernel. Otherwise
+       the variable is set to 0 and the default strategy is chosen. */
+   template< typename VT >
+   static constexpr bool UseDispatchAssign_v =
+      ( !useAssign && !IsStatic_v<VT> &&
+        IsContiguous_v<VT>  && HasMutableDataAccess_v<VT> &&
+        IsContiguous_v<VT1> && HasConstDataAccess_v<VT1> &&
+        IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> &&
+        IsDispatchable_v< ElementType_t<VT> > &&
+        IsSame_v< ElementType_t<VT>, ET1 > &&
+        IsSame_v< ElementType_t<VT>, ET2 > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Masked evaluation strategy******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the masked SIMD kernel. In case
+       the runtime dispatch is not selected, at least one of the vectors is not padded, and all
+       vectors provide direct access to contiguous elements of the same type, which supports
+       masked SIMD loads and stores, the variable is set to 1 and the remainder of the subtraction
+       is computed by a masked SIMD operation. Otherwise the variable is set to 0 and the
+       default strategy is chosen. */
+   template< typename VT >
+   static constexpr bool UseMaskedAssign_v =
+      ( !useAssign && !UseDispatchAssign_v<VT> &&
+        ( !IsPadded_v<VT> || !IsPadded_v<VT1> || !IsPadded_v<VT2> ) &&
+        IsContiguous_v<VT>  && HasMutableDataAccess_v<VT> &&
+        IsContiguous_v<VT1> && HasConstDataAccess_v<VT1> &&
+        IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> &&
+        HasSIMDMaskload_v< ElementType_t<VT> > && HasSIMDSub_v<ET1,ET2> &&
+        IsSame_v< ElementType_t<VT>, ET1 > &&
+        IsSame_v< ElementType_t<VT>, ET2 > );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DVecDVecSubExpr<VT1,VT2,TF>;  //!< Type of this DVecDVecSubExpr instance.
@@ -632,6 +683,95 @@ class DVecDVecSubExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Dispatched assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Dispatched assignment of a dense vector-dense vector subtraction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense vector-dense vector subtraction expression
+   // to a dense vector via the compute kernel for the instruction set selected at runtime. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected by
+   // the compiler in case the runtime dispatch is active and all vectors provide direct access to
+   // contiguous single or double precision elements. In case the CPU does not provide a more
+   // capable instruction set than the one selected at compile time, the subtraction is computed by
+   // the default SIMD kernel of the target vector.
+   */
+   template< typename VT >  // Type of the target dense vector
+   friend inline auto assign( DenseVector<VT,TF>& lhs, const DVecDVecSubExpr& rhs )
+      -> EnableIf_t< UseDispatchAssign_v<VT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( const auto* kernels = getKernelTable<ET1>() ) {
+         kernels->sub( rhs.size(), rhs.lhs_.data(), rhs.rhs_.data(), (~lhs).data() );
+      }
+      else {
+         (~lhs).assign( rhs );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Masked assignment to dense vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Masked assignment of a dense vector-dense vector subtraction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense vector-dense vector subtraction expression
+   // to a dense vector in case at least one of the vectors is not padded. The remaining elements
+   // behind the last full SIMD vector are computed by a masked SIMD operation instead of a scalar
+   // loop. Due to the explicit application of the SFINAE principle, this function can only be
+   // selected by the compiler in case all vectors provide direct access to contiguous elements
+   // of a data type that supports masked SIMD loads and stores.
+   */
+   template< typename VT >  // Type of the target dense vector
+   friend inline auto assign( DenseVector<VT,TF>& lhs, const DVecDVecSubExpr& rhs )
+      -> EnableIf_t< UseMaskedAssign_v<VT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t N( rhs.size() );
+
+      const size_t ipos( prevMultiple( N, SIMDSIZE ) );
+      BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+
+      const size_t i4way( prevMultiple( N, SIMDSIZE*4UL ) );
+      BLAZE_INTERNAL_ASSERT( i4way <= ipos, "Invalid end calculation" );
+
+      const ET1* a( rhs.lhs_.data() );
+      const ET2* b( rhs.rhs_.data() );
+      ElementType_t<VT>* c( (~lhs).data() );
+
+      size_t i( 0UL );
+
+      for( ; i<i4way; i+=SIMDSIZE*4UL ) {
+         storeu( c+i             , loadu( a+i              ) - loadu( b+i              ) );
+         storeu( c+i+SIMDSIZE    , loadu( a+i+SIMDSIZE     ) - loadu( b+i+SIMDSIZE     ) );
+         storeu( c+i+SIMDSIZE*2UL, loadu( a+i+SIMDSIZE*2UL ) - loadu( b+i+SIMDSIZE*2UL ) );
+         storeu( c+i+SIMDSIZE*3UL, loadu( a+i+SIMDSIZE*3UL ) - loadu( b+i+SIMDSIZE*3UL ) );
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         storeu( c+i, loadu( a+i ) - loadu( b+i ) );
+      }
+      if( i < N ) {
+         maskstore( c+i, maskload( a+i, N-i ) - maskload( b+i, N-i ), N-i );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense vector-dense vector subtraction to a sparse vector.
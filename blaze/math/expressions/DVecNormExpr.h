@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -63,6 +64,7 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelReduce.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -70,6 +72,7 @@
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
@@ -133,51 +136,48 @@ struct DVecNormHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the norm of a dense vector.
+/*!\brief Default backend implementation of the power sum of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the norm computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given vector.
+// \return The sum of the powers of the absolute values of the elements in the given range.
 //
-// This function implements the performance optimized norm of a dense vector. Due to the
-// explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization cannot be applied.
+// This function implements the performance optimized power sum of the non-empty index range
+// \f$ [begin..end) \f$ of a dense vector. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization cannot
+// be applied.
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
         , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root, FalseType )
+        , typename Power > // Type of the power operation
+inline ElementType_t<VT>
+   norm_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end, Abs abs, Power power,
+                 FalseType )
 {
-   using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
-
-   if( (~dv).size() == 0UL ) return RT();
-
-   CT tmp( ~dv );
 
-   const size_t N( tmp.size() );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
 
-   ET norm( power( abs( tmp[0UL] ) ) );
-   size_t i( 1UL );
+   ET norm( power( abs( (~dv)[begin] ) ) );
+   size_t i( begin+1UL );
 
-   for( ; (i+4UL) <= N; i+=4UL ) {
-      norm += power( abs( tmp[i    ] ) ) + power( abs( tmp[i+1UL] ) ) +
-              power( abs( tmp[i+2UL] ) ) + power( abs( tmp[i+3UL] ) );
+   for( ; (i+4UL) <= end; i+=4UL ) {
+      norm += power( abs( (~dv)[i    ] ) ) + power( abs( (~dv)[i+1UL] ) ) +
+              power( abs( (~dv)[i+2UL] ) ) + power( abs( (~dv)[i+3UL] ) );
    }
-   for( ; (i+2UL) <= N; i+=2UL ) {
-      norm += power( abs( tmp[i] ) ) + power( abs( tmp[i+1UL] ) );
+   for( ; (i+2UL) <= end; i+=2UL ) {
+      norm += power( abs( (~dv)[i] ) ) + power( abs( (~dv)[i+1UL] ) );
    }
-   for( ; i<N; ++i ) {
-      norm += power( abs( tmp[i] ) );
+   for( ; i<end; ++i ) {
+      norm += power( abs( (~dv)[i] ) );
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -185,67 +185,65 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the norm of a dense vector.
+/*!\brief SIMD optimized backend implementation of the power sum of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the norm computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given vector.
+// \return The sum of the powers of the absolute values of the elements in the given range.
 //
-// This function implements the performance optimized norm of a dense vector. Due to the
-// explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization can be applied.
+// This function implements the performance optimized power sum of the non-empty index range
+// \f$ [begin..end) \f$ of a dense vector. The index \a begin is required to be a multiple of
+// the SIMD width. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case vectorization can be applied.
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
         , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root, TrueType )
+        , typename Power > // Type of the power operation
+inline ElementType_t<VT>
+   norm_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end, Abs abs, Power power,
+                 TrueType )
 {
-   using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
    static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   if( (~dv).size() == 0UL ) return RT();
-
-   CT tmp( ~dv );
-
-   const size_t N( tmp.size() );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
 
-   constexpr bool remainder( !IsPadded_v< RemoveReference_t<VT> > );
+   constexpr bool remainder( !IsPadded_v<VT> );
 
-   const size_t ipos( remainder ? prevMultiple( N, SIMDSIZE ) : N );
-   BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+   const size_t ipos( remainder ? begin + prevMultiple( end-begin, SIMDSIZE ) : end );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
 
    SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
-   size_t i( 0UL );
+   size_t i( begin );
 
    for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
-      xmm1 += power( abs( tmp.load(i             ) ) );
-      xmm2 += power( abs( tmp.load(i+SIMDSIZE    ) ) );
-      xmm3 += power( abs( tmp.load(i+SIMDSIZE*2UL) ) );
-      xmm4 += power( abs( tmp.load(i+SIMDSIZE*3UL) ) );
+      xmm1 += power( abs( (~dv).load(i             ) ) );
+      xmm2 += power( abs( (~dv).load(i+SIMDSIZE    ) ) );
+      xmm3 += power( abs( (~dv).load(i+SIMDSIZE*2UL) ) );
+      xmm4 += power( abs( (~dv).load(i+SIMDSIZE*3UL) ) );
    }
    for( ; (i+SIMDSIZE) < ipos; i+=SIMDSIZE*2UL ) {
-      xmm1 += power( abs( tmp.load(i         ) ) );
-      xmm2 += power( abs( tmp.load(i+SIMDSIZE) ) );
+      xmm1 += power( abs( (~dv).load(i         ) ) );
+      xmm2 += power( abs( (~dv).load(i+SIMDSIZE) ) );
    }
    for( ; i<ipos; i+=SIMDSIZE ) {
-      xmm1 += power( abs( tmp.load(i) ) );
+      xmm1 += power( abs( (~dv).load(i) ) );
    }
 
    ET norm( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
 
-   for( ; remainder && i<N; ++i ) {
-      norm += power( abs( tmp[i] ) );
+   for( ; remainder && i<end; ++i ) {
+      norm += power( abs( (~dv)[i] ) );
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -271,6 +269,10 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
    // ... Resizing and initialization
    const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the size of the vector reaches the \a SMP_DVECREDUCE_THRESHOLD and shared memory
+// parallelization is active, the power sum is computed in parallel (see the smpReduce()
+// function).
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
@@ -279,7 +281,29 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dv, abs, power, root, Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return RT();
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   const auto kernel = [&tmp,&abs,&power]( size_t begin, size_t end ) {
+      return norm_backend( tmp, begin, end, abs, power,
+                           Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
+   };
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const bool parallel( isSMPReduceActive( N, SMP_DVECREDUCE_THRESHOLD ) );
+   const ET norm( smpReduce<ET>( N, 1UL, SIMDSIZE, parallel, kernel, Add() ) );
+
+   return evaluate( root( norm ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CompensatedSum.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Max.h>
@@ -48,15 +50,22 @@
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/SummationFlag.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasLoad.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsStatic.h>
 #include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -95,6 +104,24 @@ struct DVecReduceExprHelper
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatch of the dense vector summation.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Type of the dense vector
+struct DVecReduceDispatchHelper
+{
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( !IsStatic_v<VT> && IsContiguous_v<VT> && HasConstDataAccess_v<VT> &&
+        IsDispatchable_v< ElementType_t<VT> > );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -105,49 +132,46 @@ struct DVecReduceExprHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the reduction of a dense vector.
+/*!\brief Default backend implementation of the reduction of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the reduction computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense vector. Due
-// to the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization cannot be applied.
+// This function implements the performance optimized reduction operation for the non-empty
+// index range \f$ [begin..end) \f$ of a dense vector. Due to the explicit application of the
+// SFINAE principle, this function can only be selected by the compiler in case vectorization
+// cannot be applied.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+inline auto dvecreduce_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op )
    -> DisableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
-   using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
 
-   const size_t N( (~dv).size() );
-
-   if( N == 0UL ) return ET{};
-   if( N == 1UL ) return (~dv)[0UL];
-
-   CT tmp( ~dv );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
 
-   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+   if( begin+1UL == end ) return (~dv)[begin];
 
-   ET redux1( tmp[0UL] );
-   ET redux2( tmp[1UL] );
-   size_t i( 2UL );
+   ET redux1( (~dv)[begin    ] );
+   ET redux2( (~dv)[begin+1UL] );
+   size_t i( begin+2UL );
 
-   for( ; (i+4UL) <= N; i+=4UL ) {
-      redux1 = op( op( redux1, tmp[i    ] ), tmp[i+1UL] );
-      redux2 = op( op( redux2, tmp[i+2UL] ), tmp[i+3UL] );
+   for( ; (i+4UL) <= end; i+=4UL ) {
+      redux1 = op( op( redux1, (~dv)[i    ] ), (~dv)[i+1UL] );
+      redux2 = op( op( redux2, (~dv)[i+2UL] ), (~dv)[i+3UL] );
    }
-   for( ; (i+2UL) <= N; i+=2UL ) {
-      redux1 = op( redux1, tmp[i    ] );
-      redux2 = op( redux2, tmp[i+1UL] );
+   for( ; (i+2UL) <= end; i+=2UL ) {
+      redux1 = op( redux1, (~dv)[i    ] );
+      redux2 = op( redux2, (~dv)[i+1UL] );
    }
-   for( ; i<N; ++i ) {
-      redux1 = op( redux1, tmp[i] );
+   for( ; i<end; ++i ) {
+      redux1 = op( redux1, (~dv)[i] );
    }
 
    return op( redux1, redux2 );
@@ -158,71 +182,80 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the reduction of a dense vector.
+/*!\brief SIMD optimized backend implementation of the reduction of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the reduction computation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense vector. Due
-// to the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization can be applied.
+// This function implements the performance optimized reduction operation for the non-empty
+// index range \f$ [begin..end) \f$ of a dense vector. The index \a begin is required to be a
+// multiple of the SIMD width. Due to the explicit application of the SFINAE principle, this
+// function can only be selected by the compiler in case vectorization can be applied.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+inline auto dvecreduce_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end, OP op )
    -> EnableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
-   using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
 
-   const size_t N( (~dv).size() );
-
-   if( N == 0UL ) return ET{};
-
-   CT tmp( ~dv );
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
 
-   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
 
-   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+   const size_t N( end - begin );
 
    ET redux{};
 
    if( N >= SIMDSIZE )
    {
-      const size_t ipos( prevMultiple( N, SIMDSIZE ) );
-      BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+      const size_t ipos( begin + prevMultiple( N, SIMDSIZE ) );
+      BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
 
-      SIMDTrait_t<ET> xmm1( tmp.load(0UL) );
+      SIMDTrait_t<ET> xmm1( (~dv).load(begin) );
 
-      if( N >= SIMDSIZE*2UL )
+      if( N >= SIMDSIZE*4UL )
       {
-         SIMDTrait_t<ET> xmm2( tmp.load(SIMDSIZE) );
-         size_t i( SIMDSIZE*2UL );
-
-         for( ; (i+SIMDSIZE) < ipos; i+=SIMDSIZE*2UL ) {
-            xmm1 = op( xmm1, tmp.load(i         ) );
-            xmm2 = op( xmm2, tmp.load(i+SIMDSIZE) );
+         SIMDTrait_t<ET> xmm2( (~dv).load(begin+SIMDSIZE    ) );
+         SIMDTrait_t<ET> xmm3( (~dv).load(begin+SIMDSIZE*2UL) );
+         SIMDTrait_t<ET> xmm4( (~dv).load(begin+SIMDSIZE*3UL) );
+         size_t i( begin+SIMDSIZE*4UL );
+
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            xmm1 = op( xmm1, (~dv).load(i             ) );
+            xmm2 = op( xmm2, (~dv).load(i+SIMDSIZE    ) );
+            xmm3 = op( xmm3, (~dv).load(i+SIMDSIZE*2UL) );
+            xmm4 = op( xmm4, (~dv).load(i+SIMDSIZE*3UL) );
          }
          for( ; i<ipos; i+=SIMDSIZE ) {
-            xmm1 = op( xmm1, tmp.load(i) );
+            xmm1 = op( xmm1, (~dv).load(i) );
          }
 
-         xmm1 = op( xmm1, xmm2 );
+         xmm1 = op( op( xmm1, xmm2 ), op( xmm3, xmm4 ) );
+      }
+      else
+      {
+         for( size_t i=begin+SIMDSIZE; i<ipos; i+=SIMDSIZE ) {
+            xmm1 = op( xmm1, (~dv).load(i) );
+         }
       }
 
       redux = reduce( xmm1, op );
 
-      for( size_t i=ipos; i<N; ++i ) {
-         redux = op( redux, tmp[i] );
+      for( size_t i=ipos; i<end; ++i ) {
+         redux = op( redux, (~dv)[i] );
       }
    }
    else {
-      redux = tmp[0UL];
-      for( size_t i=1UL; i<N; ++i ) {
-         redux = op( redux, tmp[i] );
+      redux = (~dv)[begin];
+      for( size_t i=begin+1UL; i<end; ++i ) {
+         redux = op( redux, (~dv)[i] );
       }
    }
 
@@ -234,20 +267,154 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the summation of a dense vector.
+/*!\brief Runtime dispatched summation of a range of a dense vector.
 // \ingroup dense_vector
 //
 // \param dv The given dense vector for the summation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \param redux The resulting sum.
+// \return \a true in case the sum has been computed by a dispatched kernel, \a false if not.
+//
+// This function computes the sum of the non-empty index range \f$ [begin..end) \f$ of a dense
+// vector via the kernel for the instruction set selected at runtime (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch). Due to the explicit application of the SFINAE principle,
+// this function can only be selected by the compiler in case the dense vector provides direct
+// access to contiguous single or double precision elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dvecsum_dispatch( const DenseVector<VT,TF>& dv, size_t begin, size_t end,
+                              ElementType_t<VT>& redux )
+   -> EnableIf_t< DVecReduceDispatchHelper<VT>::value, bool >
+{
+   const auto* kernels( getKernelTable< ElementType_t<VT> >() );
+
+   if( kernels == nullptr )
+      return false;
+
+   redux = kernels->sum( end - begin, (~dv).data() + begin );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched summation of a range of a dense vector.
+// \ingroup dense_vector
+//
+// \return \a false.
+//
+// This function is selected in case the given dense vector cannot be summed by a dispatched
+// kernel.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dvecsum_dispatch( const DenseVector<VT,TF>& /*dv*/, size_t /*begin*/, size_t /*end*/,
+                              ElementType_t<VT>& /*redux*/ )
+   -> DisableIf_t< DVecReduceDispatchHelper<VT>::value, bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the summation of a range of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
 // \return The result of the summation.
 //
-// This function implements the performance optimized summation for a dense vector. Due to
-// the explicit application of the SFINAE principle, this function can only be selected by
-// the compiler in case vectorization can be applied.
+// This function implements the performance optimized summation for the non-empty index range
+// \f$ [begin..end) \f$ of a dense vector. The index \a begin is required to be a multiple of the
+// SIMD width. Due to the explicit application of the SFINAE principle, this function can only
+// be selected by the compiler in case vectorization can be applied.
 */
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
+inline auto dvecreduce_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end, Add /*op*/ )
    -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value, ElementType_t<VT> >
+{
+   using ET = ElementType_t<VT>;
+
+   constexpr bool remainder( !IsPadded_v<VT> );
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
+
+   const size_t N( end - begin );
+
+   ET redux{};
+
+   if( dvecsum_dispatch( ~dv, begin, end, redux ) ) {
+      return redux;
+   }
+
+   if( !remainder || N >= SIMDSIZE )
+   {
+      const size_t ipos( remainder ? begin + prevMultiple( N, SIMDSIZE ) : end );
+      BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
+
+      SIMDTrait_t<ET> xmm1( (~dv).load(begin) );
+      SIMDTrait_t<ET> xmm2, xmm3, xmm4;
+      size_t i( begin+SIMDSIZE );
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         xmm1 += (~dv).load(i             );
+         xmm2 += (~dv).load(i+SIMDSIZE    );
+         xmm3 += (~dv).load(i+SIMDSIZE*2UL);
+         xmm4 += (~dv).load(i+SIMDSIZE*3UL);
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         xmm1 += (~dv).load(i);
+      }
+
+      redux = sum( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) );
+
+      for( ; remainder && i<end; ++i ) {
+         redux += (~dv)[i];
+      }
+   }
+   else {
+      redux = (~dv)[begin];
+      for( size_t i=begin+1UL; i<end; ++i ) {
+         redux += (~dv)[i];
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function evaluates the given dense vector and reduces it by means of the given reduction
+// operation. In case the size of the vector reaches the \a SMP_DVECREDUCE_THRESHOLD and shared
+// memory parallelization is active, the vector is split into one block per thread, each thread
+// reduces its block by the serial (SIMD) kernel and the partial results are combined in block
+// order (see the smpReduce() function).
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<VT> dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 {
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
@@ -260,45 +427,118 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 
    BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
 
-   constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
-   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+   const auto kernel = [&tmp,&op]( size_t begin, size_t end ) {
+      return dvecreduce_backend( tmp, begin, end, op );
+   };
 
-   ET redux{};
+   const bool parallel( isSMPReduceActive( N, SMP_DVECREDUCE_THRESHOLD ) );
 
-   if( !remainder || N >= SIMDSIZE )
-   {
-      const size_t ipos( remainder ? prevMultiple( N, SIMDSIZE ) : N );
-      BLAZE_INTERNAL_ASSERT( ipos <= N, "Invalid end calculation" );
+   return smpReduce<ET>( N, 1UL, SIMDTrait<ET>::size, parallel, kernel, op );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      SIMDTrait_t<ET> xmm1( tmp.load(0UL) );
 
-      if( remainder ? N >= SIMDSIZE*2UL : N > SIMDSIZE )
-      {
-         SIMDTrait_t<ET> xmm2( tmp.load(SIMDSIZE) );
-         size_t i( SIMDSIZE*2UL );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the compensated summation of a range of a dense
+//        vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The rounded sum and the accumulated rounding errors of the range.
+//
+// This function implements the compensated summation for the non-empty index range
+// \f$ [begin..end) \f$ of a dense vector. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization cannot
+// be applied.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dveccompsum_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end )
+   -> DisableIf_t< DVecReduceExprHelper<VT,Add>::value, CompensatedSum< ElementType_t<VT> > >
+{
+   using ET = ElementType_t<VT>;
 
-         for( ; (i+SIMDSIZE) < ipos; i+=SIMDSIZE*2UL ) {
-            xmm1 += tmp.load(i         );
-            xmm2 += tmp.load(i+SIMDSIZE);
-         }
-         for( ; i<ipos; i+=SIMDSIZE ) {
-            xmm1 += tmp.load(i);
-         }
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
 
-         xmm1 += xmm2;
-      }
+   CompensatedSum<ET> redux{ (~dv)[begin], ET{} };
 
-      redux = sum( xmm1 );
+   for( size_t i=begin+1UL; i<end; ++i ) {
+      twoSum( redux.sum, ET( (~dv)[i] ), redux.error );
+   }
 
-      for( size_t i=ipos; remainder && i<N; ++i ) {
-         redux += tmp[i];
-      }
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the compensated summation of a range of a
+//        dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The rounded sum and the accumulated rounding errors of the range.
+//
+// This function implements the performance optimized compensated summation for the non-empty
+// index range \f$ [begin..end) \f$ of a dense vector. The index \a begin is required to be a
+// multiple of the SIMD width. Every SIMD lane of four independent accumulators sums its elements
+// via the error-free TwoSum transformation, the lanes are combined in a fixed order. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization can be applied.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dveccompsum_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end )
+   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value, CompensatedSum< ElementType_t<VT> > >
+{
+   using ET = ElementType_t<VT>;
+
+   constexpr bool remainder( !IsPadded_v<VT> );
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid range alignment" );
+
+   const size_t ipos( remainder ? begin + prevMultiple( end-begin, SIMDSIZE ) : end );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
+
+   using SIMDType = SIMDTrait_t<ET>;
+
+   SIMDType xmm1, xmm2, xmm3, xmm4;
+   SIMDType err1, err2, err3, err4;
+   size_t i( begin );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      twoSum( xmm1, SIMDType( (~dv).load(i             ) ), err1 );
+      twoSum( xmm2, SIMDType( (~dv).load(i+SIMDSIZE    ) ), err2 );
+      twoSum( xmm3, SIMDType( (~dv).load(i+SIMDSIZE*2UL) ), err3 );
+      twoSum( xmm4, SIMDType( (~dv).load(i+SIMDSIZE*3UL) ), err4 );
    }
-   else {
-      redux = tmp[0UL];
-      for( size_t i=1UL; i<N; ++i ) {
-         redux += tmp[i];
-      }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      twoSum( xmm1, SIMDType( (~dv).load(i) ), err1 );
+   }
+
+   CompensatedSum<ET> redux;
+
+   for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+      twoSum( redux.sum, xmm1[k], redux.error );
+      twoSum( redux.sum, xmm2[k], redux.error );
+      twoSum( redux.sum, xmm3[k], redux.error );
+      twoSum( redux.sum, xmm4[k], redux.error );
+   }
+
+   redux.error += sum( ( err1 + err2 ) + ( err3 + err4 ) );
+
+   for( ; remainder && i<end; ++i ) {
+      twoSum( redux.sum, ET( (~dv)[i] ), redux.error );
    }
 
    return redux;
@@ -307,6 +547,147 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the pairwise summation of a range of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return The result of the summation.
+//
+// This function recursively splits the non-empty index range \f$ [begin..end) \f$ into two
+// halves until the range contains at most 128 SIMD vectors, which are summed by the (SIMD)
+// summation kernel. The index \a begin is required to be a multiple of the SIMD width.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ElementType_t<VT>
+   dvecpairsum_backend( const DenseVector<VT,TF>& dv, size_t begin, size_t end )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<VT> >::size );
+   constexpr size_t BLOCKSIZE( SIMDSIZE*128UL );
+
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= (~dv).size(), "Invalid index range" );
+
+   if( end - begin <= BLOCKSIZE ) {
+      return dvecreduce_backend( ~dv, begin, end, Add() );
+   }
+
+   const size_t mid( begin + prevMultiple( ( end - begin ) / 2UL, SIMDSIZE ) );
+
+   return dvecpairsum_backend( ~dv, begin, mid ) + dvecpairsum_backend( ~dv, mid, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compensated summation of a dense vector with floating point elements.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \return The result of the summation.
+//
+// This function evaluates the given dense vector and computes its sum via the compensated
+// summation. In case the size of the vector reaches the \a SMP_DVECREDUCE_THRESHOLD and shared
+// memory parallelization is active, the partial results of all blocks are combined without
+// losing their rounding errors (see the smpReduce() function).
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+inline auto dvecsum( const DenseVector<VT,TF>& dv )
+   -> EnableIf_t< SF == compensated && IsFloatingPoint_v< ElementType_t<VT> >, ElementType_t<VT> >
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET{};
+
+   CT tmp( ~dv );
+
+   const auto kernel = [&tmp]( size_t begin, size_t end ) {
+      return dveccompsum_backend( tmp, begin, end );
+   };
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const bool parallel( isSMPReduceActive( N, SMP_DVECREDUCE_THRESHOLD ) );
+
+   return smpReduce< CompensatedSum<ET> >( N, 1UL, SIMDSIZE, parallel, kernel, Add() ).value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pairwise summation of a dense vector with floating point elements.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \return The result of the summation.
+//
+// This function evaluates the given dense vector and computes its sum via the pairwise
+// summation. In case the size of the vector reaches the \a SMP_DVECREDUCE_THRESHOLD and shared
+// memory parallelization is active, every block is summed pairwise (see the smpReduce()
+// function).
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+inline auto dvecsum( const DenseVector<VT,TF>& dv )
+   -> EnableIf_t< SF == pairwise && IsFloatingPoint_v< ElementType_t<VT> >, ElementType_t<VT> >
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET{};
+
+   CT tmp( ~dv );
+
+   const auto kernel = [&tmp]( size_t begin, size_t end ) {
+      return dvecpairsum_backend( tmp, begin, end );
+   };
+
+   const bool parallel( isSMPReduceActive( N, SMP_DVECREDUCE_THRESHOLD ) );
+
+   return smpReduce<ET>( N, 1UL, SIMDTrait<ET>::size, parallel, kernel, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Summation of a dense vector with non-floating point elements.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \return The result of the summation.
+//
+// For integral and complex element types the compensated and the pairwise summation fall back
+// to the default summation.
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+inline auto dvecsum( const DenseVector<VT,TF>& dv )
+   -> DisableIf_t< IsFloatingPoint_v< ElementType_t<VT> >, ElementType_t<VT> >
+{
+   return dvecreduce( ~dv, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Optimized backend implementation of the minimum evaluation of a uniform dense vector.
@@ -420,6 +801,41 @@ inline decltype(auto) sum( const DenseVector<VT,TF>& dv )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Computes the sum of the given dense vector by means of the given summation algorithm.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \return The sum of all elements.
+//
+// This function computes the sum of all elements of the given dense vector \a dv by means of
+// the pairwise or the compensated summation (see the SummationFlag):
+
+   \code
+   blaze::DynamicVector<double> a( 100000000UL );
+   // ... Initialization
+
+   const double s1 = sum<blaze::pairwise>( a );
+   const double s2 = sum<blaze::compensated>( a );
+   \endcode
+
+// Both algorithms are vectorized and parallelized in the same way as the default summation. The
+// compensated summation accumulates the exact rounding errors of all additions, which results
+// in an accuracy close to twice the working precision. For vectors with integral or complex
+// elements both flags result in the default summation.
+*/
+template< SummationFlag SF  // Summation flag
+        , typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+inline decltype(auto) sum( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecsum<SF>( ~dv );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reduces the given dense vector by means of multiplication.
 // \ingroup dense_vector
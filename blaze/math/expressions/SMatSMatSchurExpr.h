@@ -55,6 +55,7 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -335,20 +336,10 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) = l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( const auto& l, const auto& r ) {
+                       (~lhs)(i,l->index()) = l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -390,20 +381,10 @@ class SMatSMatSchurExpr
       // Performing the Schur product
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( const auto& l, const auto& r ) {
+                       (~lhs).append( i, l->index(), l->value() * r->value() );
+                    } );
 
          (~lhs).finalize( i );
       }
@@ -452,20 +433,10 @@ class SMatSMatSchurExpr
       std::vector<size_t> nonzeros( n, 0UL );
       for( size_t i=0UL; i<m; ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               ++nonzeros[l->index()];
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( const auto& l, const auto& ) {
+                       ++nonzeros[l->index()];
+                    } );
       }
 
       // Resizing the left-hand side sparse matrix
@@ -476,20 +447,10 @@ class SMatSMatSchurExpr
       // Performing the Schur product
       for( size_t i=0UL; i<m; ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( const auto& l, const auto& r ) {
+                       (~lhs).append( i, l->index(), l->value() * r->value() );
+                    } );
       }
    }
    /*! \endcond */
@@ -558,20 +519,10 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) += l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( const auto& l, const auto& r ) {
+                       (~lhs)(i,l->index()) += l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -645,20 +596,10 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) -= l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( const auto& l, const auto& r ) {
+                       (~lhs)(i,l->index()) -= l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -732,25 +673,15 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const auto lend( A.end(i) );
-         const auto rend( B.end(i) );
-
-         auto l( A.begin(i) );
-         auto r( B.begin(i) );
-
          size_t j( 0UL );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               for( ; j<l->index(); ++j )
-                  reset( (~lhs)(i,j) );
-               (~lhs)(i,l->index()) *= l->value() * r->value();
-               ++r;
-               ++j;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( const auto& l, const auto& r ) {
+                       for( ; j<l->index(); ++j )
+                          reset( (~lhs)(i,j) );
+                       (~lhs)(i,l->index()) *= l->value() * r->value();
+                       ++j;
+                    } );
 
          for( ; j<(~lhs).columns(); ++j )
             reset( (~lhs)(i,j) );
@@ -45,18 +45,136 @@
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/RowVector.h>
 #include <blaze/math/constraints/SparseVector.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/system/MacroDisable.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBaseOf.h>
+#include <blaze/util/typetraits/IsPointer.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemovePointer.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the runtime dispatch of the sparse vector/dense vector
+//        scalar multiplication.
+// \ingroup sparse_vector
+//
+// The runtime dispatched kernel requires the non-zero elements of the sparse vector to be stored
+// as an array of value-index-pairs (as for instance in case of the CompressedVector and the rows
+// of a row-major CompressedMatrix) and the dense vector to provide direct access to its elements.
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+struct SVecDVecInnerDispatchHelper
+{
+   //**Type definitions****************************************************************************
+   //! Element type of the left-hand side sparse vector.
+   using ET = ElementType_t<VT1>;
+
+   //! Type of the non-zero elements of the left-hand side sparse vector.
+   using PairType = RemoveCV_t< RemovePointer_t< ConstIterator_t<VT1> > >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( IsDispatchable_v<ET> &&
+        IsSame_v< ET, ElementType_t<VT2> > &&
+        IsPointer_v< ConstIterator_t<VT1> > &&
+        IsBaseOf_v< ValueIndexPair<ET>, PairType > &&
+        sizeof( ValueIndexPair<ET> ) == sizeof( PairType ) &&
+        IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched scalar product (inner product) of a sparse and a dense vector.
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side sparse vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \param sp The resulting scalar product.
+// \return \a true if the scalar product has been computed by a dispatched kernel, \a false if not.
+//
+// This function computes the scalar product of a sparse and a dense vector via the kernel for
+// the instruction set selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH switch). Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the non-zero elements of the sparse vector are stored as an array of
+// value-index-pairs and the dense vector provides direct access to its elements.
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto svecdvecinner_dispatch( const VT1& lhs, const VT2& rhs, ElementType_t<VT1>& sp )
+   -> EnableIf_t< SVecDVecInnerDispatchHelper<VT1,VT2>::value, bool >
+{
+   const auto* kernels( getKernelTable< ElementType_t<VT1> >() );
+
+   if( kernels == nullptr )
+      return false;
+
+   const ValueIndexPair< ElementType_t<VT1> >* elements( lhs.begin() );
+   sp = kernels->sparseDot( lhs.end() - lhs.begin(), elements, rhs.data() );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched scalar product (inner product) of a sparse and a dense vector.
+// \ingroup sparse_vector
+//
+// \return \a false.
+//
+// This function is selected in case the scalar product of the given sparse and dense vector
+// cannot be computed by a dispatched kernel.
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto svecdvecinner_dispatch( const VT1& /*lhs*/, const VT2& /*rhs*/,
+                                    MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >& /*sp*/ )
+   -> DisableIf_t< SVecDVecInnerDispatchHelper<VT1,VT2>::value, bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL BINARY ARITHMETIC OPERATORS
@@ -126,6 +244,10 @@ inline decltype(auto)
 
    MultType sp{};
 
+   if( svecdvecinner_dispatch( left, right, sp ) ) {
+      return sp;
+   }
+
    if( element != end ) {
       sp = element->value() * right[ element->index() ];
       ++element;
@@ -53,6 +53,7 @@
 #include <blaze/math/expressions/VecVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsTemporary.h>
@@ -272,20 +273,10 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] = l->value() * r->value();
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( const auto& l, const auto& r ) {
+                    (~lhs)[l->index()] = l->value() * r->value();
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -320,20 +311,10 @@ class SVecSVecMultExpr
       (~lhs).reserve( min( x.nonZeros(), y.nonZeros() ) );
 
       // Performing the vector multiplication
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs).append( l->index(), l->value() * r->value() );
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( const auto& l, const auto& r ) {
+                    (~lhs).append( l->index(), l->value() * r->value() );
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -364,20 +345,10 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin() );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] += l->value() * r->value();
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( const auto& l, const auto& r ) {
+                    (~lhs)[l->index()] += l->value() * r->value();
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -412,20 +383,10 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] -= l->value() * r->value();
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( const auto& l, const auto& r ) {
+                    (~lhs)[l->index()] -= l->value() * r->value();
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -460,25 +421,15 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const auto lend( x.end() );
-      const auto rend( y.end() );
-
-      auto l( x.begin()  );
-      auto r( y.begin() );
-
       size_t i( 0UL );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            for( ; i<r->index(); ++i )
-               reset( (~lhs)[i] );
-            (~lhs)[l->index()] *= l->value() * r->value();
-            ++r;
-            ++i;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( const auto& l, const auto& r ) {
+                    for( ; i<r->index(); ++i )
+                       reset( (~lhs)[i] );
+                    (~lhs)[l->index()] *= l->value() * r->value();
+                    ++i;
+                 } );
 
       for( ; i<rhs.size(); ++i )
          reset( (~lhs)[i] );
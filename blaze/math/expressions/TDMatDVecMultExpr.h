@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -179,6 +180,24 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a runtime
+       dispatched kernel (see the BLAZE_USE_RUNTIME_DISPATCH switch), the variable will be set
+       to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseDispatchKernel_v =
+      ( IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsTriangular_v<T2> &&
+        IsDispatchable_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -934,7 +953,7 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based assignment to dense vectors (default)********************************************
+   //**Dispatch-based assignment to dense vectors (default)****************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense matrix-dense vector multiplication
    //        (\f$ \vec{y}=A*\vec{x} \f$).
@@ -948,13 +967,73 @@ class TDMatDVecMultExpr
    // This function relays to the default implementation of the assignment of a large transpose
    // dense matrix-dense vector multiplication expression to a dense vector.
    */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      selectLargeAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dispatch-based assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the transpose dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH
+   // switch). In case the CPU does not provide a more capable instruction set than the one
+   // selected at compile time, the function relays to the default implementation.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      if( const auto* kernels = getKernelTable<ET>() ) {
+         kernels->tgemv( A.rows(), A.columns(), A.data(), A.spacing(),
+                         x.data(), y.data(), ET(1), ET(0) );
+      }
+      else {
+         selectLargeAssignKernel( y, A, x );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**BLAS-based assignment to dense vectors (default)********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the runtime dispatched implementation of the assignment of a large
+   // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
    {
-      selectLargeAssignKernel( y, A, x );
+      selectDispatchAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1543,7 +1622,7 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based addition assignment to dense vectors (default)***********************************
+   //**Dispatch-based addition assignment to dense vectors (default)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense matrix-dense vector multiplication
    //        (\f$ \vec{y}+=A*\vec{x} \f$).
@@ -1557,13 +1636,73 @@ class TDMatDVecMultExpr
    // This function relays to the default implementation of the addition assignment of a large
    // transpose dense matrix-dense vector multiplication expression to a dense vector.
    */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      selectLargeAddAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dispatch-based addition assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the transpose dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH
+   // switch). In case the CPU does not provide a more capable instruction set than the one
+   // selected at compile time, the function relays to the default implementation.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      if( const auto* kernels = getKernelTable<ET>() ) {
+         kernels->tgemv( A.rows(), A.columns(), A.data(), A.spacing(),
+                         x.data(), y.data(), ET(1), ET(1) );
+      }
+      else {
+         selectLargeAddAssignKernel( y, A, x );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**BLAS-based addition assignment to dense vectors (default)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the runtime dispatched implementation of the addition assignment of
+   // a large transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
    {
-      selectLargeAddAssignKernel( y, A, x );
+      selectDispatchAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2129,6 +2268,66 @@ class TDMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Dispatch-based subtraction assignment to dense vectors (default)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a transpose dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a large
+   // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      selectLargeSubAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dispatch-based subtraction assignment to dense vectors**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the transpose dense matrix-dense vector multiplication by means of the
+   // kernel for the instruction set selected at runtime (see the BLAZE_USE_RUNTIME_DISPATCH
+   // switch). In case the CPU does not provide a more capable instruction set than the one
+   // selected at compile time, the function relays to the default implementation.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectDispatchSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      if( const auto* kernels = getKernelTable<ET>() ) {
+         kernels->tgemv( A.rows(), A.columns(), A.data(), A.spacing(),
+                         x.data(), y.data(), ET(-1), ET(1) );
+      }
+      else {
+         selectLargeSubAssignKernel( y, A, x );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (default)********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense matrix-dense vector
@@ -2140,8 +2339,8 @@ class TDMatDVecMultExpr
    // \param x The right-hand side dense vector operand.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a large
-   // transpose dense matrix-dense vector multiplication expression to a dense vector.
+   // This function relays to the runtime dispatched implementation of the subtraction assignment
+   // of a large transpose dense matrix-dense vector multiplication expression to a dense vector.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -2149,7 +2348,7 @@ class TDMatDVecMultExpr
    static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
    {
-      selectLargeSubAssignKernel( y, A, x );
+      selectDispatchSubAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2931,8 +3130,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    //**********************************************************************************************
 
    //**Default assignment to dense vectors (small matrices)****************************************
-   /*!\brief Default assignment of a small scaled transpose dense matrix-dense vector multiplication
-   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   /*!\brief Default assignment of a small scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
    // \param y The target left-hand side dense vector.
@@ -3148,8 +3347,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    //**********************************************************************************************
 
    //**Default assignment to dense vectors (large matrices)****************************************
-   /*!\brief Default assignment of a large scaled transpose dense matrix-dense vector multiplication
-   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   /*!\brief Default assignment of a large scaled transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
    // \param y The target left-hand side dense vector.
@@ -115,7 +115,7 @@ struct Join
    // \return \a true in case SIMD is enabled for the data types \a Args, \a false if not.
    */
    template< typename... Args >
-   static constexpr bool simdEnabled() { return IsSIMDEnabled_v<OP,Args...>; }
+   static constexpr bool simdEnabled() { return UnpackSIMDEnabled<Args...>::value; }
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -154,6 +154,28 @@ struct Join
    //**********************************************************************************************
 
  private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary helper struct for the evaluation of the SIMD support of the wrapped operation.
+   //
+   // The UnpackSIMDEnabled class template evaluates whether the wrapped operation is SIMD-enabled
+   // for the given data types \a Args. Paired data types are recursively unpacked such that the
+   // wrapped operation is queried with the same data types as passed to its \a load() function.
+   */
+   template< typename... Args >
+   struct UnpackSIMDEnabled
+   {
+      static constexpr bool value = IsSIMDEnabled_v<OP,Args...>;
+   };
+
+   template< typename T1, typename T2, typename... Args >
+   struct UnpackSIMDEnabled< std::pair<T1,T2>, Args... >
+   {
+      static constexpr bool value = UnpackSIMDEnabled<T1,T2,Args...>::value;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    OP op_;  //!< The wrapped operation.
    //**********************************************************************************************
@@ -40,6 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/constraints/SIMDPack.h>
+#include <blaze/math/simd/Compare.h>
+#include <blaze/math/typetraits/HasSIMDCompare.h>
 #include <blaze/system/Inline.h>
 
 
@@ -70,6 +73,39 @@ struct Less
       return a < b;
    }
    //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types \a T1 and \a T2.
+   //
+   // \return \a true in case SIMD is enabled for the data types \a T1 and \a T2, \a false if not.
+   */
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return HasSIMDCompare_v<T1,T2>; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operation supports padding, i.e. whether it can deal with zeros.
+   //
+   // \return \a true in case padding is supported, \a false if not.
+   */
+   static constexpr bool paddingEnabled() { return true; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the mask resulting from the less-than comparison of the given SIMD vectors.
+   //
+   // \param a The left-hand side SIMD vector.
+   // \param b The right-hand side SIMD vector.
+   // \return The resulting SIMD mask.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE auto load( const T1& a, const T2& b ) const
+   {
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T1 );
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T2 );
+      return cmplt( a, b );
+   }
+   //**********************************************************************************************
 };
 //*************************************************************************************************
 
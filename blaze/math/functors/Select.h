@@ -0,0 +1,122 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Select.h
+//  \brief Header file for the Select functor
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_SELECT_H_
+#define _BLAZE_MATH_FUNCTORS_SELECT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/SIMDPack.h>
+#include <blaze/math/simd/Blend.h>
+#include <blaze/math/typetraits/HasSIMDBlend.h>
+#include <blaze/math/typetraits/HasSIMDCompare.h>
+#include <blaze/system/Inline.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the conditional selection between two objects/values.
+// \ingroup functors
+//
+// The Select functor represents the elementwise evaluation of \c cond ? \a a : \a b. In case
+// the condition and both operands have the same floating point data type, the selection is
+// vectorized, i.e. all non-zero conditions select the according element of \a a.
+*/
+struct Select
+{
+   //**********************************************************************************************
+   /*!\brief Returns the result of the conditional selection for the given objects/values.
+   //
+   // \param cond The condition.
+   // \param a The object/value selected in case the condition evaluates to \a true.
+   // \param b The object/value selected in case the condition evaluates to \a false.
+   // \return The selected object/value.
+   */
+   template< typename T1, typename T2, typename T3 >
+   BLAZE_ALWAYS_INLINE auto operator()( const T1& cond, const T2& a, const T3& b ) const
+   {
+      return cond ? a : b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types \a T1, \a T2, and \a T3.
+   //
+   // \return \a true in case SIMD is enabled for the given data types, \a false if not.
+   */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool simdEnabled() { return HasSIMDCompare_v<T1,T2> && HasSIMDBlend_v<T2,T3>; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operation supports padding, i.e. whether it can deal with zeros.
+   //
+   // \return \a true in case padding is supported, \a false if not.
+   */
+   static constexpr bool paddingEnabled() { return true; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the conditional selection for the given SIMD vectors.
+   //
+   // \param cond The SIMD vector of conditions.
+   // \param a The SIMD vector providing the elements selected by non-zero conditions.
+   // \param b The SIMD vector providing the elements selected by zero conditions.
+   // \return The result of the conditional selection for the given SIMD vectors.
+   */
+   template< typename T1, typename T2, typename T3 >
+   BLAZE_ALWAYS_INLINE decltype(auto) load( const T1& cond, const T2& a, const T3& b ) const
+   {
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T1 );
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T2 );
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T3 );
+      return select( cond, a, b );
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,147 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/SelectIf.h
+//  \brief Header file for the SelectIf functor
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_SELECTIF_H_
+#define _BLAZE_MATH_FUNCTORS_SELECTIF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/SIMDPack.h>
+#include <blaze/math/simd/Blend.h>
+#include <blaze/math/typetraits/HasSIMDBlend.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the conditional selection based on a binary predicate.
+// \ingroup functors
+//
+// The SelectIf functor represents the elementwise evaluation of \c op( x, y ) ? \a a : \a b,
+// i.e. the fusion of a binary predicate (as for instance the Less or Greater functor) and the
+// subsequent conditional selection into a single 4-ary operation. In case the predicate is
+// SIMD-enabled and all four operands have the same floating point data type, the operation
+// is vectorized.
+*/
+template< typename OP >  // Type of the binary predicate
+struct SelectIf
+{
+ public:
+   //**********************************************************************************************
+   /*!\brief Constructor of the SelectIf functor.
+   //
+   // \param op The wrapped binary predicate.
+   */
+   explicit constexpr SelectIf( const OP& op )
+      : op_( op )  // The wrapped binary predicate.
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the conditional selection for the given objects/values.
+   //
+   // \param x The left-hand side operand of the predicate.
+   // \param y The right-hand side operand of the predicate.
+   // \param a The object/value selected in case the predicate evaluates to \a true.
+   // \param b The object/value selected in case the predicate evaluates to \a false.
+   // \return The selected object/value.
+   */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   BLAZE_ALWAYS_INLINE auto operator()( const T1& x, const T2& y, const T3& a, const T4& b ) const
+   {
+      return op_( x, y ) ? a : b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types.
+   //
+   // \return \a true in case SIMD is enabled for the data types \a T1 to \a T4, \a false if not.
+   */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool simdEnabled() {
+      return IsSIMDEnabled_v<OP,T1,T2> && HasSIMDBlend_v<T3,T4> &&
+             IsSame_v<T1,T2> && IsSame_v<T1,T3>;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operation supports padding, i.e. whether it can deal with zeros.
+   //
+   // \return \a true in case padding is supported, \a false if not.
+   */
+   static constexpr bool paddingEnabled() { return true; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the conditional selection for the given SIMD vectors.
+   //
+   // \param x The left-hand side SIMD vector of the predicate.
+   // \param y The right-hand side SIMD vector of the predicate.
+   // \param a The SIMD vector providing the elements selected by the predicate.
+   // \param b The SIMD vector providing the elements not selected by the predicate.
+   // \return The result of the conditional selection for the given SIMD vectors.
+   */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   BLAZE_ALWAYS_INLINE decltype(auto)
+      load( const T1& x, const T2& y, const T3& a, const T4& b ) const
+   {
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T3 );
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T4 );
+      return select( op_.load( x, y ), a, b );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   OP op_;  //!< The wrapped binary predicate.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,244 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/krylov/BiCGSTAB.h
+//  \brief Header file for the biconjugate gradient stabilized (BiCGSTAB) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_KRYLOV_BICGSTAB_H_
+#define _BLAZE_MATH_KRYLOV_BICGSTAB_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/krylov/FusedKernels.h>
+#include <blaze/math/krylov/Preconditioners.h>
+#include <blaze/math/krylov/SolverSettings.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BICONJUGATE GRADIENT STABILIZED METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Biconjugate gradient stabilized method */
+//@{
+template< typename OP, typename VT1, typename VT2, typename PC = IdentityPreconditioner >
+SolverStatistics bicgstab( const OP& A, DenseVector<VT1,false>& x,
+                           const DenseVector<VT2,false>& b, const PC& M = PC(),
+                           const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2 >
+SolverStatistics bicgstab( const OP& A, DenseVector<VT1,false>& x,
+                           const DenseVector<VT2,false>& b, const SolverSettings& settings );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the general system \f$ A x = b \f$ by means of the right-preconditioned
+//        biconjugate gradient stabilized method.
+// \ingroup krylov
+//
+// \param A The square matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param settings The termination criteria.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+//
+// This function solves the linear system \f$ A x = b \f$ for a general square matrix \a A by
+// means of the BiCGSTAB method. \a A is either a Blaze matrix or any callable object computing
+// \f$ y = A x \f$ when called as \a A(y,x). The optional preconditioner \a M (for instance the
+// IncompleteLU class) is applied from the right, i.e. the residual checked against the tolerance
+// is the true residual of the unpreconditioned system.
+
+   \code
+   blaze::CompressedMatrix<double> A( N, N );
+   blaze::DynamicVector<double> x, b( N );
+   // ... Initialization
+
+   const blaze::IncompleteLU<double> M( A, 1E-4, 10UL );
+   const blaze::SolverStatistics stats( blaze::bicgstab( A, x, b, M ) );
+   \endcode
+
+// Each iteration requires two applications of both the operator and the preconditioner. In case
+// of a breakdown of the method (i.e. a vanishing inner product) the iteration is stopped and the
+// returned statistics report that the iteration has not converged. The vector updates and inner
+// products are fused into combined sweeps, which are executed in parallel for vectors with at
+// least \a BLAZE_SMP_KRYLOV_THRESHOLD elements.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverStatistics bicgstab( const OP& A, DenseVector<VT1,false>& x,
+                           const DenseVector<VT2,false>& b, const PC& M,
+                           const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   constexpr bool identity( IsSame_v<PC,IdentityPreconditioner> );
+
+   SolverStatistics stats;
+
+   const double bnorm( initializeSolution( A, ~x, ~b ) );
+
+   if( bnorm == 0.0 ) {
+      stats.converged = true;
+      return stats;
+   }
+
+   const size_t n( (~b).size() );
+
+   DynamicVector<ET> r( n ), r0, p, v( n ), t( n ), phat, shat;
+
+   computeResidual( A, r, ~b, ~x );
+   ++stats.products;
+
+   stats.residual = std::sqrt( real( innerProduct( r, r ) ) ) / bnorm;
+
+   if( stats.residual <= settings.tolerance ) {
+      stats.converged = true;
+      return stats;
+   }
+
+   if( !identity ) {
+      phat.resize( n, false );
+      shat.resize( n, false );
+   }
+
+   r0 = r;
+   p  = r;
+
+   ET rho( innerProduct( r0, r ) );
+
+   // The residual vector r is reused for the intermediate vector s
+   const DynamicVector<ET>& ph( identity ? p : phat );
+   const DynamicVector<ET>& sh( identity ? r : shat );
+
+   while( stats.iterations < settings.maxIterations )
+   {
+      if( !identity ) M.apply( phat, p );
+
+      applyOperator( A, v, ph );
+      ++stats.products;
+
+      const ET r0v( innerProduct( r0, v ) );
+      if( !isDivisor( r0v ) ) break;
+
+      const ET alpha( rho / r0v );
+      const auto ss( axpyNorm( r, -alpha, v ) );
+
+      ++stats.iterations;
+
+      if( std::sqrt( ss ) / bnorm <= settings.tolerance ) {
+         (~x) += alpha * ph;
+         stats.residual = std::sqrt( ss ) / bnorm;
+         stats.history.push_back( stats.residual );
+         stats.converged = true;
+         break;
+      }
+
+      if( !identity ) M.apply( shat, r );
+
+      applyOperator( A, t, sh );
+      ++stats.products;
+
+      const auto ts( dotNorm( t, r ) );
+      if( !isDivisor( ts[1] ) ) break;
+
+      const ET omega( ts[0] / ts[1] );
+
+      (~x) += alpha * ph + omega * sh;
+
+      const auto rr( axpyNormDot( r, -omega, t, r0 ) );
+
+      stats.residual = std::sqrt( real( rr[0] ) ) / bnorm;
+      stats.history.push_back( stats.residual );
+
+      if( stats.residual <= settings.tolerance ) {
+         stats.converged = true;
+         break;
+      }
+
+      if( !isDivisor( omega ) || !isDivisor( rr[1] ) ) break;
+
+      const ET beta( ( rr[1] / rho ) * ( alpha / omega ) );
+      p = r + beta * ( p - omega * v );
+      rho = rr[1];
+   }
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the general system \f$ A x = b \f$ by means of the unpreconditioned
+//        biconjugate gradient stabilized method.
+// \ingroup krylov
+//
+// \param A The square matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param settings The termination criteria.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverStatistics bicgstab( const OP& A, DenseVector<VT1,false>& x,
+                           const DenseVector<VT2,false>& b, const SolverSettings& settings )
+{
+   return bicgstab( A, x, b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,232 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/krylov/CG.h
+//  \brief Header file for the conjugate gradient (CG) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_KRYLOV_CG_H_
+#define _BLAZE_MATH_KRYLOV_CG_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/krylov/FusedKernels.h>
+#include <blaze/math/krylov/Preconditioners.h>
+#include <blaze/math/krylov/SolverSettings.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Conjugate gradient method */
+//@{
+template< typename OP, typename VT1, typename VT2, typename PC = IdentityPreconditioner >
+SolverStatistics cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                     const PC& M = PC(), const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2 >
+SolverStatistics cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                     const SolverSettings& settings );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the symmetric/Hermitian positive definite system \f$ A x = b \f$ by means of
+//        the preconditioned conjugate gradient method.
+// \ingroup krylov
+//
+// \param A The symmetric/Hermitian positive definite matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param M The symmetric/Hermitian positive definite preconditioner.
+// \param settings The termination criteria.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+//
+// This function solves the linear system \f$ A x = b \f$ for a symmetric (or Hermitian) positive
+// definite matrix \a A by means of the conjugate gradient method. \a A is either a Blaze matrix
+// or any callable object that computes the matrix/vector product \f$ y = A x \f$ when called as
+// \a A(y,x). The optional preconditioner \a M is any object providing the member function
+// \a apply(y,r) computing \f$ y = M^{-1} r \f$, for instance the IncompleteCholesky or the
+// JacobiPreconditioner classes.
+
+   \code
+   blaze::CompressedMatrix<double> A( N, N );
+   blaze::DynamicVector<double> x, b( N );
+   // ... Initialization
+
+   const blaze::IncompleteCholesky<double> M( A );
+   const blaze::SolverStatistics stats( blaze::cg( A, x, b, M ) );
+
+   if( !stats.converged ) { ... }
+   \endcode
+
+// In case the size of \a x does not match the size of \a b, \a x is resized and initialized to
+// zero, otherwise its values are used as initial guess. The iteration stops as soon as the
+// relative residual \f$ \|b - A x\|_2 / \|b\|_2 \f$ drops below the tolerance given by
+// \a settings or when the maximum number of iterations is reached. The returned statistics
+// report whether the iteration has converged.
+//
+// The vector updates and inner products of each iteration are fused into combined sweeps over
+// the vectors: The matrix/vector product \f$ q = A p \f$ is fused with the inner product
+// \f$ p^H q \f$ and the updates \f$ x += \alpha p \f$ and \f$ r -= \alpha q \f$ are fused with
+// the norm of the new residual. For vectors with at least \a BLAZE_SMP_KRYLOV_THRESHOLD elements
+// these sweeps are executed in parallel.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverStatistics cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                     const PC& M, const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   constexpr bool identity( IsSame_v<PC,IdentityPreconditioner> );
+
+   SolverStatistics stats;
+
+   const double bnorm( initializeSolution( A, ~x, ~b ) );
+
+   if( bnorm == 0.0 ) {
+      stats.converged = true;
+      return stats;
+   }
+
+   const size_t n( (~b).size() );
+
+   DynamicVector<ET> r( n ), p( n ), q( n ), z;
+
+   computeResidual( A, r, ~b, ~x );
+   ++stats.products;
+
+   stats.residual = std::sqrt( real( innerProduct( r, r ) ) ) / bnorm;
+
+   if( stats.residual <= settings.tolerance ) {
+      stats.converged = true;
+      return stats;
+   }
+
+   ET rz{};
+
+   if( identity ) {
+      p  = r;
+      rz = innerProduct( r, r );
+   }
+   else {
+      z.resize( n, false );
+      M.apply( z, r );
+      p  = z;
+      rz = innerProduct( r, z );
+   }
+
+   while( stats.iterations < settings.maxIterations )
+   {
+      const ET pq( multDot( A, q, p ) );
+      ++stats.products;
+
+      if( !isDivisor( pq ) ) break;
+
+      const ET alpha( rz / pq );
+      const auto rr( updateSolution( ~x, r, p, q, alpha ) );
+
+      ++stats.iterations;
+      stats.residual = std::sqrt( rr ) / bnorm;
+      stats.history.push_back( stats.residual );
+
+      if( stats.residual <= settings.tolerance ) {
+         stats.converged = true;
+         break;
+      }
+
+      ET rzNew{};
+
+      if( identity ) {
+         rzNew = rr;
+         p = r + ( rzNew / rz ) * p;
+      }
+      else {
+         M.apply( z, r );
+         rzNew = innerProduct( r, z );
+         p = z + ( rzNew / rz ) * p;
+      }
+
+      rz = rzNew;
+   }
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the symmetric/Hermitian positive definite system \f$ A x = b \f$ by means of
+//        the unpreconditioned conjugate gradient method.
+// \ingroup krylov
+//
+// \param A The symmetric/Hermitian positive definite matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param settings The termination criteria.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverStatistics cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                     const SolverSettings& settings )
+{
+   return cg( A, x, b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
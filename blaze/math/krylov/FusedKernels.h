@@ -0,0 +1,529 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/krylov/FusedKernels.h
+//  \brief Header file for the fused vector kernels of the Krylov solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_KRYLOV_FUSEDKERNELS_H_
+#define _BLAZE_MATH_KRYLOV_FUSEDKERNELS_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelReduce.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FUSED REDUCTION LOOP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of vector elements processed at once by the fused Krylov kernels.
+// \ingroup krylov
+//
+// The fused kernels process the vectors in chunks of this size. All operations of a kernel are
+// applied to one chunk before the next chunk is processed, such that the chunk remains in the
+// cache and the vectors are only streamed once from main memory.
+*/
+constexpr size_t KRYLOV_CHUNK_SIZE = 2048UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chunked, potentially parallel reduction loop of the fused Krylov kernels.
+// \ingroup krylov
+//
+// \param n The total number of vector elements.
+// \param op The chunk operation, called as \a op(begin,size) and returning the partial results.
+// \return The sums of the partial results of all chunks.
+//
+// This function splits the range \f$ [0..n) \f$ into chunks of at most \a KRYLOV_CHUNK_SIZE
+// elements and calls the given operation for each chunk. In case the number of elements reaches
+// the \a SMP_KRYLOV_THRESHOLD, the range is first split into one contiguous block per thread.
+// The partial results are combined in a fixed order, i.e. for a given number of threads the
+// result is reproducible. In case the \c BLAZE_SMP_REPRODUCIBLE_REDUCTION switch is enabled, the
+// range is split into blocks of a fixed size instead (see smpReproducibleReduce()), such that
+// the result does not depend on the number of threads.
+//
+// Since the operation may be executed inside a parallel section, it must exclusively use the
+// serial assign functions (assign(), addAssign(), ...) instead of the assignment operators.
+*/
+template< size_t N      // Number of reduction results
+        , typename ST   // Type of the reduction results
+        , typename OP > // Type of the chunk operation
+std::array<ST,N> fusedReduce( size_t n, OP op )
+{
+   const auto chunks = [&op]( size_t begin, size_t end, std::array<ST,N>& sums )
+   {
+      for( size_t i=begin; i<end; i+=KRYLOV_CHUNK_SIZE ) {
+         const std::array<ST,N> partial( op( i, min( KRYLOV_CHUNK_SIZE, end-i ) ) );
+         for( size_t k=0UL; k<N; ++k )
+            sums[k] += partial[k];
+      }
+   };
+
+   if( BLAZE_SMP_REPRODUCIBLE_REDUCTION && n > 0UL )
+   {
+      const auto kernel = [&chunks]( size_t begin, size_t end )
+      {
+         std::array<ST,N> sums{};
+         chunks( begin, end, sums );
+         return sums;
+      };
+
+      const auto combine = []( const std::array<ST,N>& a, const std::array<ST,N>& b )
+      {
+         std::array<ST,N> sums( a );
+         for( size_t k=0UL; k<N; ++k )
+            sums[k] += b[k];
+         return sums;
+      };
+
+      const bool parallel( n >= SMP_KRYLOV_THRESHOLD && getNumThreads() > 1UL );
+
+      return smpReduce< std::array<ST,N> >( n, 1UL, KRYLOV_CHUNK_SIZE, parallel, kernel, combine );
+   }
+
+   std::array<ST,N> result{};
+
+   const size_t blocks( ( n < SMP_KRYLOV_THRESHOLD )?( 1UL ):( min( getNumThreads(), n ) ) );
+
+   if( blocks < 2UL ) {
+      chunks( 0UL, n, result );
+      return result;
+   }
+
+   const size_t elementsPerBlock( n / blocks + ( ( n % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+
+   std::vector< std::array<ST,N> > partial( blocks, std::array<ST,N>{} );
+
+   smpFor( blocks, [&]( size_t b )
+   {
+      const size_t begin( min( b*elementsPerBlock, n ) );
+      chunks( begin, min( begin+elementsPerBlock, n ), partial[b] );
+   } );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      for( size_t k=0UL; k<N; ++k )
+         result[k] += partial[b][k];
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATOR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of a Blaze matrix to a dense vector (\f$ y = A x \f$).
+// \ingroup krylov
+*/
+template< typename OP     // Type of the matrix
+        , typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the operand vector
+inline auto applyOperator( const OP& A, VT1& y, const VT2& x )
+   -> EnableIf_t< IsMatrix_v<OP> >
+{
+   y = A * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of a user-defined linear operator to a dense vector (\f$ y = A x \f$).
+// \ingroup krylov
+//
+// The operator is called as \a A(y,x) and is expected to compute \f$ y = A x \f$.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the operand vector
+inline auto applyOperator( const OP& A, VT1& y, const VT2& x )
+   -> EnableIf_t< !IsMatrix_v<OP> >
+{
+   A( y, x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the residual vector \f$ r = b - A x \f$.
+// \ingroup krylov
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the residual vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename VT3 >  // Type of the solution vector
+inline void computeResidual( const OP& A, VT1& r, const VT2& b, const VT3& x )
+{
+   applyOperator( A, r, x );
+   r = b - r;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused matrix/vector multiplication and inner product (\f$ q = A p \f$, \f$ p^H q \f$).
+// \ingroup krylov
+//
+// For row-major Blaze matrices the multiplication is computed chunk by chunk and each chunk of
+// the result is directly used for the inner product, which saves a complete sweep over both
+// vectors.
+*/
+template< typename OP     // Type of the matrix
+        , typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the operand vector
+inline auto multDot( const OP& A, VT1& q, const VT2& p )
+   -> EnableIf_t< IsMatrix_v<OP> && IsRowMajorMatrix_v<OP> && !IsComputation_v<OP>
+                , ElementType_t<VT1> >
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t columns( A.columns() );
+
+   return fusedReduce<1UL,ET>( A.rows(), [&]( size_t i, size_t n )
+   {
+      auto qs( subvector( q, i, n, unchecked ) );
+      assign( qs, submatrix( A, i, 0UL, n, columns, unchecked ) * p );
+      return std::array<ET,1UL>{ { dot( conj( subvector( p, i, n, unchecked ) ), qs ) } };
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Matrix/vector multiplication and inner product (\f$ q = A p \f$, \f$ p^H q \f$).
+// \ingroup krylov
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the operand vector
+inline auto multDot( const OP& A, VT1& q, const VT2& p )
+   -> EnableIf_t< !( IsMatrix_v<OP> && IsRowMajorMatrix_v<OP> && !IsComputation_v<OP> )
+                , ElementType_t<VT1> >
+{
+   applyOperator( A, q, p );
+   return dot( conj( p ), q );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update \f$ y += \alpha x \f$ returning \f$ \|y\|_2^2 \f$.
+// \ingroup krylov
+*/
+template< typename VT1    // Type of the updated vector
+        , typename VT2    // Type of the added vector
+        , typename ST >   // Type of the scalar factor
+inline auto axpyNorm( VT1& y, const ST& alpha, const VT2& x )
+{
+   using RT = UnderlyingBuiltin_t< ElementType_t<VT1> >;
+
+   return fusedReduce<1UL,RT>( y.size(), [&]( size_t i, size_t n )
+   {
+      auto ys( subvector( y, i, n, unchecked ) );
+      addAssign( ys, alpha * subvector( x, i, n, unchecked ) );
+      return std::array<RT,1UL>{ { real( sqrNorm( ys ) ) } };
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update \f$ y += \alpha x \f$ returning \f$ z^H y \f$.
+// \ingroup krylov
+*/
+template< typename VT1    // Type of the updated vector
+        , typename VT2    // Type of the added vector
+        , typename VT3    // Type of the vector of the inner product
+        , typename ST >   // Type of the scalar factor
+inline auto axpyDot( VT1& y, const ST& alpha, const VT2& x, const VT3& z )
+{
+   using ET = ElementType_t<VT1>;
+
+   return fusedReduce<1UL,ET>( y.size(), [&]( size_t i, size_t n )
+   {
+      auto ys( subvector( y, i, n, unchecked ) );
+      addAssign( ys, alpha * subvector( x, i, n, unchecked ) );
+      return std::array<ET,1UL>{ { dot( conj( subvector( z, i, n, unchecked ) ), ys ) } };
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update \f$ y += \alpha x \f$ returning \f$ \|y\|_2^2 \f$ and \f$ z^H y \f$.
+// \ingroup krylov
+*/
+template< typename VT1    // Type of the updated vector
+        , typename VT2    // Type of the added vector
+        , typename VT3    // Type of the vector of the inner product
+        , typename ST >   // Type of the scalar factor
+inline auto axpyNormDot( VT1& y, const ST& alpha, const VT2& x, const VT3& z )
+{
+   using ET = ElementType_t<VT1>;
+
+   return fusedReduce<2UL,ET>( y.size(), [&]( size_t i, size_t n )
+   {
+      auto ys( subvector( y, i, n, unchecked ) );
+      addAssign( ys, alpha * subvector( x, i, n, unchecked ) );
+      return std::array<ET,2UL>{ { ET( real( sqrNorm( ys ) ) )
+                                 , dot( conj( subvector( z, i, n, unchecked ) ), ys ) } };
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused updates \f$ x += \alpha p \f$ and \f$ r -= \alpha q \f$ returning \f$ \|r\|_2^2 \f$.
+// \ingroup krylov
+*/
+template< typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the residual vector
+        , typename VT3    // Type of the search direction
+        , typename VT4    // Type of the image of the search direction
+        , typename ST >   // Type of the scalar factor
+inline auto updateSolution( VT1& x, VT2& r, const VT3& p, const VT4& q, const ST& alpha )
+{
+   using RT = UnderlyingBuiltin_t< ElementType_t<VT2> >;
+
+   return fusedReduce<1UL,RT>( r.size(), [&]( size_t i, size_t n )
+   {
+      auto rs( subvector( r, i, n, unchecked ) );
+      auto xs( subvector( x, i, n, unchecked ) );
+      addAssign( xs, alpha * subvector( p, i, n, unchecked ) );
+      subAssign( rs, alpha * subvector( q, i, n, unchecked ) );
+      return std::array<RT,1UL>{ { real( sqrNorm( rs ) ) } };
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused inner products \f$ x^H y \f$ and \f$ \|x\|_2^2 \f$.
+// \ingroup krylov
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline auto dotNorm( const VT1& x, const VT2& y )
+{
+   using ET = ElementType_t<VT1>;
+
+   return fusedReduce<2UL,ET>( x.size(), [&]( size_t i, size_t n )
+   {
+      const auto xs( subvector( x, i, n, unchecked ) );
+      return std::array<ET,2UL>{ { dot( conj( xs ), subvector( y, i, n, unchecked ) )
+                                 , ET( real( sqrNorm( xs ) ) ) } };
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel inner product \f$ x^H y \f$.
+// \ingroup krylov
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline auto innerProduct( const VT1& x, const VT2& y )
+{
+   using ET = ElementType_t<VT1>;
+
+   return fusedReduce<1UL,ET>( x.size(), [&]( size_t i, size_t n )
+   {
+      return std::array<ET,1UL>{ { dot( conj( subvector( x, i, n, unchecked ) )
+                                      , subvector( y, i, n, unchecked ) ) } };
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Size check of a Blaze matrix used as linear operator of a Krylov solver.
+// \ingroup krylov
+//
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and right-hand side sizes do not match.
+*/
+template< typename OP >  // Type of the matrix
+inline auto checkOperator( const OP& A, size_t n )
+   -> EnableIf_t< IsMatrix_v<OP> >
+{
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( A.rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and right-hand side sizes do not match" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Size check of a user-defined linear operator of a Krylov solver.
+// \ingroup krylov
+//
+// The size of a user-defined operator cannot be queried and is therefore not checked.
+*/
+template< typename OP >  // Type of the linear operator
+inline auto checkOperator( const OP& A, size_t n )
+   -> EnableIf_t< !IsMatrix_v<OP> >
+{
+   MAYBE_UNUSED( A, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Preparation of the solution vector of a Krylov solver.
+// \ingroup krylov
+//
+// \param A The matrix or linear operator.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \return The 2-norm of the right-hand side vector.
+// \exception std::invalid_argument Invalid linear system provided.
+//
+// In case the size of the solution vector does not match the size of the right-hand side, the
+// solution vector is resized and reset. Otherwise its current values are used as initial guess.
+// In case the right-hand side is zero, the solution vector is reset.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+inline double initializeSolution( const OP& A, VT1& x, const VT2& b )
+{
+   const size_t n( b.size() );
+
+   checkOperator( A, n );
+
+   if( x.size() != n ) {
+      resize( x, n, false );
+      reset( x );
+   }
+
+   const double bnorm( std::sqrt( real( innerProduct( b, b ) ) ) );
+
+   if( bnorm == 0.0 ) {
+      reset( x );
+   }
+
+   return bnorm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
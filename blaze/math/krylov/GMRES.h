@@ -0,0 +1,319 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/krylov/GMRES.h
+//  \brief Header file for the restarted generalized minimal residual (GMRES) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_KRYLOV_GMRES_H_
+#define _BLAZE_MATH_KRYLOV_GMRES_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/krylov/FusedKernels.h>
+#include <blaze/math/krylov/Preconditioners.h>
+#include <blaze/math/krylov/SolverSettings.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERALIZED MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Generalized minimal residual method */
+//@{
+template< typename OP, typename VT1, typename VT2, typename PC = IdentityPreconditioner >
+SolverStatistics gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                        const PC& M = PC(), const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2 >
+SolverStatistics gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                        const SolverSettings& settings );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of a complex Givens rotation eliminating the element \a b of \f$ (a,b)^T \f$.
+// \ingroup krylov
+//
+// \param a The first element, on exit the rotated element \f$ r \f$.
+// \param b The element to be eliminated.
+// \param c The resulting real cosine of the rotation.
+// \param s The resulting sine of the rotation.
+// \return void
+//
+// The computed rotation satisfies \f$ \left(\begin{array}{cc} c & s \\ -\bar{s} & c \\
+// \end{array}\right) \left(\begin{array}{c} a \\ b \\ \end{array}\right) =
+// \left(\begin{array}{c} r \\ 0 \\ \end{array}\right) \f$.
+*/
+template< typename ET    // Element type
+        , typename RT >  // Real element type
+void givens( ET& a, const ET& b, RT& c, ET& s )
+{
+   using std::abs;
+   using std::hypot;
+
+   const RT absA( abs( a ) );
+
+   if( absA == RT(0) ) {
+      c = RT(0);
+      s = ET(1);
+      a = b;
+      return;
+   }
+
+   const RT nrm( hypot( absA, RT( abs( b ) ) ) );
+   const ET phase( a / absA );
+
+   c = absA / nrm;
+   s = phase * conj( b ) / nrm;
+   a = phase * nrm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the general system \f$ A x = b \f$ by means of the right-preconditioned,
+//        restarted generalized minimal residual method GMRES(m).
+// \ingroup krylov
+//
+// \param A The square matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param settings The termination criteria and restart length.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+//
+// This function solves the linear system \f$ A x = b \f$ for a general square matrix \a A by
+// means of the GMRES method, which is restarted every \a settings.restart iterations. \a A is
+// either a Blaze matrix or any callable object computing \f$ y = A x \f$ when called as
+// \a A(y,x). The optional preconditioner \a M (for instance the IncompleteLU class) is applied
+// from the right, i.e. the minimized residual is the true residual of the unpreconditioned
+// system.
+
+   \code
+   blaze::CompressedMatrix<double> A( N, N );
+   blaze::DynamicVector<double> x, b( N );
+   // ... Initialization
+
+   blaze::SolverSettings settings;
+   settings.restart = 50UL;
+
+   const blaze::IncompleteLU<double> M( A );
+   const blaze::SolverStatistics stats( blaze::gmres( A, x, b, M, settings ) );
+   \endcode
+
+// The Krylov basis is stored in a column-major dense matrix and is orthogonalized by means of the
+// classical Gram-Schmidt method with reorthogonalization (CGS2). In contrast to the modified
+// Gram-Schmidt method this formulates the orthogonalization as two dense matrix/vector products
+// per sweep, which are executed via the fast (potentially BLAS and parallel) Blaze kernels. The
+// least squares problem is updated by means of Givens rotations. At every restart the residual
+// is recomputed explicitly, i.e. the final residual reported by the statistics is the true
+// residual.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverStatistics gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                        const PC& M, const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+   using RT = UnderlyingBuiltin_t<ET>;
+
+   using std::abs;
+
+   constexpr bool identity( IsSame_v<PC,IdentityPreconditioner> );
+
+   SolverStatistics stats;
+
+   const double bnorm( initializeSolution( A, ~x, ~b ) );
+
+   if( bnorm == 0.0 ) {
+      stats.converged = true;
+      return stats;
+   }
+
+   const size_t n( (~b).size() );
+   const size_t m( max( min( settings.restart, n ), 1UL ) );
+
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL ), H( m+1UL, m );
+   DynamicVector<ET> w( n ), z, g( m+1UL ), h( m+1UL ), y, sn( m );
+   DynamicVector<RT> cs( m );
+
+   if( !identity ) {
+      z.resize( n, false );
+   }
+
+   while( true )
+   {
+      computeResidual( A, w, ~b, ~x );
+      ++stats.products;
+
+      const RT beta( std::sqrt( real( innerProduct( w, w ) ) ) );
+
+      stats.residual = beta / bnorm;
+
+      if( stats.residual <= settings.tolerance ) {
+         stats.converged = true;
+         break;
+      }
+
+      if( stats.iterations >= settings.maxIterations ) break;
+
+      column( V, 0UL ) = w / beta;
+      reset( g );
+      g[0] = beta;
+
+      size_t k( 0UL );
+
+      while( k < m && stats.iterations < settings.maxIterations )
+      {
+         if( identity ) {
+            applyOperator( A, w, column( V, k ) );
+         }
+         else {
+            M.apply( z, column( V, k ) );
+            applyOperator( A, w, z );
+         }
+         ++stats.products;
+
+         auto Vk( submatrix( V, 0UL, 0UL, n, k+1UL ) );
+         auto Hk( subvector( column( H, k ), 0UL, k+1UL ) );
+         auto hk( subvector( h, 0UL, k+1UL ) );
+
+         Hk = ctrans( Vk ) * w;
+         w -= Vk * Hk;
+         hk = ctrans( Vk ) * w;
+         w -= Vk * hk;
+         Hk += hk;
+
+         const RT hnorm( std::sqrt( real( innerProduct( w, w ) ) ) );
+         H(k+1UL,k) = hnorm;
+
+         for( size_t i=0UL; i<k; ++i ) {
+            const ET tmp( cs[i]*H(i,k) + sn[i]*H(i+1UL,k) );
+            H(i+1UL,k) = cs[i]*H(i+1UL,k) - conj( sn[i] )*H(i,k);
+            H(i,k) = tmp;
+         }
+
+         givens( H(k,k), H(k+1UL,k), cs[k], sn[k] );
+         H(k+1UL,k) = ET(0);
+
+         g[k+1UL] = -conj( sn[k] ) * g[k];
+         g[k]     = cs[k] * g[k];
+
+         ++k;
+         ++stats.iterations;
+         stats.history.push_back( abs( g[k] ) / bnorm );
+
+         if( stats.history.back() <= settings.tolerance || hnorm == RT(0) ) break;
+
+         column( V, k ) = w / hnorm;
+      }
+
+      y = subvector( g, 0UL, k );
+
+      for( size_t i=k; i-- > 0UL; ) {
+         for( size_t j=i+1UL; j<k; ++j ) {
+            y[i] -= H(i,j) * y[j];
+         }
+         y[i] /= H(i,i);
+      }
+
+      if( identity ) {
+         (~x) += submatrix( V, 0UL, 0UL, n, k ) * y;
+      }
+      else {
+         w = submatrix( V, 0UL, 0UL, n, k ) * y;
+         M.apply( z, w );
+         (~x) += z;
+      }
+   }
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the general system \f$ A x = b \f$ by means of the unpreconditioned, restarted
+//        generalized minimal residual method GMRES(m).
+// \ingroup krylov
+//
+// \param A The square matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param settings The termination criteria and restart length.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverStatistics gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                        const SolverSettings& settings )
+{
+   return gmres( A, x, b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
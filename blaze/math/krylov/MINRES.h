@@ -0,0 +1,256 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/krylov/MINRES.h
+//  \brief Header file for the minimal residual (MINRES) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_KRYLOV_MINRES_H_
+#define _BLAZE_MATH_KRYLOV_MINRES_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/krylov/FusedKernels.h>
+#include <blaze/math/krylov/Preconditioners.h>
+#include <blaze/math/krylov/SolverSettings.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Minimal residual method */
+//@{
+template< typename OP, typename VT1, typename VT2, typename PC = IdentityPreconditioner >
+SolverStatistics minres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                         const PC& M = PC(), const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2 >
+SolverStatistics minres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                         const SolverSettings& settings );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the symmetric/Hermitian (possibly indefinite) system \f$ A x = b \f$ by means
+//        of the preconditioned minimal residual method.
+// \ingroup krylov
+//
+// \param A The symmetric/Hermitian matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param M The symmetric/Hermitian positive definite preconditioner.
+// \param settings The termination criteria.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+// \exception std::invalid_argument Invalid indefinite preconditioner provided.
+//
+// This function solves the linear system \f$ A x = b \f$ for a symmetric (or Hermitian) matrix
+// \a A by means of the MINRES method of Paige and Saunders. In contrast to cg() the matrix is
+// not required to be positive definite. \a A is either a Blaze matrix or any callable object
+// computing \f$ y = A x \f$ when called as \a A(y,x). The optional preconditioner \a M has to
+// be symmetric (or Hermitian) positive definite. In case an indefinite preconditioner is
+// detected, a \a std::invalid_argument exception is thrown.
+
+   \code
+   blaze::CompressedMatrix<double> A( N, N );
+   blaze::DynamicVector<double> x, b( N );
+   // ... Initialization
+
+   const blaze::SolverStatistics stats( blaze::minres( A, x, b ) );
+   \endcode
+
+// The residual of each iteration is not computed explicitly, but estimated by means of the
+// short recurrence of the method. Without preconditioner this estimate equals the residual in
+// exact arithmetic. With preconditioner it is the residual measured in the norm induced by
+// \f$ M^{-1} \f$, scaled to the 2-norm of the initial residual.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverStatistics minres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                         const PC& M, const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+   using RT = UnderlyingBuiltin_t<ET>;
+
+   using std::hypot;
+
+   constexpr bool identity( IsSame_v<PC,IdentityPreconditioner> );
+
+   SolverStatistics stats;
+
+   const double bnorm( initializeSolution( A, ~x, ~b ) );
+
+   if( bnorm == 0.0 ) {
+      stats.converged = true;
+      return stats;
+   }
+
+   const size_t n( (~b).size() );
+
+   DynamicVector<ET> r1( n ), r2, y( n ), v( n ), w( n ), w1( n ), w2( n );
+
+   computeResidual( A, r1, ~b, ~x );
+   ++stats.products;
+
+   const RT r0norm( std::sqrt( real( innerProduct( r1, r1 ) ) ) );
+
+   stats.residual = r0norm / bnorm;
+
+   if( stats.residual <= settings.tolerance ) {
+      stats.converged = true;
+      return stats;
+   }
+
+   M.apply( y, r1 );
+
+   const RT beta1sqr( identity ? r0norm*r0norm : real( innerProduct( r1, y ) ) );
+
+   if( beta1sqr <= RT(0) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid indefinite preconditioner provided" );
+   }
+
+   const RT beta1( std::sqrt( beta1sqr ) );
+   const RT scale( r0norm / ( beta1 * bnorm ) );
+
+   r2 = r1;
+
+   RT oldb( 0 ), beta( beta1 ), dbar( 0 ), epsln( 0 ), phibar( beta1 ), cs( -1 ), sn( 0 );
+
+   while( stats.iterations < settings.maxIterations )
+   {
+      v = ( RT(1) / beta ) * y;
+
+      applyOperator( A, y, v );
+      ++stats.products;
+
+      const RT alfa( ( stats.iterations > 0UL )
+                     ? real( axpyDot( y, -beta/oldb, r1, v ) )
+                     : real( innerProduct( v, y ) ) );
+
+      const RT yy( axpyNorm( y, -alfa/beta, r2 ) );
+
+      swap( r1, r2 );
+      swap( r2, y );
+      M.apply( y, r2 );
+
+      oldb = beta;
+
+      const RT betasqr( identity ? yy : real( innerProduct( r2, y ) ) );
+
+      if( betasqr < RT(0) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid indefinite preconditioner provided" );
+      }
+
+      beta = std::sqrt( betasqr );
+
+      const RT oldeps( epsln );
+      const RT delta( cs*dbar + sn*alfa );
+      const RT gbar( sn*dbar - cs*alfa );
+      epsln = sn * beta;
+      dbar  = -cs * beta;
+
+      const RT gamma( max( hypot( gbar, beta ), std::numeric_limits<RT>::epsilon() ) );
+      cs = gbar / gamma;
+      sn = beta / gamma;
+
+      const RT phi( cs * phibar );
+      phibar *= sn;
+
+      swap( w1, w2 );
+      swap( w2, w );
+      w = ( v - oldeps*w1 - delta*w2 ) * ( RT(1) / gamma );
+      (~x) += phi * w;
+
+      ++stats.iterations;
+      stats.residual = phibar * scale;
+      stats.history.push_back( stats.residual );
+
+      if( stats.residual <= settings.tolerance ) {
+         stats.converged = true;
+         break;
+      }
+
+      if( beta == RT(0) ) break;
+   }
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the symmetric/Hermitian (possibly indefinite) system \f$ A x = b \f$ by means
+//        of the unpreconditioned minimal residual method.
+// \ingroup krylov
+//
+// \param A The symmetric/Hermitian matrix or linear operator.
+// \param x The solution vector (on entry the initial guess).
+// \param b The right-hand side vector.
+// \param settings The termination criteria.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid linear system provided.
+*/
+template< typename OP     // Type of the matrix or linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverStatistics minres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                         const SolverSettings& settings )
+{
+   return minres( A, x, b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
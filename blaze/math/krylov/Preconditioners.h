@@ -0,0 +1,251 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/krylov/Preconditioners.h
+//  \brief Header file for the basic preconditioners of the Krylov solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_KRYLOV_PRECONDITIONERS_H_
+#define _BLAZE_MATH_KRYLOV_PRECONDITIONERS_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/views/Band.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS IDENTITYPRECONDITIONER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The identity preconditioner (\f$ M = I \f$).
+// \ingroup krylov
+//
+// The IdentityPreconditioner is the default preconditioner of all Krylov solvers. The solvers
+// detect it at compile time and skip the application of the preconditioner altogether.
+//
+// In general, a preconditioner is any type providing a member function \a apply(y,r), which
+// computes \f$ y = M^{-1} r \f$ for two dense vectors. Next to the IdentityPreconditioner and
+// the JacobiPreconditioner this includes the IncompleteLU and IncompleteCholesky classes.
+*/
+struct IdentityPreconditioner
+{
+   //**Apply function******************************************************************************
+   /*!\brief Application of the preconditioner (\f$ y = r \f$).
+   //
+   // \param y The resulting vector.
+   // \param r The vector to be preconditioned.
+   // \return void
+   */
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void apply( DenseVector<VT1,TF1>& y, const DenseVector<VT2,TF2>& r ) const {
+      ~y = ~r;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS JACOBIPRECONDITIONER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The Jacobi (diagonal) preconditioner (\f$ M = diag(A) \f$).
+// \ingroup krylov
+//
+// The JacobiPreconditioner stores the inverse of the diagonal of a square matrix and scales the
+// preconditioned vector element-wise:
+
+   \code
+   blaze::CompressedMatrix<double> A( N, N );
+   blaze::DynamicVector<double> x( N ), b( N );
+   // ... Initialization
+
+   blaze::JacobiPreconditioner<double> M( A );
+   blaze::cg( A, x, b, M );
+   \endcode
+
+// In case the given matrix is not square or has a zero on its diagonal, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+class JacobiPreconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   JacobiPreconditioner() = default;
+
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Compute functions***************************************************************************
+   /*!\name Compute functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Apply functions*****************************************************************************
+   /*!\name Apply functions */
+   //@{
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   inline void apply( DenseVector<VT1,TF1>& y, const DenseVector<VT2,TF2>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> inverse_;  //!< The inverse diagonal elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the JacobiPreconditioner.
+//
+// \param A The square matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the preconditioner for the given square matrix.
+//
+// \param A The square matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline void JacobiPreconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   DynamicVector<Type> inverse( diagonal( ~A ) );
+
+   for( size_t i=0UL; i<inverse.size(); ++i ) {
+      if( !isDivisor( inverse[i] ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid zero diagonal element detected" );
+      }
+      inverse[i] = Type(1) / inverse[i];
+   }
+
+   swap( inverse_, inverse );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ y = M^{-1} r \f$).
+//
+// \param y The resulting vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the resulting vector
+        , bool TF1         // Transpose flag of the resulting vector
+        , typename VT2     // Type of the preconditioned vector
+        , bool TF2 >       // Transpose flag of the preconditioned vector
+inline void JacobiPreconditioner<Type>::apply( DenseVector<VT1,TF1>& y,
+                                               const DenseVector<VT2,TF2>& r ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == inverse_.size(), "Invalid vector size detected" );
+
+   ~y = transTo<TF2>( inverse_ ) * (~r);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the preconditioner.
+//
+// \return The number of rows.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t JacobiPreconditioner<Type>::rows() const noexcept
+{
+   return inverse_.size();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,111 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/krylov/SolverSettings.h
+//  \brief Header file for the settings and statistics of the Krylov solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_KRYLOV_SOLVERSETTINGS_H_
+#define _BLAZE_MATH_KRYLOV_SOLVERSETTINGS_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  STRUCT SOLVERSETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Settings of the iterative Krylov solvers.
+// \ingroup krylov
+//
+// The SolverSettings specify the termination criteria of the iterative solvers cg(), bicgstab(),
+// gmres(), and minres(). An iteration is terminated successfully as soon as the relative residual
+// \f$ \|b - A x\|_2 / \|b\|_2 \f$ drops below the given \a tolerance. In case the solver does not
+// converge within \a maxIterations iterations, the iteration is stopped and the last iterate is
+// returned. The \a restart length is only used by gmres().
+
+   \code
+   blaze::SolverSettings settings;
+   settings.tolerance     = 1E-10;
+   settings.maxIterations = 500UL;
+
+   const blaze::SolverStatistics stats( blaze::cg( A, x, b, settings ) );
+   \endcode
+*/
+struct SolverSettings
+{
+   double tolerance     { 1E-8 };    //!< The relative residual tolerance.
+   size_t maxIterations { 1000UL };  //!< The maximum number of iterations.
+   size_t restart       { 30UL };    //!< The restart length of GMRES.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRUCT SOLVERSTATISTICS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Statistics of a single run of an iterative Krylov solver.
+// \ingroup krylov
+//
+// The SolverStatistics are returned by all iterative solvers. They report whether the solver
+// has converged, the number of performed iterations and operator applications, the final
+// relative residual and the relative residual after each iteration.
+*/
+struct SolverStatistics
+{
+   bool   converged  { false };  //!< \a true in case the tolerance has been reached.
+   size_t iterations { 0UL };    //!< The number of performed iterations.
+   size_t products   { 0UL };    //!< The number of applications of the linear operator.
+   double residual   { 0.0 };    //!< The final relative residual.
+   std::vector<double> history;  //!< The relative residual after each iteration.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,238 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Blend.h
+//  \brief Header file for the SIMD blend and select functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_BLEND_H_
+#define _BLAZE_MATH_SIMD_BLEND_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Compare.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Componentwise blend of two vectors of single precision floating point SIMD values.
+// \ingroup simd
+//
+// \param a The SIMD operand providing the elements not selected by the mask.
+// \param b The SIMD operand providing the elements selected by the mask.
+// \param mask The selection mask.
+// \return The resulting vector.
+//
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the first operand
+        , typename T2 >  // Type of the second operand
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   blend( const SIMDf32<T1>& a, const SIMDf32<T2>& b, SIMDfloatMask mask ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_mask_blend_ps( mask, (~a).eval().value, (~b).eval().value );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_blendv_ps( (~a).eval().value, (~b).eval().value, mask );
+}
+#elif BLAZE_SSE4_MODE
+{
+   return _mm_blendv_ps( (~a).eval().value, (~b).eval().value, mask );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_or_ps( _mm_andnot_ps( mask, (~a).eval().value ),
+                     _mm_and_ps( mask, (~b).eval().value ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise selection between two vectors of single precision floating point SIMD
+//        values.
+// \ingroup simd
+//
+// \param mask The selection mask.
+// \param a The SIMD operand providing the elements selected by the mask.
+// \param b The SIMD operand providing the elements not selected by the mask.
+// \return The resulting vector.
+//
+// This function is the SIMD equivalent of the elementwise evaluation of \c mask ? \a a : \a b.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the first operand
+        , typename T2 >  // Type of the second operand
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   select( SIMDfloatMask mask, const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
+{
+   return blend( b, a, mask );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise selection between two vectors of single precision floating point SIMD
+//        values based on a vector of conditions.
+// \ingroup simd
+//
+// \param cond The SIMD vector of conditions.
+// \param a The SIMD operand providing the elements selected by non-zero conditions.
+// \param b The SIMD operand providing the elements selected by zero conditions.
+// \return The resulting vector.
+//
+// This function is the SIMD equivalent of the elementwise evaluation of \c cond ? \a a : \a b,
+// i.e. all non-zero elements of \a cond (including NaN) select the according element of \a a.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the conditions
+        , typename T2    // Type of the first operand
+        , typename T3 >  // Type of the second operand
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   select( const SIMDf32<T1>& cond, const SIMDf32<T2>& a, const SIMDf32<T3>& b ) noexcept
+{
+   return blend( b, a, cmpneq( cond, SIMDfloat() ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Componentwise blend of two vectors of double precision floating point SIMD values.
+// \ingroup simd
+//
+// \param a The SIMD operand providing the elements not selected by the mask.
+// \param b The SIMD operand providing the elements selected by the mask.
+// \param mask The selection mask.
+// \return The resulting vector.
+//
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the first operand
+        , typename T2 >  // Type of the second operand
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   blend( const SIMDf64<T1>& a, const SIMDf64<T2>& b, SIMDdoubleMask mask ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_mask_blend_pd( mask, (~a).eval().value, (~b).eval().value );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_blendv_pd( (~a).eval().value, (~b).eval().value, mask );
+}
+#elif BLAZE_SSE4_MODE
+{
+   return _mm_blendv_pd( (~a).eval().value, (~b).eval().value, mask );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_or_pd( _mm_andnot_pd( mask, (~a).eval().value ),
+                     _mm_and_pd( mask, (~b).eval().value ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise selection between two vectors of double precision floating point SIMD
+//        values.
+// \ingroup simd
+//
+// \param mask The selection mask.
+// \param a The SIMD operand providing the elements selected by the mask.
+// \param b The SIMD operand providing the elements not selected by the mask.
+// \return The resulting vector.
+//
+// This function is the SIMD equivalent of the elementwise evaluation of \c mask ? \a a : \a b.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the first operand
+        , typename T2 >  // Type of the second operand
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   select( SIMDdoubleMask mask, const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
+{
+   return blend( b, a, mask );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise selection between two vectors of double precision floating point SIMD
+//        values based on a vector of conditions.
+// \ingroup simd
+//
+// \param cond The SIMD vector of conditions.
+// \param a The SIMD operand providing the elements selected by non-zero conditions.
+// \param b The SIMD operand providing the elements selected by zero conditions.
+// \return The resulting vector.
+//
+// This function is the SIMD equivalent of the elementwise evaluation of \c cond ? \a a : \a b,
+// i.e. all non-zero elements of \a cond (including NaN) select the according element of \a a.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the conditions
+        , typename T2    // Type of the first operand
+        , typename T3 >  // Type of the second operand
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   select( const SIMDf64<T1>& cond, const SIMDf64<T2>& a, const SIMDf64<T3>& b ) noexcept
+{
+   return blend( b, a, cmpneq( cond, SIMDdouble() ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,521 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Compare.h
+//  \brief Header file for the SIMD comparison functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_COMPARE_H_
+#define _BLAZE_MATH_SIMD_COMPARE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MASK TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Result type of the componentwise comparison of two vectors of single precision
+//        floating point SIMD values.
+// \ingroup simd
+//
+// Depending on the available instruction set the mask is represented by a bit mask (MIC and
+// AVX-512) or by a vector with all bits set in the selected elements (SSE and AVX).
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+using SIMDfloatMask = __mmask16;
+#elif BLAZE_AVX_MODE
+using SIMDfloatMask = __m256;
+#elif BLAZE_SSE_MODE
+using SIMDfloatMask = __m128;
+#else
+using SIMDfloatMask = bool;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Result type of the componentwise comparison of two vectors of double precision
+//        floating point SIMD values.
+// \ingroup simd
+//
+// Depending on the available instruction set the mask is represented by a bit mask (MIC and
+// AVX-512) or by a vector with all bits set in the selected elements (SSE2 and AVX).
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+using SIMDdoubleMask = __mmask8;
+#elif BLAZE_AVX_MODE
+using SIMDdoubleMask = __m256d;
+#elif BLAZE_SSE2_MODE
+using SIMDdoubleMask = __m128d;
+#else
+using SIMDdoubleMask = bool;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Componentwise equality comparison of two vectors of single precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDfloatMask
+   cmpeq( const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_ps_mask( (~a).eval().value, (~b).eval().value, _CMP_EQ_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_ps( (~a).eval().value, (~b).eval().value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_cmpeq_ps( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise inequality comparison of two vectors of single precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is not equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is set.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDfloatMask
+   cmpneq( const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_ps_mask( (~a).eval().value, (~b).eval().value, _CMP_NEQ_UQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_ps( (~a).eval().value, (~b).eval().value, _CMP_NEQ_UQ );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_cmpneq_ps( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise less-than comparison of two vectors of single precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is less than \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDfloatMask
+   cmplt( const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_ps_mask( (~a).eval().value, (~b).eval().value, _CMP_LT_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_ps( (~a).eval().value, (~b).eval().value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_cmplt_ps( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise less-or-equal comparison of two vectors of single precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is less than or equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDfloatMask
+   cmple( const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_ps_mask( (~a).eval().value, (~b).eval().value, _CMP_LE_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_ps( (~a).eval().value, (~b).eval().value, _CMP_LE_OQ );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_cmple_ps( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise greater-than comparison of two vectors of single precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is greater than \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDfloatMask
+   cmpgt( const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_ps_mask( (~a).eval().value, (~b).eval().value, _CMP_GT_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_ps( (~a).eval().value, (~b).eval().value, _CMP_GT_OQ );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_cmpgt_ps( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise greater-or-equal comparison of two vectors of single precision floating
+//        point SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is greater than or equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDfloatMask
+   cmpge( const SIMDf32<T1>& a, const SIMDf32<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_ps_mask( (~a).eval().value, (~b).eval().value, _CMP_GE_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_ps( (~a).eval().value, (~b).eval().value, _CMP_GE_OQ );
+}
+#elif BLAZE_SSE_MODE
+{
+   return _mm_cmpge_ps( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Componentwise equality comparison of two vectors of double precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDdoubleMask
+   cmpeq( const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_pd_mask( (~a).eval().value, (~b).eval().value, _CMP_EQ_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_pd( (~a).eval().value, (~b).eval().value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_cmpeq_pd( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise inequality comparison of two vectors of double precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is not equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is set.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDdoubleMask
+   cmpneq( const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_pd_mask( (~a).eval().value, (~b).eval().value, _CMP_NEQ_UQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_pd( (~a).eval().value, (~b).eval().value, _CMP_NEQ_UQ );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_cmpneq_pd( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise less-than comparison of two vectors of double precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is less than \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDdoubleMask
+   cmplt( const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_pd_mask( (~a).eval().value, (~b).eval().value, _CMP_LT_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_pd( (~a).eval().value, (~b).eval().value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_cmplt_pd( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise less-or-equal comparison of two vectors of double precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is less than or equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDdoubleMask
+   cmple( const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_pd_mask( (~a).eval().value, (~b).eval().value, _CMP_LE_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_pd( (~a).eval().value, (~b).eval().value, _CMP_LE_OQ );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_cmple_pd( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise greater-than comparison of two vectors of double precision floating point
+//        SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is greater than \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDdoubleMask
+   cmpgt( const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_pd_mask( (~a).eval().value, (~b).eval().value, _CMP_GT_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_pd( (~a).eval().value, (~b).eval().value, _CMP_GT_OQ );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_cmpgt_pd( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Componentwise greater-or-equal comparison of two vectors of double precision floating
+//        point SIMD values.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD operand.
+// \param b The right-hand side SIMD operand.
+// \return The mask of all elements for which \a a is greater than or equal to \a b.
+//
+// In case either of the two elements is NaN, the according element of the mask is not set.
+// This operation is only available for SSE2, AVX, MIC, and AVX-512.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+BLAZE_ALWAYS_INLINE SIMDdoubleMask
+   cmpge( const SIMDf64<T1>& a, const SIMDf64<T2>& b ) noexcept
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+{
+   return _mm512_cmp_pd_mask( (~a).eval().value, (~b).eval().value, _CMP_GE_OQ );
+}
+#elif BLAZE_AVX_MODE
+{
+   return _mm256_cmp_pd( (~a).eval().value, (~b).eval().value, _CMP_GE_OQ );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return _mm_cmpge_pd( (~a).eval().value, (~b).eval().value );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1675 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Elementary.h
+//  \brief Header file for the portable SIMD elementary functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_ELEMENTARY_H_
+#define _BLAZE_MATH_SIMD_ELEMENTARY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/dense/CompensatedSum.h>
+#include <blaze/math/simd/Add.h>
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Blend.h>
+#include <blaze/math/simd/Compare.h>
+#include <blaze/math/simd/Div.h>
+#include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/math/simd/Max.h>
+#include <blaze/math/simd/Min.h>
+#include <blaze/math/simd/Mult.h>
+#include <blaze/math/simd/Set.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/math/simd/Sub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+#if BLAZE_PORTABLE_SIMD_MATH_MODE
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT PRIMITIVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise not-less-than comparison of two vectors of single precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The mask of all lanes for which \f$ !(a < b) \f$ (true in case of NaN).
+*/
+BLAZE_ALWAYS_INLINE SIMDfloatMask simdNotLess( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_ps_mask( a.value, b.value, _CMP_NLT_UQ );
+#elif BLAZE_AVX_MODE
+   return _mm256_cmp_ps( a.value, b.value, _CMP_NLT_UQ );
+#else
+   return _mm_cmpnlt_ps( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise disjunction of two comparison masks of single precision vectors.
+// \ingroup simd
+//
+// \param a The left-hand side mask.
+// \param b The right-hand side mask.
+// \return The combined mask.
+*/
+BLAZE_ALWAYS_INLINE SIMDfloatMask simdOr( SIMDfloatMask a, SIMDfloatMask b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return static_cast<SIMDfloatMask>( a | b );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_ps( a, b );
+#else
+   return _mm_or_ps( a, b );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the bit pattern of a comparison mask of single precision vectors.
+// \ingroup simd
+//
+// \param mask The comparison mask.
+// \return The bit pattern of the mask (bit \a i is set in case lane \a i is set).
+*/
+BLAZE_ALWAYS_INLINE unsigned int simdMaskBits( SIMDfloatMask mask ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return mask;
+#elif BLAZE_AVX_MODE
+   return _mm256_movemask_ps( mask );
+#else
+   return _mm_movemask_ps( mask );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Flips the sign of all lanes of \a a for which the sign bit of \a b is set.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \param b The vector providing the sign bits.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdXorSign( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+   const SIMDfloat sign( set( -0.0F ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps(
+      _mm512_xor_si512( _mm512_castps_si512( a.value ),
+                        _mm512_and_si512( _mm512_castps_si512( b.value ),
+                                          _mm512_castps_si512( sign.value ) ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_xor_ps( a.value, _mm256_and_ps( b.value, sign.value ) );
+#else
+   return _mm_xor_ps( a.value, _mm_and_ps( b.value, sign.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the absolute value of a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdAbs( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat sign( set( -0.0F ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_andnot_si512( _mm512_castps_si512( sign.value ),
+                                                    _mm512_castps_si512( a.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_andnot_ps( sign.value, a.value );
+#else
+   return _mm_andnot_ps( sign.value, a.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds a vector of single precision values to the nearest integral values.
+// \ingroup simd
+//
+// \param a The vector of single precision values (with \f$ |a| < 2^{31} \f$).
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdRound( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_roundscale_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_AVX_MODE
+   return _mm256_round_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_SSE4_MODE
+   return _mm_round_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+   return _mm_cvtepi32_ps( _mm_cvtps_epi32( a.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ 2^n \f$ for a vector of integral single precision values.
+// \ingroup simd
+//
+// \param n The vector of integral exponents in the range \f$ [-126..127] \f$.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdPow2( const SIMDfloat& n ) noexcept
+{
+   const SIMDfloat t( n + set( 8388735.0F ) );  // 2^23 + 127
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_castps_si512( t.value ), 23 ) );
+#elif BLAZE_AVX2_MODE
+   return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_castps_si256( t.value ), 23 ) );
+#elif BLAZE_AVX_MODE
+   const __m128i lo( _mm_slli_epi32( _mm_castps_si128( _mm256_castps256_ps128( t.value ) ), 23 ) );
+   const __m128i hi( _mm_slli_epi32( _mm_castps_si128( _mm256_extractf128_ps( t.value, 1 ) ), 23 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( lo ) ),
+                                _mm_castsi128_ps( hi ), 1 );
+#else
+   return _mm_castsi128_ps( _mm_slli_epi32( _mm_castps_si128( t.value ), 23 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the unbiased exponent of a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of positive, finite, and normalized single precision values.
+// \return The vector of exponents as single precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdExponent( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat magic( set( 8388608.0F ) );  // 2^23
+
+#if BLAZE_AVX512F_MODE
+   const __m512i e( _mm512_or_si512( _mm512_srli_epi32( _mm512_castps_si512( a.value ), 23 ),
+                                     _mm512_castps_si512( magic.value ) ) );
+   return SIMDfloat( _mm512_castsi512_ps( e ) ) - set( 8388735.0F );
+#elif BLAZE_AVX2_MODE
+   const __m256i e( _mm256_or_si256( _mm256_srli_epi32( _mm256_castps_si256( a.value ), 23 ),
+                                     _mm256_castps_si256( magic.value ) ) );
+   return SIMDfloat( _mm256_castsi256_ps( e ) ) - set( 8388735.0F );
+#elif BLAZE_AVX_MODE
+   const __m128i lo( _mm_srli_epi32( _mm_castps_si128( _mm256_castps256_ps128( a.value ) ), 23 ) );
+   const __m128i hi( _mm_srli_epi32( _mm_castps_si128( _mm256_extractf128_ps( a.value, 1 ) ), 23 ) );
+   const __m256 e( _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( lo ) ),
+                                         _mm_castsi128_ps( hi ), 1 ) );
+   return SIMDfloat( _mm256_or_ps( e, magic.value ) ) - set( 8388735.0F );
+#else
+   const __m128i e( _mm_or_si128( _mm_srli_epi32( _mm_castps_si128( a.value ), 23 ),
+                                  _mm_castps_si128( magic.value ) ) );
+   return SIMDfloat( _mm_castsi128_ps( e ) ) - set( 8388735.0F );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the mantissa of a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of positive, finite, and normalized single precision values.
+// \return The vector of mantissas in the range \f$ [1..2) \f$.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdMantissa( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat one( set( 1.0F ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps(
+      _mm512_or_si512( _mm512_and_si512( _mm512_castps_si512( a.value ),
+                                         _mm512_set1_epi32( 0x007FFFFF ) ),
+                       _mm512_castps_si512( one.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_ps( _mm256_and_ps( a.value, _mm256_castsi256_ps( _mm256_set1_epi32( 0x007FFFFF ) ) ),
+                        one.value );
+#else
+   return _mm_or_ps( _mm_and_ps( a.value, _mm_castsi128_ps( _mm_set1_epi32( 0x007FFFFF ) ) ),
+                     one.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT PRIMITIVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise not-less-than comparison of two vectors of double precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The mask of all lanes for which \f$ !(a < b) \f$ (true in case of NaN).
+*/
+BLAZE_ALWAYS_INLINE SIMDdoubleMask simdNotLess( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_pd_mask( a.value, b.value, _CMP_NLT_UQ );
+#elif BLAZE_AVX_MODE
+   return _mm256_cmp_pd( a.value, b.value, _CMP_NLT_UQ );
+#else
+   return _mm_cmpnlt_pd( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise disjunction of two comparison masks of double precision vectors.
+// \ingroup simd
+//
+// \param a The left-hand side mask.
+// \param b The right-hand side mask.
+// \return The combined mask.
+*/
+BLAZE_ALWAYS_INLINE SIMDdoubleMask simdOr( SIMDdoubleMask a, SIMDdoubleMask b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return static_cast<SIMDdoubleMask>( a | b );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_pd( a, b );
+#else
+   return _mm_or_pd( a, b );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the bit pattern of a comparison mask of double precision vectors.
+// \ingroup simd
+//
+// \param mask The comparison mask.
+// \return The bit pattern of the mask (bit \a i is set in case lane \a i is set).
+*/
+BLAZE_ALWAYS_INLINE unsigned int simdMaskBits( SIMDdoubleMask mask ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return mask;
+#elif BLAZE_AVX_MODE
+   return _mm256_movemask_pd( mask );
+#else
+   return _mm_movemask_pd( mask );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Flips the sign of all lanes of \a a for which the sign bit of \a b is set.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \param b The vector providing the sign bits.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdXorSign( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+   const SIMDdouble sign( set( -0.0 ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd(
+      _mm512_xor_si512( _mm512_castpd_si512( a.value ),
+                        _mm512_and_si512( _mm512_castpd_si512( b.value ),
+                                          _mm512_castpd_si512( sign.value ) ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_xor_pd( a.value, _mm256_and_pd( b.value, sign.value ) );
+#else
+   return _mm_xor_pd( a.value, _mm_and_pd( b.value, sign.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the absolute value of a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdAbs( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble sign( set( -0.0 ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_andnot_si512( _mm512_castpd_si512( sign.value ),
+                                                    _mm512_castpd_si512( a.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_andnot_pd( sign.value, a.value );
+#else
+   return _mm_andnot_pd( sign.value, a.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds a vector of double precision values to the nearest integral values.
+// \ingroup simd
+//
+// \param a The vector of double precision values (with \f$ |a| < 2^{31} \f$).
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdRound( const SIMDdouble& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_roundscale_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_AVX_MODE
+   return _mm256_round_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#elif BLAZE_SSE4_MODE
+   return _mm_round_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+   return _mm_cvtepi32_pd( _mm_cvtpd_epi32( a.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ 2^n \f$ for a vector of integral double precision values.
+// \ingroup simd
+//
+// \param n The vector of integral exponents in the range \f$ [-1022..1023] \f$.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdPow2( const SIMDdouble& n ) noexcept
+{
+   const SIMDdouble t( n + set( 4503599627371519.0 ) );  // 2^52 + 1023
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_slli_epi64( _mm512_castpd_si512( t.value ), 52 ) );
+#elif BLAZE_AVX2_MODE
+   return _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_castpd_si256( t.value ), 52 ) );
+#elif BLAZE_AVX_MODE
+   const __m128i lo( _mm_slli_epi64( _mm_castpd_si128( _mm256_castpd256_pd128( t.value ) ), 52 ) );
+   const __m128i hi( _mm_slli_epi64( _mm_castpd_si128( _mm256_extractf128_pd( t.value, 1 ) ), 52 ) );
+   return _mm256_insertf128_pd( _mm256_castpd128_pd256( _mm_castsi128_pd( lo ) ),
+                                _mm_castsi128_pd( hi ), 1 );
+#else
+   return _mm_castsi128_pd( _mm_slli_epi64( _mm_castpd_si128( t.value ), 52 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the unbiased exponent of a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of positive, finite, and normalized double precision values.
+// \return The vector of exponents as double precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdExponent( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble magic( set( 4503599627370496.0 ) );  // 2^52
+
+#if BLAZE_AVX512F_MODE
+   const __m512i e( _mm512_or_si512( _mm512_srli_epi64( _mm512_castpd_si512( a.value ), 52 ),
+                                     _mm512_castpd_si512( magic.value ) ) );
+   return SIMDdouble( _mm512_castsi512_pd( e ) ) - set( 4503599627371519.0 );
+#elif BLAZE_AVX2_MODE
+   const __m256i e( _mm256_or_si256( _mm256_srli_epi64( _mm256_castpd_si256( a.value ), 52 ),
+                                     _mm256_castpd_si256( magic.value ) ) );
+   return SIMDdouble( _mm256_castsi256_pd( e ) ) - set( 4503599627371519.0 );
+#elif BLAZE_AVX_MODE
+   const __m128i lo( _mm_srli_epi64( _mm_castpd_si128( _mm256_castpd256_pd128( a.value ) ), 52 ) );
+   const __m128i hi( _mm_srli_epi64( _mm_castpd_si128( _mm256_extractf128_pd( a.value, 1 ) ), 52 ) );
+   const __m256d e( _mm256_insertf128_pd( _mm256_castpd128_pd256( _mm_castsi128_pd( lo ) ),
+                                          _mm_castsi128_pd( hi ), 1 ) );
+   return SIMDdouble( _mm256_or_pd( e, magic.value ) ) - set( 4503599627371519.0 );
+#else
+   const __m128i e( _mm_or_si128( _mm_srli_epi64( _mm_castpd_si128( a.value ), 52 ),
+                                  _mm_castpd_si128( magic.value ) ) );
+   return SIMDdouble( _mm_castsi128_pd( e ) ) - set( 4503599627371519.0 );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the mantissa of a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of positive, finite, and normalized double precision values.
+// \return The vector of mantissas in the range \f$ [1..2) \f$.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdMantissa( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble one( set( 1.0 ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd(
+      _mm512_or_si512( _mm512_and_si512( _mm512_castpd_si512( a.value ),
+                                         _mm512_set1_epi64( 0x000FFFFFFFFFFFFFLL ) ),
+                       _mm512_castpd_si512( one.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_pd( _mm256_and_pd( a.value,
+                                       _mm256_castsi256_pd( _mm256_set1_epi64x( 0x000FFFFFFFFFFFFFLL ) ) ),
+                        one.value );
+#else
+   return _mm_or_pd( _mm_and_pd( a.value, _mm_castsi128_pd( _mm_set1_epi64x( 0x000FFFFFFFFFFFFFLL ) ) )
+                   , one.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION PRIMITIVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the lower half of a vector of single precision values to double precision.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The vector of double precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdLowerHalf( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cvtps_pd( _mm512_castps512_ps256( a.value ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_cvtps_pd( _mm256_castps256_ps128( a.value ) );
+#else
+   return _mm_cvtps_pd( a.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the upper half of a vector of single precision values to double precision.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The vector of double precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdUpperHalf( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cvtps_pd( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( a.value ), 1 ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_cvtps_pd( _mm256_extractf128_ps( a.value, 1 ) );
+#else
+   return _mm_cvtps_pd( _mm_movehl_ps( a.value, a.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines two vectors of double precision values to a vector of single precision values.
+// \ingroup simd
+//
+// \param lo The vector of double precision values forming the lower half of the result.
+// \param hi The vector of double precision values forming the upper half of the result.
+// \return The vector of single precision values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdNarrow( const SIMDdouble& lo, const SIMDdouble& hi ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castpd_ps(
+      _mm512_insertf64x4( _mm512_castpd256_pd512( _mm256_castps_pd( _mm512_cvtpd_ps( lo.value ) ) ),
+                          _mm256_castps_pd( _mm512_cvtpd_ps( hi.value ) ), 1 ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_cvtpd_ps( lo.value ) ),
+                                _mm256_cvtpd_ps( hi.value ), 1 );
+#else
+   return _mm_movelh_ps( _mm_cvtpd_ps( lo.value ), _mm_cvtpd_ps( hi.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any lane of the given comparison mask is set.
+// \ingroup simd
+//
+// \param mask The comparison mask.
+// \return \a true in case at least one lane is set, \a false if not.
+*/
+template< typename M >  // Type of the comparison mask
+BLAZE_ALWAYS_INLINE bool simdAny( M mask ) noexcept
+{
+   return simdMaskBits( mask ) != 0U;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Flips the sign of all lanes of the given vector.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The negated vector.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T simdNegate( const T& a ) noexcept
+{
+   return simdXorSign( a, T( set( typename T::ValueType( -0.0 ) ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluates a polynomial by means of the Horner scheme.
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param p The intermediate result.
+// \return The resulting vector.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T simdHorner( const T& /*x*/, const T& p ) noexcept
+{
+   return p;
+}
+
+template< typename T          // Type of the SIMD vector
+        , typename... Cs >    // Types of the remaining coefficients
+BLAZE_ALWAYS_INLINE const T
+   simdHorner( const T& x, const T& p, typename T::ValueType c, Cs... cs ) noexcept
+{
+   return simdHorner( x, T( p * x + set( c ) ), cs... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluates the polynomial \f$ c_n x^n + \ldots + c_1 x + c_0 \f$.
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param c The coefficient of the highest order term.
+// \param cs The remaining coefficients, sorted from the highest to the lowest order.
+// \return The resulting vector.
+*/
+template< typename T          // Type of the SIMD vector
+        , typename... Cs >    // Types of the remaining coefficients
+BLAZE_ALWAYS_INLINE const T
+   simdPolynomial( const T& x, typename T::ValueType c, Cs... cs ) noexcept
+{
+   return simdHorner( x, T( set( c ) ), cs... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ x \cdot 2^n \f$ for a vector of floating point values.
+// \ingroup simd
+//
+// \param x The vector of floating point values.
+// \param n The vector of integral exponents.
+// \return The resulting vector.
+//
+// The scaling is performed in two steps such that results in the overflow and subnormal range
+// are computed correctly for exponents up to twice the exponent range of the data type.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T simdLdexp( const T& x, const T& n ) noexcept
+{
+   using ET = typename T::ValueType;
+
+   const T n1( simdRound( n * set( ET( 0.5 ) ) - set( ET( 0.25 ) ) ) );
+   const T n2( n - n1 );
+
+   return T( x * simdPow2( n1 ) ) * simdPow2( n2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recomputes the selected lanes of a vector by means of a scalar function.
+// \ingroup simd
+//
+// \param res The vector of results.
+// \param mask The mask of the lanes to be recomputed.
+// \param a The vector of arguments.
+// \param op The scalar function.
+// \return The updated vector of results.
+//
+// This function is used to handle rare arguments (as for instance very large arguments of the
+// trigonometric functions or special values) without penalizing the vectorized computation.
+*/
+template< typename T     // Type of the SIMD vector
+        , typename M     // Type of the comparison mask
+        , typename OP >  // Type of the scalar operation
+const T simdFallback( const T& res, M mask, const T& a, OP op )
+{
+   using ET = typename T::ValueType;
+
+   ET r[T::size];
+   ET x[T::size];
+
+   storeu( r, res );
+   storeu( x, a );
+
+   const unsigned int bits( simdMaskBits( mask ) );
+
+   for( size_t i=0UL; i<T::size; ++i ) {
+      if( bits & ( 1U << i ) )
+         r[i] = op( x[i] );
+   }
+
+   return loadu( r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recomputes the selected lanes of a vector by means of a scalar binary function.
+// \ingroup simd
+//
+// \param res The vector of results.
+// \param mask The mask of the lanes to be recomputed.
+// \param a The vector of left-hand side arguments.
+// \param b The vector of right-hand side arguments.
+// \param op The scalar function.
+// \return The updated vector of results.
+*/
+template< typename T     // Type of the SIMD vector
+        , typename M     // Type of the comparison mask
+        , typename OP >  // Type of the scalar operation
+const T simdFallback( const T& res, M mask, const T& a, const T& b, OP op )
+{
+   using ET = typename T::ValueType;
+
+   ET r[T::size];
+   ET x[T::size];
+   ET y[T::size];
+
+   storeu( r, res );
+   storeu( x, a );
+   storeu( y, b );
+
+   const unsigned int bits( simdMaskBits( mask ) );
+
+   for( size_t i=0UL; i<T::size; ++i ) {
+      if( bits & ( 1U << i ) )
+         r[i] = op( x[i], y[i] );
+   }
+
+   return loadu( r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies a double precision kernel to a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \param op The double precision kernel.
+// \return The resulting vector.
+*/
+template< typename OP >  // Type of the double precision kernel
+BLAZE_ALWAYS_INLINE const SIMDfloat simdViaDouble( const SIMDfloat& a, OP op ) noexcept
+{
+   return simdNarrow( op( simdLowerHalf( a ) ), op( simdUpperHalf( a ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies a binary double precision kernel to two vectors of single precision values.
+// \ingroup simd
+//
+// \param a The vector of left-hand side single precision values.
+// \param b The vector of right-hand side single precision values.
+// \param op The double precision kernel.
+// \return The resulting vector.
+*/
+template< typename OP >  // Type of the double precision kernel
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   simdViaDouble( const SIMDfloat& a, const SIMDfloat& b, OP op ) noexcept
+{
+   return simdNarrow( op( simdLowerHalf( a ), simdLowerHalf( b ) ),
+                      op( simdUpperHalf( a ), simdUpperHalf( b ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ 2^n e^r \f$ for a vector of reduced arguments.
+// \ingroup simd
+//
+// \param r The vector of reduced arguments in the range \f$ [-\ln(2)/2..\ln(2)/2] \f$.
+// \param n The vector of integral exponents.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdExpReduced( const SIMDdouble& r, const SIMDdouble& n ) noexcept
+{
+   // Minimax approximation of (e^r-1-r)/r^2 on [-ln(2)/2,ln(2)/2]
+   const SIMDdouble p( simdPolynomial( r, 2.510038549551032e-08, 2.7620088445409746e-07
+                                        , 2.7557268459997064e-06, 2.4801521295954376e-05
+                                        , 0.00019841269863053618, 0.0013888888917213717
+                                        , 0.0083333333333300615, 0.041666666666624129
+                                        , 0.16666666666666669, 0.50000000000000011 ) );
+
+   return simdLdexp( SIMDdouble( set( 1.0 ) + SIMDdouble( r + SIMDdouble( r * r ) * p ) ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of \f$ e^x \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+//
+// The argument is reduced via \f$ e^x = 2^n e^r \f$ with \f$ |r| \leq \ln(2)/2 \f$ and
+// \f$ e^r \f$ is approximated by a minimax polynomial of degree 11. The maximum error is
+// 1.1 ulp; overflow, underflow, subnormal results, infinities and NaN are handled correctly.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdExp( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble x( max( set( -745.2 ), min( set( 709.8 ), a ) ) );
+   const SIMDdouble n( simdRound( x * set( 1.4426950408889634 ) ) );
+   const SIMDdouble r1( x - n * set( 6.93147180369123816490e-01 ) );
+   const SIMDdouble r ( r1 - n * set( 1.90821492927058770002e-10 ) );
+
+   return simdExpReduced( r, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of \f$ e^x-1 \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values in the range \f$ [0..40] \f$.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdExpm1( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble n( simdRound( a * set( 1.4426950408889634 ) ) );
+   const SIMDdouble r1( a - n * set( 6.93147180369123816490e-01 ) );
+   const SIMDdouble r ( r1 - n * set( 1.90821492927058770002e-10 ) );
+
+   // Minimax approximation of (e^r-1-r)/r^2 on [-ln(2)/2,ln(2)/2]
+   const SIMDdouble p( simdPolynomial( r, 2.510038549551032e-08, 2.7620088445409746e-07
+                                        , 2.7557268459997064e-06, 2.4801521295954376e-05
+                                        , 0.00019841269863053618, 0.0013888888917213717
+                                        , 0.0083333333333300615, 0.041666666666624129
+                                        , 0.16666666666666669, 0.50000000000000011 ) );
+
+   const SIMDdouble q( r + SIMDdouble( r * r ) * p );
+   const SIMDdouble t( simdPow2( n ) );
+
+   return SIMDdouble( t - set( 1.0 ) ) + t * q;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decomposes a vector of positive double precision values for the logarithm.
+// \ingroup simd
+//
+// \param a The vector of positive, finite double precision values.
+// \param e The vector of exponents.
+// \return The vector of reduced arguments \f$ f = m - 1 \f$ with \f$ a = 2^e m \f$.
+//
+// The mantissa \a m is chosen in the range \f$ [\sqrt{2}/2..\sqrt{2}) \f$. Subnormal values
+// are scaled into the normalized range before the decomposition.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdLogReduce( const SIMDdouble& a, SIMDdouble& e ) noexcept
+{
+   const SIMDdoubleMask tiny( cmplt( a, set( std::numeric_limits<double>::min() ) ) );
+   const SIMDdouble x( blend( a, SIMDdouble( a * set( 18014398509481984.0 ) ), tiny ) );  // 2^54
+
+   e = simdExponent( x );
+   e = blend( e, SIMDdouble( e - set( 54.0 ) ), tiny );
+
+   SIMDdouble m( simdMantissa( x ) );
+   const SIMDdoubleMask large( cmplt( set( 1.4142135623730951 ), m ) );
+   m = blend( m, SIMDdouble( m * set( 0.5 ) ), large );
+   e = blend( e, SIMDdouble( e + set( 1.0 ) ), large );
+
+   return m - set( 1.0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluates the polynomial part of the logarithm kernel.
+// \ingroup simd
+//
+// \param z The vector of squared reduced arguments \f$ z = s^2 \f$ with \f$ s = f/(2+f) \f$.
+// \return The vector \f$ R(z) \f$ with \f$ \ln(1+f) = 2s + s R(z) \f$.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdLogPolynomial( const SIMDdouble& z ) noexcept
+{
+   // Minimax approximation of (2*atanh(s)/s-2)/s^2 on [0,0.02944]
+   return z * simdPolynomial( z, 0.1308675766695207, 0.13268760562036724, 0.15386240172447838
+                               , 0.18181795631498243, 0.22222222391794727, 0.28571428570803253
+                               , 0.40000000000000879, 0.66666666666666663 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the natural logarithm for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+//
+// The argument is decomposed into \f$ a = 2^e (1+f) \f$ with \f$ \sqrt{2}/2 \leq 1+f < \sqrt{2}
+// \f$ and \f$ \ln(1+f) = 2\,\mathrm{atanh}(f/(2+f)) \f$ is approximated by a minimax polynomial.
+// The maximum error is 1 ulp. Zero, negative values, infinity and NaN are handled according to
+// the C++ standard library.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdLog( const SIMDdouble& a ) noexcept
+{
+   SIMDdouble e;
+   const SIMDdouble f( simdLogReduce( a, e ) );
+   const SIMDdouble s( f / SIMDdouble( f + set( 2.0 ) ) );
+   const SIMDdouble R( simdLogPolynomial( SIMDdouble( s * s ) ) );
+
+   const SIMDdouble t( s * SIMDdouble( f - R ) - e * set( 1.90821492927058770002e-10 ) );
+   SIMDdouble res( e * set( 6.93147180369123816490e-01 ) + SIMDdouble( f - t ) );
+
+   const double infinity( std::numeric_limits<double>::infinity() );
+   res = blend( res, a, simdNotLess( a, set( infinity ) ) );
+   res = blend( res, set( -infinity ), cmpeq( a, set( 0.0 ) ) );
+   res = blend( res, set( std::numeric_limits<double>::quiet_NaN() ), cmplt( a, set( 0.0 ) ) );
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the natural logarithm of a vector of double precision values in extended
+//        precision.
+// \ingroup simd
+//
+// \param a The vector of positive, finite double precision values.
+// \param lo The vector of trailing parts of the logarithm.
+// \return The vector of leading parts of the logarithm.
+//
+// The logarithm is returned as unevaluated sum of a leading and a trailing part with a relative
+// error of approximately \f$ 2^{-68} \f$, which is required for an accurate power function.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdLogExtended( const SIMDdouble& a, SIMDdouble& lo ) noexcept
+{
+   SIMDdouble e;
+   const SIMDdouble f( simdLogReduce( a, e ) );
+
+   // s = f/(2+f) as unevaluated sum s + slo
+   const SIMDdouble u( f + set( 2.0 ) );
+   const SIMDdouble ulo( f - SIMDdouble( u - set( 2.0 ) ) );
+   const SIMDdouble v( set( 1.0 ) / u );
+   const SIMDdouble s( f * v );
+   SIMDdouble perr;
+   const SIMDdouble p( twoProduct( s, u, perr ) );
+   const SIMDdouble slo( SIMDdouble( SIMDdouble( f - p ) - perr - s * ulo ) * v );
+
+   // ln(x) = e*ln(2) + 2s + 2slo + s*R(s^2)
+   const SIMDdouble A( e * set( 6.93147180369123816490e-01 ) );
+   const SIMDdouble B( s + s );
+   const SIMDdouble h( A + B );
+   const SIMDdouble bb( h - A );
+   const SIMDdouble err( SIMDdouble( A - SIMDdouble( h - bb ) ) + SIMDdouble( B - bb ) );
+   const SIMDdouble T( s * simdLogPolynomial( SIMDdouble( s * s ) ) );
+   const SIMDdouble l( err + SIMDdouble( e * set( 1.90821492927058770002e-10 ) +
+                                         SIMDdouble( SIMDdouble( slo + slo ) + T ) ) );
+
+   const SIMDdouble hi( h + l );
+   lo = l - SIMDdouble( hi - h );
+   return hi;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sine of a vector of double precision values shifted by quarter periods.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \param shift The number of quarter periods (0 for the sine, 1 for the cosine).
+// \return The vector of values \f$ \sin(a + shift \cdot \pi/2) \f$.
+//
+// The argument is reduced via a four-part Cody-Waite reduction to \f$ |r| \leq \pi/4 \f$, where
+// the reduced argument is kept as unevaluated sum of two values. The sine and cosine of the
+// reduced argument are approximated by minimax polynomials of degree 13 and 14, respectively.
+// The result is selected according to the quadrant. Arguments with \f$ |a| \geq 10^6 \f$,
+// infinity and NaN are not handled by this kernel.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdSinKernel( const SIMDdouble& a, double shift ) noexcept
+{
+   const SIMDdouble q( simdRound( a * set( 0.63661977236758138 ) ) );
+
+   // Reduced argument as unevaluated sum r + rr
+   const SIMDdouble r1( a - q * set( 1.57079632673412561417e+00 ) );
+   const SIMDdouble w1( q * set( 6.07710050630396597660e-11 ) );
+   const SIMDdouble r2( r1 - w1 );
+   const SIMDdouble bb( r2 - r1 );
+   const SIMDdouble e2( SIMDdouble( r1 - SIMDdouble( r2 - bb ) ) - SIMDdouble( w1 + bb ) );
+   const SIMDdouble w2( q * set( 2.02226624871116645580e-21 ) + q * set( 8.47842766036889956997e-32 ) );
+   const SIMDdouble u ( e2 - w2 );
+   const SIMDdouble r ( r2 + u );
+   const SIMDdouble rr( SIMDdouble( r2 - r ) + u );
+
+   const SIMDdouble z( r * r );
+
+   // Minimax approximation of (sin(r)-r)/r^3 on [0,pi/4]
+   const SIMDdouble S( simdPolynomial( z, 1.5918115263265974e-10, -2.5051131650235181e-08
+                                        , 2.7557316101617874e-06, -0.00019841269836756774
+                                        , 0.008333333333330948, -0.16666666666666666 ) );
+
+   // Minimax approximation of (cos(r)-1+r^2/2)/r^4 on [0,pi/4]
+   const SIMDdouble C( simdPolynomial( z, -1.1382623647474604e-11, 2.087614614655861e-09
+                                        , -2.7557317271145144e-07, 2.4801587298764561e-05
+                                        , -0.0013888888888887398, 0.041666666666666664 ) );
+
+   const SIMDdouble hz( z * set( 0.5 ) );
+   const SIMDdouble v ( set( 1.0 ) - hz );
+
+   const SIMDdouble sine( r + SIMDdouble( SIMDdouble( r * z ) * S + rr * v ) );
+   const SIMDdouble cosine( v + SIMDdouble( SIMDdouble( SIMDdouble( set( 1.0 ) - v ) - hz ) +
+                                            SIMDdouble( SIMDdouble( z * z ) * C - r * rr ) ) );
+
+   // Quadrant j = (q+shift) mod 4
+   const SIMDdouble k( q + set( shift ) );
+   const SIMDdouble j( k - set( 4.0 ) * simdRound( k * set( 0.25 ) - set( 0.375 ) ) );
+   const SIMDdouble odd( j - set( 2.0 ) * simdRound( j * set( 0.5 ) - set( 0.25 ) ) );
+
+   const SIMDdouble res( blend( sine, cosine, cmplt( set( 0.5 ), odd ) ) );
+   return blend( res, simdNegate( res ), cmplt( set( 1.5 ), j ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the sine for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+//
+// The maximum error is 1 ulp. Arguments with \f$ |a| \geq 10^6 \f$, infinity and NaN are
+// handled by the scalar \c std::sin() function.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdSin( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble res( blend( simdSinKernel( a, 0.0 ), a, cmpeq( a, set( 0.0 ) ) ) );
+   const SIMDdoubleMask large( simdNotLess( simdAbs( a ), set( 1.0E6 ) ) );
+
+   if( simdAny( large ) )
+      return simdFallback( res, large, a, []( double x ){ return std::sin( x ); } );
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the cosine for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+//
+// The maximum error is 1 ulp. Arguments with \f$ |a| \geq 10^6 \f$, infinity and NaN are
+// handled by the scalar \c std::cos() function.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdCos( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble res( simdSinKernel( a, 1.0 ) );
+   const SIMDdoubleMask large( simdNotLess( simdAbs( a ), set( 1.0E6 ) ) );
+
+   if( simdAny( large ) )
+      return simdFallback( res, large, a, []( double x ){ return std::cos( x ); } );
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the hyperbolic tangent for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+//
+// The hyperbolic tangent is computed via \f$ \tanh(|x|) = e/(e+2) \f$ with \f$ e = e^{2|x|}-1
+// \f$. The maximum error is 2.6 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdTanh( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble x( min( set( 20.0 ), simdAbs( a ) ) );
+   const SIMDdouble e( simdExpm1( SIMDdouble( x + x ) ) );
+
+   return simdXorSign( SIMDdouble( e / SIMDdouble( e + set( 2.0 ) ) ), a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the error function for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \return The resulting vector.
+//
+// For \f$ |x| < 1 \f$ the error function is approximated by \f$ x + x P(x^2) \f$, for larger
+// arguments via \f$ 1 - e^{-x^2} G(x) \f$, where \a G is approximated by piecewise minimax
+// polynomials on \f$ [1..2) \f$, \f$ [2..3.5) \f$, and \f$ [3.5..6] \f$. The maximum error
+// is 1.2 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdErf( const SIMDdouble& a ) noexcept
+{
+   const SIMDdouble x( min( set( 6.0 ), simdAbs( a ) ) );
+   const SIMDdoubleMask small( cmplt( x, set( 1.0 ) ) );
+   const SIMDdoubleMask large( simdNotLess( x, set( 1.0 ) ) );
+
+   SIMDdouble res;
+
+   if( simdAny( small ) )
+   {
+      // Minimax approximation of erf(x)/x-1 in x^2 on [0,1]
+      res = x + x * simdPolynomial( SIMDdouble( x * x )
+                                  , -7.7958988270021425e-10, 1.3720064546777686e-08
+                                  , -1.6208483801871705e-07, 1.6447424703317362e-06
+                                  , -1.4924736907419661e-05, 0.00012055294904839707
+                                  , -0.00085483259753896918, 0.0052239776071164225
+                                  , -0.02686617064323777, 0.11283791670945006
+                                  , -0.37612638903183543, 0.1283791670955126 );
+   }
+
+   if( simdAny( large ) )
+   {
+      // Minimax approximations of erfc(x)*exp(x^2) on [3.5,6], [2,3.5), and [1,2)
+      SIMDdouble g( simdPolynomial( SIMDdouble( x - set( 4.75 ) )
+                                  , -1.2397154955686125e-09, 7.1851175675256251e-09
+                                  , -3.5308951693218504e-08, 1.9859009944209772e-07
+                                  , -1.1118029273174716e-06, 6.0825106822287093e-06
+                                  , -3.2775694447978083e-05, 0.00017392778941474965
+                                  , -0.00090809890867533905, 0.0046613264381130462
+                                  , -0.023503448597910273, 0.11630270720874594 ) );
+
+      const SIMDdoubleMask medium( cmplt( x, set( 3.5 ) ) );
+
+      if( simdAny( medium ) ) {
+         g = blend( g, simdPolynomial( SIMDdouble( x - set( 2.75 ) )
+                                         , 1.8069520510416326e-09, -8.01181001890603e-09
+                                         , 3.1057106076114763e-08, -1.3192706697647487e-07
+                                         , 5.5204181405505622e-07, -2.2476763215839708e-06
+                                         , 8.9401407850924132e-06, -3.4698539513744727e-05
+                                         , 0.00013118180233874277, -0.00048219509328292938
+                                         , 0.001719581885194874, -0.0059343378965648393
+                                         , 0.019758592987324287, -0.063237637560641366
+                                         , 0.19366209627906869 ), medium );
+      }
+
+      const SIMDdoubleMask near( cmplt( x, set( 2.0 ) ) );
+
+      if( simdAny( near ) ) {
+         g = blend( g, simdPolynomial( SIMDdouble( x - set( 1.5 ) )
+                                         , -4.9328442020002609e-08, 1.8038197652346406e-07
+                                         , -5.9469983739505155e-07, 2.0616890651298812e-06
+                                         , -6.9752858549045046e-06, 2.286543658874603e-05
+                                         , -7.2658887595578817e-05, 0.00022330981211640024
+                                         , -0.00066193006861799326, 0.0018861348854630824
+                                         , -0.0051459575479159882, 0.013377340952802835
+                                         , -0.032930905299563468, 0.076151039855480551
+                                         , -0.16362291773256007, 0.32158541645431749 ), near );
+      }
+
+      // exp(-x^2) with x^2 as unevaluated sum xx + xxlo
+      SIMDdouble xxlo;
+      const SIMDdouble xx( twoProduct( x, x, xxlo ) );
+      const SIMDdouble e( simdExp( simdNegate( xx ) ) * SIMDdouble( set( 1.0 ) - xxlo ) );
+
+      res = blend( res, SIMDdouble( set( 1.0 ) - e * g ), large );
+   }
+
+   return simdXorSign( res, a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the power function for two vectors of double precision values.
+// \ingroup simd
+//
+// \param a The vector of base values.
+// \param b The vector of exponents.
+// \return The resulting vector.
+//
+// The power function is computed as \f$ a^b = e^{b \ln(a)} \f$, where the logarithm and the
+// product are evaluated in extended precision. The maximum error is 1.4 ulp. Non-positive or
+// non-finite bases and non-finite exponents are handled by the scalar \c std::pow() function.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdPow( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+   const double infinity( std::numeric_limits<double>::infinity() );
+
+   SIMDdouble llo, zlo;
+   const SIMDdouble lhi( simdLogExtended( a, llo ) );
+   const SIMDdouble zhi( twoProduct( b, lhi, zlo ) );
+   zlo = zlo + b * llo;
+
+   const SIMDdouble z( max( set( -745.2 ), min( set( 709.8 ), zhi ) ) );
+   const SIMDdouble n( simdRound( z * set( 1.4426950408889634 ) ) );
+   const SIMDdouble r1( z - n * set( 6.93147180369123816490e-01 ) );
+   const SIMDdouble r ( SIMDdouble( r1 - n * set( 1.90821492927058770002e-10 ) ) + zlo );
+
+   const SIMDdouble res( simdExpReduced( r, n ) );
+
+   const SIMDdoubleMask special(
+      simdOr( simdOr( simdNotLess( set( 0.0 ), a ), simdNotLess( a, set( infinity ) ) ),
+              simdOr( simdNotLess( simdAbs( b ), set( infinity ) ),
+                      simdNotLess( simdAbs( zhi ), set( infinity ) ) ) ) );
+
+   if( simdAny( special ) )
+      return simdFallback( res, special, a, b, []( double x, double y ){ return std::pow( x, y ); } );
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of \f$ e^x \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+//
+// The argument is reduced via \f$ e^x = 2^n e^r \f$ with \f$ |r| \leq \ln(2)/2 \f$ and
+// \f$ e^r \f$ is approximated by a minimax polynomial of degree 6. The maximum error is 1.1 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdExp( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat x( max( set( -104.0F ), min( set( 88.8F ), a ) ) );
+   const SIMDfloat n( simdRound( x * set( 1.44269504F ) ) );
+   const SIMDfloat r1( x - n * set( 0.693359375F ) );
+   const SIMDfloat r ( r1 - n * set( -2.12194440e-4F ) );
+
+   // Minimax approximation of (e^r-1-r)/r^2 on [-ln(2)/2,ln(2)/2]
+   const SIMDfloat p( simdPolynomial( r, 0.0013926184F, 0.0083631789F, 0.041666556F
+                                       , 0.16666576F, 0.5F ) );
+
+   return simdLdexp( SIMDfloat( set( 1.0F ) + SIMDfloat( r + SIMDfloat( r * r ) * p ) ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of \f$ e^x-1 \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values in the range \f$ [0..20] \f$.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdExpm1( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat n( simdRound( a * set( 1.44269504F ) ) );
+   const SIMDfloat r1( a - n * set( 0.693359375F ) );
+   const SIMDfloat r ( r1 - n * set( -2.12194440e-4F ) );
+
+   // Minimax approximation of (e^r-1-r)/r^2 on [-ln(2)/2,ln(2)/2]
+   const SIMDfloat p( simdPolynomial( r, 0.0013926184F, 0.0083631789F, 0.041666556F
+                                       , 0.16666576F, 0.5F ) );
+
+   const SIMDfloat q( r + SIMDfloat( r * r ) * p );
+   const SIMDfloat t( simdPow2( n ) );
+
+   return SIMDfloat( t - set( 1.0F ) ) + t * q;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the natural logarithm for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+//
+// The argument is decomposed into \f$ a = 2^e (1+f) \f$ with \f$ \sqrt{2}/2 \leq 1+f < \sqrt{2}
+// \f$ and \f$ \ln(1+f) = 2\,\mathrm{atanh}(f/(2+f)) \f$ is approximated by a minimax polynomial.
+// The maximum error is 1 ulp. Zero, negative values, infinity and NaN are handled according to
+// the C++ standard library.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdLog( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloatMask tiny( cmplt( a, set( std::numeric_limits<float>::min() ) ) );
+   const SIMDfloat x( blend( a, SIMDfloat( a * set( 33554432.0F ) ), tiny ) );  // 2^25
+
+   SIMDfloat e( simdExponent( x ) );
+   e = blend( e, SIMDfloat( e - set( 25.0F ) ), tiny );
+
+   SIMDfloat m( simdMantissa( x ) );
+   const SIMDfloatMask large( cmplt( set( 1.41421356F ), m ) );
+   m = blend( m, SIMDfloat( m * set( 0.5F ) ), large );
+   e = blend( e, SIMDfloat( e + set( 1.0F ) ), large );
+
+   const SIMDfloat f( m - set( 1.0F ) );
+   const SIMDfloat s( f / SIMDfloat( f + set( 2.0F ) ) );
+   const SIMDfloat z( s * s );
+
+   // Minimax approximation of (2*atanh(s)/s-2)/s^2 on [0,0.02944]
+   const SIMDfloat R( z * simdPolynomial( z, 0.29580045F, 0.39988777F, 0.66666687F ) );
+
+   const SIMDfloat t( s * SIMDfloat( f - R ) - e * set( -2.12194440e-4F ) );
+   SIMDfloat res( e * set( 0.693359375F ) + SIMDfloat( f - t ) );
+
+   const float infinity( std::numeric_limits<float>::infinity() );
+   res = blend( res, a, simdNotLess( a, set( infinity ) ) );
+   res = blend( res, set( -infinity ), cmpeq( a, set( 0.0F ) ) );
+   res = blend( res, set( std::numeric_limits<float>::quiet_NaN() ), cmplt( a, set( 0.0F ) ) );
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sine of a vector of single precision values shifted by quarter periods.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \param shift The number of quarter periods (0 for the sine, 1 for the cosine).
+// \return The vector of values \f$ \sin(a + shift \cdot \pi/2) \f$.
+//
+// The argument is reduced via a four-part Cody-Waite reduction to \f$ |r| \leq \pi/4 \f$, where
+// the reduced argument is kept as unevaluated sum of two values. The sine and cosine of the
+// reduced argument are approximated by minimax polynomials of degree 9 and 8, respectively.
+// Arguments with \f$ |a| \geq 10^4 \f$, infinity and NaN are not handled by this kernel.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdSinKernel( const SIMDfloat& a, float shift ) noexcept
+{
+   const SIMDfloat q( simdRound( a * set( 0.636619772F ) ) );
+
+   // Reduced argument as unevaluated sum r + rr
+   const SIMDfloat r1( a - q * set( 1.5703125F ) );
+   const SIMDfloat w1( q * set( 4.83751297e-4F ) );
+   const SIMDfloat r2( r1 - w1 );
+   const SIMDfloat bb( r2 - r1 );
+   const SIMDfloat e2( SIMDfloat( r1 - SIMDfloat( r2 - bb ) ) - SIMDfloat( w1 + bb ) );
+   const SIMDfloat w3( q * set( 7.54953362e-8F ) );
+   const SIMDfloat r3( r2 - w3 );
+   const SIMDfloat cc( r3 - r2 );
+   const SIMDfloat e3( SIMDfloat( r2 - SIMDfloat( r3 - cc ) ) - SIMDfloat( w3 + cc ) );
+   const SIMDfloat u ( SIMDfloat( e2 + e3 ) - q * set( 2.56334407e-12F ) );
+   const SIMDfloat r ( r3 + u );
+   const SIMDfloat rr( SIMDfloat( r3 - r ) + u );
+
+   const SIMDfloat z( r * r );
+
+   // Minimax approximation of (sin(r)-r)/r^3 on [0,pi/4]
+   const SIMDfloat S( simdPolynomial( z, 2.72496209e-06F, -1.98400841e-04F
+                                       , 8.33333191e-03F, -1.66666672e-01F ) );
+
+   // Minimax approximation of (cos(r)-1+r^2/2)/r^4 on [0,pi/4]
+   const SIMDfloat C( simdPolynomial( z, -2.73007032e-07F, 2.48005981e-05F
+                                       , -1.38888881e-03F, 4.16666679e-02F ) );
+
+   const SIMDfloat hz( z * set( 0.5F ) );
+   const SIMDfloat v ( set( 1.0F ) - hz );
+
+   const SIMDfloat sine( r + SIMDfloat( SIMDfloat( r * z ) * S + rr * v ) );
+   const SIMDfloat cosine( v + SIMDfloat( SIMDfloat( SIMDfloat( set( 1.0F ) - v ) - hz ) +
+                                          SIMDfloat( SIMDfloat( z * z ) * C - r * rr ) ) );
+
+   // Quadrant j = (q+shift) mod 4
+   const SIMDfloat k( q + set( shift ) );
+   const SIMDfloat j( k - set( 4.0F ) * simdRound( k * set( 0.25F ) - set( 0.375F ) ) );
+   const SIMDfloat odd( j - set( 2.0F ) * simdRound( j * set( 0.5F ) - set( 0.25F ) ) );
+
+   const SIMDfloat res( blend( sine, cosine, cmplt( set( 0.5F ), odd ) ) );
+   return blend( res, simdNegate( res ), cmplt( set( 1.5F ), j ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the sine for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+//
+// The maximum error is 1 ulp. Arguments with \f$ |a| \geq 10^4 \f$, infinity and NaN are
+// handled by means of the double precision kernel.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdSin( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat res( blend( simdSinKernel( a, 0.0F ), a, cmpeq( a, set( 0.0F ) ) ) );
+   const SIMDfloatMask large( simdNotLess( simdAbs( a ), set( 1.0E4F ) ) );
+
+   if( simdAny( large ) )
+      return blend( res, simdViaDouble( a, []( const SIMDdouble& x ){ return simdSin( x ); } )
+                      , large );
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the cosine for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+//
+// The maximum error is 1 ulp. Arguments with \f$ |a| \geq 10^4 \f$, infinity and NaN are
+// handled by means of the double precision kernel.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdCos( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat res( simdSinKernel( a, 1.0F ) );
+   const SIMDfloatMask large( simdNotLess( simdAbs( a ), set( 1.0E4F ) ) );
+
+   if( simdAny( large ) )
+      return blend( res, simdViaDouble( a, []( const SIMDdouble& x ){ return simdCos( x ); } )
+                      , large );
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the hyperbolic tangent for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+//
+// The hyperbolic tangent is computed via \f$ \tanh(|x|) = e/(e+2) \f$ with \f$ e = e^{2|x|}-1
+// \f$. The maximum error is 2.5 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdTanh( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat x( min( set( 10.0F ), simdAbs( a ) ) );
+   const SIMDfloat e( simdExpm1( SIMDfloat( x + x ) ) );
+
+   return simdXorSign( SIMDfloat( e / SIMDfloat( e + set( 2.0F ) ) ), a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the error function for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \return The resulting vector.
+//
+// For \f$ |x| < 1 \f$ the error function is approximated by \f$ x + x P(x^2) \f$, for larger
+// arguments via \f$ 1 - e^{-x^2} G(x) \f$, where \a G is approximated by a minimax polynomial
+// on \f$ [1..4] \f$. The maximum error is 2.3 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdErf( const SIMDfloat& a ) noexcept
+{
+   const SIMDfloat x( min( set( 4.0F ), simdAbs( a ) ) );
+   const SIMDfloatMask small( cmplt( x, set( 1.0F ) ) );
+   const SIMDfloatMask large( simdNotLess( x, set( 1.0F ) ) );
+
+   SIMDfloat res;
+
+   if( simdAny( small ) )
+   {
+      // Minimax approximation of erf(x)/x-1 in x^2 on [0,1]
+      res = x + x * simdPolynomial( SIMDfloat( x * x ), 7.87587487e-05F, -8.01686430e-04F
+                                  , 5.18908724e-03F, -2.68542115e-02F, 1.12835944e-01F
+                                  , -3.76126260e-01F, 1.28379107e-01F );
+   }
+
+   if( simdAny( large ) )
+   {
+      // Minimax approximation of erfc(x)*exp(x^2) on [1,4]
+      const SIMDfloat g( simdPolynomial( SIMDfloat( x - set( 2.5F ) )
+                                       , 1.61189075e-06F, -6.37786206e-06F, 1.46895572e-05F
+                                       , -5.36272928e-05F, 2.12313564e-04F, -7.38927862e-04F
+                                       , 2.46650865e-03F, -7.99938850e-03F, 2.49380562e-02F
+                                       , -7.43475929e-02F, 2.10806370e-01F ) );
+
+      // exp(-x^2) with x^2 as unevaluated sum xx + xxlo
+      SIMDfloat xxlo;
+      const SIMDfloat xx( twoProduct( x, x, xxlo ) );
+      const SIMDfloat e( simdExp( simdNegate( xx ) ) * SIMDfloat( set( 1.0F ) - xxlo ) );
+
+      res = blend( res, SIMDfloat( set( 1.0F ) - e * g ), large );
+   }
+
+   return simdXorSign( res, a );
+}
+/*! \endcond */
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Portable computation of the power function for two vectors of single precision values.
+// \ingroup simd
+//
+// \param a The vector of base values.
+// \param b The vector of exponents.
+// \return The resulting vector.
+//
+// The power function is computed as \f$ a^b = e^{b \ln(a)} \f$ by means of the double precision
+// kernels. The maximum error is 1 ulp. Non-positive or non-finite bases and non-finite exponents
+// are handled by the scalar \c std::pow() function.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdPow( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+   const float infinity( std::numeric_limits<float>::infinity() );
+
+   const SIMDfloat res( simdViaDouble( a, b, []( const SIMDdouble& x, const SIMDdouble& y ){
+      return simdExp( SIMDdouble( y * simdLog( x ) ) );
+   } ) );
+
+   const SIMDfloatMask special(
+      simdOr( simdOr( simdNotLess( set( 0.0F ), a ), simdNotLess( a, set( infinity ) ) ),
+              simdNotLess( simdAbs( b ), set( infinity ) ) ) );
+
+   if( simdAny( special ) )
+      return simdFallback( res, special, a, b, []( float x, float y ){ return std::pow( x, y ); } );
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
+
+#endif
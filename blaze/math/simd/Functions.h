@@ -52,8 +52,10 @@
 #include <blaze/math/simd/Bitand.h>
 #include <blaze/math/simd/Bitor.h>
 #include <blaze/math/simd/Bitxor.h>
+#include <blaze/math/simd/Blend.h>
 #include <blaze/math/simd/Cbrt.h>
 #include <blaze/math/simd/Ceil.h>
+#include <blaze/math/simd/Compare.h>
 #include <blaze/math/simd/Conj.h>
 #include <blaze/math/simd/Cos.h>
 #include <blaze/math/simd/Cosh.h>
@@ -74,6 +76,8 @@
 #include <blaze/math/simd/Log.h>
 #include <blaze/math/simd/Log2.h>
 #include <blaze/math/simd/Log10.h>
+#include <blaze/math/simd/Maskload.h>
+#include <blaze/math/simd/Maskstore.h>
 #include <blaze/math/simd/Max.h>
 #include <blaze/math/simd/Min.h>
 #include <blaze/math/simd/Mult.h>
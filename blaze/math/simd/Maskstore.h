@@ -0,0 +1,231 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Maskstore.h
+//  \brief Header file for the SIMD masked store functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_MASKSTORE_H_
+#define _BLAZE_MATH_SIMD_MASKSTORE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Maskload.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores the first \a n elements of a vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 4-byte integral vector to be stored.
+// \param n The number of elements to be stored.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 4-byte integral values. The
+// memory behind the first \a n elements is not accessed, i.e. the function can be used to store
+// the remainder of an unpadded array. The given address is not required to be properly aligned.
+// Note that \a n must not exceed the number of elements of the SIMD vector.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_t< IsIntegral_v<T1> && HasSize_v<T1,4UL> >
+   maskstore( T1* address, const SIMDi32<T2>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi32( address, static_cast<__mmask16>( ( 1U << n ) - 1U ), (~value).value );
+#elif BLAZE_AVX2_MODE
+   _mm256_maskstore_epi32( reinterpret_cast<int*>( address ), tailmask32( n ), (~value).value );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores the first \a n elements of a vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 8-byte integral vector to be stored.
+// \param n The number of elements to be stored.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 8-byte integral values. The
+// memory behind the first \a n elements is not accessed, i.e. the function can be used to store
+// the remainder of an unpadded array. The given address is not required to be properly aligned.
+// Note that \a n must not exceed the number of elements of the SIMD vector.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_t< IsIntegral_v<T1> && HasSize_v<T1,8UL> >
+   maskstore( T1* address, const SIMDi64<T2>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n <= T2::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_epi64( address, static_cast<__mmask8>( ( 1U << n ) - 1U ), (~value).value );
+#elif BLAZE_AVX2_MODE
+   _mm256_maskstore_epi64( reinterpret_cast<long long*>( address ), tailmask64( n ),
+                           (~value).value );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores the first \a n elements of a vector of 'float' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \param n The number of elements to be stored.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 'float' values. The memory behind
+// the first \a n elements is not accessed, i.e. the function can be used to store the remainder
+// of an unpadded array. The given address is not required to be properly aligned. Note that \a n
+// must not exceed the number of elements of the SIMD vector.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void maskstore( float* address, const SIMDf32<T>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n <= SIMDfloat::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_ps( address, static_cast<__mmask16>( ( 1U << n ) - 1U ),
+                          (~value).eval().value );
+#elif BLAZE_AVX_MODE
+   _mm256_maskstore_ps( address, tailmask32( n ), (~value).eval().value );
+#else
+   float tmp[SIMDfloat::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores the first \a n elements of a vector of 'double' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'double' vector to be stored.
+// \param n The number of elements to be stored.
+// \return void
+//
+// This function stores the first \a n elements of a vector of 'double' values. The memory
+// behind the first \a n elements is not accessed, i.e. the function can be used to store the
+// remainder of an unpadded array. The given address is not required to be properly aligned.
+// Note that \a n must not exceed the number of elements of the SIMD vector.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void maskstore( double* address, const SIMDf64<T>& value, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n <= SIMDdouble::size, "Invalid number of elements" );
+
+#if BLAZE_AVX512F_MODE
+   _mm512_mask_storeu_pd( address, static_cast<__mmask8>( ( 1U << n ) - 1U ),
+                          (~value).eval().value );
+#elif BLAZE_AVX_MODE
+   _mm256_maskstore_pd( address, tailmask64( n ), (~value).eval().value );
+#else
+   double tmp[SIMDdouble::size];
+   storeu( tmp, value );
+   for( size_t i=0UL; i<n; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -357,7 +357,7 @@ template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE void storeu( float* address, const SIMDf32<T>& value ) noexcept
 {
 #if BLAZE_AVX512F_MODE
-   _mm512_storeu_ps( address, (~value).value );
+   _mm512_storeu_ps( address, (~value).eval().value );
 #elif BLAZE_MIC_MODE
    const SIMDfloat tmp( (~value).eval().value );
    _mm512_packstorelo_ps( address     , tmp.value );
@@ -427,7 +427,7 @@ template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE void storeu( double* address, const SIMDf64<T>& value ) noexcept
 {
 #if BLAZE_AVX512F_MODE
-   _mm512_storeu_pd( address, (~value).value );
+   _mm512_storeu_pd( address, (~value).eval().value );
 #elif BLAZE_MIC_MODE
    const SIMDdouble tmp( (~value).eval().value );
    _mm512_packstorelo_pd( address    , tmp.value );
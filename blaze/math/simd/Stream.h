@@ -342,7 +342,7 @@ BLAZE_ALWAYS_INLINE void stream( float* address, const SIMDf32<T>& value ) noexc
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
 #if BLAZE_AVX512F_MODE
-   _mm512_stream_ps( address, (~value).value );
+   _mm512_stream_ps( address, (~value).eval().value );
 #elif BLAZE_MIC_MODE
    _mm512_storenr_ps( address, (~value).eval().value );
 #elif BLAZE_AVX_MODE
@@ -406,7 +406,7 @@ BLAZE_ALWAYS_INLINE void stream( double* address, const SIMDf64<T>& value ) noex
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
 #if BLAZE_AVX512F_MODE
-   _mm512_stream_pd( address, (~value).value );
+   _mm512_stream_pd( address, (~value).eval().value );
 #elif BLAZE_MIC_MODE
    _mm512_storenr_pd( address, (~value).eval().value );
 #elif BLAZE_AVX_MODE
@@ -0,0 +1,267 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Async.h
+//  \brief Header file for the asynchronous evaluation of expressions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_ASYNC_H_
+#define _BLAZE_MATH_SMP_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <exception>
+#include <memory>
+#include <vector>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/Future.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/mpl/If.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/math/smp/threads/Async.h>
+#else
+#include <blaze/math/smp/default/Async.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCASSIGNER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the asynchronous assignment of two operands.
+// \ingroup smp
+//
+// The AsyncAssigner class template references the target operand and stores the source operand
+// according to the given type, i.e. expressions are stored by value and all other operands are
+// referenced.
+*/
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the stored source operand
+struct AsyncAssigner
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssigner class template.
+   //
+   // \param target The target operand to be assigned to.
+   // \param source The source operand to be assigned to the target.
+   */
+   template< typename T >  // Type of the given source operand
+   inline AsyncAssigner( Target& target, const T& source )
+      : target_( target )  // The target operand
+      , source_( source )  // The source operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment between the two operands.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      target_ = source_;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Target& target_;  //!< The target operand.
+   Source  source_;  //!< The source operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous evaluation functions */
+//@{
+template< typename Callable >
+Future asyncCall( Callable task, const std::vector<Future>& deps = {} );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+Future asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                    const std::vector<Future>& deps = {} );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                    const std::vector<Future>& deps = {} );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous execution of the given task.
+// \ingroup smp
+//
+// \param task The task to be executed, called as \a task().
+// \param deps The asynchronous evaluations the task depends on.
+// \return The future of the task.
+//
+// This function starts the asynchronous execution of the given task and immediately returns a
+// Future for its completion. The task is started as soon as all given dependencies have been
+// completed. In case of the C++11 and Boost thread parallelization, the task is executed by the
+// thread pool and any (compound) assignment within the task is parallelized by means of the
+// threads of the pool that are not busy with other tasks, i.e. several concurrently executed
+// tasks share the threads of the pool. In case of the OpenMP or HPX parallelization or in case
+// no parallelization is active, the task is executed synchronously as soon as all dependencies
+// have been completed. An exception thrown by the task (or by any of its dependencies) is
+// stored in the future and rethrown by Future::wait(). In case a dependency has thrown an
+// exception, the task is not executed.
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, X;
+   blaze::DynamicVector<double> d, y, z;
+   // ... Resizing and initialization
+
+   // Starting two independent evaluations
+   blaze::Future fx = blaze::asyncAssign( X, A * B );
+   blaze::Future fy = blaze::asyncCall( [&]() { y = inv( C ) * d; } );
+
+   // Starting an evaluation that depends on both previous evaluations
+   blaze::Future fz = blaze::asyncCall( [&]() { z = X * y; }, { fx, fy } );
+
+   fz.wait();
+   \endcode
+
+// Note that the task is executed outside of any serial section that is active in the calling
+// thread and that all operands used by the task must not be destroyed or modified before the
+// task has been completed. Also note that an expression involving the results of dependencies
+// has to be created within the task (as in the example above), since the size of an expression
+// is checked on creation.
+*/
+template< typename Callable >  // Type of the task
+Future asyncCall( Callable task, const std::vector<Future>& deps )
+{
+   const auto state( std::make_shared<FutureState>() );
+
+   auto run = [state,task]() mutable
+   {
+      try {
+         task();
+      }
+      catch( ... ) {
+         state->complete( std::current_exception() );
+         return;
+      }
+      state->complete( nullptr );
+   };
+
+   whenAll( deps, [state,run]( std::exception_ptr error )
+   {
+      if( error != nullptr )
+         state->complete( error );
+      else
+         smpLaunch( run );
+   } );
+
+   return Future( state );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (or vector expression) to be assigned.
+// \param deps The asynchronous evaluations the assignment depends on.
+// \return The future of the assignment.
+//
+// This function starts the asynchronous evaluation of the assignment \a lhs = \a rhs (see
+// asyncCall() for details). The given expression is stored by value, whereas the target vector
+// and all operands of the expression are referenced, i.e. they must not be destroyed or
+// modified before the assignment has been completed. In case the assignment fails (e.g. due to
+// a size mismatch), the exception is rethrown by Future::wait().
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+Future asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                    const std::vector<Future>& deps )
+{
+   using Operand = If_t< IsExpression_v<VT2>, const VT2, const VT2& >;
+
+   return asyncCall( AsyncAssigner<VT1,Operand>( ~lhs, ~rhs ), deps );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (or matrix expression) to be assigned.
+// \param deps The asynchronous evaluations the assignment depends on.
+// \return The future of the assignment.
+//
+// This function starts the asynchronous evaluation of the assignment \a lhs = \a rhs (see
+// asyncCall() for details). The given expression is stored by value, whereas the target matrix
+// and all operands of the expression are referenced, i.e. they must not be destroyed or
+// modified before the assignment has been completed. In case the assignment fails (e.g. due to
+// a size mismatch), the exception is rethrown by Future::wait().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                    const std::vector<Future>& deps )
+{
+   using Operand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
+
+   return asyncCall( AsyncAssigner<MT1,Operand>( ~lhs, ~rhs ), deps );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
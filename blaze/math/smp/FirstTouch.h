@@ -0,0 +1,298 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/FirstTouch.h
+//  \brief Header file for the parallel first-touch initialization of dense arrays
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether an array of the given size is initialized by a parallel first touch.
+// \ingroup smp
+//
+// \param size The number of elements of the array.
+// \param threshold The SMP threshold for the assignment of the according data structure.
+// \return \a true in case the array is initialized in parallel, \a false if not.
+*/
+inline bool isFirstTouchActive( size_t size, size_t threshold )
+{
+   return BLAZE_SMP_FIRST_TOUCH != 0 &&
+          size > 0UL && size >= threshold &&
+          getNumThreads() > 1UL &&
+          !isSerialSectionActive() && !isParallelSectionActive();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes a strided array page by page, distributing the pages round-robin among
+//        all threads.
+// \ingroup smp
+//
+// \param v Pointer to the first element of the array.
+// \param total The total number of elements of the array.
+// \param spacing The number of elements per row (or column) including the padding elements.
+// \param limit The number of non-padding elements per row (or column).
+// \param value The value of all non-padding elements.
+// \return void
+//
+// All padding elements are default initialized.
+*/
+template< typename Type >  // Data type of the array elements
+void firstTouchInterleaved( Type* v, size_t total, size_t spacing, size_t limit,
+                            const Type& value )
+{
+   constexpr size_t pageSize( 4096UL );
+   constexpr size_t elementsPerPage( pageSize >= sizeof(Type) ? pageSize / sizeof(Type) : 1UL );
+
+   const size_t threads( getNumThreads() );
+   const size_t offset ( ( reinterpret_cast<std::uintptr_t>( v ) % pageSize ) / sizeof(Type) );
+   const size_t pages  ( ( total + offset - 1UL ) / elementsPerPage + 1UL );
+
+   smpFor( threads, [=]( size_t t )
+   {
+      for( size_t page=t; page<pages; page+=threads )
+      {
+         const size_t begin( page == 0UL ? 0UL : page*elementsPerPage - offset );
+         const size_t end  ( min( (page+1UL)*elementsPerPage - offset, total ) );
+
+         for( size_t k=begin, index=begin%spacing; k<end; ++k ) {
+            v[k] = ( index < limit )?( value ):( Type() );
+            if( ++index == spacing ) index = 0UL;
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the block size of the SMP assignment for the given number of elements.
+// \ingroup smp
+//
+// \param size The number of elements to be distributed.
+// \param threads The number of threads.
+// \return The number of elements per thread.
+*/
+template< typename Type >  // Data type of the array elements
+size_t firstTouchBlockSize( size_t size, size_t threads )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t addon     ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( size / threads + addon );
+   const size_t rest      ( equalShare & ( SIMDSIZE - 1UL ) );
+
+   return ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first-touch initialization of the elements of a dense vector.
+// \ingroup smp
+//
+// \param v Pointer to the first element of the vector.
+// \param n The size of the vector.
+// \param capacity The capacity of the vector including the padding elements.
+// \param value The initial value of all \a n vector elements.
+// \return \a true in case the vector has been initialized, \a false if not.
+//
+// This function initializes the given vector in parallel in case the parallel first-touch
+// initialization is enabled (see the \c BLAZE_SMP_FIRST_TOUCH switch) and the vector is large
+// enough to be assigned in parallel. The \a n elements of the vector are set to \a value, all
+// padding elements are default initialized. In mode 1 every thread initializes the elements it
+// processes during an SMP assignment, in mode 2 the memory pages are initialized round-robin by
+// all threads. In case the vector is not initialized, the function returns \a false and the
+// caller is responsible for the initialization.
+*/
+template< typename Type >  // Data type of the vector elements
+bool smpFirstTouch( Type* v, size_t n, size_t capacity, const Type& value )
+{
+   if( !IsVectorizable_v<Type> || !isFirstTouchActive( n, SMP_DVECASSIGN_THRESHOLD ) )
+      return false;
+
+   if( BLAZE_SMP_FIRST_TOUCH == 2 ) {
+      firstTouchInterleaved( v, capacity, capacity, n, value );
+      return true;
+   }
+
+   const size_t sizePerThread( firstTouchBlockSize<Type>( n, getNumThreads() ) );
+   const size_t blocks( ( n - 1UL ) / sizePerThread + 1UL );
+
+   smpFor( blocks, [=]( size_t i )
+   {
+      const size_t begin( i*sizePerThread );
+      const size_t end  ( min( begin+sizePerThread, n ) );
+
+      for( size_t k=begin; k<end; ++k ) {
+         v[k] = value;
+      }
+
+      if( i+1UL == blocks ) {
+         for( size_t k=n; k<capacity; ++k ) {
+            v[k] = Type();
+         }
+      }
+   } );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first-touch initialization of the elements of a dense matrix.
+// \ingroup smp
+//
+// \param v Pointer to the first element of the matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param spacing The spacing between two rows (row-major) or columns (column-major).
+// \param value The initial value of all \f$ m \times n \f$ matrix elements.
+// \return \a true in case the matrix has been initialized, \a false if not.
+//
+// This function initializes the given matrix in parallel in case the parallel first-touch
+// initialization is enabled (see the \c BLAZE_SMP_FIRST_TOUCH switch) and the matrix is large
+// enough to be assigned in parallel. All \f$ m \times n \f$ elements of the matrix are set to
+// \a value, all padding elements are default initialized. In mode 1 every thread initializes
+// the block of the matrix it processes during an SMP assignment, in mode 2 the memory pages
+// are initialized round-robin by all threads. In case the matrix is not initialized, the
+// function returns \a false and the caller is responsible for the initialization.
+*/
+template< bool SO          // Storage order of the matrix
+        , typename Type >  // Data type of the matrix elements
+bool smpFirstTouch( Type* v, size_t m, size_t n, size_t spacing, const Type& value )
+{
+   if( !IsVectorizable_v<Type> || !isFirstTouchActive( m*n, SMP_DMATASSIGN_THRESHOLD ) )
+      return false;
+
+   if( BLAZE_SMP_FIRST_TOUCH == 2 ) {
+      firstTouchInterleaved( v, ( SO ? n : m )*spacing, spacing, ( SO ? m : n ), value );
+      return true;
+   }
+
+   const ThreadMapping threads( createThreadMapping( getNumThreads(), m, n, SO ) );
+
+   const size_t rowsPerThread( firstTouchBlockSize<Type>( m, threads.first  ) );
+   const size_t colsPerThread( firstTouchBlockSize<Type>( n, threads.second ) );
+
+   const size_t rowBlocks( ( m - 1UL ) / rowsPerThread + 1UL );
+   const size_t colBlocks( ( n - 1UL ) / colsPerThread + 1UL );
+
+   smpFor( rowBlocks*colBlocks, [=]( size_t k )
+   {
+      const size_t i( k / colBlocks );
+      const size_t j( k % colBlocks );
+
+      const size_t ibegin( i*rowsPerThread );
+      const size_t jbegin( j*colsPerThread );
+      const size_t iend  ( min( ibegin+rowsPerThread, m ) );
+      const size_t jend  ( min( jbegin+colsPerThread, n ) );
+
+      if( !SO )
+      {
+         const size_t jpad( j+1UL == colBlocks ? spacing : jend );
+
+         for( size_t row=ibegin; row<iend; ++row ) {
+            for( size_t col=jbegin; col<jend; ++col )
+               v[row*spacing+col] = value;
+            for( size_t col=jend; col<jpad; ++col )
+               v[row*spacing+col] = Type();
+         }
+      }
+      else
+      {
+         const size_t ipad( i+1UL == rowBlocks ? spacing : iend );
+
+         for( size_t col=jbegin; col<jend; ++col ) {
+            for( size_t row=ibegin; row<iend; ++row )
+               v[col*spacing+row] = value;
+            for( size_t row=iend; row<ipad; ++row )
+               v[col*spacing+row] = Type();
+         }
+      }
+   } );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
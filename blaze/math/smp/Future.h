@@ -0,0 +1,374 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Future.h
+//  \brief Header file for the Future class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_FUTURE_H_
+#define _BLAZE_MATH_SMP_FUTURE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS FUTURESTATE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The shared state of an asynchronous evaluation.
+// \ingroup smp
+//
+// The FutureState class represents the completion state of an asynchronous evaluation, which
+// is shared between the evaluation and all Future handles. In addition to the completion flag
+// and the (optional) exception of the evaluation, it stores all continuations that have to be
+// executed on completion (i.e. the dependent asynchronous evaluations).
+*/
+class FutureState
+{
+ public:
+   //**Type definitions****************************************************************************
+   using Continuation = std::function<void(std::exception_ptr)>;  //!< Type of a continuation.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Default constructor for the FutureState class.
+   */
+   inline FutureState()
+      : done_         ( false )  // Completion flag
+      , error_        ()         // The exception thrown by the evaluation
+      , continuations_()         // The continuations executed on completion
+      , mutex_        ()         // Synchronization mutex
+      , condition_    ()         // Wait condition for the completion
+   {}
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   FutureState( const FutureState& ) = delete;
+   FutureState& operator=( const FutureState& ) = delete;
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns whether the evaluation has been completed.
+   //
+   // \return \a true in case the evaluation has been completed, \a false if not.
+   */
+   inline bool isDone() const {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      return done_;
+   }
+
+   /*!\brief Waiting for the completion of the evaluation.
+   //
+   // \return The exception thrown by the evaluation (empty in case of success).
+   */
+   inline std::exception_ptr wait() const {
+      std::unique_lock<std::mutex> lock( mutex_ );
+      condition_.wait( lock, [this]() { return done_; } );
+      return error_;
+   }
+
+   /*!\brief Registering a continuation to be executed on completion.
+   //
+   // \param continuation The continuation, called with the exception of the evaluation.
+   // \return void
+   //
+   // In case the evaluation has already been completed, the continuation is executed
+   // immediately by the calling thread.
+   */
+   inline void then( Continuation continuation ) {
+      std::unique_lock<std::mutex> lock( mutex_ );
+      if( !done_ ) {
+         continuations_.push_back( std::move( continuation ) );
+         return;
+      }
+      const std::exception_ptr error( error_ );
+      lock.unlock();
+      continuation( error );
+   }
+
+   /*!\brief Marking the evaluation as completed.
+   //
+   // \param error The exception thrown by the evaluation (empty in case of success).
+   // \return void
+   //
+   // This function wakes up all threads waiting for the completion and afterwards executes
+   // all registered continuations.
+   */
+   inline void complete( std::exception_ptr error ) {
+      std::vector<Continuation> continuations;
+      {
+         std::lock_guard<std::mutex> lock( mutex_ );
+         BLAZE_INTERNAL_ASSERT( !done_, "Repeated completion detected" );
+         done_  = true;
+         error_ = error;
+         continuations.swap( continuations_ );
+      }
+      condition_.notify_all();
+      for( Continuation& continuation : continuations ) {
+         continuation( error );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   bool done_;                                  //!< Completion flag.
+   std::exception_ptr error_;                   //!< The exception thrown by the evaluation.
+   std::vector<Continuation> continuations_;    //!< The continuations executed on completion.
+   mutable std::mutex mutex_;                   //!< Synchronization mutex.
+   mutable std::condition_variable condition_;  //!< Wait condition for the completion.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for an asynchronous evaluation.
+// \ingroup smp
+//
+// The Future class represents the result of an asynchronous evaluation started via asyncCall()
+// or asyncAssign(). It allows to query whether the evaluation has been completed and to wait
+// for its completion. Additionally, a future can be passed as dependency to further asynchronous
+// evaluations, which are started as soon as all their dependencies have been completed. In
+// contrast to \c std::future, a Future can be copied and waited for an arbitrary number of
+// times. A default constructed Future does not refer to any evaluation and is always ready.
+*/
+class Future
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline Future() = default;
+
+   /*! \cond BLAZE_INTERNAL */
+   explicit inline Future( std::shared_ptr<FutureState> state );
+   /*! \endcond */
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool valid() const noexcept;
+   inline bool ready() const;
+   inline void wait () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename Callable >
+   friend void whenAll( const std::vector<Future>& deps, Callable continuation );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<FutureState> state_;  //!< The shared state of the evaluation.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a handle for the given evaluation.
+//
+// \param state The shared state of the evaluation.
+*/
+inline Future::Future( std::shared_ptr<FutureState> state )
+   : state_( std::move( state ) )  // The shared state of the evaluation
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the future refers to an asynchronous evaluation.
+//
+// \return \a true in case the future refers to an evaluation, \a false if not.
+*/
+inline bool Future::valid() const noexcept
+{
+   return state_ != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the asynchronous evaluation has been completed.
+//
+// \return \a true in case the evaluation has been completed, \a false if not.
+*/
+inline bool Future::ready() const
+{
+   return state_ == nullptr || state_->isDone();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the asynchronous evaluation.
+//
+// \return void
+//
+// This function blocks until the asynchronous evaluation has been completed. In case the
+// evaluation (or one of its dependencies) has thrown an exception, the exception is rethrown.
+// Note that this function should not be called from within an asynchronous evaluation, since
+// it blocks a thread of the thread pool. Instead, the awaited evaluation should be specified
+// as dependency.
+*/
+inline void Future::wait() const
+{
+   if( state_ == nullptr )
+      return;
+
+   const std::exception_ptr error( state_->wait() );
+
+   if( error != nullptr ) {
+      std::rethrow_exception( error );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given continuation on completion of all given dependencies.
+// \ingroup smp
+//
+// \param deps The asynchronous evaluations to wait for.
+// \param continuation The continuation, called as \a continuation(error).
+// \return void
+//
+// This function registers the given continuation with all given dependencies. The continuation
+// is executed exactly once by the thread completing the last dependency, or immediately by the
+// calling thread in case all dependencies have already been completed. In case any dependency
+// has thrown an exception, the first of these exceptions is passed to the continuation.
+*/
+template< typename Callable >  // Type of the continuation
+void whenAll( const std::vector<Future>& deps, Callable continuation )
+{
+   struct Join
+   {
+      explicit Join( size_t count, Callable c )
+         : pending( count ), error(), mutex(), continuation( std::move( c ) )
+      {}
+
+      void release( std::exception_ptr e ) {
+         if( e != nullptr ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            if( error == nullptr ) error = e;
+         }
+         if( pending.fetch_sub( 1UL ) == 1UL ) {
+            continuation( error );
+         }
+      }
+
+      std::atomic<size_t> pending;       // The number of outstanding dependencies
+      std::exception_ptr  error;         // The first exception of any dependency
+      std::mutex          mutex;         // Synchronization mutex for the exception
+      Callable            continuation;  // The continuation to be executed
+   };
+
+   const auto join( std::make_shared<Join>( deps.size()+1UL, std::move( continuation ) ) );
+
+   for( const Future& dep : deps ) {
+      if( dep.state_ == nullptr )
+         join->release( nullptr );
+      else
+         dep.state_->then( [join]( std::exception_ptr e ) { join->release( e ); } );
+   }
+
+   join->release( nullptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,279 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ParallelReduce.h
+//  \brief Header file for the SMP parallel total reduction of dense vectors and matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_PARALLELREDUCE_H_
+#define _BLAZE_MATH_SMP_PARALLELREDUCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a total reduction of the given size is executed in parallel.
+// \ingroup smp
+//
+// \param size The total number of elements to be reduced.
+// \param threshold The SMP threshold of the reduction.
+// \return \a true in case the reduction is executed in parallel, \a false if not.
+*/
+inline bool isSMPReduceActive( size_t size, size_t threshold )
+{
+   return size > 1UL && size >= threshold &&
+          getNumThreads() > 1UL &&
+          !isSerialSectionActive() && !isParallelSectionActive();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the block size of a parallel total reduction.
+// \ingroup smp
+//
+// \param size The number of elements to be reduced.
+// \param threads The number of threads.
+// \param granularity The block size is rounded up to a multiple of this value.
+// \return The number of elements per block.
+*/
+inline size_t smpReduceBlockSize( size_t size, size_t threads, size_t granularity )
+{
+   const size_t addon     ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( size / threads + addon );
+   const size_t rest      ( equalShare % granularity );
+
+   return ( rest )?( equalShare - rest + granularity ):( equalShare );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP REDUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pairwise combination of the partial results of a reproducible total reduction.
+// \ingroup smp
+//
+// \param partial The partial results of all blocks.
+// \param lo The index of the first partial result to be combined.
+// \param hi The index one past the last partial result to be combined.
+// \param op The operation to combine two partial results.
+// \return The combination of the partial results in the range \f$ [lo..hi) \f$.
+//
+// The partial results are combined by a balanced binary tree, which only depends on the number
+// of partial results. In comparison to a linear combination the rounding error grows with the
+// logarithm of the number of blocks instead of linearly.
+*/
+template< typename Type  // Type of the partial results
+        , typename OP >  // Type of the combination operation
+Type smpReduceCombine( const std::vector<Type>& partial, size_t lo, size_t hi, OP& op )
+{
+   BLAZE_INTERNAL_ASSERT( lo < hi, "Invalid range of partial results" );
+
+   if( hi - lo == 1UL ) {
+      return partial[lo];
+   }
+
+   const size_t mid( lo + ( hi - lo ) / 2UL );
+
+   return op( smpReduceCombine( partial, lo, mid, op ), smpReduceCombine( partial, mid, hi, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reproducible, potentially parallel total reduction of the index range \f$ [0..n) \f$.
+// \ingroup smp
+//
+// \param n The total number of indices \f$[1..\infty)\f$.
+// \param width The number of elements per index (e.g. the number of columns of a matrix).
+// \param granularity The begin of each block is a multiple of this value.
+// \param parallel \a true in case the reduction should be executed in parallel.
+// \param kernel The serial reduction kernel, called as \a kernel(begin,end).
+// \param op The operation to combine the partial results of two blocks.
+// \return The result of the total reduction.
+//
+// This function splits the range \f$ [0..n) \f$ into blocks of approximately
+// \c BLAZE_SMP_REDUCTION_BLOCK_SIZE elements, independent of the number of threads, and
+// combines the partial results of all blocks via smpReduceCombine(). In case \a parallel is
+// \a true, every thread reduces a contiguous group of blocks. Since neither the blocks nor
+// the combination tree depend on the number of threads, the result is bitwise identical for
+// serial and parallel execution.
+*/
+template< typename Type      // Type of the reduction result
+        , typename Kernel    // Type of the serial reduction kernel
+        , typename OP >      // Type of the combination operation
+Type smpReproducibleReduce( size_t n, size_t width, size_t granularity, bool parallel,
+                            Kernel& kernel, OP& op )
+{
+   const size_t indices  ( max( BLAZE_SMP_REDUCTION_BLOCK_SIZE / max( width, 1UL ), 1UL ) );
+   const size_t rest     ( indices % granularity );
+   const size_t blockSize( ( rest )?( indices - rest + granularity ):( indices ) );
+   const size_t blocks   ( ( n - 1UL ) / blockSize + 1UL );
+
+   if( blocks < 2UL ) {
+      return kernel( 0UL, n );
+   }
+
+   std::vector<Type> partial( blocks );
+
+   const auto reduceBlocks = [&]( size_t first, size_t last )
+   {
+      for( size_t b=first; b<last; ++b ) {
+         const size_t begin( b*blockSize );
+         partial[b] = kernel( begin, min( begin+blockSize, n ) );
+      }
+   };
+
+   const size_t groups( ( parallel )?( min( getNumThreads(), blocks ) ):( 1UL ) );
+
+   if( groups < 2UL ) {
+      reduceBlocks( 0UL, blocks );
+   }
+   else {
+      const size_t blocksPerGroup( ( blocks - 1UL ) / groups + 1UL );
+
+      smpFor( groups, [&]( size_t g )
+      {
+         const size_t first( min( g*blocksPerGroup, blocks ) );
+         reduceBlocks( first, min( first+blocksPerGroup, blocks ) );
+      } );
+   }
+
+   return smpReduceCombine( partial, 0UL, blocks, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Potentially parallel total reduction of the index range \f$ [0..n) \f$.
+// \ingroup smp
+//
+// \param n The total number of indices \f$[1..\infty)\f$.
+// \param width The number of elements per index (e.g. the number of columns of a matrix).
+// \param granularity The begin of each block is a multiple of this value.
+// \param parallel \a true in case the reduction should be executed in parallel.
+// \param kernel The serial reduction kernel, called as \a kernel(begin,end).
+// \param op The operation to combine the partial results of two blocks.
+// \return The result of the total reduction.
+//
+// In case \a parallel is \a true (see the isSMPReduceActive() function), the range \f$ [0..n) \f$
+// is split into one contiguous block per thread and each block is reduced by the given serial
+// \a kernel via smpFor(). The partial results of all blocks are combined in block order, i.e.
+// for a given number of threads the result is reproducible. Otherwise the complete range is
+// reduced by a single call of the kernel. The \a granularity is used to align the blocks to
+// the SIMD width of the kernel, such that each block can be processed by aligned loads.
+//
+// In case the \c BLAZE_SMP_REPRODUCIBLE_REDUCTION switch is enabled, the range is split into
+// blocks of a fixed size instead (see smpReproducibleReduce()), such that the result does not
+// depend on the number of threads.
+*/
+template< typename Type      // Type of the reduction result
+        , typename Kernel    // Type of the serial reduction kernel
+        , typename OP >      // Type of the combination operation
+Type smpReduce( size_t n, size_t width, size_t granularity, bool parallel, Kernel kernel, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of elements" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid granularity" );
+
+   if( BLAZE_SMP_REPRODUCIBLE_REDUCTION ) {
+      return smpReproducibleReduce<Type>( n, width, granularity, parallel, kernel, op );
+   }
+
+   if( !parallel ) {
+      return kernel( 0UL, n );
+   }
+
+   const size_t blockSize( smpReduceBlockSize( n, getNumThreads(), granularity ) );
+   const size_t blocks   ( ( n - 1UL ) / blockSize + 1UL );
+
+   if( blocks < 2UL ) {
+      return kernel( 0UL, n );
+   }
+
+   std::vector<Type> partial( blocks );
+
+   smpFor( blocks, [&]( size_t b )
+   {
+      const size_t begin( b*blockSize );
+      partial[b] = kernel( begin, min( begin+blockSize, n ) );
+   } );
+
+   Type redux( partial[0UL] );
+
+   for( size_t b=1UL; b<blocks; ++b ) {
+      redux = op( redux, partial[b] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -97,15 +98,28 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || \
+    BLAZE_OPENMP_PARALLEL_MODE
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active (i.e. the
+                                           currently executed code is inside a parallel
+                                           section), the flag is set to \a true, otherwise
+                                           it is \a false. In case of the C++11, Boost,
+                                           and OpenMP parallelization, every thread has its
+                                           own flag, which enables parallel sections in
+                                           concurrently executing threads. */
+#else
    static bool active_;  //!< Activity flag for the parallel section.
                          /*!< In case a parallel section is active (i.e. the currently executed
                               code is inside a parallel section), the flag is set to \a true,
                               otherwise it is \a false. */
+#endif
    //@}
    //**********************************************************************************************
 
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
+   template< typename > friend class ParallelTaskScope;
    friend bool isParallelSectionActive();
    /*! \endcond */
    //**********************************************************************************************
@@ -123,8 +137,14 @@ class ParallelSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || \
+    BLAZE_OPENMP_PARALLEL_MODE
+template< typename T >
+thread_local bool ParallelSection<T>::active_ = false;
+#else
 template< typename T >
 bool ParallelSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -198,6 +218,66 @@ inline ParallelSection<T>::operator bool() const
 
 
 
+//=================================================================================================
+//
+//  CLASS PARALLELTASKSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scope of a task executed on behalf of a parallel section.
+// \ingroup smp
+//
+// The ParallelTaskScope class sets the parallel section flag of the calling thread to the given
+// state for its lifetime and afterwards restores the previous state. It is used by the C++11,
+// Boost, and OpenMP parallelization to execute the tasks of a parallel section as part of this
+// parallel section (i.e. nested SMP assignments are detected) and by the C++11 and Boost thread
+// backends to execute independent tasks (e.g. asynchronous evaluations) outside of any parallel
+// section, even in case they are executed by a thread that waits for the completion of its own
+// parallel section.
+*/
+template< typename T >
+class ParallelTaskScope
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ParallelTaskScope class.
+   //
+   // \param active The state of the parallel section flag within the scope.
+   */
+   explicit inline ParallelTaskScope( bool active )
+      : previous_( ParallelSection<T>::active_ )  // The previous state of the flag
+   {
+      ParallelSection<T>::active_ = active;
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor of the ParallelTaskScope class.
+   */
+   inline ~ParallelTaskScope()
+   {
+      ParallelSection<T>::active_ = previous_;
+   }
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   ParallelTaskScope( const ParallelTaskScope& ) = delete;
+   ParallelTaskScope& operator=( const ParallelTaskScope& ) = delete;
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   bool previous_;  //!< The previous state of the parallel section flag.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL FUNCTIONS
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +90,21 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || \
+    BLAZE_OPENMP_PARALLEL_MODE
+   static thread_local bool active_;  //!< Activity flag for the serial section.
+                                      /*!< In case a serial section is active (i.e. the
+                                           currently executed code is inside a serial
+                                           section), the flag is set to \a true, otherwise
+                                           it is \a false. In case of the C++11, Boost,
+                                           and OpenMP parallelization, every thread has its
+                                           own flag. */
+#else
    static bool active_;  //!< Activity flag for the serial section.
                          /*!< In case a serial section is active (i.e. the currently executed
                               code is inside a serial section), the flag is set to \a true,
                               otherwise it is \a false. */
+#endif
    //@}
    //**********************************************************************************************
 
@@ -115,8 +127,14 @@ class SerialSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || \
+    BLAZE_OPENMP_PARALLEL_MODE
+template< typename T >
+thread_local bool SerialSection<T>::active_ = false;
+#else
 template< typename T >
 bool SerialSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -0,0 +1,95 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadTeam.h
+//  \brief Header file for the ThreadTeam class and the team section macro
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADTEAM_H_
+#define _BLAZE_MATH_SMP_THREADTEAM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/Suffix.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#include <blaze/math/smp/threads/ThreadTeam.h>
+#elif BLAZE_OPENMP_PARALLEL_MODE
+#include <blaze/math/smp/openmp/ThreadTeam.h>
+#else
+#include <blaze/math/smp/default/ThreadTeam.h>
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  TEAM SECTION MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section for the execution of parallel operations by a team of threads.
+// \ingroup smp
+//
+// This macro provides the option to start a team section, within which all parallel operations
+// of the calling thread are executed by the threads of the given ThreadTeam only. This enables
+// several threads to run parallel operations at the same time without oversubscribing the
+// available cores:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+
+   // ... Resizing and initialization
+
+   // Created once by a request handling thread
+   blaze::ThreadTeam team( 4UL );
+
+   // All parallel operations within the team section are executed by the four threads of
+   // the team, independent of the parallel operations of any other thread.
+   BLAZE_TEAM_SECTION( team ) {
+      y = A * x;
+   }
+   \endcode
+
+// Team sections can be nested, in which case the innermost team section determines the team.
+// Note that team sections are supported by the C++11, Boost, and OpenMP parallelization only.
+*/
+#define BLAZE_TEAM_SECTION( team ) \
+   if( blaze::TeamSection BLAZE_JOIN( teamSection, __LINE__ ){ team } )
+//*************************************************************************************************
+
+#endif
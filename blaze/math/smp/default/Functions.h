@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
+#include <vector>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/MaybeUnused.h>
@@ -61,6 +63,9 @@ namespace blaze {
 BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
 BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
 BLAZE_ALWAYS_INLINE void   shutDownThreads();
+
+BLAZE_ALWAYS_INLINE std::vector<size_t> getThreadAffinity();
+BLAZE_ALWAYS_INLINE void                setThreadAffinity( const std::string& affinity );
 //@}
 //*************************************************************************************************
 
@@ -130,6 +135,50 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the CPUs the threads for thread parallel operations are pinned to.
+// \ingroup smp
+//
+// \return The CPUs of the threads (empty in case the threads are not pinned).
+//
+// Note that in case no parallelization is active the function will always return an empty
+// vector.
+*/
+BLAZE_ALWAYS_INLINE std::vector<size_t> getThreadAffinity()
+{
+   return std::vector<size_t>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads for thread parallel operations to specific CPUs.
+// \ingroup smp
+//
+// \param affinity The affinity specification.
+// \return void
+// \exception std::invalid_argument Invalid thread affinity.
+//
+// Via this function the threads of the C++11 and Boost thread parallelization can be pinned to
+// specific CPUs. The following values are supported for the given \a affinity:
+//
+//  - \c "none": The threads are not pinned (default).
+//  - \c "compact": The threads fill one NUMA node after another.
+//  - \c "spread": The threads are distributed round-robin across all NUMA nodes.
+//  - A list of CPUs (e.g. "0-7,16-23"): The \a i-th thread is pinned to the \a i-th CPU.
+//
+// Since the \a i-th block of every parallel assignment is executed by the \a i-th thread, the
+// data of repeated operations on the same operands stays local to the same core and NUMA node.
+// The initial affinity can also be specified via the \c BLAZE_THREAD_AFFINITY environment
+// variable. Note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& affinity )
+{
+   MAYBE_UNUSED( affinity );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
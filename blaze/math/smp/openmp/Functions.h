@@ -41,9 +41,12 @@
 //*************************************************************************************************
 
 #include <omp.h>
+#include <string>
+#include <vector>
 #include <blaze/math/Exception.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -131,6 +134,44 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs the threads for OpenMP parallel operations are pinned to.
+// \ingroup smp
+//
+// \return An empty vector.
+//
+// The thread affinity of OpenMP threads is controlled by the OpenMP runtime. Therefore this
+// function always returns an empty vector.
+*/
+BLAZE_ALWAYS_INLINE std::vector<size_t> getThreadAffinity()
+{
+   return std::vector<size_t>();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads for OpenMP parallel operations to specific CPUs.
+// \ingroup smp
+//
+// \param affinity The affinity specification.
+// \return void
+//
+// The thread affinity of OpenMP threads is controlled by the OpenMP runtime via the
+// \c OMP_PROC_BIND and \c OMP_PLACES environment variables (e.g. \c OMP_PROC_BIND=spread and
+// \c OMP_PLACES=cores). Therefore this function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& affinity )
+{
+   MAYBE_UNUSED( affinity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,253 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/ThreadTeam.h
+//  \brief Header file for the OpenMP-based ThreadTeam class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_THREADTEAM_H_
+#define _BLAZE_MATH_SMP_OPENMP_THREADTEAM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <string>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS THREADTEAM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A team of threads for the parallel operations of specific threads.
+// \ingroup smp
+//
+// The ThreadTeam class represents a group of threads for the parallel operations of specific
+// threads. In case of the OpenMP parallelization, all parallel operations started by a thread
+// within a team section (see \c BLAZE_TEAM_SECTION) use the number of threads of the team,
+// independent of the number of threads of any other thread. Thus several threads (e.g. the
+// request handling threads of a service) can run parallel operations without oversubscribing
+// the available cores:
+
+   \code
+   // Executed by every request handling thread
+   blaze::ThreadTeam team( 4UL, "0-3" );  // Four threads pinned to the CPUs 0 to 3
+
+   BLAZE_TEAM_SECTION( team )
+   {
+      y = A * x;  // Executed by the four threads of the team
+   }
+   \endcode
+
+// Note that in case of the OpenMP parallelization the given thread affinity is ignored. The
+// placement of the OpenMP threads can be controlled via the \c OMP_PLACES and \c OMP_PROC_BIND
+// environment variables.
+*/
+class ThreadTeam
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ThreadTeam( size_t n );
+   inline ThreadTeam( size_t n, const std::string& affinity );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;  //!< The number of threads of the team.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class TeamSection;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a team of \a n unpinned threads.
+//
+// \param n The number of threads of the team \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+inline ThreadTeam::ThreadTeam( size_t n )
+   : ThreadTeam( n, "none" )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a team of \a n threads pinned to the given CPUs.
+//
+// \param n The number of threads of the team \f$[1..\infty)\f$.
+// \param affinity The CPUs the threads of the team are pinned to (ignored).
+// \exception std::invalid_argument Invalid number of threads.
+// \exception std::invalid_argument Invalid thread affinity.
+*/
+inline ThreadTeam::ThreadTeam( size_t n, const std::string& affinity )
+   : size_( n )  // The number of threads of the team
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   std::vector<size_t> cpus;
+
+   if( !threadpool::parseAffinity( affinity, cpus ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the team.
+//
+// \return The number of threads of the team.
+*/
+inline size_t ThreadTeam::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEAMSECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Section for the execution of parallel operations by a team of threads.
+// \ingroup smp
+//
+// The TeamSection class is an auxiliary helper class for the \a BLAZE_TEAM_SECTION macro. It
+// sets the number of OpenMP threads of the calling thread to the size of the given team for its
+// lifetime and afterwards restores the previous number of threads.
+*/
+class TeamSection
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TeamSection class.
+   //
+   // \param team The team executing the parallel operations of the calling thread.
+   */
+   explicit inline TeamSection( ThreadTeam& team )
+      : previous_( omp_get_max_threads() )  // The previous number of threads
+   {
+      omp_set_num_threads( static_cast<int>( team.size_ ) );
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor of the TeamSection class.
+   */
+   inline ~TeamSection()
+   {
+      omp_set_num_threads( previous_ );
+   }
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion operator to \a bool.
+   //
+   // \return \a true (a team section is always entered).
+   */
+   inline operator bool() const
+   {
+      return true;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   int previous_;  //!< The previous number of threads of the calling thread.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
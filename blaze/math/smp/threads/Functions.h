@@ -40,11 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
+#include <vector>
 #include <blaze/math/Exception.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -98,6 +101,57 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs the threads for thread parallel operations are pinned to.
+// \ingroup smp
+//
+// \return The CPUs of the threads (empty in case the threads are not pinned).
+*/
+BLAZE_ALWAYS_INLINE std::vector<size_t> getThreadAffinity()
+{
+   return TheThreadBackend::affinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads for thread parallel operations to specific CPUs.
+// \ingroup smp
+//
+// \param affinity The affinity specification.
+// \return void
+// \exception std::invalid_argument Invalid thread affinity.
+//
+// Via this function the threads for thread parallel operations can be pinned to specific CPUs.
+// The following values are supported for the given \a affinity:
+//
+//  - \c "none": The threads are not pinned (default).
+//  - \c "compact": The threads fill one NUMA node after another.
+//  - \c "spread": The threads are distributed round-robin across all NUMA nodes.
+//  - A list of CPUs (e.g. "0-7,16-23"): The \a i-th thread is pinned to the \a i-th CPU.
+//
+// Since the \a i-th block of every parallel assignment is executed by the \a i-th thread, the
+// data of repeated operations on the same operands stays local to the same core and NUMA node.
+// In case an invalid affinity is specified, a \a std::invalid_argument exception is thrown.
+// Thread pinning is currently only supported on Linux systems.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& affinity )
+{
+   std::vector<size_t> cpus;
+
+   if( !threadpool::parseAffinity( affinity, cpus ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity" );
+   }
+
+   TheThreadBackend::setAffinity( std::move( cpus ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
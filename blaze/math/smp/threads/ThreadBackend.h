@@ -51,7 +51,10 @@
 #endif
 
 #include <cstdlib>
+#include <memory>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/ParallelSection.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
@@ -86,12 +89,27 @@ template< typename TT    // Type of the encapsulated thread
 class ThreadBackend
 {
  public:
+   //**Type definitions****************************************************************************
+   using Pool = ThreadPool<TT,MT,LT,CT>;  //!< Type of a pool of threads.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
    static inline size_t size  ();
    static inline void   resize( size_t n, bool block=false );
    static inline void   wait  ();
+
+   static inline std::vector<size_t> affinity   ();
+   static inline void                setAffinity( std::vector<size_t> cpus );
+   //@}
+   //**********************************************************************************************
+
+   //**Team functions******************************************************************************
+   /*!\name Team functions */
+   //@{
+   static inline std::unique_ptr<Pool> createTeam( size_t n, std::vector<size_t> cpus );
+   static inline Pool*                 joinTeam  ( Pool* team );
    //@}
    //**********************************************************************************************
 
@@ -100,6 +118,12 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename OP >
+   static inline void schedule( size_t index, OP op );
+
+   template< typename OP >
+   static inline void launch( OP op );
    //@}
    //**********************************************************************************************
 
@@ -132,6 +156,7 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
+         ParallelTaskScope<int> scope( true );
          op_( target_, source_ );
       }
       //*******************************************************************************************
@@ -149,22 +174,125 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Iteration*********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a single loop iteration.
+   */
+   template< typename OP >  // Type of the loop body
+   struct Iteration
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Iteration class template.
+      //
+      // \param op The loop body.
+      */
+      explicit inline Iteration( OP op )
+         : op_( op )  // The loop body
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the given iteration of the loop as part of the parallel section.
+      //
+      // \param index The index of the loop iteration.
+      // \return void
+      */
+      inline void operator()( size_t index ) {
+         ParallelTaskScope<int> scope( true );
+         op_( index );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      OP op_;  //!< The loop body.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Launcher**********************************************************************
+   /*!\brief Auxiliary functor for the execution of an independent task.
+   */
+   template< typename OP >  // Type of the task
+   struct Launcher
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Launcher class template.
+      //
+      // \param pool The pool of threads the task is launched on.
+      // \param op The task to be executed.
+      */
+      explicit inline Launcher( Pool* pool, OP op )
+         : pool_( pool )  // The pool of threads the task is launched on
+         , op_  ( op   )  // The task to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task outside of any parallel section.
+      //
+      // \return void
+      //
+      // The task is executed as part of the team it has been launched from, i.e. all parallel
+      // operations of the task are executed by the same pool of threads.
+      */
+      inline void operator()() {
+         ParallelTaskScope<int> scope( false );
+         Pool* const previous( joinTeam( pool_ ) );
+         op_();
+         joinTeam( previous );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Pool* pool_;  //!< The pool of threads the task is launched on.
+      OP    op_;    //!< The task to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Batch = typename Pool::Batch;  //!< Type of a batch of tasks.
+   //**********************************************************************************************
+
+   //**Private struct Batches**********************************************************************
+   /*!\brief The batches of a single thread.
+   //
+   // A thread waiting for its batch may execute tasks that schedule further tasks (nested
+   // parallel operations). These tasks are collected in the next batch of the stack.
+   */
+   struct Batches
+   {
+      std::vector< std::unique_ptr<Batch> > stack;  //!< The batches of all nesting levels.
+      size_t depth = 0UL;                           //!< The current nesting level.
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t              initPool();
+   static inline size_t              initSpinTime();
+   static inline std::vector<size_t> initAffinity();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline Batches& batches();
+   static inline Batch&   pendingBatch();
+   static inline Pool*&   currentTeam();
+   static inline Pool&    pool();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified via
+                                  the environment variable \c BLAZE_NUM_THREADS. However, it
+                                  can be explicitly resized to arbitrary numbers of threads.
+                                  It is used by all threads that are not part of a team. */
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +311,8 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+typename ThreadBackend<TT,MT,LT,CT>::Pool
+   ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initSpinTime(), initAffinity() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -198,9 +327,9 @@ ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Returns the total number of threads managed by the thread backend system.
+/*!\brief Returns the total number of threads available to the calling thread.
 //
-// \return The total number of threads of the thread backend system.
+// \return The number of threads of the team of the calling thread or of the backend system.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -208,7 +337,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 {
-   return threadpool_.size();
+   return pool().size();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -228,7 +357,7 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // removed from the backend system, otherwise new threads are added to the backend system. In
 // case an invalid number of threads is specified, an \a std::invalid_argument exception is
 // thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// number of threads is available. Note that the size of a team cannot be changed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -248,7 +377,10 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function submits all tasks scheduled by the calling thread at once and blocks until
+// all of them have been completed. Tasks scheduled by other threads are not waited for. While
+// waiting, the calling thread takes part in the execution of the tasks. In case the calling
+// thread is part of a team, the tasks are executed by the threads of the team only.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -256,7 +388,122 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   Batch& batch( pendingBatch() );
+
+   if( batch.isEmpty() )
+      return;
+
+   Batches& b( batches() );
+
+   Pool& p( pool() );
+
+   ++b.depth;
+   p.submit( batch );
+   p.wait( batch );
+   --b.depth;
+
+   batch.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs the threads of the thread backend system are pinned to.
+//
+// \return The CPUs of the threads (empty in case the threads are not pinned).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::affinity()
+{
+   return threadpool_.affinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pinning the threads of the thread backend system to the given CPUs.
+//
+// \param cpus The CPUs the threads are pinned to (empty to unpin the threads).
+// \return void
+//
+// This function pins the \a i-th thread of the backend system to the CPU \a cpus[i % N], where
+// \a N is the number of given CPUs. Since the \a i-th block of every (compound) assignment is
+// executed by the \a i-th thread, the data of repeated operations on the same operands stays
+// local to the same core and NUMA node.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( std::vector<size_t> cpus )
+{
+   threadpool_.setAffinity( std::move( cpus ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEAM FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a separate pool of threads for a team.
+//
+// \param n The number of threads of the team \f$[1..\infty)\f$.
+// \param cpus The CPUs the threads of the team are pinned to (empty for unpinned threads).
+// \return The pool of threads of the team.
+//
+// This function creates a new pool of \a n threads with the same spin time as the threads of
+// the backend system. The threads of the team only execute the tasks of threads that have
+// joined the team (see joinTeam()).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::unique_ptr<typename ThreadBackend<TT,MT,LT,CT>::Pool>
+   ThreadBackend<TT,MT,LT,CT>::createTeam( size_t n, std::vector<size_t> cpus )
+{
+   return std::unique_ptr<Pool>( new Pool( n, initSpinTime(), std::move( cpus ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assigns the calling thread to the given team.
+//
+// \param team The pool of threads of the team (\c nullptr for the threads of the backend).
+// \return The previous team of the calling thread.
+//
+// This function assigns the calling thread to the given team. All subsequent parallel operations
+// of the calling thread are executed by the threads of the team only, until the calling thread
+// is assigned to another team.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pool* ThreadBackend<TT,MT,LT,CT>::joinTeam( Pool* team )
+{
+   Pool*& current( currentTeam() );
+   Pool* const previous( current );
+   current = team;
+   return previous;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -280,6 +527,8 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 // \return void
 //
 // This function schedules a (compound) assignment of the two given operands for execution.
+// The task is collected in the batch of the calling thread and submitted to the thread pool
+// by the next call to wait().
 */
 template< typename TT      // Type of the encapsulated thread
         , typename MT      // Type of the synchronization mutex
@@ -291,7 +540,60 @@ template< typename Target  // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op ) );
+   pendingBatch().add( Assigner<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a single iteration of a parallel loop for execution.
+//
+// \param index The index of the loop iteration.
+// \param op The loop body, called as \a op(index).
+// \return void
+//
+// This function schedules the iteration \a index of a parallel loop for execution. The task
+// is collected in the batch of the calling thread and submitted to the thread pool by the
+// next call to wait().
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the loop body
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( size_t index, OP op )
+{
+   pendingBatch().add( Iteration<OP>( op ), index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Launching an independent task.
+//
+// \param op The task to be executed, called as \a op().
+// \return void
+//
+// This function hands the given task immediately to the thread pool. In contrast to the tasks
+// of a parallel section the task is not awaited by wait() and it is executed outside of any
+// parallel section, i.e. it can start parallel (compound) assignments itself. The blocks of
+// these assignments are stolen by idle threads, such that several concurrently executed tasks
+// share the threads of the pool. In case the calling thread is part of a team, the task is
+// executed by the threads of the team. The task must not throw an exception.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::launch( OP op )
+{
+   Pool& p( pool() );
+   p.schedule( Launcher<OP>( &p, op ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -338,6 +640,161 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial spin time of the threads of the thread pool.
+//
+// \return The initial spin time in microseconds.
+//
+// This function determines the initial spin time based on the \c BLAZE_SPIN_TIME environment
+// variable. In case the environment variable is not defined or not set, the function returns
+// the value of the \c BLAZE_SMP_SPIN_TIME compilation switch.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::initSpinTime()
+{
+   const char* env = std::getenv( "BLAZE_SPIN_TIME" );
+
+   if( env == nullptr )
+      return BLAZE_SMP_SPIN_TIME;
+   else return max( 0, atoi( env ) );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial CPUs the threads of the thread pool are pinned to.
+//
+// \return The initial CPUs of the threads (empty in case the threads are not pinned).
+//
+// This function determines the initial thread affinity based on the \c BLAZE_THREAD_AFFINITY
+// environment variable (see blaze::threadpool::parseAffinity() for the supported values). In
+// case the environment variable is not defined or contains an invalid value, the threads are
+// not pinned.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+   std::vector<size_t> cpus;
+
+   if( env != nullptr ) {
+      threadpool::parseAffinity( env, cpus );
+   }
+
+   return cpus;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the batches of the calling thread.
+//
+// \return Reference to the batches of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Batches& ThreadBackend<TT,MT,LT,CT>::batches()
+{
+   static thread_local Batches b;
+   return b;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the batch of tasks scheduled by the calling thread.
+//
+// \return Reference to the batch of the calling thread.
+//
+// Every thread collects its scheduled tasks in a separate batch, which enables nested parallel
+// operations. Since the batch is reused, scheduling a task does not require to reallocate the
+// storage of the batch.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Batch& ThreadBackend<TT,MT,LT,CT>::pendingBatch()
+{
+   Batches& b( batches() );
+
+   if( b.depth == b.stack.size() ) {
+      b.stack.emplace_back( new Batch() );
+   }
+
+   return *b.stack[b.depth];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the team of the calling thread.
+//
+// \return Reference to the pool of threads of the team (\c nullptr in case of no team).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pool*& ThreadBackend<TT,MT,LT,CT>::currentTeam()
+{
+   static thread_local Pool* team( nullptr );
+   return team;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pool of threads executing the tasks of the calling thread.
+//
+// \return Reference to the pool of threads of the team or of the backend system.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pool& ThreadBackend<TT,MT,LT,CT>::pool()
+{
+   Pool* const team( currentTeam() );
+   return ( team != nullptr ) ? *team : threadpool_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,273 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/AMD.h
+//  \brief Header file for the approximate minimum degree ordering of sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_AMD_H_
+#define _BLAZE_MATH_SPARSE_AMD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FILL-REDUCING ORDERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fill-reducing ordering functions */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> amd( const SparseMatrix<MT,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes an approximate minimum degree ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix to be ordered.
+// \return The fill-reducing permutation.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a fill-reducing ordering of the symmetric sparsity pattern of
+// \f$ A + A^T \f$ (the values of the matrix are irrelevant) by means of the approximate minimum
+// degree algorithm. The returned permutation \a p lists the rows/columns of the matrix in the
+// order in which they should be eliminated, i.e. the \a k-th row/column of the reordered matrix
+// corresponds to the row/column \a p[k] of \a A:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::amd( A ) );
+   \endcode
+
+// The ordering is computed on the quotient graph of the matrix: Eliminated rows/columns are
+// represented by elements, which are absorbed as soon as they become part of a newly formed
+// element. Instead of the exact external degree of each variable the algorithm maintains the
+// approximate degree bound of Amestoy, Davis, and Duff, which can be updated in time
+// proportional to the size of the quotient graph. Elements that are completely contained in
+// the newly formed element are absorbed aggressively. In case the given matrix is not a square
+// matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> amd( const SparseMatrix<MT,SO>& A )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+   const size_t npos( n );
+
+   enum : unsigned char { active, eliminated, absorbed };
+
+   std::vector< std::vector<size_t> > adjacency( n );  // Variables adjacent to each variable
+   std::vector< std::vector<size_t> > elements ( n );  // Elements adjacent to each variable
+   std::vector< std::vector<size_t> > members  ( n );  // Variables of each element
+   std::vector<unsigned char> status( n, active );
+
+   // Setting up the symmetric adjacency structure of A + A^T
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+         const size_t j( element->index() );
+         if( i != j ) {
+            adjacency[i].push_back( j );
+            adjacency[j].push_back( i );
+         }
+      }
+   }
+
+   std::vector<size_t> degree( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      std::sort( adjacency[i].begin(), adjacency[i].end() );
+      adjacency[i].erase( std::unique( adjacency[i].begin(), adjacency[i].end() ),
+                          adjacency[i].end() );
+      degree[i] = adjacency[i].size();
+   }
+
+   // Setting up the degree lists
+   std::vector<size_t> head( n, npos );
+   std::vector<size_t> next( n, npos );
+   std::vector<size_t> prev( n, npos );
+
+   auto insert = [&]( size_t i )
+   {
+      const size_t d( degree[i] );
+      prev[i] = npos;
+      next[i] = head[d];
+      if( head[d] != npos )
+         prev[head[d]] = i;
+      head[d] = i;
+   };
+
+   auto remove = [&]( size_t i )
+   {
+      if( prev[i] != npos ) next[prev[i]] = next[i];
+      else head[degree[i]] = next[i];
+      if( next[i] != npos ) prev[next[i]] = prev[i];
+   };
+
+   for( size_t i=n; i>0UL; --i ) {
+      insert( i-1UL );
+   }
+
+   std::vector<size_t> mark  ( n, npos );  // Membership flags for the currently formed element
+   std::vector<size_t> wmark ( n, npos );  // Validity flags for the external element sizes
+   std::vector<size_t> weight( n, 0UL  );  // External sizes |Le \ Lp| of the elements
+
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   std::vector<size_t> members_p;
+   size_t mindeg( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      // Selecting the variable of minimum approximate degree
+      while( head[mindeg] == npos ) {
+         ++mindeg;
+      }
+
+      const size_t p( head[mindeg] );
+      remove( p );
+      perm.push_back( p );
+
+      // Forming the new element Lp from all adjacent variables and elements
+      members_p.clear();
+      mark[p] = p;
+
+      for( size_t e : elements[p] ) {
+         if( status[e] != eliminated ) continue;
+         for( size_t i : members[e] ) {
+            if( status[i] == active && mark[i] != p ) {
+               mark[i] = p;
+               members_p.push_back( i );
+            }
+         }
+         status[e] = absorbed;
+         std::vector<size_t>().swap( members[e] );
+      }
+
+      for( size_t i : adjacency[p] ) {
+         if( status[i] == active && mark[i] != p ) {
+            mark[i] = p;
+            members_p.push_back( i );
+         }
+      }
+
+      status[p] = eliminated;
+      std::vector<size_t>().swap( adjacency[p] );
+      std::vector<size_t>().swap( elements[p] );
+
+      // Pruning the adjacency structure of all variables of the new element
+      for( size_t i : members_p )
+      {
+         remove( i );
+
+         auto& Ei( elements[i] );
+         Ei.erase( std::remove_if( Ei.begin(), Ei.end(), [&]( size_t e ) {
+                      return status[e] != eliminated;
+                   } ), Ei.end() );
+         Ei.push_back( p );
+
+         auto& Ai( adjacency[i] );
+         Ai.erase( std::remove_if( Ai.begin(), Ai.end(), [&]( size_t j ) {
+                      return status[j] != active || mark[j] == p;
+                   } ), Ai.end() );
+      }
+
+      // Computing the external sizes |Le \ Lp| of all elements adjacent to the new element
+      for( size_t i : members_p ) {
+         for( size_t e : elements[i] ) {
+            if( e == p ) continue;
+            if( wmark[e] != p ) {
+               wmark[e] = p;
+               weight[e] = members[e].size();
+            }
+            --weight[e];
+         }
+      }
+
+      // Updating the approximate degrees
+      const size_t external( members_p.empty() ? 0UL : members_p.size()-1UL );
+
+      for( size_t i : members_p )
+      {
+         size_t d( adjacency[i].size() + external );
+
+         for( size_t e : elements[i] ) {
+            if( e == p || status[e] != eliminated ) continue;
+            if( weight[e] == 0UL ) {
+               status[e] = absorbed;  // Aggressive absorption of Le into Lp
+               std::vector<size_t>().swap( members[e] );
+            }
+            else d += weight[e];
+         }
+
+         degree[i] = min( d, degree[i] + external, n-k-1UL );
+         insert( i );
+
+         if( degree[i] < mindeg )
+            mindeg = degree[i];
+      }
+
+      members[p] = members_p;
+   }
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid permutation detected" );
+
+   return perm;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
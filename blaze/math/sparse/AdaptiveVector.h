@@ -0,0 +1,1356 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/AdaptiveVector.h
+//  \brief Header file for the implementation of an adaptive sparse/dense vector
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ADAPTIVEVECTOR_H_
+#define _BLAZE_MATH_SPARSE_ADAPTIVEVECTOR_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <ostream>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Vector switching between a sparse and a dense representation depending on its fill.
+// \ingroup sparse_vector
+//
+// The AdaptiveVector class template represents a vector of arbitrary size, which stores its
+// elements either in a CompressedVector (sparse representation) or in a DynamicVector (dense
+// representation). The vector monitors its fill, i.e. the ratio of non-zero elements to its
+// size, and automatically switches to the dense representation as soon as the fill exceeds
+// the \a densify threshold and back to the sparse representation as soon as the fill falls
+// below the \a sparsify threshold:
+
+   \code
+   blaze::AdaptiveVector<double> frontier( 100000UL );  // Starts in sparse representation
+
+   frontier.set( 42UL, 1.0 );                          // Sparse insertion
+   // ... Inserting further elements
+
+   if( frontier.isDense() ) { ... }                    // Dense once the fill exceeds 5%
+   \endcode
+
+// The default thresholds are 2% and 5%. Since the sparsify threshold is smaller than the densify
+// threshold, the representation does not flip back and forth in case the fill oscillates around
+// one of the thresholds. The thresholds can be adapted via the setThresholds() function.
+//
+// Since the representation is chosen at runtime, an AdaptiveVector is neither a DenseVector
+// nor a SparseVector and cannot be directly used as operand of vector expressions. Instead, the
+// apply() member function or the visit() function pass the currently active representation to
+// the given operation. Via a generic lambda this selects the fastest kernel for the current
+// state of the vector:
+
+   \code
+   blaze::CompressedMatrix<double> A( 100000UL, 100000UL );
+   blaze::DynamicVector<double> y;
+   // ... Initialization
+
+   frontier.apply( [&]( const auto& x ) { y = A * x; } );  // SMatSVecMult or SMatDVecMult
+   \endcode
+
+// Assignments and compound assignments of dense and sparse vectors are performed in the
+// representation that fits the right-hand side operand best and are followed by an update of
+// the representation:
+
+   \code
+   blaze::DynamicVector<double> d( 100000UL );
+   blaze::CompressedVector<double> s( 100000UL );
+
+   frontier =  s;    // Sparse assignment
+   frontier += d;    // Switch to dense representation, dense addition
+   frontier -= s;    // Dense/sparse subtraction (in case the vector remains dense)
+   frontier *= 0.5;  // Scaling of the active representation
+   \endcode
+
+// Note that the inactive representation keeps its memory in order to make subsequent switches
+// of the representation cheap.
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag >  // Transpose flag
+class AdaptiveVector
+{
+ public:
+   //**Type definitions****************************************************************************
+   using SparseType  = CompressedVector<Type,TF>;  //!< Type of the sparse representation.
+   using DenseType   = DynamicVector<Type,TF>;     //!< Type of the dense representation.
+   using ElementType = Type;                       //!< Type of the vector elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline AdaptiveVector();
+   explicit inline AdaptiveVector( size_t n );
+
+   template< typename VT > inline AdaptiveVector( const DenseVector<VT,TF>&  dv );
+   template< typename VT > inline AdaptiveVector( const SparseVector<VT,TF>& sv );
+
+   AdaptiveVector( const AdaptiveVector& ) = default;
+   AdaptiveVector( AdaptiveVector&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type operator[]( size_t index ) const;
+   inline Type at( size_t index ) const;
+   inline const SparseType& sparse() const noexcept;
+   inline const DenseType&  dense () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   AdaptiveVector& operator=( const AdaptiveVector& ) = default;
+   AdaptiveVector& operator=( AdaptiveVector&& ) = default;
+
+   template< typename VT > inline AdaptiveVector& operator= ( const DenseVector<VT,TF>&  rhs );
+   template< typename VT > inline AdaptiveVector& operator= ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline AdaptiveVector& operator+=( const DenseVector<VT,TF>&  rhs );
+   template< typename VT > inline AdaptiveVector& operator+=( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline AdaptiveVector& operator-=( const DenseVector<VT,TF>&  rhs );
+   template< typename VT > inline AdaptiveVector& operator-=( const SparseVector<VT,TF>& rhs );
+
+   template< typename Other >
+   inline auto operator*=( Other scalar ) -> EnableIf_t< IsNumeric_v<Other>, AdaptiveVector& >;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline double fill() const noexcept;
+   inline bool   isDense() const noexcept;
+   inline bool   isSparse() const noexcept;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   swap( AdaptiveVector& v ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline void set  ( size_t index, const Type& value );
+   inline void add  ( size_t index, const Type& value );
+   inline void erase( size_t index );
+   //@}
+   //**********************************************************************************************
+
+   //**Representation functions********************************************************************
+   /*!\name Representation functions */
+   //@{
+   inline void   toDense();
+   inline void   toSparse();
+   inline void   adapt();
+   inline void   setThresholds( double sparsify, double densify );
+   inline double sparsifyThreshold() const noexcept;
+   inline double densifyThreshold() const noexcept;
+
+   template< typename OP > inline decltype(auto) apply( OP&& op ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void update( size_t index, const Type& value );
+   inline void recount();
+
+   template< typename VT, typename OP >
+   inline void updateDense( const SparseVector<VT,TF>& rhs, OP op );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SparseType sparse_;  //!< The sparse representation of the vector.
+   DenseType  dense_;   //!< The dense representation of the vector.
+   bool isDense_;       //!< Flag for the active representation.
+   size_t nonZeros_;    //!< The number of non-zero elements in the dense representation.
+   double sparsify_;    //!< The fill below which the vector switches to the sparse representation.
+   double densify_;     //!< The fill above which the vector switches to the dense representation.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for AdaptiveVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline AdaptiveVector<Type,TF>::AdaptiveVector()
+   : sparse_  ()        // The sparse representation of the vector
+   , dense_   ()        // The dense representation of the vector
+   , isDense_ ( false ) // Flag for the active representation
+   , nonZeros_( 0UL )   // The number of non-zero elements in the dense representation
+   , sparsify_( 0.02 )  // The fill below which the vector switches to the sparse representation
+   , densify_ ( 0.05 )  // The fill above which the vector switches to the dense representation
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an adaptive vector of size \a n.
+//
+// \param n The size of the vector.
+//
+// The vector is initialized as a sparse vector without non-zero elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline AdaptiveVector<Type,TF>::AdaptiveVector( size_t n )
+   : AdaptiveVector()
+{
+   sparse_.resize( n, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense vectors.
+//
+// \param dv Dense vector to be copied.
+//
+// The representation of the vector is chosen according to the fill of the given vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the foreign dense vector
+inline AdaptiveVector<Type,TF>::AdaptiveVector( const DenseVector<VT,TF>& dv )
+   : AdaptiveVector()
+{
+   *this = ~dv;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from sparse vectors.
+//
+// \param sv Sparse vector to be copied.
+//
+// The representation of the vector is chosen according to the fill of the given vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the foreign sparse vector
+inline AdaptiveVector<Type,TF>::AdaptiveVector( const SparseVector<VT,TF>& sv )
+   : AdaptiveVector()
+{
+   *this = ~sv;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline Type AdaptiveVector<Type,TF>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid vector access index" );
+
+   if( isDense_ )
+      return dense_[index];
+   else return sparse_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked read access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid vector access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline Type AdaptiveVector<Type,TF>::at( size_t index ) const
+{
+   if( index >= size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sparse representation of the vector.
+//
+// \return Reference to the sparse representation.
+//
+// This function must only be called in case the vector is in sparse representation. This
+// precondition is only checked in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline const typename AdaptiveVector<Type,TF>::SparseType&
+   AdaptiveVector<Type,TF>::sparse() const noexcept
+{
+   BLAZE_USER_ASSERT( !isDense_, "Access to inactive sparse representation" );
+   return sparse_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the dense representation of the vector.
+//
+// \return Reference to the dense representation.
+//
+// This function must only be called in case the vector is in dense representation. This
+// precondition is only checked in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline const typename AdaptiveVector<Type,TF>::DenseType&
+   AdaptiveVector<Type,TF>::dense() const noexcept
+{
+   BLAZE_USER_ASSERT( isDense_, "Access to inactive dense representation" );
+   return dense_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense vectors.
+//
+// \param rhs Dense vector to be copied.
+// \return Reference to the assigned vector.
+//
+// The vector is resized according to the given vector. The assignment is performed in dense
+// representation, afterwards the representation is adapted to the fill of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline AdaptiveVector<Type,TF>&
+   AdaptiveVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
+{
+   dense_ = ~rhs;
+   sparse_.clear();
+   isDense_ = true;
+
+   recount();
+   adapt();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for sparse vectors.
+//
+// \param rhs Sparse vector to be copied.
+// \return Reference to the assigned vector.
+//
+// The vector is resized according to the given vector. The assignment is performed in sparse
+// representation, afterwards the representation is adapted to the fill of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline AdaptiveVector<Type,TF>&
+   AdaptiveVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
+{
+   sparse_ = ~rhs;
+   dense_.clear();
+   isDense_  = false;
+   nonZeros_ = 0UL;
+
+   adapt();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a dense vector
+//        (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector to be added to the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The addition is performed in dense representation, afterwards the representation is adapted
+// to the fill of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline AdaptiveVector<Type,TF>&
+   AdaptiveVector<Type,TF>::operator+=( const DenseVector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( !isDense_ && (~rhs).canAlias( &sparse_ ) ) {
+      const ResultType_t<VT> tmp( ~rhs );
+      toDense();
+      dense_ += tmp;
+   }
+   else {
+      toDense();
+      dense_ += ~rhs;
+   }
+
+   recount();
+   adapt();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a sparse vector
+//        (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side sparse vector to be added to the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The addition is performed in the currently active representation, afterwards the
+// representation is adapted to the fill of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline AdaptiveVector<Type,TF>&
+   AdaptiveVector<Type,TF>::operator+=( const SparseVector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( isDense_ )
+      updateDense( ~rhs, []( const Type& a, const auto& b ){ return a + b; } );
+   else
+      sparse_ += ~rhs;
+
+   adapt();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a dense vector
+//        (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector to be subtracted from the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The subtraction is performed in dense representation, afterwards the representation is
+// adapted to the fill of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline AdaptiveVector<Type,TF>&
+   AdaptiveVector<Type,TF>::operator-=( const DenseVector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( !isDense_ && (~rhs).canAlias( &sparse_ ) ) {
+      const ResultType_t<VT> tmp( ~rhs );
+      toDense();
+      dense_ -= tmp;
+   }
+   else {
+      toDense();
+      dense_ -= ~rhs;
+   }
+
+   recount();
+   adapt();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a sparse vector
+//        (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side sparse vector to be subtracted from the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The subtraction is performed in the currently active representation, afterwards the
+// representation is adapted to the fill of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline AdaptiveVector<Type,TF>&
+   AdaptiveVector<Type,TF>::operator-=( const SparseVector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( isDense_ )
+      updateDense( ~rhs, []( const Type& a, const auto& b ){ return a - b; } );
+   else
+      sparse_ -= ~rhs;
+
+   adapt();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a vector and
+//        a scalar value (\f$ \vec{a}*=s \f$).
+//
+// \param scalar The right-hand side scalar value for the multiplication.
+// \return Reference to the vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline auto AdaptiveVector<Type,TF>::operator*=( Other scalar )
+   -> EnableIf_t< IsNumeric_v<Other>, AdaptiveVector& >
+{
+   if( isDense_ ) {
+      dense_ *= scalar;
+      recount();
+   }
+   else {
+      sparse_ *= scalar;
+   }
+
+   adapt();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the vector.
+//
+// \return The size of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline size_t AdaptiveVector<Type,TF>::size() const noexcept
+{
+   return ( isDense_ )?( dense_.size() ):( sparse_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the vector.
+//
+// \return The number of non-zero elements in the vector.
+//
+// In sparse representation, the function returns the number of stored elements (which may
+// include explicitly stored zero elements). In dense representation, the function returns
+// the number of elements that are not default values.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline size_t AdaptiveVector<Type,TF>::nonZeros() const noexcept
+{
+   return ( isDense_ )?( nonZeros_ ):( sparse_.nonZeros() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill of the vector, i.e. the ratio of non-zero elements to its size.
+//
+// \return The fill of the vector in the range \f$[0..1]\f$.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline double AdaptiveVector<Type,TF>::fill() const noexcept
+{
+   const size_t n( size() );
+   return ( n > 0UL )?( double( nonZeros() ) / double( n ) ):( 0.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is in dense representation.
+//
+// \return \a true in case the vector is in dense representation, \a false if not.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline bool AdaptiveVector<Type,TF>::isDense() const noexcept
+{
+   return isDense_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is in sparse representation.
+//
+// \return \a true in case the vector is in sparse representation, \a false if not.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline bool AdaptiveVector<Type,TF>::isSparse() const noexcept
+{
+   return !isDense_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of the vector to their default value and switches the
+// vector to the sparse representation. The size of the vector is preserved.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::reset()
+{
+   if( isDense_ ) {
+      sparse_.resize( dense_.size(), false );
+      dense_.clear();
+      isDense_  = false;
+      nonZeros_ = 0UL;
+   }
+
+   sparse_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the vector.
+//
+// \return void
+//
+// After the clear() function, the size of the vector is 0 and the vector is in sparse
+// representation.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::clear()
+{
+   sparse_.clear();
+   dense_.clear();
+   isDense_  = false;
+   nonZeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the vector.
+//
+// \param n The new size of the vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the vector to the given size \a n. In case the vector is enlarged and
+// \a preserve is \a true, the new elements are default initialized. Afterwards the
+// representation is adapted to the fill of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::resize( size_t n, bool preserve )
+{
+   using blaze::reset;
+
+   if( !preserve ) {
+      clear();
+      sparse_.resize( n, false );
+      return;
+   }
+
+   if( isDense_ ) {
+      const size_t oldSize( dense_.size() );
+      dense_.resize( n, true );
+      for( size_t i=oldSize; i<n; ++i )
+         reset( dense_[i] );
+      recount();
+   }
+   else {
+      sparse_.resize( n, true );
+   }
+
+   adapt();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two adaptive vectors.
+//
+// \param v The vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::swap( AdaptiveVector& v ) noexcept
+{
+   using std::swap;
+
+   sparse_.swap( v.sparse_ );
+   dense_.swap( v.dense_ );
+   swap( isDense_, v.isDense_ );
+   swap( nonZeros_, v.nonZeros_ );
+   swap( sparsify_, v.sparsify_ );
+   swap( densify_, v.densify_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updating a single element in dense representation.
+//
+// \param index The index of the element \f$[0..N-1]\f$.
+// \param value The new value of the element.
+// \return void
+//
+// This function updates the number of non-zero elements of the dense representation.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::update( size_t index, const Type& value )
+{
+   BLAZE_INTERNAL_ASSERT( isDense_, "Invalid representation detected" );
+
+   const bool wasZero( isDefault<strict>( dense_[index] ) );
+   const bool isZero ( isDefault<strict>( value ) );
+
+   dense_[index] = value;
+
+   if( wasZero && !isZero )
+      ++nonZeros_;
+   else if( !wasZero && isZero )
+      --nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recounting the non-zero elements of the dense representation.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::recount()
+{
+   BLAZE_INTERNAL_ASSERT( isDense_, "Invalid representation detected" );
+
+   nonZeros_ = 0UL;
+   for( size_t i=0UL; i<dense_.size(); ++i ) {
+      if( !isDefault<strict>( dense_[i] ) )
+         ++nonZeros_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise update of the dense representation with a sparse vector.
+//
+// \param rhs The right-hand side sparse vector.
+// \param op The binary operation combining the current value and the value of \a rhs.
+// \return void
+//
+// This function updates all elements of the dense representation at the positions of the
+// non-zero elements of \a rhs and keeps track of the number of non-zero elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename VT    // Type of the right-hand side sparse vector
+        , typename OP >  // Type of the binary operation
+inline void AdaptiveVector<Type,TF>::updateDense( const SparseVector<VT,TF>& rhs, OP op )
+{
+   if( (~rhs).canAlias( &dense_ ) ) {
+      const ResultType_t<VT> tmp( ~rhs );
+      updateDense( tmp, op );
+      return;
+   }
+
+   CompositeType_t<VT> x( ~rhs );
+
+   for( auto element=x.begin(); element!=x.end(); ++element ) {
+      const size_t index( element->index() );
+      update( index, op( dense_[index], element->value() ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the vector.
+//
+// \param index The index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return void
+// \exception std::out_of_range Invalid vector access index.
+//
+// This function sets the value of an element of the vector. In sparse representation, setting
+// an element to its default value erases the element. In case the fill of the vector crosses
+// one of the thresholds, the representation of the vector is switched.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::set( size_t index, const Type& value )
+{
+   if( index >= size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+
+   if( isDense_ ) {
+      update( index, value );
+      if( fill() < sparsify_ )
+         toSparse();
+   }
+   else if( isDefault<strict>( value ) ) {
+      sparse_.erase( index );
+   }
+   else {
+      sparse_.set( index, value );
+      if( fill() > densify_ )
+         toDense();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a value to an element of the vector.
+//
+// \param index The index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value to be added to the element.
+// \return void
+// \exception std::out_of_range Invalid vector access index.
+//
+// This function adds the given value to an element of the vector. In case the fill of the
+// vector crosses one of the thresholds, the representation of the vector is switched.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::add( size_t index, const Type& value )
+{
+   if( index >= size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+
+   if( isDense_ ) {
+      set( index, dense_[index] + value );
+      return;
+   }
+
+   const auto pos( sparse_.find( index ) );
+
+   if( pos != sparse_.end() )
+      set( index, pos->value() + value );
+   else
+      set( index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the vector.
+//
+// \param index The index of the element to be erased \f$[0..N-1]\f$.
+// \return void
+// \exception std::out_of_range Invalid vector access index.
+//
+// This function resets the element to its default value. In case the fill of the vector falls
+// below the sparsify threshold, the vector is switched to the sparse representation.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::erase( size_t index )
+{
+   set( index, Type() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REPRESENTATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Switching to the dense representation.
+//
+// \return void
+//
+// This function switches the vector to the dense representation. In case the vector is already
+// in dense representation, the function has no effect.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::toDense()
+{
+   if( isDense_ )
+      return;
+
+   dense_    = sparse_;
+   isDense_  = true;
+   nonZeros_ = 0UL;
+
+   for( auto element=sparse_.begin(); element!=sparse_.end(); ++element ) {
+      if( !isDefault<strict>( element->value() ) )
+         ++nonZeros_;
+   }
+
+   sparse_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Switching to the sparse representation.
+//
+// \return void
+//
+// This function switches the vector to the sparse representation. Only the non-zero elements
+// of the dense representation are stored. In case the vector is already in sparse
+// representation, the function has no effect.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::toSparse()
+{
+   if( !isDense_ )
+      return;
+
+   const size_t n( dense_.size() );
+
+   sparse_.resize( n, false );
+   sparse_.reserve( nonZeros_ );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( !isDefault<strict>( dense_[i] ) )
+         sparse_.append( i, dense_[i] );
+   }
+
+   dense_.clear();
+   isDense_  = false;
+   nonZeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adapting the representation to the current fill of the vector.
+//
+// \return void
+//
+// This function switches the vector to the dense representation in case its fill exceeds the
+// densify threshold and to the sparse representation in case its fill falls below the sparsify
+// threshold.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::adapt()
+{
+   if( isDense_ && fill() < sparsify_ )
+      toSparse();
+   else if( !isDense_ && fill() > densify_ )
+      toDense();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the fill thresholds for switching the representation.
+//
+// \param sparsify The fill below which the vector switches to the sparse representation.
+// \param densify The fill above which the vector switches to the dense representation.
+// \return void
+// \exception std::invalid_argument Invalid fill thresholds.
+//
+// This function sets the thresholds for switching the representation and adapts the current
+// representation accordingly. The thresholds must satisfy \f$ 0 \le sparsify \le densify \le 1
+// \f$. Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void AdaptiveVector<Type,TF>::setThresholds( double sparsify, double densify )
+{
+   if( !( sparsify >= 0.0 && sparsify <= densify && densify <= 1.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid fill thresholds" );
+   }
+
+   sparsify_ = sparsify;
+   densify_  = densify;
+
+   adapt();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill below which the vector switches to the sparse representation.
+//
+// \return The sparsify threshold.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline double AdaptiveVector<Type,TF>::sparsifyThreshold() const noexcept
+{
+   return sparsify_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill above which the vector switches to the dense representation.
+//
+// \return The densify threshold.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline double AdaptiveVector<Type,TF>::densifyThreshold() const noexcept
+{
+   return densify_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the given operation to the active representation of the vector.
+//
+// \param op The operation to be applied.
+// \return The result of the operation.
+//
+// This function calls the given operation with the active representation of the vector, i.e.
+// either with the CompressedVector or the DynamicVector. The operation has to be callable with
+// both representations and has to return the same type in both cases.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+template< typename OP >  // Type of the operation
+inline decltype(auto) AdaptiveVector<Type,TF>::apply( OP&& op ) const
+{
+   if( isDense_ )
+      return std::forward<OP>( op )( dense_ );
+   else
+      return std::forward<OP>( op )( sparse_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADAPTIVEVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name AdaptiveVector operators */
+//@{
+template< typename Type, bool TF >
+void reset( AdaptiveVector<Type,TF>& v );
+
+template< typename Type, bool TF >
+void clear( AdaptiveVector<Type,TF>& v );
+
+template< typename Type, bool TF >
+size_t size( const AdaptiveVector<Type,TF>& v ) noexcept;
+
+template< typename Type, bool TF >
+size_t nonZeros( const AdaptiveVector<Type,TF>& v ) noexcept;
+
+template< typename Type, bool TF >
+void swap( AdaptiveVector<Type,TF>& a, AdaptiveVector<Type,TF>& b ) noexcept;
+
+template< typename Type, bool TF, typename OP >
+decltype(auto) visit( const AdaptiveVector<Type,TF>& v, OP&& op );
+
+template< typename Type, bool TF >
+std::ostream& operator<<( std::ostream& os, const AdaptiveVector<Type,TF>& v );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given adaptive vector.
+// \ingroup sparse_vector
+//
+// \param v The vector to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void reset( AdaptiveVector<Type,TF>& v )
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given adaptive vector.
+// \ingroup sparse_vector
+//
+// \param v The vector to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void clear( AdaptiveVector<Type,TF>& v )
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the given adaptive vector.
+// \ingroup sparse_vector
+//
+// \param v The given vector.
+// \return The size of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline size_t size( const AdaptiveVector<Type,TF>& v ) noexcept
+{
+   return v.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the given adaptive vector.
+// \ingroup sparse_vector
+//
+// \param v The given vector.
+// \return The number of non-zero elements in the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline size_t nonZeros( const AdaptiveVector<Type,TF>& v ) noexcept
+{
+   return v.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two adaptive vectors.
+// \ingroup sparse_vector
+//
+// \param a The first vector to be swapped.
+// \param b The second vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void swap( AdaptiveVector<Type,TF>& a, AdaptiveVector<Type,TF>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the given operation to the active representation of the given vector.
+// \ingroup sparse_vector
+//
+// \param v The given vector.
+// \param op The operation to be applied.
+// \return The result of the operation.
+//
+// This function calls the given operation with the active representation of the vector, i.e.
+// either with a CompressedVector or a DynamicVector:
+
+   \code
+   blaze::AdaptiveVector<double> x( 1000UL );
+   blaze::DynamicVector<double> y( 1000UL );
+   // ... Initialization
+
+   const double d = visit( x, [&]( const auto& v ) { return dot( v, y ); } );
+   \endcode
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the operation
+inline decltype(auto) visit( const AdaptiveVector<Type,TF>& v, OP&& op )
+{
+   return v.apply( std::forward<OP>( op ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for adaptive vectors.
+// \ingroup sparse_vector
+//
+// \param os Reference to the output stream.
+// \param v Reference to a constant adaptive vector object.
+// \return Reference to the output stream.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline std::ostream& operator<<( std::ostream& os, const AdaptiveVector<Type,TF>& v )
+{
+   return v.apply( [&os]( const auto& x ) -> std::ostream& { return os << x; } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -53,6 +53,7 @@
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelFor.h>
 #include <blaze/math/sparse/Forward.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
@@ -2824,22 +2825,70 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   // Counting the number of elements per row
+   if( m_ == 0UL )
+      return;
+
+   // Partitioning the columns of the right-hand side matrix into blocks. In order to limit the
+   // memory required for the per-block histograms, the number of blocks is restricted such that
+   // the histograms never occupy more memory than the non-zero elements of the matrix.
+   const size_t nonzeros( (~rhs).nonZeros() );
+   const size_t threads ( ( nonzeros < SMP_SMATTRANS_THRESHOLD )?( 1UL ):( getNumThreads() ) );
+   const size_t blocks  ( max( min( threads, n_, nonzeros / m_ ), 1UL ) );
+
+   const size_t colsPerBlock( n_ / blocks + ( ( n_ % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+   const size_t rowsPerBlock( m_ / blocks + ( ( m_ % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+
+   std::vector<size_t> offsets( blocks*m_, 0UL );
    std::vector<size_t> rowLengths( m_, 0UL );
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         ++rowLengths[element->index()];
-   }
+
+   // Counting the number of elements per row for each block of columns
+   smpFor( blocks, [&]( size_t b )
+   {
+      size_t* const counts( offsets.data() + b*m_ );
+
+      const size_t jend( min( (b+1UL)*colsPerBlock, n_ ) );
+      for( size_t j=b*colsPerBlock; j<jend; ++j ) {
+         for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            ++counts[element->index()];
+      }
+   } );
+
+   // Converting the counts into the offsets of the blocks within each row
+   smpFor( blocks, [&]( size_t b )
+   {
+      const size_t iend( min( (b+1UL)*rowsPerBlock, m_ ) );
+      for( size_t i=b*rowsPerBlock; i<iend; ++i ) {
+         for( size_t k=0UL; k<blocks; ++k ) {
+            const size_t count( offsets[k*m_+i] );
+            offsets[k*m_+i] = rowLengths[i];
+            rowLengths[i] += count;
+         }
+      }
+   } );
 
    // Resizing the compressed matrix
    for( size_t i=0UL; i<m_; ++i ) {
       begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
    }
 
-   // Appending the elements to the rows of the compressed matrix
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         append( element->index(), j, element->value() );
+   // Scattering the elements of each block of columns into the rows of the compressed matrix
+   smpFor( blocks, [&]( size_t b )
+   {
+      size_t* const cursors( offsets.data() + b*m_ );
+
+      const size_t jend( min( (b+1UL)*colsPerBlock, n_ ) );
+      for( size_t j=b*colsPerBlock; j<jend; ++j ) {
+         for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+            const size_t i( element->index() );
+            Element& target( *( begin_[i] + cursors[i]++ ) );
+            target.value_ = element->value();
+            target.index_ = j;
+         }
+      }
+   } );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = begin_[i+1UL];
    }
 }
 //*************************************************************************************************
@@ -5607,22 +5656,70 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   // Counting the number of elements per column
+   if( n_ == 0UL )
+      return;
+
+   // Partitioning the rows of the right-hand side matrix into blocks. In order to limit the
+   // memory required for the per-block histograms, the number of blocks is restricted such that
+   // the histograms never occupy more memory than the non-zero elements of the matrix.
+   const size_t nonzeros( (~rhs).nonZeros() );
+   const size_t threads ( ( nonzeros < SMP_SMATTRANS_THRESHOLD )?( 1UL ):( getNumThreads() ) );
+   const size_t blocks  ( max( min( threads, m_, nonzeros / n_ ), 1UL ) );
+
+   const size_t rowsPerBlock( m_ / blocks + ( ( m_ % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+   const size_t colsPerBlock( n_ / blocks + ( ( n_ % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+
+   std::vector<size_t> offsets( blocks*n_, 0UL );
    std::vector<size_t> columnLengths( n_, 0UL );
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         ++columnLengths[element->index()];
-   }
+
+   // Counting the number of elements per column for each block of rows
+   smpFor( blocks, [&]( size_t b )
+   {
+      size_t* const counts( offsets.data() + b*n_ );
+
+      const size_t iend( min( (b+1UL)*rowsPerBlock, m_ ) );
+      for( size_t i=b*rowsPerBlock; i<iend; ++i ) {
+         for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            ++counts[element->index()];
+      }
+   } );
+
+   // Converting the counts into the offsets of the blocks within each column
+   smpFor( blocks, [&]( size_t b )
+   {
+      const size_t jend( min( (b+1UL)*colsPerBlock, n_ ) );
+      for( size_t j=b*colsPerBlock; j<jend; ++j ) {
+         for( size_t k=0UL; k<blocks; ++k ) {
+            const size_t count( offsets[k*n_+j] );
+            offsets[k*n_+j] = columnLengths[j];
+            columnLengths[j] += count;
+         }
+      }
+   } );
 
    // Resizing the compressed matrix
    for( size_t j=0UL; j<n_; ++j ) {
       begin_[j+1UL] = end_[j+1UL] = begin_[j] + columnLengths[j];
    }
 
-   // Appending the elements to the columns of the compressed matrix
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         append( i, element->index(), element->value() );
+   // Scattering the elements of each block of rows into the columns of the compressed matrix
+   smpFor( blocks, [&]( size_t b )
+   {
+      size_t* const cursors( offsets.data() + b*n_ );
+
+      const size_t iend( min( (b+1UL)*rowsPerBlock, m_ ) );
+      for( size_t i=b*rowsPerBlock; i<iend; ++i ) {
+         for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+            const size_t j( element->index() );
+            Element& target( *( begin_[j] + cursors[j]++ ) );
+            target.value_ = element->value();
+            target.index_ = i;
+         }
+      }
+   } );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_[j] = begin_[j+1UL];
    }
 }
 /*! \endcond */
@@ -0,0 +1,1607 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CustomCompressedMatrix.h
+//  \brief Implementation of a customizable compressed matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_CUSTOMCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_CUSTOMCOMPRESSEDMATRIX_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsCustom.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConvertible.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup custom_compressed_matrix CustomCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a customizable compressed matrix.
+// \ingroup custom_compressed_matrix
+//
+// The CustomCompressedMatrix class template provides the functionality to represent an external
+// sparse matrix in compressed row storage (CRS) or compressed column storage (CCS) format as a
+// native \b Blaze sparse matrix. In contrast to all other sparse matrix types, this sparse
+// matrix does not own its arrays but uses the arrays of row/column offsets, indices and values
+// of the external matrix without copying. The type of the elements, the storage order, and the
+// type of the indices of the matrix can be specified via the following three template
+// parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CustomCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CustomCompressedMatrix can be used with
+//          any possibly cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the integral type of the offsets and indices (e.g. \c int, \c unsigned
+//          \c int, \c long, \c size_t, ...). The default type is \c size_t.
+//
+// A row-major \f$ M \times N \f$ matrix is given by three arrays: The \a offsets array of size
+// \f$ M+1 \f$, and the \a indices and \a values arrays, which contain the column indices and
+// the values of the non-zero elements of row \a i in the range \f$ [offsets[i]..offsets[i+1]) \f$.
+// The column indices of each row are required to be strictly increasing. For a column-major
+// matrix the \a offsets array has \f$ N+1 \f$ elements and the \a indices array contains the
+// row indices of the non-zero elements of each column:
+
+   \code
+   using blaze::CustomCompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   // Wrapping the row-major 3x4 matrix
+   //
+   //    ( 1 0 2 0 )
+   //    ( 0 0 0 3 )
+   //    ( 4 5 0 0 )
+   //
+   // given in 32-bit compressed row storage format
+   const int offsets[] = { 0, 2, 3, 5 };
+   const int indices[] = { 0, 2, 3, 0, 1 };
+   double    values [] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+   CustomCompressedMatrix<double,rowMajor,int> A( values, indices, offsets, 3UL, 4UL );
+
+   // Wrapping the same arrays as the transpose 4x3 matrix in compressed column storage format
+   CustomCompressedMatrix<const double,columnMajor,int> B( values, indices, offsets, 4UL, 3UL );
+   \endcode
+
+// The sparsity pattern of a custom compressed matrix is fixed, i.e. it is not possible to insert
+// or erase elements. However, in case the element type is not const-qualified, the values of the
+// non-zero elements can be modified via iterators:
+
+   \code
+   // Traversing the non-zero elements of the 2nd row of A
+   for( auto it=A.begin(2); it!=A.end(2); ++it ) {
+      it->value() *= 2.0;   // Modification of the value of the non-zero element
+      ... = it->index();    // Access to the index of the non-zero element
+   }
+
+   A(1,3) = 2.0;            // Compilation error: No write access via the function call operator
+   const double d = A(1,3); // Access to the element (1,3)
+   \endcode
+
+// A custom compressed matrix can be used on the right-hand side of all sparse matrix operations
+// and is evaluated with the same kernels as CompressedMatrix, including the SMP kernels of the
+// sparse matrix/dense vector multiplication. Since the arrays are not copied, the matrix doesn't
+// increase the memory consumption of the external matrix:
+
+   \code
+   blaze::DynamicVector<double> x( 4UL ), y;
+   blaze::CompressedMatrix<double,rowMajor> C;
+
+   y = A * x;          // Sparse matrix/dense vector multiplication without copying A
+   C = A * trans( B ); // Sparse matrix/sparse matrix multiplication
+   \endcode
+
+// Note that the CustomCompressedMatrix class template doesn't take responsibility for the given
+// arrays, i.e. the arrays have to outlive the matrix. Copying a custom compressed matrix results
+// in a second matrix referring to the same arrays. The constructor only checks the given arrays
+// for \c nullptr and the first and last offset for consistency. The offsets of all rows/columns
+// and the sorting and range of the indices can be checked via the isIntact() function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+class CustomCompressedMatrix
+   : public SparseMatrix< CustomCompressedMatrix<Type,SO,IT>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using VT = RemoveConst_t<Type>;  //!< The non-const element type.
+   //**********************************************************************************************
+
+   //**CustomIterator class definition*************************************************************
+   /*!\brief Iterator over the non-zero elements of the custom compressed matrix.
+   */
+   template< typename ValueType_ >  // Type of the values
+   class CustomIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the custom compressed matrix.
+      using Element = ValueIndexPair<VT>;
+
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                          //!< Type of the elements.
+      using PointerType      = const CustomIterator*;            //!< Pointer return type.
+      using ReferenceType    = const Element;                    //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Iterator difference type.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the CustomIterator class.
+      */
+      inline CustomIterator() noexcept
+         : value_( nullptr )  // Pointer to the current value
+         , index_( nullptr )  // Pointer to the current index
+      {}
+
+      /*!\brief Constructor for the CustomIterator class.
+      //
+      // \param value Pointer to the initial value.
+      // \param index Pointer to the initial index.
+      */
+      inline CustomIterator( ValueType_* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current index
+      {}
+
+      /*!\brief Conversion constructor from different CustomIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename ValueType2
+              , typename = EnableIf_t< IsConvertible_v<ValueType2*,ValueType_*> > >
+      inline CustomIterator( const CustomIterator<ValueType2>& it ) noexcept
+         : value_( it.value_ )  // Pointer to the current value
+         , index_( it.index_ )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Increment/decrement operators************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline CustomIterator& operator++() noexcept {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const CustomIterator operator++( int ) noexcept {
+         const CustomIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline CustomIterator& operator--() noexcept {
+         --value_;
+         --index_;
+         return *this;
+      }
+
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const CustomIterator operator--( int ) noexcept {
+         const CustomIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline CustomIterator& operator+=( ptrdiff_t inc ) noexcept {
+         value_ += inc;
+         index_ += inc;
+         return *this;
+      }
+
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline CustomIterator& operator-=( ptrdiff_t dec ) noexcept {
+         value_ -= dec;
+         index_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Access operators*************************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value-index-pair.
+      */
+      inline ReferenceType operator*() const {
+         return Element( *value_, *index_ );
+      }
+
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline PointerType operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return Reference to the current value of the sparse element.
+      */
+      inline ValueType_& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return static_cast<size_t>( *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Comparison operators*********************************************************************
+      /*!\brief Equality comparison between two CustomIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const CustomIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+
+      /*!\brief Inequality comparison between two CustomIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const CustomIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+
+      /*!\brief Less-than comparison between two CustomIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const CustomIterator& rhs ) const noexcept {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Arithmetic operators*********************************************************************
+      /*!\brief Calculating the number of elements between two CustomIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const CustomIterator& rhs ) const noexcept {
+         return index_ - rhs.index_;
+      }
+
+      /*!\brief Addition between a CustomIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const CustomIterator operator+( CustomIterator it, ptrdiff_t inc ) noexcept {
+         return it += inc;
+      }
+
+      /*!\brief Subtraction between a CustomIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const CustomIterator operator-( CustomIterator it, ptrdiff_t dec ) noexcept {
+         return it -= dec;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ValueType_* value_;  //!< Pointer to the current value.
+      const IT*   index_;  //!< Pointer to the current index.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename ValueType2 > friend class CustomIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CustomCompressedMatrix<Type,SO,IT>;  //!< Type of this CustomCompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;               //!< Base type of this CustomCompressedMatrix instance.
+   using ResultType     = CompressedMatrix<VT,SO>;             //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<VT,!SO>;            //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<VT,!SO>;            //!< Transpose type for expression template evaluations.
+   using ElementType    = VT;                                  //!< Type of the matrix elements.
+   using ReturnType     = const VT&;                           //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                         //!< Data type for composite expression templates.
+   using Reference      = const VT&;                           //!< Reference to a matrix value.
+   using ConstReference = const VT&;                           //!< Reference to a constant matrix value.
+   using IndexType      = IT;                                  //!< Type of the offsets and indices.
+   using Iterator       = CustomIterator<Type>;                //!< Iterator over non-constant elements.
+   using ConstIterator  = CustomIterator<const Type>;          //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CustomCompressedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CustomCompressedMatrix<NewType,SO,IT>;  //!< The type of the other CustomCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CustomCompressedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CustomCompressedMatrix<Type,SO,IT>;  //!< The type of the other CustomCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<VT>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CustomCompressedMatrix() noexcept;
+   inline CustomCompressedMatrix( Type* values, const IT* indices, const IT* offsets,
+                                  size_t m, size_t n );
+
+   CustomCompressedMatrix( const CustomCompressedMatrix& ) = default;
+   CustomCompressedMatrix( CustomCompressedMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~CustomCompressedMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   CustomCompressedMatrix& operator=( const CustomCompressedMatrix& ) = default;
+   CustomCompressedMatrix& operator=( CustomCompressedMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear() noexcept;
+   inline void   swap( CustomCompressedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Resource management functions***************************************************************
+   /*!\name Resource management functions */
+   //@{
+   inline void reset( Type* values, const IT* indices, const IT* offsets, size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t lines() const noexcept;
+   inline const IT* lowerIndex( size_t i, size_t j ) const noexcept;
+   inline const IT* upperIndex( size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t    m_;        //!< The current number of rows of the matrix.
+   size_t    n_;        //!< The current number of columns of the matrix.
+   Type*     values_;   //!< The external array of values of the non-zero elements.
+   const IT* indices_;  //!< The external array of indices of the non-zero elements.
+   const IT* offsets_;  //!< The external array of offsets of the rows/columns.
+   //@}
+   //**********************************************************************************************
+
+   //**Static member variables*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static const VT zero_;  //!< Neutral element for accesses to zero elements.
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+const RemoveConst_t<Type> CustomCompressedMatrix<Type,SO,IT>::zero_{};
+/*! \endcond */
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CustomCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline CustomCompressedMatrix<Type,SO,IT>::CustomCompressedMatrix() noexcept
+   : m_      ( 0UL )      // The current number of rows of the matrix
+   , n_      ( 0UL )      // The current number of columns of the matrix
+   , values_ ( nullptr )  // The external array of values of the non-zero elements
+   , indices_( nullptr )  // The external array of indices of the non-zero elements
+   , offsets_( nullptr )  // The external array of offsets of the rows/columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ M \times N \f$ custom compressed matrix.
+//
+// \param values The array of values of the non-zero elements.
+// \param indices The array of column (row-major) or row (column-major) indices.
+// \param offsets The array of row (row-major) or column (column-major) offsets.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid array of offsets.
+// \exception std::invalid_argument Invalid array of indices or values.
+//
+// This constructor creates a custom compressed matrix of size \f$ M \times N \f$ around the
+// given arrays. The non-zero elements of row/column \a i are stored in the range
+// \f$ [offsets[i]..offsets[i+1]) \f$ of the \a indices and \a values arrays. The constructor
+// throws a \a std::invalid_argument exception in the following cases:
+//
+//  - ... the given array of offsets is a \c nullptr;
+//  - ... the offset of the last row/column is smaller than the offset of the first row/column;
+//  - ... the matrix contains non-zero elements and the array of indices or values is a
+//        \c nullptr.
+//
+// The offsets of the individual rows/columns and the indices are not checked. The validity of
+// the given arrays can be checked via the isIntact() function.
+//
+// \note The custom compressed matrix does \b NOT take responsibility for the given arrays!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline CustomCompressedMatrix<Type,SO,IT>::CustomCompressedMatrix( Type* values, const IT* indices,
+                                                                   const IT* offsets,
+                                                                   size_t m, size_t n )
+   : m_      ( m )        // The current number of rows of the matrix
+   , n_      ( n )        // The current number of columns of the matrix
+   , values_ ( values )   // The external array of values of the non-zero elements
+   , indices_( indices )  // The external array of indices of the non-zero elements
+   , offsets_( offsets )  // The external array of offsets of the rows/columns
+{
+   if( offsets == nullptr || offsets[lines()] < offsets[0UL] ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of offsets" );
+   }
+
+   if( nonZeros() > 0UL && ( values == nullptr || indices == nullptr ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the non-zero element \f$ (i,j) \f$ or to a zero element
+// in case \f$ (i,j) \f$ is not contained in the sparsity pattern. The element is looked up via
+// binary search. This function only performs an index check in case BLAZE_USER_ASSERT() is
+// active. In contrast, the at() function is guaranteed to perform a check of the given access
+// indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstReference
+   CustomCompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstReference
+   CustomCompressedMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::Iterator
+   CustomCompressedMatrix<Type,SO,IT>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return Iterator( values_ + offsets_[i], indices_ + offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return ConstIterator( values_ + offsets_[i], indices_ + offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return ConstIterator( values_ + offsets_[i], indices_ + offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::Iterator
+   CustomCompressedMatrix<Type,SO,IT>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return Iterator( values_ + offsets_[i+1UL], indices_ + offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return ConstIterator( values_ + offsets_[i+1UL], indices_ + offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return ConstIterator( values_ + offsets_[i+1UL], indices_ + offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// Since the sparsity pattern of a custom compressed matrix is fixed, the capacity of the matrix
+// corresponds to the number of non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// Since the sparsity pattern of a custom compressed matrix is fixed, the capacity of the
+// row/column corresponds to the number of non-zero elements in the row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::nonZeros() const noexcept
+{
+   if( offsets_ == nullptr )
+      return 0UL;
+
+   return static_cast<size_t>( offsets_[lines()] - offsets_[0UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return static_cast<size_t>( offsets_[i+1UL] - offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets the values of all non-zero elements to their default value. Note that
+// the sparsity pattern of the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void CustomCompressedMatrix<Type,SO,IT>::reset()
+{
+   for( size_t i=0UL; i<lines(); ++i )
+      reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values of all non-zero elements in the specified row/column to their
+// default value. In case the storage order is set to \a rowMajor the function resets the values
+// in row \a i, if the storage order is set to \a columnMajor the function resets the values in
+// column \a i. Note that the sparsity pattern of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void CustomCompressedMatrix<Type,SO,IT>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   for( IT k=offsets_[i]; k<offsets_[i+1UL]; ++k )
+      clear( values_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0 and the matrix doesn't refer to the
+// external arrays anymore.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void CustomCompressedMatrix<Type,SO,IT>::clear() noexcept
+{
+   m_       = 0UL;
+   n_       = 0UL;
+   values_  = nullptr;
+   indices_ = nullptr;
+   offsets_ = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom compressed matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void CustomCompressedMatrix<Type,SO,IT>::swap( CustomCompressedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   swap( values_, m.values_ );
+   swap( indices_, m.indices_ );
+   swap( offsets_, m.offsets_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the matrix.
+//
+// \return The number of rows (row-major) or columns (column-major) of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline size_t CustomCompressedMatrix<Type,SO,IT>::lines() const noexcept
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RESOURCE MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Resets the custom compressed matrix and replaces the arrays with the given arrays.
+//
+// \param values The array of values of the non-zero elements.
+// \param indices The array of column (row-major) or row (column-major) indices.
+// \param offsets The array of row (row-major) or column (column-major) offsets.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Invalid array of offsets.
+// \exception std::invalid_argument Invalid array of indices or values.
+//
+// This function resets the custom compressed matrix to the given arrays of size \f$ M \times N \f$.
+// In case the given arrays are invalid (see the constructor), a \a std::invalid_argument exception
+// is thrown and the matrix remains unchanged.
+//
+// \note The custom compressed matrix does NOT take responsibility for the new arrays!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void CustomCompressedMatrix<Type,SO,IT>::reset( Type* values, const IT* indices,
+                                                       const IT* offsets, size_t m, size_t n )
+{
+   CustomCompressedMatrix tmp( values, indices, offsets, m, n );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparsity
+// pattern of the matrix. It specifically searches for the element at row index \a i and column
+// index \a j. In case the element is found, the function returns a row/column iterator to the
+// element. Otherwise an iterator just past the last non-zero element of row \a i or column
+// \a j (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::Iterator
+   CustomCompressedMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const size_t index( SO ? i : j );
+   const IT* const pos( lowerIndex( i, j ) );
+
+   if( pos != indices_ + offsets_[( SO ? j : i )+1UL] && static_cast<size_t>( *pos ) == index )
+      return Iterator( values_ + ( pos - indices_ ), pos );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparsity
+// pattern of the matrix. It specifically searches for the element at row index \a i and column
+// index \a j. In case the element is found, the function returns a row/column iterator to the
+// element. Otherwise an iterator just past the last non-zero element of row \a i or column
+// \a j (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t index( SO ? i : j );
+   const IT* const pos( lowerIndex( i, j ) );
+
+   if( pos != indices_ + offsets_[( SO ? j : i )+1UL] && static_cast<size_t>( *pos ) == index )
+      return ConstIterator( values_ + ( pos - indices_ ), pos );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less than the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::Iterator
+   CustomCompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   const IT* const pos( lowerIndex( i, j ) );
+   return Iterator( values_ + ( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less than the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const IT* const pos( lowerIndex( i, j ) );
+   return ConstIterator( values_ + ( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater than the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::Iterator
+   CustomCompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   const IT* const pos( upperIndex( i, j ) );
+   return Iterator( values_ + ( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater than the given row
+// index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline typename CustomCompressedMatrix<Type,SO,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   const IT* const pos( upperIndex( i, j ) );
+   return ConstIterator( values_ + ( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first index of row/column \a i not less than the given index.
+//
+// \param i The row index. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Pointer to the first index not less than the given index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline const IT* CustomCompressedMatrix<Type,SO,IT>::lowerIndex( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   return std::lower_bound( indices_ + offsets_[line], indices_ + offsets_[line+1UL], index,
+                            []( const IT& a, size_t b ) { return static_cast<size_t>( a ) < b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first index of row/column \a i greater than the given index.
+//
+// \param i The row index. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Pointer to the first index greater than the given index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline const IT* CustomCompressedMatrix<Type,SO,IT>::upperIndex( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   return std::upper_bound( indices_ + offsets_[line], indices_ + offsets_[line+1UL], index,
+                            []( size_t a, const IT& b ) { return a < static_cast<size_t>( b ); } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the offsets and indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomCompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the offsets and indices
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomCompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix). Since a custom compressed matrix cannot be assigned to,
+// the function returns \a false. However, the matrix can be used as operand of SMP assignments.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline bool CustomCompressedMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CUSTOMCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+void reset( CustomCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void reset( CustomCompressedMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+void clear( CustomCompressedMatrix<Type,SO,IT>& m );
+
+template< RelaxationFlag RF, typename Type, bool SO, typename IT >
+bool isDefault( const CustomCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+bool isIntact( const CustomCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void swap( CustomCompressedMatrix<Type,SO,IT>& a, CustomCompressedMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given custom compressed matrix.
+// \ingroup custom_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+//
+// This function resets the values of all non-zero elements of the given matrix to their default
+// value. Note that the sparsity pattern of the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void reset( CustomCompressedMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given custom compressed matrix.
+// \ingroup custom_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given custom compressed
+// matrix to their default value. In case the given matrix is a \a rowMajor matrix the function
+// resets the values in row \a i, if it is a \a columnMajor matrix the function resets the values
+// in column \a i. Note that the sparsity pattern of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void reset( CustomCompressedMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given custom compressed matrix.
+// \ingroup custom_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void clear( CustomCompressedMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given custom compressed matrix is in default state.
+// \ingroup custom_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the custom compressed matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0. In case it is in default state, the function
+// returns \a true, else it will return \a false.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO            // Storage order
+        , typename IT >      // Type of the offsets and indices
+inline bool isDefault( const CustomCompressedMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given custom compressed matrix are intact.
+// \ingroup custom_compressed_matrix
+//
+// \param m The custom compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the external arrays of the custom compressed matrix represent a
+// valid matrix, i.e. if the offsets of all rows/columns are non-decreasing and if the indices of
+// each row/column are strictly increasing and smaller than the number of columns/rows. Since
+// this requires a traversal of all offsets and indices, the check is not performed by the
+// constructor. The following example demonstrates the use of the \a isIntact() function:
+
+   \code
+   blaze::CustomCompressedMatrix<double> A( values, indices, offsets, m, n );
+   if( isIntact( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline bool isIntact( const CustomCompressedMatrix<Type,SO,IT>& m )
+{
+   const size_t lines( SO ? m.columns() : m.rows() );
+   const size_t size ( SO ? m.rows() : m.columns() );
+
+   for( size_t i=0UL; i<lines; ++i )
+   {
+      if( m.end(i) < m.begin(i) )
+         return false;
+
+      for( auto element=m.begin(i); element!=m.end(i); ++element ) {
+         if( element->index() >= size ||
+             ( element != m.begin(i) && element->index() <= ( element-1 )->index() ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom compressed matrices.
+// \ingroup custom_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the offsets and indices
+inline void swap( CustomCompressedMatrix<Type,SO,IT>& a,
+                  CustomCompressedMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCUSTOM SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsCustom< CustomCompressedMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
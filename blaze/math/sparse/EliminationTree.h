@@ -0,0 +1,230 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/EliminationTree.h
+//  \brief Header file for the elimination tree of sparse symmetric matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ELIMINATIONTREE_H_
+#define _BLAZE_MATH_SPARSE_ELIMINATIONTREE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ELIMINATION TREE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Elimination tree functions */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> etree( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+std::vector<size_t> etree( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+inline std::vector<size_t> postorder( const std::vector<size_t>& parent );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elimination tree of the given sparse symmetric matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix with symmetric sparsity pattern.
+// \return The parent of each row/column in the elimination tree.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the elimination tree of the given sparse matrix, i.e. the tree whose
+// edges connect each column \a j of the Cholesky factor \f$ L \f$ with the row index of the first
+// off-diagonal non-zero element of column \a j. The result contains the parent of every column;
+// the roots of the tree (i.e. the last column of each connected component) are marked by the
+// number of rows of the matrix. The function assumes that the sparsity pattern of \a A is
+// symmetric and only takes the strictly upper part of each column into account. In case the
+// given matrix is not a square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> etree( const SparseMatrix<MT,SO>& A )
+{
+   std::vector<size_t> perm( (~A).rows() );
+
+   for( size_t i=0UL; i<perm.size(); ++i ) {
+      perm[i] = i;
+   }
+
+   return etree( ~A, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elimination tree of the given symmetrically permuted sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix with symmetric sparsity pattern.
+// \param perm The symmetric permutation to be applied to the matrix.
+// \return The parent of each row/column of the permuted matrix in the elimination tree.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function computes the elimination tree of the matrix \f$ P A P^T \f$, where the \a k-th
+// row/column of the permuted matrix corresponds to the row/column \a perm[k] of \a A (as for
+// instance computed by the amd() function). The parents are given in terms of the permuted
+// matrix; the roots of the tree are marked by the number of rows of the matrix. In case the
+// given matrix is not a square matrix or the size of the permutation does not match the size
+// of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> etree( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+   else if( perm.size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   std::vector<size_t> iperm( n );
+   std::vector<size_t> parent( n, n );
+   std::vector<size_t> ancestor( n, n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      iperm[perm[k]] = k;
+   }
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t p( perm[j] );
+
+      for( auto element=(~A).begin(p); element!=(~A).end(p); ++element )
+      {
+         size_t i( iperm[element->index()] );
+
+         if( i >= j ) continue;
+
+         // Traversing the path from i to the root of its subtree, compressing it on the way
+         while( ancestor[i] != n && ancestor[i] != j ) {
+            const size_t next( ancestor[i] );
+            ancestor[i] = j;
+            i = next;
+         }
+
+         if( ancestor[i] == n ) {
+            ancestor[i] = j;
+            parent[i] = j;
+         }
+      }
+   }
+
+   return parent;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a postordering of the given elimination tree.
+// \ingroup sparse_matrix
+//
+// \param parent The parent of each node of the tree (roots are marked by the number of nodes).
+// \return The nodes of the tree in postorder.
+//
+// This function computes a depth-first postordering of the given tree (or forest), i.e. every
+// node is preceded by all nodes of its subtree and the nodes of each subtree are numbered
+// consecutively. The children of each node are visited in ascending order. Renumbering a matrix
+// according to a postordering of its elimination tree does not change the fill of the Cholesky
+// factor, but it places the columns of each subtree next to each other.
+*/
+inline std::vector<size_t> postorder( const std::vector<size_t>& parent )
+{
+   const size_t n( parent.size() );
+
+   std::vector<size_t> head( n+1UL, n );
+   std::vector<size_t> next( n, n );
+   std::vector<size_t> post;
+   std::vector<size_t> stack;
+
+   post.reserve( n );
+
+   // Setting up the children lists in ascending order (the virtual node n holds all roots)
+   for( size_t j=n; j>0UL; --j ) {
+      const size_t p( parent[j-1UL] );
+      BLAZE_USER_ASSERT( p <= n, "Invalid parent detected" );
+      next[j-1UL] = head[p];
+      head[p] = j-1UL;
+   }
+
+   for( size_t root=head[n]; root!=n; root=next[root] )
+   {
+      stack.push_back( root );
+
+      while( !stack.empty() )
+      {
+         const size_t j( stack.back() );
+         const size_t child( head[j] );
+
+         if( child == n ) {
+            stack.pop_back();
+            post.push_back( j );
+         }
+         else {
+            head[j] = next[child];
+            stack.push_back( child );
+         }
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( post.size() == n, "Invalid postordering detected" );
+
+   return post;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,704 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/FixedPattern.h
+//  \brief Header file for the fixed sparsity pattern assembly interface of the compressed matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_FIXEDPATTERN_H_
+#define _BLAZE_MATH_SPARSE_FIXEDPATTERN_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place value access to a compressed matrix with frozen sparsity pattern.
+// \ingroup sparse_matrix
+//
+// The FixedPattern class template provides fast access to the non-zero elements of a compressed
+// matrix whose sparsity pattern does not change anymore. This is the typical situation in Newton
+// iterations and time stepping schemes, where a system matrix with a fixed pattern is assembled
+// over and over again. A FixedPattern is created via the freeze() function:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and setting up the sparsity pattern of A
+
+   auto pattern = freeze( A );
+   \endcode
+
+// Freezing a matrix removes all excessive capacity from the matrix (see the \c trim() function)
+// such that all non-zero elements are stored consecutively in storage order. Each non-zero
+// element can then be addressed by its position in storage order, its so-called \a slot. The
+// slots of the elements in row \a i (in case of a row-major matrix) or column \a i (in case of
+// a column-major matrix) lie in the range \f$ [offset(i)..offset(i+1)) \f$:
+
+   \code
+   pattern.reset();  // Resetting all values to zero without touching the sparsity pattern
+
+   for( size_t k=0UL; k<pattern.size(); ++k ) {
+      pattern[k] *= 2.0;
+   }
+   \endcode
+
+// For the scatter-add of element matrices, the slots of all elements of an element matrix can
+// be computed once via the slots() function and be reused in all subsequent assembly steps. In
+// contrast to the function call operator of the compressed matrix, this avoids any search for
+// the position of an element:
+
+   \code
+   std::vector<size_t> dofs{ 3UL, 7UL, 8UL };
+   const std::vector<size_t> map( pattern.slots( dofs, dofs ) );
+
+   blaze::DynamicMatrix<double> Ke( 3UL, 3UL );
+   // ... Computing the element matrix
+
+   pattern.scatterAdd( map, Ke );
+   \endcode
+
+// The add() and scatterAdd() functions are not thread-safe, i.e. they must not be used to
+// concurrently update the same slot from several threads. For a parallel assembly, the
+// atomicAdd() and atomicScatterAdd() functions can be used instead. They protect each single
+// update by one of a fixed number of locks, which are assigned to the slots in a round-robin
+// fashion.
+//
+// Note that the sparsity pattern of the underlying matrix must not be changed as long as the
+// FixedPattern is in use. Any insertion or erasure of elements, any resize and any assignment
+// to the matrix invalidates all slots. The isIntact() function can be used to detect some of
+// these violations.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+class FixedPattern
+{
+ public:
+   //**Type definitions****************************************************************************
+   using MatrixType     = CompressedMatrix<Type,SO>;  //!< Type of the underlying compressed matrix.
+   using ElementType    = Type;                       //!< Type of the matrix elements.
+   using Reference      = Type&;                      //!< Reference to a non-constant value.
+   using ConstReference = const Type&;                //!< Reference to a constant value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The number of locks used for the thread-safe accumulation of values.
+   static constexpr size_t locks = 256UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FixedPattern( MatrixType& matrix );
+
+   FixedPattern( FixedPattern&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   FixedPattern& operator=( FixedPattern&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t k ) noexcept;
+   inline ConstReference operator[]( size_t k ) const noexcept;
+   inline Reference      at( size_t k );
+   inline ConstReference at( size_t k ) const;
+   inline MatrixType&    matrix() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t offset( size_t i ) const noexcept;
+   inline size_t slot( size_t i, size_t j ) const;
+
+   template< typename IT1, typename IT2 >
+   std::vector<size_t> slots( const IT1& rowIndices, const IT2& columnIndices ) const;
+
+   inline void reset();
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Accumulation functions**********************************************************************
+   /*!\name Accumulation functions */
+   //@{
+   inline void add      ( size_t k, const Type& value ) noexcept;
+   inline void atomicAdd( size_t k, const Type& value );
+
+   template< typename MT, bool SO2 >
+   void scatterAdd( const std::vector<size_t>& map, const DenseMatrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   void atomicScatterAdd( const std::vector<size_t>& map, const DenseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Iterator = typename MatrixType::Iterator;  //!< Iterator over the non-zero elements.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t lines() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType* matrix_;                   //!< The underlying compressed matrix.
+   Iterator first_;                       //!< The first non-zero element of the matrix.
+   size_t size_;                          //!< The number of non-zero elements of the matrix.
+   std::unique_ptr<std::mutex[]> mutex_;  //!< The locks for the thread-safe accumulation.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a FixedPattern for the given compressed matrix.
+//
+// \param matrix The compressed matrix whose sparsity pattern is frozen.
+//
+// The constructor removes all excessive capacity from the given matrix. Please note that in case
+// a reallocation occurs, all iterators, pointers and references to elements of the matrix are
+// invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+FixedPattern<Type,SO>::FixedPattern( MatrixType& matrix )
+   : matrix_( &matrix )                  // The underlying compressed matrix
+   , first_ ()                           // The first non-zero element of the matrix
+   , size_  ( matrix.nonZeros() )        // The number of non-zero elements of the matrix
+   , mutex_ ( new std::mutex[locks] )    // The locks for the thread-safe accumulation
+{
+   matrix.trim();
+
+   if( lines() > 0UL ) {
+      first_ = matrix.begin( 0UL );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invalid fixed pattern detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the value of the given slot.
+//
+// \param k The slot of the accessed element \f$[0..size()-1]\f$.
+// \return Reference to the value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename FixedPattern<Type,SO>::Reference
+   FixedPattern<Type,SO>::operator[]( size_t k ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid slot access index" );
+   return first_[k].value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the value of the given slot.
+//
+// \param k The slot of the accessed element \f$[0..size()-1]\f$.
+// \return Reference to the value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename FixedPattern<Type,SO>::ConstReference
+   FixedPattern<Type,SO>::operator[]( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid slot access index" );
+   return first_[k].value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the value of the given slot.
+//
+// \param k The slot of the accessed element \f$[0..size()-1]\f$.
+// \return Reference to the value of the accessed element.
+// \exception std::out_of_range Invalid slot access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename FixedPattern<Type,SO>::Reference
+   FixedPattern<Type,SO>::at( size_t k )
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid slot access index" );
+   }
+   return (*this)[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the value of the given slot.
+//
+// \param k The slot of the accessed element \f$[0..size()-1]\f$.
+// \return Reference to the value of the accessed element.
+// \exception std::out_of_range Invalid slot access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename FixedPattern<Type,SO>::ConstReference
+   FixedPattern<Type,SO>::at( size_t k ) const
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid slot access index" );
+   }
+   return (*this)[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the underlying compressed matrix.
+//
+// \return Reference to the underlying compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename FixedPattern<Type,SO>::MatrixType& FixedPattern<Type,SO>::matrix() const noexcept
+{
+   return *matrix_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of slots, i.e. the number of non-zero elements of the matrix.
+//
+// \return The number of slots.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t FixedPattern<Type,SO>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first slot of the given row/column.
+//
+// \param i The row/column index \f$[0..M]\f$ or \f$[0..N]\f$.
+// \return The first slot of row/column \a i.
+//
+// This function returns the slot of the first non-zero element in row \a i (in case of a
+// row-major matrix) or column \a i (in case of a column-major matrix). For \a i equal to the
+// number of rows/columns the function returns size().
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t FixedPattern<Type,SO>::offset( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i <= lines(), "Invalid row/column access index" );
+
+   if( i == lines() )
+      return size_;
+   else return matrix_->begin(i) - first_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the slot of the element (i,j).
+//
+// \param i The row index of the element \f$[0..M-1]\f$.
+// \param j The column index of the element \f$[0..N-1]\f$.
+// \return The slot of the element (i,j).
+// \exception std::out_of_range Invalid matrix access index.
+// \exception std::invalid_argument Element is not part of the sparsity pattern.
+//
+// This function performs a binary search for the element (i,j) within its row (in case of a
+// row-major matrix) or column (in case of a column-major matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t FixedPattern<Type,SO>::slot( size_t i, size_t j ) const
+{
+   if( i >= matrix_->rows() || j >= matrix_->columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   const Iterator pos( matrix_->find( i, j ) );
+
+   if( pos == matrix_->end( SO ? j : i ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Element is not part of the sparsity pattern" );
+   }
+
+   return pos - first_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the slots of all elements of an element matrix.
+//
+// \param rowIndices The global row indices of the element matrix.
+// \param columnIndices The global column indices of the element matrix.
+// \return The slots of all elements of the element matrix in row-major order.
+// \exception std::out_of_range Invalid matrix access index.
+// \exception std::invalid_argument Element is not part of the sparsity pattern.
+//
+// This function computes the slots of all elements \f$ (rowIndices[a],columnIndices[b]) \f$
+// of an element matrix and returns them in row-major order, i.e. the slot of the element
+// \f$ (a,b) \f$ of the element matrix is stored at position \f$ a \cdot columnIndices.size()
+// + b \f$. The index containers can be of any type providing a \c size() function and a
+// subscript operator (as for instance \c std::vector, \c std::array or DynamicVector). In case
+// any of the elements is not part of the sparsity pattern, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO >        // Storage order
+template< typename IT1     // Type of the row indices
+        , typename IT2 >   // Type of the column indices
+std::vector<size_t>
+   FixedPattern<Type,SO>::slots( const IT1& rowIndices, const IT2& columnIndices ) const
+{
+   const size_t m( rowIndices.size() );
+   const size_t n( columnIndices.size() );
+
+   std::vector<size_t> map( m*n );
+
+   for( size_t a=0UL; a<m; ++a ) {
+      for( size_t b=0UL; b<n; ++b ) {
+         map[a*n+b] = slot( rowIndices[a], columnIndices[b] );
+      }
+   }
+
+   return map;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the values of all non-zero elements to their default value.
+//
+// \return void
+//
+// In contrast to the \c reset() function of the compressed matrix, this function does not
+// remove any element from the sparsity pattern.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void FixedPattern<Type,SO>::reset()
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( isIntact(), "Invalid fixed pattern detected" );
+
+   for( size_t k=0UL; k<size_; ++k ) {
+      reset( first_[k].value() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the sparsity pattern of the underlying matrix is still intact.
+//
+// \return \a true in case the sparsity pattern is intact, \a false if not.
+//
+// This function checks whether the number of non-zero elements and the storage position of the
+// first element of the underlying matrix have not been changed since the matrix has been frozen
+// and whether all non-zero elements are still stored consecutively. Changes of the sparsity
+// pattern that preserve these properties are not detected.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool FixedPattern<Type,SO>::isIntact() const noexcept
+{
+   if( matrix_->nonZeros() != size_ )
+      return false;
+
+   if( lines() == 0UL )
+      return true;
+
+   if( matrix_->begin( 0UL ) != first_ )
+      return false;
+
+   for( size_t i=1UL; i<lines(); ++i ) {
+      if( matrix_->begin(i) != matrix_->end(i-1UL) )
+         return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows or columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t FixedPattern<Type,SO>::lines() const noexcept
+{
+   return SO ? matrix_->columns() : matrix_->rows();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCUMULATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adds the given value to the value of the given slot.
+//
+// \param k The slot of the updated element \f$[0..size()-1]\f$.
+// \param value The value to be added.
+// \return void
+//
+// This function is not thread-safe. For a concurrent update of the same slot by several threads
+// the atomicAdd() function has to be used.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void FixedPattern<Type,SO>::add( size_t k, const Type& value ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid slot access index" );
+   first_[k].value() += value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread-safe addition of the given value to the value of the given slot.
+//
+// \param k The slot of the updated element \f$[0..size()-1]\f$.
+// \param value The value to be added.
+// \return void
+//
+// This function can be called concurrently by several threads, also for the same slot. The
+// update is protected by the lock assigned to the given slot.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void FixedPattern<Type,SO>::atomicAdd( size_t k, const Type& value )
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid slot access index" );
+
+   std::lock_guard<std::mutex> lock( mutex_[k%locks] );
+   first_[k].value() += value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scatter-add of an element matrix.
+//
+// \param map The slots of the elements of the element matrix (see the slots() function).
+// \param rhs The element matrix to be added.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function adds the element \f$ (a,b) \f$ of the given element matrix to the slot stored
+// at position \f$ a \cdot rhs.columns() + b \f$ of the given slot map. In case the size of the
+// slot map does not match the size of the element matrix, a \a std::invalid_argument exception
+// is thrown. This function is not thread-safe, for a parallel assembly the atomicScatterAdd()
+// function has to be used.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the element matrix
+        , bool SO2 >     // Storage order of the element matrix
+void FixedPattern<Type,SO>::scatterAdd( const std::vector<size_t>& map,
+                                        const DenseMatrix<MT,SO2>& rhs )
+{
+   const size_t m( (~rhs).rows() );
+   const size_t n( (~rhs).columns() );
+
+   if( map.size() != m*n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   for( size_t a=0UL; a<m; ++a ) {
+      for( size_t b=0UL; b<n; ++b ) {
+         add( map[a*n+b], (~rhs)(a,b) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread-safe scatter-add of an element matrix.
+//
+// \param map The slots of the elements of the element matrix (see the slots() function).
+// \param rhs The element matrix to be added.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function works as the scatterAdd() function, but can be called concurrently by several
+// threads, also in case the element matrices share slots.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the element matrix
+        , bool SO2 >     // Storage order of the element matrix
+void FixedPattern<Type,SO>::atomicScatterAdd( const std::vector<size_t>& map,
+                                              const DenseMatrix<MT,SO2>& rhs )
+{
+   const size_t m( (~rhs).rows() );
+   const size_t n( (~rhs).columns() );
+
+   if( map.size() != m*n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   for( size_t a=0UL; a<m; ++a ) {
+      for( size_t b=0UL; b<n; ++b ) {
+         atomicAdd( map[a*n+b], (~rhs)(a,b) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name FixedPattern functions */
+//@{
+template< typename Type, bool SO >
+FixedPattern<Type,SO> freeze( CompressedMatrix<Type,SO>& matrix );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Freezes the sparsity pattern of the given compressed matrix.
+// \ingroup sparse_matrix
+//
+// \param matrix The compressed matrix whose sparsity pattern is frozen.
+// \return The FixedPattern providing slot-based access to the values of the matrix.
+//
+// This function creates a FixedPattern for the given compressed matrix, which provides slot-based
+// access to the values of all non-zero elements of the matrix (see the FixedPattern class
+// template for details). The sparsity pattern of the given matrix must not be changed as long
+// as the returned FixedPattern is in use.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+FixedPattern<Type,SO> freeze( CompressedMatrix<Type,SO>& matrix )
+{
+   return FixedPattern<Type,SO>( matrix );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
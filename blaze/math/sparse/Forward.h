@@ -42,6 +42,7 @@
 
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -60,6 +61,11 @@ template< typename Type                    // Data type of the matrix
         , bool SO = defaultStorageOrder >  // Storage order
 class CompressedMatrix;
 
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Type of the offsets and indices
+class CustomCompressedMatrix;
+
 template< typename Type                    // Data type of the matrix
         , bool SO = defaultStorageOrder >  // Storage order
 class IdentityMatrix;
@@ -0,0 +1,502 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/IncompleteCholesky.h
+//  \brief Header file for the incomplete Cholesky decomposition of sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_INCOMPLETECHOLESKY_H_
+#define _BLAZE_MATH_SPARSE_INCOMPLETECHOLESKY_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/LevelSchedule.h>
+#include <blaze/math/sparse/LSE.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INCOMPLETE CHOLESKY DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Incomplete Cholesky decomposition functions */
+//@{
+template< typename Type, bool SO >
+void ic0( CompressedMatrix<Type,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place IC(0) decomposition of the given sparse symmetric positive definite matrix.
+// \ingroup sparse_matrix
+//
+// \param A The sparse symmetric (or Hermitian) matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-symmetric sparsity pattern provided.
+// \exception std::runtime_error Incomplete decomposition of non-positive-definite matrix failed.
+//
+// This function computes the incomplete Cholesky decomposition without fill-in (IC(0)) of the
+// given sparse symmetric (or Hermitian) matrix. The lower triangular factor \f$ L \f$ has the
+// same sparsity pattern as the lower part of \a A and satisfies \f$ (LL^H)_{ij} = a_{ij} \f$ for
+// all non-zero elements of \a A. The decomposition is computed in place: After the function
+// returns, the lower part of \a A contains the factor \f$ L \f$ and the upper part of \a A
+// contains \f$ L^H \f$. The sparsity pattern of \a A is not changed:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization of a symmetric positive definite matrix
+
+   blaze::ic0( A );  // A now contains both L and L^H
+   \endcode
+
+// The function only accesses the values of one triangular half of the matrix, i.e. the values
+// of \a A are assumed to be symmetric (or Hermitian). The function fails if ...
+//
+//  - ... the given matrix is not a square matrix;
+//  - ... the sparsity pattern of the given matrix is not symmetric;
+//  - ... a diagonal element is missing or the decomposition encounters a non-positive pivot.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order of the matrix
+void ic0( CompressedMatrix<Type,SO>& A )
+{
+   using Iterator = typename CompressedMatrix<Type,SO>::Iterator;
+
+   if( !isSquare( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( A.rows() );
+
+   std::vector<Iterator> diag  ( n );  // The diagonal element of each slice
+   std::vector<Iterator> mirror( n );  // The next unprocessed element behind each diagonal
+   std::vector<Iterator> work  ( n );
+   std::vector<size_t>   mark  ( n, n );
+
+   // In case of a column-major matrix the slices are the rows of the conjugate matrix. The
+   // factor computed in the strictly upper part of A is therefore the conjugate transpose
+   // of the Cholesky factor of A.
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Iterator end( A.end(i) );
+
+      Iterator element( A.begin(i) );
+
+      for( ; element!=end && element->index() < i; ++element ) {
+         work[element->index()] = element;
+         mark[element->index()] = i;
+      }
+
+      if( element == end || element->index() != i ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Incomplete decomposition of non-positive-definite matrix failed" );
+      }
+
+      diag[i]   = element;
+      mirror[i] = element+1UL;
+
+      auto pivot( real( diag[i]->value() ) );
+
+      for( element=A.begin(i); element!=diag[i]; ++element )
+      {
+         const size_t j( element->index() );
+
+         Type value( element->value() );
+
+         for( Iterator other=A.begin(j); other!=diag[j]; ++other ) {
+            const size_t k( other->index() );
+            if( mark[k] == i )
+               value -= work[k]->value() * conj( other->value() );
+         }
+
+         value /= diag[j]->value();
+         element->value() = value;
+         pivot -= real( value * conj( value ) );
+
+         if( mirror[j] == A.end(j) || mirror[j]->index() != i ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-symmetric sparsity pattern provided" );
+         }
+
+         mirror[j]->value() = conj( value );
+         ++mirror[j];
+      }
+
+      if( !( pivot > 0 ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Incomplete decomposition of non-positive-definite matrix failed" );
+      }
+
+      diag[i]->value() = std::sqrt( pivot );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( mirror[i] != A.end(i) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-symmetric sparsity pattern provided" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky preconditioner for sparse symmetric positive definite matrices.
+// \ingroup sparse_matrix
+//
+// The IncompleteCholesky class template represents the incomplete Cholesky decomposition
+// \f$ A \approx LL^H \f$ without fill-in (IC(0), see the ic0() function) of a sparse symmetric
+// (or Hermitian) positive definite matrix \a A, which can be used as preconditioner for iterative
+// solvers as for instance the conjugate gradient method. Both \f$ L \f$ and \f$ L^H \f$ are stored
+// in a single CompressedMatrix. The preconditioner is applied via the function call operator,
+// which computes \f$ y = L^{-H} L^{-1} r \f$:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;  // The sparse system matrix
+   blaze::DynamicVector<double> r;                               // The residual vector
+   // ... Resizing and initialization
+
+   const blaze::IncompleteCholesky<double> ic( A );  // IC(0) preconditioner
+
+   blaze::DynamicVector<double> y( ic( r ) );  // Applying the preconditioner
+   ic.apply( y, r );                           // Applying the preconditioner without allocation
+   \endcode
+
+// During the decomposition the forward and backward substitutions are analysed by means of a
+// level schedule (see the LevelSchedule class). In case the shared memory parallelization is
+// enabled, all levels containing at least as many rows as specified by the
+// \c BLAZE_SMP_SMATTRSV_THRESHOLD are processed in parallel.
+*/
+template< typename Type                   // Data type of the factor
+        , bool SO=defaultStorageOrder >  // Storage order of the factor
+class IncompleteCholesky
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                       //!< Type of the elements of the factor.
+   using FactorType  = CompressedMatrix<Type,SO>;  //!< Type of the combined factors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline IncompleteCholesky();
+
+   template< typename MT, bool SO2 >
+   explicit inline IncompleteCholesky( const SparseMatrix<MT,SO2>& A );
+
+   IncompleteCholesky( const IncompleteCholesky& ) = default;
+   IncompleteCholesky( IncompleteCholesky&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~IncompleteCholesky() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   IncompleteCholesky& operator=( const IncompleteCholesky& ) = default;
+   IncompleteCholesky& operator=( IncompleteCholesky&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO2 >
+   void compute( const SparseMatrix<MT,SO2>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Application functions***********************************************************************
+   /*!\name Application functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   void apply( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& r ) const;
+
+   template< typename VT, bool TF >
+   inline DynamicVector<Type,TF> operator()( const DenseVector<VT,TF>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t            rows()     const noexcept;
+   inline size_t            nonZeros() const noexcept;
+   inline const FactorType& factors()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType    factors_;  //!< The factor L and its conjugate transpose.
+   LevelSchedule lower_;    //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;    //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for IncompleteCholesky.
+//
+// The default constructor creates an empty decomposition of a \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+inline IncompleteCholesky<Type,SO>::IncompleteCholesky()
+   : factors_()                   // The factor L and its conjugate transpose
+   , lower_  ( factors_, true  )  // The level schedule of the forward substitution
+   , upper_  ( factors_, false )  // The level schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the IC(0) decomposition of the given sparse matrix.
+//
+// \param A The sparse symmetric (or Hermitian) matrix to be decomposed.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-symmetric sparsity pattern provided.
+// \exception std::runtime_error Incomplete decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+inline IncompleteCholesky<Type,SO>::IncompleteCholesky( const SparseMatrix<MT,SO2>& A )
+   : IncompleteCholesky()
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computation of the IC(0) decomposition of the given sparse matrix.
+//
+// \param A The sparse symmetric (or Hermitian) matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-symmetric sparsity pattern provided.
+// \exception std::runtime_error Incomplete decomposition of non-positive-definite matrix failed.
+//
+// This function computes the IC(0) decomposition of the given sparse matrix (see the ic0()
+// function) and analyses the resulting triangular factors. In case of an exception the previous
+// decomposition remains unchanged.
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+void IncompleteCholesky<Type,SO>::compute( const SparseMatrix<MT,SO2>& A )
+{
+   FactorType factors( ~A );
+   ic0( factors );
+
+   LevelSchedule lower( factors, true  );
+   LevelSchedule upper( factors, false );
+
+   swap( factors_, factors );
+   lower_ = std::move( lower );
+   upper_ = std::move( upper );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner to the given vector (\f$ y = L^{-H} L^{-1} r \f$).
+//
+// \param y The resulting dense vector.
+// \param r The dense vector the preconditioner is applied to.
+// \return void
+// \exception std::invalid_argument Invalid vector size provided.
+//
+// This function applies the preconditioner to the given vector \a r by means of a forward and
+// a backward substitution and stores the result in \a y. The vector \a y is resized if necessary,
+// \a y and \a r may refer to the same vector.
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+template< typename VT1   // Type of the resulting vector
+        , bool TF        // Transpose flag of the vectors
+        , typename VT2 > // Type of the given vector
+void IncompleteCholesky<Type,SO>::apply( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& r ) const
+{
+   if( (~r).size() != factors_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size provided" );
+   }
+
+   resize( ~y, (~r).size(), false );
+   smpAssign( ~y, ~r );
+
+   solveTriangularPart<true,false> ( factors_, ~y, lower_ );
+   solveTriangularPart<false,false>( factors_, ~y, upper_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner to the given vector (\f$ L^{-H} L^{-1} r \f$).
+//
+// \param r The dense vector the preconditioner is applied to.
+// \return The result of the application of the preconditioner.
+// \exception std::invalid_argument Invalid vector size provided.
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+template< typename VT    // Type of the given vector
+        , bool TF >      // Transpose flag of the given vector
+inline DynamicVector<Type,TF>
+   IncompleteCholesky<Type,SO>::operator()( const DenseVector<VT,TF>& r ) const
+{
+   DynamicVector<Type,TF> y;
+   apply( y, ~r );
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+inline size_t IncompleteCholesky<Type,SO>::rows() const noexcept
+{
+   return factors_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements of both stored factors.
+//
+// \return The number of non-zero elements of \f$ L \f$ and \f$ L^H \f$ (diagonal counted once).
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+inline size_t IncompleteCholesky<Type,SO>::nonZeros() const noexcept
+{
+   return factors_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combined factors of the decomposition.
+//
+// \return The factor L in the lower part and its conjugate transpose in the upper part.
+*/
+template< typename Type  // Data type of the factor
+        , bool SO >      // Storage order of the factor
+inline const typename IncompleteCholesky<Type,SO>::FactorType&
+   IncompleteCholesky<Type,SO>::factors() const noexcept
+{
+   return factors_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
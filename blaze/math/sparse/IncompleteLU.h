@@ -0,0 +1,762 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/IncompleteLU.h
+//  \brief Header file for the incomplete LU decomposition of sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_INCOMPLETELU_H_
+#define _BLAZE_MATH_SPARSE_INCOMPLETELU_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/LevelSchedule.h>
+#include <blaze/math/sparse/LSE.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INCOMPLETE LU DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Incomplete LU decomposition functions */
+//@{
+template< typename Type, bool SO >
+void ilu0( CompressedMatrix<Type,SO>& A );
+
+template< typename Type, bool SO >
+void ilut( CompressedMatrix<Type,SO>& A, double tau, size_t fill );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place ILU(0) decomposition of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The sparse matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+//
+// This function computes the incomplete LU decomposition without fill-in (ILU(0)) of the given
+// square sparse matrix. The factors \f$ L \f$ and \f$ U \f$ have the same sparsity pattern as
+// the strictly lower and the upper part of \a A, respectively, and satisfy \f$ (LU)_{ij} =
+// a_{ij} \f$ for all non-zero elements of \a A. The decomposition is computed in place: After
+// the function returns, the strictly lower part of \a A contains the strictly lower part of
+// the unit lower triangular factor \f$ L \f$ and the upper part of \a A contains the upper
+// triangular factor \f$ U \f$. The sparsity pattern of \a A is not changed:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   blaze::ilu0( A );  // A now contains the strictly lower part of L and the factor U
+   \endcode
+
+// The row-major variant of the function proceeds row by row, the column-major variant column
+// by column. Both variants compute the same factors. The function fails if ...
+//
+//  - ... the given matrix is not a square matrix;
+//  - ... a diagonal element is missing or becomes zero during the decomposition.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order of the matrix
+void ilu0( CompressedMatrix<Type,SO>& A )
+{
+   using Iterator = typename CompressedMatrix<Type,SO>::Iterator;
+
+   if( !isSquare( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( A.rows() );
+
+   std::vector<Iterator> diag( n );
+   std::vector<Iterator> work( n );
+   std::vector<size_t>   mark( n, n );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Iterator end( A.end(i) );
+
+      diag[i] = end;
+
+      for( Iterator element=A.begin(i); element!=end; ++element ) {
+         const size_t j( element->index() );
+         work[j] = element;
+         mark[j] = i;
+         if( j == i )
+            diag[i] = element;
+      }
+
+      // Eliminating the strictly lower (row-major) or upper (column-major) part of the slice
+      for( Iterator element=A.begin(i); element!=diag[i] && element->index() < i; ++element )
+      {
+         const size_t k( element->index() );
+
+         if( !SO )
+            element->value() /= diag[k]->value();
+
+         const Type factor( element->value() );
+
+         for( Iterator other=diag[k]+1UL; other!=A.end(k); ++other ) {
+            const size_t j( other->index() );
+            if( mark[j] == i )
+               work[j]->value() -= factor * other->value();
+         }
+      }
+
+      if( diag[i] == end || !isDivisor( diag[i]->value() ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Incomplete decomposition of singular matrix failed" );
+      }
+
+      if( SO ) {
+         for( Iterator element=diag[i]+1UL; element!=end; ++element )
+            element->value() /= diag[i]->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place ILUT decomposition of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The sparse matrix to be decomposed.
+// \param tau The relative drop tolerance.
+// \param fill The maximum number of elements per row (or column) in each of both factors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid drop tolerance provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+//
+// This function computes the threshold-based incomplete LU decomposition ILUT(\a tau,\a fill)
+// of the given square sparse matrix. In contrast to the ILU(0) decomposition (see the ilu0()
+// function) the factors may contain fill-in elements. During the elimination of each row all
+// elements whose magnitude is smaller than \a tau times the Euclidean norm of the original row
+// are dropped. Afterwards only the \a fill largest elements of the strictly lower and the upper
+// part of the row are kept (in addition to the diagonal element). The decomposition replaces
+// the content of \a A in the same format as the ilu0() function:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   blaze::ilut( A, 1E-4, 20UL );  // A now contains the strictly lower part of L and the factor U
+   \endcode
+
+// A drop tolerance of zero in combination with a sufficiently large \a fill results in the
+// complete LU decomposition without pivoting. The row-major variant of the function computes
+// the factors row by row, the column-major variant column by column (in which case the drop
+// rules are applied to the columns). The function fails if ...
+//
+//  - ... the given matrix is not a square matrix;
+//  - ... the given drop tolerance is negative;
+//  - ... a diagonal element is missing or becomes zero during the decomposition.
+//
+// In all failure cases an exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order of the matrix
+void ilut( CompressedMatrix<Type,SO>& A, double tau, size_t fill )
+{
+   using std::abs;
+
+   if( !isSquare( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( !( tau >= 0.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid drop tolerance provided" );
+   }
+
+   const size_t n( A.rows() );
+   const size_t npos( n );
+
+   std::vector<size_t> ptr( n+1UL, 0UL );  // The offsets of the slices of the factors
+   std::vector<size_t> diag( n );          // The position of the diagonal element of each slice
+   std::vector<size_t> idx;                // The indices of the elements of the factors
+   std::vector<Type>   val;                // The values of the elements of the factors
+
+   idx.reserve( A.nonZeros() );
+   val.reserve( A.nonZeros() );
+
+   std::vector<size_t> pos( n, npos );  // The position of each index within the work slice
+   std::vector<size_t> windex;          // The indices of the work slice
+   std::vector<Type>   wvalue;          // The values of the work slice
+   std::vector<size_t> lower, upper;    // The kept positions in front of/behind the diagonal
+   std::priority_queue< size_t, std::vector<size_t>, std::greater<size_t> > pending;
+
+   const auto larger = [&wvalue]( size_t a, size_t b ) {
+      return abs( wvalue[a] ) > abs( wvalue[b] );
+   };
+
+   const auto byIndex = [&windex]( size_t a, size_t b ) {
+      return windex[a] < windex[b];
+   };
+
+   const auto select = [&]( std::vector<size_t>& part ) {
+      if( part.size() > fill ) {
+         std::nth_element( part.begin(), part.begin()+fill, part.end(), larger );
+         part.resize( fill );
+      }
+      std::sort( part.begin(), part.end(), byIndex );
+   };
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      double norm( 0.0 );
+
+      windex.clear();
+      wvalue.clear();
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         pos[j] = windex.size();
+         windex.push_back( j );
+         wvalue.push_back( element->value() );
+         norm += abs( element->value() ) * abs( element->value() );
+         if( j < i )
+            pending.push( j );
+      }
+
+      const double threshold( tau * std::sqrt( norm ) );
+
+      // Eliminating the elements in front of the diagonal in ascending order
+      while( !pending.empty() )
+      {
+         const size_t k( pending.top() );
+         pending.pop();
+
+         if( !SO )
+            wvalue[pos[k]] /= val[diag[k]];
+
+         if( abs( wvalue[pos[k]] ) < threshold ) {
+            wvalue[pos[k]] = Type();
+            continue;
+         }
+
+         const Type wk( wvalue[pos[k]] );
+
+         for( size_t p=diag[k]+1UL; p<ptr[k+1UL]; ++p )
+         {
+            const size_t j( idx[p] );
+
+            if( pos[j] == npos ) {
+               pos[j] = windex.size();
+               windex.push_back( j );
+               wvalue.push_back( -wk * val[p] );
+               if( j < i )
+                  pending.push( j );
+            }
+            else {
+               wvalue[pos[j]] -= wk * val[p];
+            }
+         }
+      }
+
+      if( pos[i] == npos || !isDivisor( wvalue[pos[i]] ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Incomplete decomposition of singular matrix failed" );
+      }
+
+      const Type pivot( wvalue[pos[i]] );
+
+      // Applying the dropping rules
+      lower.clear();
+      upper.clear();
+
+      for( size_t p=0UL; p<windex.size(); ++p )
+      {
+         const size_t j( windex[p] );
+         pos[j] = npos;
+
+         if( j > i && SO )
+            wvalue[p] /= pivot;
+
+         if( j != i && !isDefault<strict>( wvalue[p] ) && !( abs( wvalue[p] ) < threshold ) )
+            ( j < i ? lower : upper ).push_back( p );
+      }
+
+      select( lower );
+      select( upper );
+
+      // Storing the slice of the factors
+      for( size_t p : lower ) {
+         idx.push_back( windex[p] );
+         val.push_back( wvalue[p] );
+      }
+
+      diag[i] = idx.size();
+      idx.push_back( i );
+      val.push_back( pivot );
+
+      for( size_t p : upper ) {
+         idx.push_back( windex[p] );
+         val.push_back( wvalue[p] );
+      }
+
+      ptr[i+1UL] = idx.size();
+   }
+
+   CompressedMatrix<Type,SO> factor( n, n, idx.size() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t p=ptr[i]; p<ptr[i+1UL]; ++p ) {
+         if( SO ) factor.append( idx[p], i, val[p] );
+         else     factor.append( i, idx[p], val[p] );
+      }
+      factor.finalize( i );
+   }
+
+   swap( A, factor );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner for sparse matrices.
+// \ingroup sparse_matrix
+//
+// The IncompleteLU class template represents an incomplete LU decomposition \f$ A \approx LU \f$
+// of a sparse square matrix \a A, which can be used as preconditioner for iterative solvers.
+// Depending on the constructor either the ILU(0) decomposition (see the ilu0() function) or the
+// threshold-based ILUT decomposition (see the ilut() function) is computed. Both factors are
+// stored in a single CompressedMatrix. The preconditioner is applied via the function call
+// operator, which computes \f$ y = U^{-1} L^{-1} r \f$:
+
+   \code
+   blaze::CompressedMatrix<double> A;  // The sparse system matrix
+   blaze::DynamicVector<double> r;     // The residual vector
+   // ... Resizing and initialization
+
+   const blaze::IncompleteLU<double> ilu( A );               // ILU(0) preconditioner
+   const blaze::IncompleteLU<double> ilut( A, 1E-4, 20UL );  // ILUT preconditioner
+
+   blaze::DynamicVector<double> y( ilu( r ) );  // Applying the preconditioner
+   ilut.apply( y, r );                          // Applying the preconditioner without allocation
+   \endcode
+
+// During the decomposition the forward and backward substitutions are analysed by means of a
+// level schedule (see the LevelSchedule class). In case the shared memory parallelization is
+// enabled, all levels containing at least as many rows as specified by the
+// \c BLAZE_SMP_SMATTRSV_THRESHOLD are processed in parallel.
+*/
+template< typename Type                   // Data type of the factors
+        , bool SO=defaultStorageOrder >  // Storage order of the factors
+class IncompleteLU
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                       //!< Type of the elements of the factors.
+   using FactorType  = CompressedMatrix<Type,SO>;  //!< Type of the combined factors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline IncompleteLU();
+
+   template< typename MT, bool SO2 >
+   explicit inline IncompleteLU( const SparseMatrix<MT,SO2>& A );
+
+   template< typename MT, bool SO2 >
+   explicit inline IncompleteLU( const SparseMatrix<MT,SO2>& A, double tau, size_t fill );
+
+   IncompleteLU( const IncompleteLU& ) = default;
+   IncompleteLU( IncompleteLU&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~IncompleteLU() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   IncompleteLU& operator=( const IncompleteLU& ) = default;
+   IncompleteLU& operator=( IncompleteLU&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO2 >
+   void compute( const SparseMatrix<MT,SO2>& A );
+
+   template< typename MT, bool SO2 >
+   void compute( const SparseMatrix<MT,SO2>& A, double tau, size_t fill );
+   //@}
+   //**********************************************************************************************
+
+   //**Application functions***********************************************************************
+   /*!\name Application functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   void apply( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& r ) const;
+
+   template< typename VT, bool TF >
+   inline DynamicVector<Type,TF> operator()( const DenseVector<VT,TF>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t            rows()     const noexcept;
+   inline size_t            nonZeros() const noexcept;
+   inline const FactorType& factors()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void assign( FactorType& factors );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType    factors_;  //!< The strictly lower part of L and the factor U.
+   LevelSchedule lower_;    //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;    //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for IncompleteLU.
+//
+// The default constructor creates an empty decomposition of a \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+inline IncompleteLU<Type,SO>::IncompleteLU()
+   : factors_()                   // The strictly lower part of L and the factor U
+   , lower_  ( factors_, true  )  // The level schedule of the forward substitution
+   , upper_  ( factors_, false )  // The level schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ILU(0) decomposition of the given sparse matrix.
+//
+// \param A The sparse matrix to be decomposed.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+inline IncompleteLU<Type,SO>::IncompleteLU( const SparseMatrix<MT,SO2>& A )
+   : IncompleteLU()
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ILUT decomposition of the given sparse matrix.
+//
+// \param A The sparse matrix to be decomposed.
+// \param tau The relative drop tolerance.
+// \param fill The maximum number of elements per row (or column) in each of both factors.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid drop tolerance provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+inline IncompleteLU<Type,SO>::IncompleteLU( const SparseMatrix<MT,SO2>& A, double tau, size_t fill )
+   : IncompleteLU()
+{
+   compute( ~A, tau, fill );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computation of the ILU(0) decomposition of the given sparse matrix.
+//
+// \param A The sparse matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+//
+// This function computes the ILU(0) decomposition of the given sparse matrix (see the ilu0()
+// function) and analyses the resulting triangular factors. In case of an exception the previous
+// decomposition remains unchanged.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+void IncompleteLU<Type,SO>::compute( const SparseMatrix<MT,SO2>& A )
+{
+   FactorType factors( ~A );
+   ilu0( factors );
+   assign( factors );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the ILUT decomposition of the given sparse matrix.
+//
+// \param A The sparse matrix to be decomposed.
+// \param tau The relative drop tolerance.
+// \param fill The maximum number of elements per row (or column) in each of both factors.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid drop tolerance provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+//
+// This function computes the ILUT decomposition of the given sparse matrix (see the ilut()
+// function) and analyses the resulting triangular factors. In case of an exception the previous
+// decomposition remains unchanged.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+void IncompleteLU<Type,SO>::compute( const SparseMatrix<MT,SO2>& A, double tau, size_t fill )
+{
+   FactorType factors( ~A );
+   ilut( factors, tau, fill );
+   assign( factors );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Takes over the given factors and analyses the triangular substitutions.
+//
+// \param factors The strictly lower part of L and the factor U.
+// \return void
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+inline void IncompleteLU<Type,SO>::assign( FactorType& factors )
+{
+   LevelSchedule lower( factors, true  );
+   LevelSchedule upper( factors, false );
+
+   swap( factors_, factors );
+   lower_ = std::move( lower );
+   upper_ = std::move( upper );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner to the given vector (\f$ y = U^{-1} L^{-1} r \f$).
+//
+// \param y The resulting dense vector.
+// \param r The dense vector the preconditioner is applied to.
+// \return void
+// \exception std::invalid_argument Invalid vector size provided.
+//
+// This function applies the preconditioner to the given vector \a r by means of a forward and
+// a backward substitution and stores the result in \a y. The vector \a y is resized if necessary,
+// \a y and \a r may refer to the same vector.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+template< typename VT1   // Type of the resulting vector
+        , bool TF        // Transpose flag of the vectors
+        , typename VT2 > // Type of the given vector
+void IncompleteLU<Type,SO>::apply( DenseVector<VT1,TF>& y, const DenseVector<VT2,TF>& r ) const
+{
+   if( (~r).size() != factors_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size provided" );
+   }
+
+   resize( ~y, (~r).size(), false );
+   smpAssign( ~y, ~r );
+
+   solveTriangularPart<true,true>  ( factors_, ~y, lower_ );
+   solveTriangularPart<false,false>( factors_, ~y, upper_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner to the given vector (\f$ U^{-1} L^{-1} r \f$).
+//
+// \param r The dense vector the preconditioner is applied to.
+// \return The result of the application of the preconditioner.
+// \exception std::invalid_argument Invalid vector size provided.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+template< typename VT    // Type of the given vector
+        , bool TF >      // Transpose flag of the given vector
+inline DynamicVector<Type,TF>
+   IncompleteLU<Type,SO>::operator()( const DenseVector<VT,TF>& r ) const
+{
+   DynamicVector<Type,TF> y;
+   apply( y, ~r );
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+inline size_t IncompleteLU<Type,SO>::rows() const noexcept
+{
+   return factors_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements of both factors.
+//
+// \return The number of non-zero elements of both factors (without the unit diagonal of L).
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+inline size_t IncompleteLU<Type,SO>::nonZeros() const noexcept
+{
+   return factors_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combined factors of the decomposition.
+//
+// \return The strictly lower part of the unit lower factor L and the upper factor U.
+*/
+template< typename Type  // Data type of the factors
+        , bool SO >      // Storage order of the factors
+inline const typename IncompleteLU<Type,SO>::FactorType&
+   IncompleteLU<Type,SO>::factors() const noexcept
+{
+   return factors_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,412 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Intersection.h
+//  \brief Kernels for the intersection of the index sets of two sparse ranges
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_INTERSECTION_H_
+#define _BLAZE_MATH_SPARSE_INTERSECTION_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <type_traits>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse intersection functions */
+//@{
+template< typename IT1, typename IT2, typename OP >
+void intersect( IT1 l, IT1 lend, IT2 r, IT2 rend, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Size ratio of two sparse ranges above which the intersection switches to galloping.
+// \ingroup sparse
+//
+// In case one of the two index ranges is at least this many times larger than the other, the
+// intersection walks the smaller range and locates each of its indices in the larger range by
+// exponential search instead of merging both ranges element by element.
+*/
+constexpr size_t gallopingRatio = 32UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum average index distance for the block-wise SIMD intersection.
+// \ingroup sparse
+//
+// The block-wise SIMD intersection only pays off as long as most blocks do not contain any
+// matching indices. Therefore it is only selected in case the average distance between two
+// consecutive indices of the denser of the two index ranges is at least this large. Denser
+// ranges are intersected by the merge kernel.
+*/
+constexpr size_t blockDistance = 5UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the detection of random access sparse iterators.
+// \ingroup sparse
+*/
+template< typename IT >
+using IsRandomAccessIntersection =
+   BoolConstant< std::is_base_of< std::random_access_iterator_tag
+                                , typename std::iterator_traits<IT>::iterator_category >::value >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merge-based intersection of two sorted sparse ranges.
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \param op The operation to be called for every pair of elements with matching indices.
+// \return void
+//
+// This function advances the range with the smaller current index until both indices match.
+// This sequential merge is the fallback for all iterators that do not provide random access,
+// for densely populated ranges, and for the remainder of the block-wise SIMD intersection.
+*/
+template< typename IT1  // Type of the left-hand side iterator
+        , typename IT2  // Type of the right-hand side iterator
+        , typename OP >  // Type of the operation
+inline void intersectMerge( IT1 l, IT1 lend, IT2 r, IT2 rend, OP& op )
+{
+   while( l != lend && r != rend )
+   {
+      if( l->index() < r->index() ) {
+         ++l;
+      }
+      else if( r->index() < l->index() ) {
+         ++r;
+      }
+      else {
+         op( l, r );
+         ++l;
+         ++r;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Galloping intersection of a short and a long sorted sparse range.
+// \ingroup sparse
+//
+// \param s Iterator to the first element of the short range.
+// \param send Iterator one past the last element of the short range.
+// \param b Iterator to the first element of the long range.
+// \param bend Iterator one past the last element of the long range.
+// \param op The operation to be called for every pair of elements with matching indices.
+// \return void
+//
+// This function locates every index of the short range within the long range by means of an
+// exponential search followed by a binary search, starting from the position of the previous
+// match. The number of index comparisons is therefore logarithmic in the gap between two
+// consecutive indices of the short range instead of linear in the size of the long range.
+// The operation is called as \a op(s,b) in increasing order of the matching indices.
+*/
+template< typename IT1  // Type of the short range iterator
+        , typename IT2  // Type of the long range iterator
+        , typename OP >  // Type of the operation
+inline void intersectGallop( IT1 s, IT1 send, IT2 b, IT2 bend, OP& op )
+{
+   for( ; s != send && b != bend; ++s )
+   {
+      const size_t index( s->index() );
+
+      if( b->index() < index )
+      {
+         const ptrdiff_t bound( bend - b );
+         ptrdiff_t lo( 0 );
+         ptrdiff_t hi( 1 );
+
+         while( hi < bound && ( b + hi )->index() < index ) {
+            lo = hi;
+            hi *= 2;
+         }
+
+         if( hi > bound ) hi = bound;
+
+         while( hi - lo > 1 ) {
+            const ptrdiff_t mid( lo + ( hi - lo ) / 2 );
+            if( ( b + mid )->index() < index ) lo = mid;
+            else hi = mid;
+         }
+
+         b = b + hi;
+         if( b == bend ) break;
+      }
+
+      if( b->index() == index ) {
+         op( s, b );
+         b = b + 1;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise SIMD intersection of two sorted sparse ranges.
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \param op The operation to be called for every pair of elements with matching indices.
+// \return void
+//
+// This function compares blocks of 8 (AVX-512) or 4 (AVX2) indices of both ranges all-against-all,
+// either by broadcasting every right-hand side index (AVX-512) or by repeated rotations of the
+// right-hand side block (AVX2). Only blocks containing at least one match are inspected element-
+// wise, and the block with the smaller maximum index is skipped as a whole. Since the sparse
+// elements store values and indices interleaved, the indices of a block are gathered with scalar
+// loads. The remainder of both ranges is handled by the merge kernel. Without AVX2 support the
+// entire intersection is handled by the merge kernel.
+*/
+template< typename IT1  // Type of the left-hand side iterator
+        , typename IT2  // Type of the right-hand side iterator
+        , typename OP >  // Type of the operation
+inline void intersectBlock( IT1 l, IT1 lend, IT2 r, IT2 rend, OP& op )
+{
+#if BLAZE_AVX512F_MODE
+   constexpr ptrdiff_t block( 8 );
+
+   while( lend - l >= block && rend - r >= block )
+   {
+      const __m512i a( _mm512_set_epi64( ( l+7 )->index(), ( l+6 )->index(), ( l+5 )->index()
+                                       , ( l+4 )->index(), ( l+3 )->index(), ( l+2 )->index()
+                                       , ( l+1 )->index(), l->index() ) );
+      unsigned int mask( _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( r->index() ) ) );
+      mask |= _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( ( r+1 )->index() ) );
+      mask |= _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( ( r+2 )->index() ) );
+      mask |= _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( ( r+3 )->index() ) );
+      mask |= _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( ( r+4 )->index() ) );
+      mask |= _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( ( r+5 )->index() ) );
+      mask |= _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( ( r+6 )->index() ) );
+      mask |= _mm512_cmpeq_epi64_mask( a, _mm512_set1_epi64( ( r+7 )->index() ) );
+#elif BLAZE_AVX2_MODE
+   constexpr ptrdiff_t block( 4 );
+
+   while( lend - l >= block && rend - r >= block )
+   {
+      const __m256i a( _mm256_set_epi64x( ( l+3 )->index(), ( l+2 )->index()
+                                        , ( l+1 )->index(), l->index() ) );
+      const __m256i b( _mm256_set_epi64x( ( r+3 )->index(), ( r+2 )->index()
+                                        , ( r+1 )->index(), r->index() ) );
+
+      __m256i eq( _mm256_cmpeq_epi64( a, b ) );
+      eq = _mm256_or_si256( eq, _mm256_cmpeq_epi64( a, _mm256_permute4x64_epi64( b, 0x39 ) ) );
+      eq = _mm256_or_si256( eq, _mm256_cmpeq_epi64( a, _mm256_permute4x64_epi64( b, 0x4E ) ) );
+      eq = _mm256_or_si256( eq, _mm256_cmpeq_epi64( a, _mm256_permute4x64_epi64( b, 0x93 ) ) );
+
+      unsigned int mask( _mm256_movemask_pd( _mm256_castsi256_pd( eq ) ) );
+#endif
+
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+      if( mask != 0U )
+      {
+         ptrdiff_t j( 0 );
+         for( ptrdiff_t i=0; i<block; ++i, mask >>= 1U )
+         {
+            if( mask & 1U ) {
+               const size_t index( ( l+i )->index() );
+               while( ( r+j )->index() != index ) ++j;
+               op( l+i, r+j );
+            }
+         }
+      }
+
+      const size_t lmax( ( l+block-1 )->index() );
+      const size_t rmax( ( r+block-1 )->index() );
+
+      if( lmax <= rmax ) l = l + block;
+      if( rmax <= lmax ) r = r + block;
+   }
+#endif
+
+   intersectMerge( l, lend, r, rend, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the intersection of two random access sparse ranges.
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \param op The operation to be called for every pair of elements with matching indices.
+// \return void
+//
+// This function selects the galloping kernel in case the sizes of both ranges are skewed by
+// more than the galloping ratio, the block-wise SIMD kernel in case both ranges are sparsely
+// populated, and the merge kernel otherwise.
+*/
+template< typename IT1  // Type of the left-hand side iterator
+        , typename IT2  // Type of the right-hand side iterator
+        , typename OP >  // Type of the operation
+inline void intersect_backend( IT1 l, IT1 lend, IT2 r, IT2 rend, OP& op, TrueType )
+{
+   const size_t lsize( lend - l );
+   const size_t rsize( rend - r );
+
+   if( lsize * gallopingRatio <= rsize ) {
+      intersectGallop( l, lend, r, rend, op );
+   }
+   else if( rsize * gallopingRatio <= lsize ) {
+      auto swapped = [&op]( const IT2& s, const IT1& b ) { op( b, s ); };
+      intersectGallop( r, rend, l, lend, swapped );
+   }
+   else {
+      const size_t first( min( l->index(), r->index() ) );
+      const size_t last ( max( ( lend-1 )->index(), ( rend-1 )->index() ) );
+
+      if( max( lsize, rsize ) * blockDistance <= last - first + 1UL ) {
+         intersectBlock( l, lend, r, rend, op );
+      }
+      else {
+         intersectMerge( l, lend, r, rend, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the intersection of two forward sparse ranges.
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \param op The operation to be called for every pair of elements with matching indices.
+// \return void
+*/
+template< typename IT1  // Type of the left-hand side iterator
+        , typename IT2  // Type of the right-hand side iterator
+        , typename OP >  // Type of the operation
+inline void intersect_backend( IT1 l, IT1 lend, IT2 r, IT2 rend, OP& op, FalseType )
+{
+   intersectMerge( l, lend, r, rend, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intersection of the index sets of two sorted sparse ranges.
+// \ingroup sparse
+//
+// \param l Iterator to the first element of the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator to the first element of the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \param op The operation to be called for every pair of elements with matching indices.
+// \return void
+//
+// This function calls \a op(l,r) for every pair of elements of the two given sparse ranges that
+// share the same index. Both ranges are required to be sorted by strictly increasing indices,
+// as given by the iterators of all sparse vectors and of all rows/columns of sparse matrices.
+// The operation is called in increasing order of the matching indices, i.e. in exactly the
+// same order as by a sequential merge of both ranges.
+
+   \code
+   blaze::CompressedVector<double> a, b;
+   // ... Initialization
+   double sum{};
+   blaze::intersect( a.begin(), a.end(), b.begin(), b.end(), [&sum]( auto l, auto r ) {
+      sum += l->value() * r->value();
+   } );
+   \endcode
+
+// For random access iterators this function switches to a galloping search in case the sizes
+// of both ranges are strongly skewed and uses an AVX-512 or AVX2 block comparison of the indices
+// otherwise. For all other iterators both ranges are merged element by element.
+*/
+template< typename IT1  // Type of the left-hand side iterator
+        , typename IT2  // Type of the right-hand side iterator
+        , typename OP >  // Type of the operation
+inline void intersect( IT1 l, IT1 lend, IT2 r, IT2 rend, OP op )
+{
+   intersect_backend( l, lend, r, rend, op,
+                      BoolConstant< IsRandomAccessIntersection<IT1>::value &&
+                                    IsRandomAccessIntersection<IT2>::value >() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,596 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/LSE.h
+//  \brief Header file for the sparse matrix linear system solver functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_LSE_H_
+#define _BLAZE_MATH_SPARSE_LSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/LevelSchedule.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS FOR SOLVING SPARSE TRIANGULAR LINEAR SYSTEMS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solving a single row of a sparse row-major triangular system.
+// \ingroup sparse_matrix
+//
+// \param A The sparse row-major triangular system matrix.
+// \param x The solution vector, initialized with the right-hand side.
+// \param i The index of the row to be solved.
+// \return \a true if the row has been solved, \a false in case of a singular system matrix.
+//
+// This function computes the \a i-th element of the solution vector under the assumption that
+// all elements the row depends on have already been computed. Elements of the row that belong
+// to the opposite triangular part of the matrix are ignored.
+*/
+template< bool LOW      // Lower (true) or upper (false) triangular system matrix
+        , bool UNI      // Unit (true) or non-unit (false) diagonal
+        , typename MT   // Type of the system matrix
+        , typename VT > // Type of the solution vector
+inline bool solveRow( const MT& A, VT& x, size_t i )
+{
+   ElementType_t<VT> tmp( x[i] );
+   ElementType_t<MT> diagonal{};
+
+   const auto end( A.end(i) );
+   for( auto element=A.begin(i); element!=end; ++element ) {
+      const size_t j( element->index() );
+      if( LOW ? j < i : j > i )
+         tmp -= element->value() * x[j];
+      else if( j == i )
+         diagonal = element->value();
+   }
+
+   if( !UNI ) {
+      if( !isDivisor( diagonal ) )
+         return false;
+      tmp /= diagonal;
+   }
+
+   x[i] = tmp;
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solving a single row of a gathered row-wise triangular system.
+// \ingroup sparse_matrix
+//
+// \param indices The column indices of the row-wise pattern.
+// \param values The values of the non-zero elements in row-wise order.
+// \param first The position of the first element of the row.
+// \param last The position one past the last element of the row.
+// \param x The solution vector, initialized with the right-hand side.
+// \param i The index of the row to be solved.
+// \return \a true if the row has been solved, \a false in case of a singular system matrix.
+*/
+template< bool LOW      // Lower (true) or upper (false) triangular system matrix
+        , bool UNI      // Unit (true) or non-unit (false) diagonal
+        , typename ET   // Element type of the system matrix
+        , typename VT > // Type of the solution vector
+inline bool solveRow( const size_t* indices, const ET* values, size_t first, size_t last
+                    , VT& x, size_t i )
+{
+   ElementType_t<VT> tmp( x[i] );
+   ET diagonal{};
+
+   for( size_t k=first; k<last; ++k ) {
+      const size_t j( indices[k] );
+      if( LOW ? j < i : j > i )
+         tmp -= values[k] * x[j];
+      else if( j == i )
+         diagonal = values[k];
+   }
+
+   if( !UNI ) {
+      if( !isDivisor( diagonal ) )
+         return false;
+      tmp /= diagonal;
+   }
+
+   x[i] = tmp;
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward or backward substitution for a sparse row-major triangular system.
+// \ingroup sparse_matrix
+//
+// \param A The sparse row-major triangular system matrix.
+// \param x The solution vector, initialized with the right-hand side.
+// \return void
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+*/
+template< bool LOW      // Lower (true) or upper (false) triangular system matrix
+        , bool UNI      // Unit (true) or non-unit (false) diagonal
+        , typename MT   // Type of the system matrix
+        , typename VT > // Type of the solution vector
+void solveRowMajor( const MT& A, VT& x )
+{
+   const size_t N( A.rows() );
+
+   for( size_t k=0UL; k<N; ++k ) {
+      if( !solveRow<LOW,UNI>( A, x, LOW ? k : N-k-1UL ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward or backward substitution for a sparse column-major triangular system.
+// \ingroup sparse_matrix
+//
+// \param A The sparse column-major triangular system matrix.
+// \param x The solution vector, initialized with the right-hand side.
+// \return void
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the system column by column: As soon as the \a j-th element of the
+// solution has been computed, its contribution is subtracted from all remaining elements of
+// the right-hand side. Elements that belong to the opposite triangular part of the matrix are
+// ignored.
+*/
+template< bool LOW      // Lower (true) or upper (false) triangular system matrix
+        , bool UNI      // Unit (true) or non-unit (false) diagonal
+        , typename MT   // Type of the system matrix
+        , typename VT > // Type of the solution vector
+void solveColumnMajor( const MT& A, VT& x )
+{
+   const size_t N( A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const size_t j( LOW ? k : N-k-1UL );
+
+      const auto begin( A.begin(j) );
+      const auto end  ( A.end(j) );
+
+      auto diagonal( begin );
+      while( diagonal != end && diagonal->index() < j ) {
+         ++diagonal;
+      }
+
+      const bool found( diagonal != end && diagonal->index() == j );
+
+      if( !UNI ) {
+         if( !found || !isDivisor( diagonal->value() ) ) {
+            BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+         }
+         x[j] /= diagonal->value();
+      }
+
+      const ElementType_t<VT> xj( x[j] );
+
+      if( LOW ) {
+         for( auto element=( found ? ++diagonal : diagonal ); element!=end; ++element )
+            x[element->index()] -= element->value() * xj;
+      }
+      else {
+         for( auto element=begin; element!=diagonal; ++element )
+            x[element->index()] -= element->value() * xj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Level-scheduled substitution for a sparse triangular system.
+// \ingroup sparse_matrix
+//
+// \param A The sparse triangular system matrix.
+// \param x The solution vector, initialized with the right-hand side.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function processes the levels of the given schedule one after another. The rows of all
+// levels containing at least \a SMP_SMATTRSV_THRESHOLD rows are distributed among the available
+// threads, all smaller levels are solved by the calling thread. In case of a column-major matrix
+// the values of the matrix are gathered into row-wise order first, such that every row can be
+// solved without concurrent updates of the solution vector.
+*/
+template< bool LOW      // Lower (true) or upper (false) triangular system matrix
+        , bool UNI      // Unit (true) or non-unit (false) diagonal
+        , typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT > // Type of the solution vector
+void solveScheduled( const SparseMatrix<MT,SO>& A, VT& x, const LevelSchedule& schedule )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t N( (~A).rows() );
+   const size_t threads( getNumThreads() );
+
+   if( N == 0UL )
+      return;
+
+   std::unique_ptr<ET[]> values;
+
+   // Gathering the values of a column-major matrix in row-wise order
+   if( SO )
+   {
+      values.reset( new ET[schedule.nonZeros()] );
+
+      const size_t* const offsets( schedule.columnOffsets() );
+      const size_t* const slots  ( schedule.slots() );
+
+      const size_t blocks( min( threads, N ) );
+      const size_t columnsPerBlock( N / blocks + ( ( N % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+
+      smpFor( blocks, [&]( size_t b )
+      {
+         const size_t jend( min( (b+1UL)*columnsPerBlock, N ) );
+         for( size_t j=b*columnsPerBlock; j<jend; ++j ) {
+            size_t slot( offsets[j] );
+            for( auto element=(~A).begin(j); element!=(~A).end(j); ++element, ++slot )
+               values[slots[slot]] = element->value();
+         }
+      } );
+   }
+
+   auto solveRowAt = [&]( size_t i ) -> bool
+   {
+      if( SO ) {
+         const size_t* const offsets( schedule.rowOffsets() );
+         return solveRow<LOW,UNI>( schedule.columnIndices(), values.get()
+                                 , offsets[i], offsets[i+1UL], x, i );
+      }
+      else {
+         return solveRow<LOW,UNI>( ~A, x, i );
+      }
+   };
+
+   std::atomic<bool> singular( false );
+
+   for( size_t l=0UL; l<schedule.levels(); ++l )
+   {
+      const size_t* const rows( schedule.begin(l) );
+      const size_t size( schedule.levelSize(l) );
+
+      if( size < SMP_SMATTRSV_THRESHOLD ) {
+         for( size_t k=0UL; k<size; ++k ) {
+            if( !solveRowAt( rows[k] ) )
+               singular = true;
+         }
+      }
+      else {
+         const size_t blocks( min( threads, size ) );
+         const size_t rowsPerBlock( size / blocks + ( ( size % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+
+         smpFor( blocks, [&]( size_t b )
+         {
+            const size_t kend( min( (b+1UL)*rowsPerBlock, size ) );
+            for( size_t k=b*rowsPerBlock; k<kend; ++k ) {
+               if( !solveRowAt( rows[k] ) )
+                  singular = true;
+            }
+         } );
+      }
+
+      if( singular ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place substitution for the lower or upper part of a sparse system matrix.
+// \ingroup sparse_matrix
+//
+// \param A The sparse system matrix.
+// \param x The solution vector, initialized with the right-hand side.
+// \param schedule The level schedule of the lower or upper part of the system matrix.
+// \return void
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the system given by the lower (or upper) triangular part of \a A. All
+// elements of the opposite triangular part are ignored. The level schedule is used in case more
+// than one thread is available, the largest level reaches the \a SMP_SMATTRSV_THRESHOLD and no
+// serial or parallel section is active. Otherwise the system is solved by ordinary forward or
+// backward substitution.
+*/
+template< bool LOW      // Lower (true) or upper (false) triangular system matrix
+        , bool UNI      // Unit (true) or non-unit (false) diagonal
+        , typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT > // Type of the solution vector
+void solveTriangularPart( const SparseMatrix<MT,SO>& A, VT& x, const LevelSchedule& schedule )
+{
+   BLAZE_INTERNAL_ASSERT( schedule.size() == (~A).rows(), "Invalid level schedule detected" );
+   BLAZE_INTERNAL_ASSERT( schedule.isLower() == LOW, "Invalid level schedule detected" );
+
+   if( getNumThreads() > 1UL && schedule.maxLevelSize() >= SMP_SMATTRSV_THRESHOLD &&
+       !isSerialSectionActive() && !isParallelSectionActive() )
+      solveScheduled<LOW,UNI>( ~A, x, schedule );
+   else if( SO )
+      solveColumnMajor<LOW,UNI>( ~A, x );
+   else
+      solveRowMajor<LOW,UNI>( ~A, x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTIONS FOR SOLVING SPARSE TRIANGULAR LINEAR SYSTEMS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse triangular LSE functions */
+//@{
+template< typename MT, bool SO, typename VT1, bool TF1, typename VT2, bool TF2 >
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b );
+
+template< typename MT, bool SO, typename VT1, bool TF1, typename VT2, bool TF2 >
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x,
+            const DenseVector<VT2,TF2>& b, const LevelSchedule& schedule );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse triangular linear system of equations (\f$ A*x=b \f$).
+// \ingroup sparse_matrix
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param x The dense solution vector.
+// \param b The dense right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes a solution for the given linear system of equations \f$ A*x=b \f$,
+// where \a A is the given sparse triangular system matrix, \a x is the solution vector, and
+// \a b is the given right-hand side vector. In case of a lower triangular matrix, the system is
+// solved via forward substitution, in case of an upper triangular matrix via backward
+// substitution. Both row-major (CSR) and column-major (CSC) matrices are supported natively,
+// i.e. the sparse matrix is neither converted into a dense matrix nor copied:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;  // The sparse lower system matrix
+   blaze::DynamicVector<double> b;                           // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> x;  // The solution vector
+   solve( L, x, b );
+   \endcode
+
+// The triangular structure of the system matrix has to be known at compile time. Therefore
+// the function can only be used with lower, upper, unilower, uniupper, and diagonal matrices.
+// The attempt to use any other matrix type results in a compilation error. In case the type
+// of the matrix does not provide this information, it can be provided manually by means of
+// declaration operations:
+
+   \code
+   blaze::CompressedMatrix<double> A;  // The sparse system matrix
+   blaze::DynamicVector<double> b;     // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> x;  // The solution vector
+
+   solve( decllow( A ), x, b );     // Solving the LSE with a lower system matrix
+   solve( declunilow( A ), x, b );  // Solving the LSE with an unilower system matrix
+   solve( declupp( A ), x, b );     // Solving the LSE with an upper system matrix
+   solve( decluniupp( A ), x, b );  // Solving the LSE with an uniupper system matrix
+   \endcode
+
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of the right-hand side vector doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a x may already have been modified.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF1      // Transpose flag of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   constexpr bool LOW( IsLower_v<MT> );
+   constexpr bool UNI( IsUniTriangular_v<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   CompositeType_t<MT> Atmp( ~A );
+
+   resize( ~x, (~b).size(), false );
+   smpAssign( ~x, ~b );
+
+   if( SO )
+      solveColumnMajor<LOW,UNI>( Atmp, ~x );
+   else
+      solveRowMajor<LOW,UNI>( Atmp, ~x );
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~x ), "Broken invariant detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse triangular linear system of equations by means of a level
+//        schedule (\f$ A*x=b \f$).
+// \ingroup sparse_matrix
+//
+// \param A The sparse lower or upper triangular system matrix.
+// \param x The dense solution vector.
+// \param b The dense right-hand side vector.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes a solution for the given linear system of equations \f$ A*x=b \f$ by
+// means of the given level schedule (see the LevelSchedule class). The rows of each level of
+// the schedule are independent of each other and are therefore solved in parallel in case the
+// shared memory parallelization is enabled and the level contains at least as many rows as
+// specified by the \c BLAZE_SMP_SMATTRSV_THRESHOLD:
+
+   \code
+   blaze::UpperMatrix< blaze::CompressedMatrix<double,blaze::columnMajor> > U;
+   blaze::DynamicVector<double> b;
+   // ... Resizing and initialization
+
+   const blaze::LevelSchedule schedule( U );  // Analysing the sparsity pattern of U
+
+   blaze::DynamicVector<double> x;  // The solution vector
+   solve( U, x, b, schedule );      // Solving the LSE by means of the level schedule
+   \endcode
+
+// In case no shared memory parallelization is active, in case only a single thread is available,
+// or in case no level of the schedule reaches the threshold, the system is solved by ordinary
+// forward or backward substitution. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of the right-hand side vector doesn't match the dimensions of the system matrix;
+//  - ... the given schedule has not been computed for a matrix of the same size, the same number
+//        of non-zero elements, the same triangular structure, and the same storage order;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a x may already have been modified.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF1      // Transpose flag of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x,
+            const DenseVector<VT2,TF2>& b, const LevelSchedule& schedule )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   constexpr bool LOW( IsLower_v<MT> );
+   constexpr bool UNI( IsUniTriangular_v<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (~A).rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+   else if( schedule.size() != (~A).rows() || schedule.nonZeros() != nonZeros( ~A ) ||
+            schedule.isLower() != LOW || schedule.isColumnMajor() != SO ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid level schedule provided" );
+   }
+
+   CompositeType_t<MT> Atmp( ~A );
+
+   resize( ~x, (~b).size(), false );
+   smpAssign( ~x, ~b );
+
+   solveTriangularPart<LOW,UNI>( Atmp, ~x, schedule );
+
+   BLAZE_INTERNAL_ASSERT( isIntact( ~x ), "Broken invariant detected" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,613 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/LevelSchedule.h
+//  \brief Header file for the level schedule of sparse triangular systems
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_LEVELSCHEDULE_H_
+#define _BLAZE_MATH_SPARSE_LEVELSCHEDULE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsTriangular.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level schedule for the parallel solution of sparse triangular systems.
+// \ingroup sparse_matrix
+//
+// The LevelSchedule class represents the analysed dependency structure of a sparse lower or
+// upper triangular matrix. During the analysis the rows of the matrix are grouped into levels
+// (also called wavefronts) such that each row only depends on rows of previous levels. All rows
+// of a single level can therefore be solved independently of each other. Given a schedule, the
+// \c solve() function for sparse triangular matrices processes the levels one after another
+// and distributes the rows of each sufficiently large level among the available threads:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;  // The sparse lower system matrix
+   blaze::DynamicVector<double> b;                           // The right-hand side vector
+   // ... Resizing and initialization
+
+   const blaze::LevelSchedule schedule( L );  // Analysing the sparsity pattern of L once
+
+   blaze::DynamicVector<double> x;  // The solution vector
+   solve( L, x, b, schedule );      // Solving the LSE by means of the level schedule
+   \endcode
+
+// The schedule only depends on the sparsity pattern of the matrix. It can therefore be reused
+// for an arbitrary number of solves as long as the pattern of the matrix remains unchanged. In
+// case the non-zero elements of the matrix are rearranged, the schedule has to be recomputed
+// via the analyze() function.
+//
+// For row-major matrices the schedule merely consists of the level ordering of the rows. For
+// column-major matrices the schedule additionally stores the row-wise pattern of the matrix,
+// which allows to gather the values of the matrix in row order such that each row can be solved
+// without concurrent updates of the solution vector.
+*/
+class LevelSchedule
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline LevelSchedule();
+
+   template< typename MT, bool SO >
+   explicit inline LevelSchedule( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   explicit inline LevelSchedule( const SparseMatrix<MT,SO>& A, bool lower );
+
+   LevelSchedule( const LevelSchedule& ) = default;
+   LevelSchedule( LevelSchedule&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~LevelSchedule() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   LevelSchedule& operator=( const LevelSchedule& ) = default;
+   LevelSchedule& operator=( LevelSchedule&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void analyze( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   inline void analyze( const SparseMatrix<MT,SO>& A, bool lower );
+
+   inline size_t        size()                const noexcept;
+   inline size_t        nonZeros()            const noexcept;
+   inline size_t        levels()              const noexcept;
+   inline size_t        levelSize( size_t l ) const noexcept;
+   inline size_t        maxLevelSize()        const noexcept;
+   inline bool          isLower()             const noexcept;
+   inline bool          isColumnMajor()       const noexcept;
+   inline const size_t* begin( size_t l )     const noexcept;
+   inline const size_t* end  ( size_t l )     const noexcept;
+   inline void          reset();
+   //@}
+   //**********************************************************************************************
+
+   //**Row pattern access functions****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\name Row pattern access functions */
+   //@{
+   inline const size_t* rowOffsets()    const noexcept;
+   inline const size_t* columnIndices() const noexcept;
+   inline const size_t* columnOffsets() const noexcept;
+   inline const size_t* slots()         const noexcept;
+   //@}
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;             //!< The number of rows/columns of the analysed matrix.
+   size_t nonZeros_;      //!< The number of non-zero elements of the analysed matrix.
+   size_t maxLevelSize_;  //!< The number of rows of the largest level.
+   bool lower_;           //!< \a true for lower triangular matrices, \a false for upper ones.
+   bool columnMajor_;     //!< \a true for column-major matrices, \a false for row-major ones.
+
+   std::vector<size_t> levels_;   //!< The offsets of the levels within the row ordering.
+   std::vector<size_t> order_;    //!< The rows of the matrix, ordered by level.
+   std::vector<size_t> rowPtr_;   //!< The offsets of the rows within the row-wise pattern.
+   std::vector<size_t> colIdx_;   //!< The column indices of the row-wise pattern.
+   std::vector<size_t> colPtr_;   //!< The offsets of the columns within the column-wise storage.
+   std::vector<size_t> slots_;    //!< The row-wise position of each element in column-wise order.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LevelSchedule.
+//
+// The default constructor creates an empty level schedule, which can only be used for solving
+// \f$ 0 \times 0 \f$ systems.
+*/
+inline LevelSchedule::LevelSchedule()
+   : n_           ( 0UL )       // The number of rows/columns of the analysed matrix
+   , nonZeros_    ( 0UL )       // The number of non-zero elements of the analysed matrix
+   , maxLevelSize_( 0UL )       // The number of rows of the largest level
+   , lower_       ( true )      // Flag for lower triangular matrices
+   , columnMajor_ ( false )     // Flag for column-major matrices
+   , levels_      ( 1UL, 0UL )  // The offsets of the levels within the row ordering
+   , order_       ()            // The rows of the matrix, ordered by level
+   , rowPtr_      ()            // The offsets of the rows within the row-wise pattern
+   , colIdx_      ()            // The column indices of the row-wise pattern
+   , colPtr_      ()            // The offsets of the columns within the column-wise storage
+   , slots_       ()            // The row-wise position of each element in column-wise order
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the analysis of the given sparse triangular matrix.
+//
+// \param A The sparse lower or upper triangular matrix to be analysed.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This constructor analyses the sparsity pattern of the given sparse triangular matrix (see
+// the analyze() function). In case the given matrix is not a square matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline LevelSchedule::LevelSchedule( const SparseMatrix<MT,SO>& A )
+   : LevelSchedule()
+{
+   analyze( ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the analysis of the lower or upper part of the given sparse matrix.
+//
+// \param A The sparse matrix to be analysed.
+// \param lower \a true to analyse the lower part, \a false to analyse the upper part of \a A.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This constructor analyses the sparsity pattern of the lower or upper triangular part of the
+// given general sparse matrix (see the analyze() function). In case the given matrix is not a
+// square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline LevelSchedule::LevelSchedule( const SparseMatrix<MT,SO>& A, bool lower )
+   : LevelSchedule()
+{
+   analyze( ~A, lower );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Analysis of the sparsity pattern of the given sparse triangular matrix.
+//
+// \param A The sparse lower or upper triangular matrix to be analysed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the level schedule of the given sparse triangular matrix. Each row
+// \f$ i \f$ is assigned to the level directly following the highest level of all rows it
+// depends on, i.e. all rows \f$ j \f$ with a non-zero element \f$ a_{ij} \f$ in the strictly
+// lower (or upper) part of the matrix. Within each level the rows are stored in ascending order.
+// The function only takes the sparsity pattern into account, the values of the non-zero elements
+// are irrelevant. In case the given matrix is not a square matrix, a \a std::invalid_argument
+// exception is thrown.
+//
+// \note The matrix type has to be a lower or upper triangular matrix type (as for instance
+// LowerMatrix or UpperMatrix). The attempt to analyse a matrix of any other type results in
+// a compilation error. In case the type of the matrix does not provide this compile time
+// information, it can be provided by means of the decllow() or declupp() operations.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline void LevelSchedule::analyze( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsTriangular_v<MT>, "Non-triangular matrix type detected" );
+
+   analyze( ~A, IsLower_v<MT> );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Analysis of the sparsity pattern of the lower or upper part of the given sparse matrix.
+//
+// \param A The sparse matrix to be analysed.
+// \param lower \a true to analyse the lower part, \a false to analyse the upper part of \a A.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the level schedule of the lower (or upper) triangular part of the
+// given general sparse matrix. All elements of the opposite triangular part are ignored, which
+// corresponds to the behavior of the triangular solve() functions. This allows to schedule the
+// forward and backward substitutions with a matrix that stores two triangular factors in a
+// single sparse matrix (as for instance the factors of an incomplete LU decomposition). In case
+// the given matrix is not a square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline void LevelSchedule::analyze( const SparseMatrix<MT,SO>& A, bool lower )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   std::vector<size_t> level( n, 0UL );
+   size_t nonzeros( 0UL );
+   size_t levels( 0UL );
+
+   rowPtr_.clear();
+   colIdx_.clear();
+   colPtr_.clear();
+   slots_.clear();
+
+   // Computing the level of each row
+   if( !SO )
+   {
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const size_t i( lower ? k : n-k-1UL );
+
+         for( auto element=(~A).begin(i); element!=(~A).end(i); ++element, ++nonzeros ) {
+            const size_t j( element->index() );
+            if( ( lower ? j < i : j > i ) && level[i] <= level[j] )
+               level[i] = level[j] + 1UL;
+         }
+
+         if( level[i] >= levels )
+            levels = level[i] + 1UL;
+      }
+   }
+   else
+   {
+      rowPtr_.assign( n+1UL, 0UL );
+      colPtr_.assign( n+1UL, 0UL );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const size_t j( lower ? k : n-k-1UL );
+
+         if( level[j] >= levels )
+            levels = level[j] + 1UL;
+
+         for( auto element=(~A).begin(j); element!=(~A).end(j); ++element, ++nonzeros ) {
+            const size_t i( element->index() );
+            if( ( lower ? i > j : i < j ) && level[i] <= level[j] )
+               level[i] = level[j] + 1UL;
+            ++rowPtr_[i+1UL];
+            ++colPtr_[j+1UL];
+         }
+      }
+
+      // Setting up the row-wise pattern and the position of each element within it
+      for( size_t i=0UL; i<n; ++i ) {
+         rowPtr_[i+1UL] += rowPtr_[i];
+         colPtr_[i+1UL] += colPtr_[i];
+      }
+
+      std::vector<size_t> cursor( rowPtr_.begin(), rowPtr_.end()-1L );
+      colIdx_.resize( nonzeros );
+      slots_.resize( nonzeros );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         size_t slot( colPtr_[j] );
+         for( auto element=(~A).begin(j); element!=(~A).end(j); ++element, ++slot ) {
+            const size_t pos( cursor[element->index()]++ );
+            colIdx_[pos] = j;
+            slots_[slot] = pos;
+         }
+      }
+   }
+
+   // Sorting the rows by level
+   levels_.assign( levels+1UL, 0UL );
+   order_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++levels_[level[i]+1UL];
+   }
+
+   maxLevelSize_ = 0UL;
+   for( size_t l=0UL; l<levels; ++l ) {
+      if( levels_[l+1UL] > maxLevelSize_ )
+         maxLevelSize_ = levels_[l+1UL];
+      levels_[l+1UL] += levels_[l];
+   }
+
+   std::vector<size_t> cursor( levels_.begin(), levels_.end()-1L );
+   for( size_t i=0UL; i<n; ++i ) {
+      order_[cursor[level[i]]++] = i;
+   }
+
+   n_           = n;
+   nonZeros_    = nonzeros;
+   lower_       = lower;
+   columnMajor_ = SO;
+
+   BLAZE_INTERNAL_ASSERT( levels_.back() == n_, "Invalid level offsets detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the analysed matrix.
+//
+// \return The number of rows/columns of the analysed matrix.
+*/
+inline size_t LevelSchedule::size() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the analysed matrix.
+//
+// \return The number of non-zero elements of the analysed matrix.
+*/
+inline size_t LevelSchedule::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the schedule.
+//
+// \return The number of levels of the schedule.
+//
+// The number of levels corresponds to the length of the longest dependency chain of the analysed
+// matrix. A diagonal matrix results in a single level, a dense triangular matrix in \a n levels.
+*/
+inline size_t LevelSchedule::levels() const noexcept
+{
+   return levels_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the specified level.
+//
+// \param l The index of the level \f$[0..levels())\f$.
+// \return The number of rows of level \a l.
+*/
+inline size_t LevelSchedule::levelSize( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return levels_[l+1UL] - levels_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the largest level.
+//
+// \return The number of rows of the largest level.
+*/
+inline size_t LevelSchedule::maxLevelSize() const noexcept
+{
+   return maxLevelSize_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the schedule has been computed for a lower triangular matrix.
+//
+// \return \a true for a lower triangular matrix, \a false for an upper triangular matrix.
+*/
+inline bool LevelSchedule::isLower() const noexcept
+{
+   return lower_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the schedule has been computed for a column-major matrix.
+//
+// \return \a true for a column-major matrix, \a false for a row-major matrix.
+*/
+inline bool LevelSchedule::isColumnMajor() const noexcept
+{
+   return columnMajor_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first row of the specified level.
+//
+// \param l The index of the level \f$[0..levels())\f$.
+// \return Pointer to the first row of level \a l.
+*/
+inline const size_t* LevelSchedule::begin( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return order_.data() + levels_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer just past the last row of the specified level.
+//
+// \param l The index of the level \f$[0..levels())\f$.
+// \return Pointer just past the last row of level \a l.
+*/
+inline const size_t* LevelSchedule::end( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return order_.data() + levels_[l+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the level schedule to the empty state.
+//
+// \return void
+*/
+inline void LevelSchedule::reset()
+{
+   *this = LevelSchedule();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW PATTERN ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offsets of the rows within the row-wise pattern of a column-major matrix.
+//
+// \return Pointer to the \a n+1 row offsets (\c nullptr in case of a row-major matrix).
+*/
+inline const size_t* LevelSchedule::rowOffsets() const noexcept
+{
+   return rowPtr_.empty() ? nullptr : rowPtr_.data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the column indices of the row-wise pattern of a column-major matrix.
+//
+// \return Pointer to the column indices (\c nullptr in case of a row-major matrix).
+*/
+inline const size_t* LevelSchedule::columnIndices() const noexcept
+{
+   return colIdx_.empty() ? nullptr : colIdx_.data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offsets of the columns within the column-wise storage of the matrix.
+//
+// \return Pointer to the \a n+1 column offsets (\c nullptr in case of a row-major matrix).
+*/
+inline const size_t* LevelSchedule::columnOffsets() const noexcept
+{
+   return colPtr_.empty() ? nullptr : colPtr_.data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the position of each element of a column-major matrix within the row-wise pattern.
+//
+// \return Pointer to the positions of the non-zero elements (\c nullptr for a row-major matrix).
+//
+// The positions are stored in the order in which the non-zero elements are traversed column
+// by column, i.e. the \a k-th element of column \a j is located at the row-wise position
+// \c slots()[columnOffsets()[j]+k].
+*/
+inline const size_t* LevelSchedule::slots() const noexcept
+{
+   return slots_.empty() ? nullptr : slots_.data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
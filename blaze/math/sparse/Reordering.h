@@ -0,0 +1,857 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Reordering.h
+//  \brief Header file for the bandwidth- and locality-improving reordering of sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_REORDERING_H_
+#define _BLAZE_MATH_SPARSE_REORDERING_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ADJACENCYGRAPH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symmetric adjacency graph of the sparsity pattern of a square sparse matrix.
+// \ingroup sparse_matrix
+//
+// The AdjacencyGraph represents the sparsity pattern of \f$ A + A^T \f$ (without the diagonal)
+// in compressed form. It provides the breadth-first level structures and pseudo-peripheral
+// nodes required by the reordering algorithms. In order to restrict a search to a subgraph,
+// each node is assigned an owner and a search only visits nodes with the given owner.
+*/
+class AdjacencyGraph
+{
+ public:
+   //**Constructor*********************************************************************************
+   template< typename MT, bool SO >
+   explicit inline AdjacencyGraph( const SparseMatrix<MT,SO>& A );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline size_t        size  () const noexcept;
+   inline size_t        degree( size_t i ) const noexcept;
+   inline const size_t* begin ( size_t i ) const noexcept;
+   inline const size_t* end   ( size_t i ) const noexcept;
+
+   inline size_t levelStructure( size_t root, const std::vector<size_t>& owner, size_t id,
+                                 std::vector<size_t>& order, std::vector<size_t>& levels,
+                                 bool sortByDegree ) const;
+
+   inline size_t pseudoPeripheralNode( size_t start, const std::vector<size_t>& owner, size_t id,
+                                       std::vector<size_t>& order,
+                                       std::vector<size_t>& levels ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   std::vector<size_t> offsets_;    //!< The offsets of the adjacency lists.
+   std::vector<size_t> adjacency_;  //!< The concatenated adjacency lists.
+   mutable std::vector<size_t> mark_;  //!< The visitation marks of the nodes.
+   mutable size_t stamp_;              //!< The mark of the current search.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the adjacency graph of the given square sparse matrix.
+//
+// \param A The square sparse matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline AdjacencyGraph::AdjacencyGraph( const SparseMatrix<MT,SO>& A )
+   : offsets_  ( (~A).rows()+1UL, 0UL )  // The offsets of the adjacency lists
+   , adjacency_()                        // The concatenated adjacency lists
+   , mark_     ( (~A).rows(), 0UL )      // The visitation marks of the nodes
+   , stamp_    ( 0UL )                   // The mark of the current search
+{
+   BLAZE_INTERNAL_ASSERT( (~A).rows() == (~A).columns(), "Non-square matrix detected" );
+
+   const size_t n( (~A).rows() );
+
+   // Counting the entries of both A and A^T
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+         const size_t j( element->index() );
+         if( i != j ) {
+            ++offsets_[i+1UL];
+            ++offsets_[j+1UL];
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      offsets_[i+1UL] += offsets_[i];
+   }
+
+   adjacency_.resize( offsets_[n] );
+
+   std::vector<size_t> cursors( offsets_.begin(), offsets_.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+         const size_t j( element->index() );
+         if( i != j ) {
+            adjacency_[cursors[i]++] = j;
+            adjacency_[cursors[j]++] = i;
+         }
+      }
+   }
+
+   // Removing duplicate entries of symmetric patterns
+   size_t pos( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const auto first( adjacency_.begin()+offsets_[i] );
+      const auto last ( adjacency_.begin()+offsets_[i+1UL] );
+      std::sort( first, last );
+      const auto unique( std::unique( first, last ) );
+      offsets_[i] = pos;
+      pos = std::move( first, unique, adjacency_.begin()+pos ) - adjacency_.begin();
+   }
+
+   offsets_[n] = pos;
+   adjacency_.resize( pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of nodes of the graph.
+//
+// \return The number of nodes.
+*/
+inline size_t AdjacencyGraph::size() const noexcept
+{
+   return offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of neighbors of the given node.
+//
+// \param i The index of the node.
+// \return The number of neighbors.
+*/
+inline size_t AdjacencyGraph::degree( size_t i ) const noexcept
+{
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first neighbor of the given node.
+//
+// \param i The index of the node.
+// \return Pointer to the first neighbor.
+*/
+inline const size_t* AdjacencyGraph::begin( size_t i ) const noexcept
+{
+   return adjacency_.data() + offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer one past the last neighbor of the given node.
+//
+// \param i The index of the node.
+// \return Pointer one past the last neighbor.
+*/
+inline const size_t* AdjacencyGraph::end( size_t i ) const noexcept
+{
+   return adjacency_.data() + offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the breadth-first level structure rooted at the given node.
+//
+// \param root The root node of the level structure.
+// \param owner The owners of all nodes.
+// \param id The owner of the nodes to be visited.
+// \param order The resulting nodes in breadth-first order.
+// \param levels The resulting offsets of the levels within \a order.
+// \param sortByDegree \a true to visit the neighbors of each node in order of increasing degree.
+// \return The number of levels.
+//
+// This function visits all nodes reachable from \a root via nodes with owner \a id. Level \a l
+// of the resulting level structure consists of the nodes in the range
+// \f$ [levels[l]..levels[l+1]) \f$ of \a order.
+*/
+inline size_t AdjacencyGraph::levelStructure( size_t root, const std::vector<size_t>& owner,
+                                              size_t id, std::vector<size_t>& order,
+                                              std::vector<size_t>& levels, bool sortByDegree ) const
+{
+   BLAZE_INTERNAL_ASSERT( owner[root] == id, "Invalid root node detected" );
+
+   ++stamp_;
+
+   order.clear();
+   levels.clear();
+
+   order.push_back( root );
+   levels.push_back( 0UL );
+   mark_[root] = stamp_;
+
+   size_t first( 0UL );
+
+   while( first < order.size() )
+   {
+      const size_t last( order.size() );
+
+      for( size_t k=first; k<last; ++k )
+      {
+         const size_t start( order.size() );
+
+         for( const size_t* j=begin( order[k] ); j!=end( order[k] ); ++j ) {
+            if( owner[*j] == id && mark_[*j] != stamp_ ) {
+               mark_[*j] = stamp_;
+               order.push_back( *j );
+            }
+         }
+
+         if( sortByDegree ) {
+            std::sort( order.begin()+start, order.end(), [this]( size_t a, size_t b ) {
+               return degree( a ) < degree( b ) || ( degree( a ) == degree( b ) && a < b );
+            } );
+         }
+      }
+
+      levels.push_back( last );
+      first = last;
+   }
+
+   return levels.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a pseudo-peripheral node of the subgraph containing the given node.
+//
+// \param start The start node of the search.
+// \param owner The owners of all nodes.
+// \param id The owner of the nodes to be visited.
+// \param order The level structure of the resulting node in breadth-first order.
+// \param levels The offsets of the levels within \a order.
+// \return The pseudo-peripheral node.
+//
+// This function implements the algorithm of Gibbs, Poole, and Stockmeyer in the formulation of
+// George and Liu: Starting from \a start, the level structure is repeatedly rooted at the node
+// of minimum degree of the last level until the number of levels does not increase anymore.
+// On return, \a order and \a levels contain the level structure rooted at the resulting node.
+*/
+inline size_t AdjacencyGraph::pseudoPeripheralNode( size_t start, const std::vector<size_t>& owner,
+                                                    size_t id, std::vector<size_t>& order,
+                                                    std::vector<size_t>& levels ) const
+{
+   size_t root  ( start );
+   size_t height( levelStructure( root, owner, id, order, levels, false ) );
+
+   while( true )
+   {
+      size_t candidate( order[levels[height-1UL]] );
+
+      for( size_t k=levels[height-1UL]+1UL; k<levels[height]; ++k ) {
+         if( degree( order[k] ) < degree( candidate ) )
+            candidate = order[k];
+      }
+
+      // The eccentricity of the candidate is at least the eccentricity of the current root,
+      // i.e. the level structure of the candidate is at least as deep
+      const size_t candidateHeight( levelStructure( candidate, owner, id, order, levels, false ) );
+
+      root = candidate;
+
+      if( candidateHeight <= height )
+         return root;
+
+      height = candidateHeight;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REORDERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reordering functions */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+std::vector<size_t> nestedDissection( const SparseMatrix<MT,SO>& A, size_t leafSize = 256UL );
+
+template< typename MT, bool SO >
+std::vector<size_t> rowLocalityOrder( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, SO >
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, SO >
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& rowPerm,
+            const std::vector<size_t>& colPerm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the reverse Cuthill-McKee ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix to be ordered.
+// \return The bandwidth-reducing permutation.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a bandwidth- and profile-reducing ordering of the symmetric sparsity
+// pattern of \f$ A + A^T \f$ (the values of the matrix are irrelevant) by means of the reverse
+// Cuthill-McKee algorithm. Each connected component of the graph is numbered in breadth-first
+// order starting from a pseudo-peripheral node, visiting the neighbors of each node in order of
+// increasing degree. The resulting numbering is reversed. As for the amd() function, the
+// \a k-th row/column of the reordered matrix corresponds to the row/column \a p[k] of \a A:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::rcm( A ) );
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, p ) );
+
+   const blaze::DynamicVector<double> xp( elements( x, p ) );  // Permuting x
+   elements( y, p ) = B * xp;                                  // Equivalent to y = A * x
+   \endcode
+
+// A small bandwidth places the non-zero elements of each row close to the diagonal and therefore
+// improves the locality of the accesses to the vector in a sparse matrix/vector multiplication.
+// In case the given matrix is not a square matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   CompositeType_t<MT> tmp( ~A );
+   const AdjacencyGraph graph( tmp );
+
+   // Starting each component at a node of minimum degree
+   std::vector<size_t> candidates( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      candidates[i] = i;
+   }
+
+   std::stable_sort( candidates.begin(), candidates.end(), [&graph]( size_t a, size_t b ) {
+      return graph.degree( a ) < graph.degree( b );
+   } );
+
+   std::vector<size_t> owner( n, 0UL );  // 0: unnumbered node, 1: numbered node
+   std::vector<size_t> order, levels;
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   for( size_t start : candidates )
+   {
+      if( owner[start] != 0UL ) continue;
+
+      const size_t root( graph.pseudoPeripheralNode( start, owner, 0UL, order, levels ) );
+      graph.levelStructure( root, owner, 0UL, order, levels, true );
+
+      for( size_t i : order ) {
+         owner[i] = 1UL;
+         perm.push_back( i );
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid permutation detected" );
+
+   std::reverse( perm.begin(), perm.end() );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a nested dissection ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix to be ordered.
+// \param leafSize The maximum number of rows/columns of a subgraph that is not bisected anymore.
+// \return The nested dissection permutation.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a nested dissection ordering of the symmetric sparsity pattern of
+// \f$ A + A^T \f$ (the values of the matrix are irrelevant). The graph is recursively bisected
+// by means of vertex separators until the subgraphs contain at most \a leafSize nodes. Each
+// separator is the middle level of a level structure rooted at a pseudo-peripheral node.
+// Disconnected subgraphs are split into their components without separator. The resulting
+// permutation numbers both halves of a subgraph before its separator and the nodes of each
+// leaf in breadth-first order:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::nestedDissection( A ) );
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, p ) );
+   \endcode
+
+// The resulting matrix consists of diagonal blocks of strongly coupled rows/columns, which are
+// only coupled via the separator rows/columns at the end of each block. In contrast to the
+// rcm() function this groups the rows of each subdomain of a mesh into cache-sized blocks,
+// irrespective of the shape of the mesh. Additionally, the ordering reduces the fill-in of a
+// subsequent sparse factorization. In case the given matrix is not a square matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> nestedDissection( const SparseMatrix<MT,SO>& A, size_t leafSize )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+   const size_t numbered( std::numeric_limits<size_t>::max() );
+
+   CompositeType_t<MT> tmp( ~A );
+   const AdjacencyGraph graph( tmp );
+
+   struct Subgraph {
+      std::vector<size_t> nodes;  // The nodes of the subgraph
+      size_t id;                  // The owner ID of the nodes
+      bool separator;             // true in case the nodes form a separator
+   };
+
+   std::vector<size_t> owner( n, 0UL );
+   std::vector<size_t> order, levels;
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   std::vector<Subgraph> stack;
+   stack.push_back( Subgraph{ std::vector<size_t>( n ), 0UL, false } );
+   for( size_t i=0UL; i<n; ++i ) {
+      stack.back().nodes[i] = i;
+   }
+
+   size_t nextId( 1UL );
+
+   auto assign = [&]( std::vector<size_t>::const_iterator first,
+                      std::vector<size_t>::const_iterator last, bool separator )
+   {
+      Subgraph subgraph{ std::vector<size_t>( first, last ), nextId++, separator };
+      for( size_t i : subgraph.nodes ) {
+         owner[i] = subgraph.id;
+      }
+      return subgraph;
+   };
+
+   while( !stack.empty() )
+   {
+      Subgraph current( std::move( stack.back() ) );
+      stack.pop_back();
+
+      const size_t size( current.nodes.size() );
+
+      if( size == 0UL ) continue;
+
+      // Numbering separators
+      if( current.separator ) {
+         for( size_t i : current.nodes ) {
+            owner[i] = numbered;
+            perm.push_back( i );
+         }
+         continue;
+      }
+
+      const size_t root( graph.pseudoPeripheralNode( current.nodes[0], owner, current.id,
+                                                     order, levels ) );
+
+      // Numbering leaves component by component in breadth-first order
+      if( size <= leafSize || ( order.size() == size && levels.size() < 4UL ) )
+      {
+         graph.levelStructure( root, owner, current.id, order, levels, true );
+
+         auto next( current.nodes.begin() );
+
+         while( true ) {
+            for( size_t i : order ) {
+               owner[i] = numbered;
+               perm.push_back( i );
+            }
+
+            next = std::find_if( next, current.nodes.end(),
+                                 [&]( size_t i ) { return owner[i] == current.id; } );
+            if( next == current.nodes.end() ) break;
+
+            const size_t start( graph.pseudoPeripheralNode( *next, owner, current.id,
+                                                            order, levels ) );
+            graph.levelStructure( start, owner, current.id, order, levels, true );
+         }
+
+         continue;
+      }
+
+      // Splitting disconnected subgraphs into the first component and the remainder
+      if( order.size() < size )
+      {
+         std::vector<size_t> remainder;
+         remainder.reserve( size - order.size() );
+
+         const Subgraph first( assign( order.begin(), order.end(), false ) );
+
+         for( size_t i : current.nodes ) {
+            if( owner[i] == current.id )
+               remainder.push_back( i );
+         }
+
+         stack.push_back( assign( remainder.begin(), remainder.end(), false ) );
+         stack.push_back( first );
+         continue;
+      }
+
+      // Bisecting connected subgraphs by the middle level of the level structure
+      const size_t height( levels.size() - 1UL );
+
+      size_t middle( 1UL );
+      while( middle+2UL < height && levels[middle+1UL] < size/2UL ) {
+         ++middle;
+      }
+
+      const Subgraph left     ( assign( order.begin(), order.begin()+levels[middle], false ) );
+      const Subgraph separator( assign( order.begin()+levels[middle],
+                                        order.begin()+levels[middle+1UL], true ) );
+      const Subgraph right    ( assign( order.begin()+levels[middle+1UL], order.end(), false ) );
+
+      stack.push_back( separator );
+      stack.push_back( right );
+      stack.push_back( left );
+   }
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid permutation detected" );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a locality-improving row ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The (potentially non-square) sparse matrix to be ordered.
+// \return The row permutation.
+//
+// This function computes an ordering of the rows of the given sparse matrix by the mean column
+// index of their non-zero elements. Consecutive rows of the reordered matrix therefore access
+// neighboring elements of the vector in a sparse matrix/vector multiplication, which improves
+// the reuse of cache lines. In contrast to the rcm() and nestedDissection() functions the
+// columns are not reordered, i.e. the ordering can also be applied to non-square matrices and
+// does not affect the vector operand:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::rowLocalityOrder( A ) );
+   std::vector<size_t> q( A.columns() );
+   std::iota( q.begin(), q.end(), 0UL );
+
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, p, q ) );
+
+   elements( y, p ) = B * x;  // Equivalent to y = A * x
+   \endcode
+
+// Empty rows keep their relative position. Rows with equal mean column index keep their
+// original order.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> rowLocalityOrder( const SparseMatrix<MT,SO>& A )
+{
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+
+   CompositeType_t<MT> tmp( ~A );
+
+   std::vector<double> sums  ( m, 0.0 );
+   std::vector<size_t> counts( m, 0UL );
+
+   const size_t lines( SO ? n : m );
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      for( auto element=tmp.begin(k); element!=tmp.end(k); ++element ) {
+         const size_t i( SO ? element->index() : k );
+         const size_t j( SO ? k : element->index() );
+         sums[i] += j;
+         ++counts[i];
+      }
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      sums[i] = ( counts[i] != 0UL )?( sums[i] / counts[i] ):( ( double( i ) * n ) / m );
+   }
+
+   std::vector<size_t> perm( m );
+   for( size_t i=0UL; i<m; ++i ) {
+      perm[i] = i;
+   }
+
+   std::stable_sort( perm.begin(), perm.end(), [&sums]( size_t a, size_t b ) {
+      return sums[a] < sums[b];
+   } );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of the rows and columns of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix to be permuted.
+// \param perm The permutation of the rows and columns.
+// \return The permuted matrix \f$ B = P A P^T \f$.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function returns the matrix \f$ B \f$ with \f$ B(i,j) = A(perm[i],perm[j]) \f$, i.e. the
+// \a k-th row and column of the resulting matrix correspond to the row and column \a perm[k]
+// of \a A. This is the convention of all ordering functions (rcm(), nestedDissection(), amd()).
+// See the permute() function with separate row and column permutations for details.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, SO >
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   return permute( ~A, perm, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Validation of the given permutation.
+// \ingroup sparse_matrix
+//
+// \param perm The permutation to be validated.
+// \param n The expected size of the permutation.
+// \return \a true in case the permutation is the identity, \a false otherwise.
+// \exception std::invalid_argument Invalid permutation provided.
+*/
+inline bool checkPermutation( const std::vector<size_t>& perm, size_t n )
+{
+   if( perm.size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+   }
+
+   std::vector<bool> used( n, false );
+   bool identity( true );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      if( perm[k] >= n || used[perm[k]] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+      }
+      used[perm[k]] = true;
+      identity = identity && ( perm[k] == k );
+   }
+
+   return identity;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the rows and columns of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The sparse matrix to be permuted.
+// \param rowPerm The permutation of the rows.
+// \param colPerm The permutation of the columns.
+// \return The permuted matrix \f$ B = P A Q^T \f$.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function returns the compressed matrix \f$ B \f$ with \f$ B(i,j) = A(rowPerm[i],
+// colPerm[j]) \f$. Both permutations have to contain every row and column index of \a A exactly
+// once, otherwise a \a std::invalid_argument exception is thrown.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::rcm( A ) );
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, p, p ) );
+   \endcode
+
+// The permuted matrix is assembled in a single pass over the non-zero elements: Since the size of
+// each row (column) of the result is known in advance, the rows (columns) are filled independently
+// of each other, which is performed in parallel in case the number of non-zero elements reaches
+// the \a BLAZE_SMP_SMATPERMUTE_THRESHOLD. In case the column (row) permutation is the identity,
+// the elements of each row (column) are copied without sorting.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, SO >
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& rowPerm,
+            const std::vector<size_t>& colPerm )
+{
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+
+   const bool rowIdentity( checkPermutation( rowPerm, m ) );
+   const bool colIdentity( checkPermutation( colPerm, n ) );
+
+   // Mapping the permutations to the major (rows/columns) and minor (columns/rows) dimension
+   const std::vector<size_t>& majorPerm( SO ? colPerm : rowPerm );
+   const std::vector<size_t>& minorPerm( SO ? rowPerm : colPerm );
+   const bool minorIdentity( SO ? rowIdentity : colIdentity );
+
+   const size_t lines( SO ? n : m );
+
+   CompositeType_t<MT> tmp( ~A );
+
+   std::vector<size_t> inverse( minorPerm.size() );
+   for( size_t k=0UL; k<minorPerm.size(); ++k ) {
+      inverse[minorPerm[k]] = k;
+   }
+
+   std::vector<size_t> nonzeros( lines );
+   size_t total( 0UL );
+   for( size_t k=0UL; k<lines; ++k ) {
+      nonzeros[k] = tmp.nonZeros( majorPerm[k] );
+      total += nonzeros[k];
+   }
+
+   CompressedMatrix<ET,SO> B( m, n, nonzeros );
+
+   const size_t threads( ( total < SMP_SMATPERMUTE_THRESHOLD )?( 1UL ):( getNumThreads() ) );
+   const size_t blocks ( max( min( threads, lines ), 1UL ) );
+   const size_t linesPerBlock( lines / blocks + ( ( lines % blocks != 0UL )?( 1UL ):( 0UL ) ) );
+
+   // Filling the lines of the permuted matrix. Since the capacity of each line matches its
+   // final number of elements, the lines are filled independently without finalization.
+   smpFor( blocks, [&]( size_t b )
+   {
+      std::vector< std::pair<size_t,ET> > buffer;
+
+      const size_t kend( min( (b+1UL)*linesPerBlock, lines ) );
+      for( size_t k=b*linesPerBlock; k<kend; ++k )
+      {
+         const size_t source( majorPerm[k] );
+
+         if( minorIdentity ) {
+            for( auto element=tmp.begin(source); element!=tmp.end(source); ++element ) {
+               if( SO ) B.append( element->index(), k, element->value() );
+               else     B.append( k, element->index(), element->value() );
+            }
+            continue;
+         }
+
+         buffer.clear();
+         for( auto element=tmp.begin(source); element!=tmp.end(source); ++element ) {
+            buffer.emplace_back( inverse[element->index()], element->value() );
+         }
+
+         std::sort( buffer.begin(), buffer.end(),
+                    []( const std::pair<size_t,ET>& lhs, const std::pair<size_t,ET>& rhs ) {
+                       return lhs.first < rhs.first;
+                    } );
+
+         for( const auto& element : buffer ) {
+            if( SO ) B.append( element.first, k, element.second );
+            else     B.append( k, element.first, element.second );
+         }
+      }
+   } );
+
+   return B;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
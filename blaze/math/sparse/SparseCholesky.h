@@ -0,0 +1,947 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseCholesky.h
+//  \brief Header file for the sparse Cholesky decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSECHOLESKY_H_
+#define _BLAZE_MATH_SPARSE_SPARSECHOLESKY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/sparse/AMD.h>
+#include <blaze/math/sparse/EliminationTree.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal Cholesky decomposition of sparse symmetric positive definite matrices.
+// \ingroup sparse_matrix
+//
+// The SparseCholesky class template represents the Cholesky decomposition \f$ P A P^T = L L^H \f$
+// (or, in case the \a LDL flag is set, the \f$ P A P^T = L D L^H \f$ decomposition) of a sparse
+// symmetric (or Hermitian) matrix \a A. In contrast to the dense llh() function the sparse matrix
+// is never converted into a dense matrix and no LAPACK library is required:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SymmetricMatrix;
+
+   SymmetricMatrix< CompressedMatrix<double> > A;  // The sparse system matrix
+   blaze::DynamicVector<double> b;                 // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::SparseCholesky<double> chol( A );  // Analysis and numeric factorization
+
+   blaze::DynamicVector<double> x;
+   chol.solve( x, b );  // Solving A*x=b by means of the factorization
+   \endcode
+
+// The decomposition is computed in two phases:
+//
+//  - The symbolic analysis (see the analyze() function) computes a fill-reducing ordering of the
+//    matrix via the approximate minimum degree algorithm (see the amd() function), the elimination
+//    tree of the reordered matrix (see the etree() function), the number of non-zero elements of
+//    each column of \f$ L \f$, and the partitioning of \f$ L \f$ into supernodes, i.e. groups of
+//    consecutive columns with identical sparsity pattern.
+//  - The numeric factorization (see the factorize() function) computes the values of the factor.
+//    Each supernode is stored as a dense column-major block. The contributions of previously
+//    factorized supernodes are computed as dense matrix/matrix products and the supernodes
+//    themselves are factorized via dense matrix/vector products. Therefore the numeric
+//    factorization directly benefits from the vectorized dense kernels of Blaze.
+//
+// The result of the analysis only depends on the sparsity pattern of the matrix. In case only
+// the values of the matrix change, the factorization can be recomputed by calling factorize()
+// without repeating the analysis:
+
+   \code
+   blaze::SparseCholesky<double> chol;
+   chol.analyze( A );  // Symbolic analysis of the sparsity pattern of A
+
+   for( ... ) {
+      // ... Changing the values of A
+      chol.factorize( A );  // Numeric-only refactorization
+      chol.solve( x, b );
+   }
+   \endcode
+
+// Since the factorization only depends on the system matrix, it can be used for an arbitrary
+// number of right-hand sides. The \f$ L D L^H \f$ variant avoids the square roots of the
+// \f$ L L^H \f$ decomposition and can also be used for quasi-definite matrices:
+
+   \code
+   blaze::SparseCholesky<double,true> ldl( A );  // LDL^H decomposition of A
+   \endcode
+
+// \note The type of the given matrices has to be a symmetric or Hermitian matrix type (as for
+// instance SymmetricMatrix or HermitianMatrix). The attempt to use a matrix of any other type
+// results in a compilation error. In case the type of a matrix does not provide this compile
+// time information, it can be provided by means of the declsym() or declherm() operations.
+*/
+template< typename Type     // Data type of the factor
+        , bool LDL=false >  // Flag for the LDL^H (true) or LL^H (false) decomposition
+class SparseCholesky
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Type of the elements of the factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseCholesky();
+
+   template< typename MT, bool SO >
+   explicit inline SparseCholesky( const SparseMatrix<MT,SO>& A );
+
+   SparseCholesky( const SparseCholesky& ) = default;
+   SparseCholesky( SparseCholesky&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SparseCholesky() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   SparseCholesky& operator=( const SparseCholesky& ) = default;
+   SparseCholesky& operator=( SparseCholesky&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   inline void compute( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void solve( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void solve( DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                     rows()         const noexcept;
+   inline size_t                     nonZeros()     const noexcept;
+   inline size_t                     supernodes()   const noexcept;
+   inline bool                       isFactorized() const noexcept;
+   inline const std::vector<size_t>& permutation()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Block      = CustomMatrix<Type,unaligned,unpadded,columnMajor>;        //!< Supernode block.
+   using ConstBlock = CustomMatrix<const Type,unaligned,unpadded,columnMajor>;  //!< Constant supernode block.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;            //!< The number of rows/columns of the analysed matrix.
+   size_t matrixNnz_;    //!< The number of non-zero elements of the analysed matrix.
+   size_t factorNnz_;    //!< The number of non-zero elements of the factor L.
+   bool   factorized_;   //!< Flag for a successfully completed numeric factorization.
+
+   std::vector<size_t> perm_;     //!< The fill-reducing ordering of the rows/columns.
+   std::vector<size_t> iperm_;    //!< The inverse of the fill-reducing ordering.
+   std::vector<size_t> super_;    //!< The first column of each supernode.
+   std::vector<size_t> superOf_;  //!< The supernode of each column.
+   std::vector<size_t> rowPtr_;   //!< The offsets of the row patterns of the supernodes.
+   std::vector<size_t> rowIdx_;   //!< The row patterns of the supernodes.
+   std::vector<size_t> valPtr_;   //!< The offsets of the dense blocks of the supernodes.
+   std::vector<Type>   values_;   //!< The dense column-major blocks of the supernodes.
+   std::vector<Type>   diag_;     //!< The diagonal matrix D of the LDL^H decomposition.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseCholesky.
+//
+// The default constructor creates an empty decomposition of a \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+inline SparseCholesky<Type,LDL>::SparseCholesky()
+   : n_         ( 0UL )        // The number of rows/columns of the analysed matrix
+   , matrixNnz_ ( 0UL )        // The number of non-zero elements of the analysed matrix
+   , factorNnz_ ( 0UL )        // The number of non-zero elements of the factor L
+   , factorized_( true )       // Flag for a successfully completed numeric factorization
+   , perm_      ()             // The fill-reducing ordering of the rows/columns
+   , iperm_     ()             // The inverse of the fill-reducing ordering
+   , super_     ( 1UL, 0UL )   // The first column of each supernode
+   , superOf_   ()             // The supernode of each column
+   , rowPtr_    ( 1UL, 0UL )   // The offsets of the row patterns of the supernodes
+   , rowIdx_    ()             // The row patterns of the supernodes
+   , valPtr_    ( 1UL, 0UL )   // The offsets of the dense blocks of the supernodes
+   , values_    ()             // The dense column-major blocks of the supernodes
+   , diag_      ()             // The diagonal matrix D of the LDL^H decomposition
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the decomposition of the given sparse matrix.
+//
+// \param A The sparse symmetric matrix to be decomposed.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This constructor performs both the symbolic analysis and the numeric factorization of the
+// given sparse matrix (see the compute() function).
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline SparseCholesky<Type,LDL>::SparseCholesky( const SparseMatrix<MT,SO>& A )
+   : SparseCholesky()
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix.
+//
+// \param A The sparse symmetric matrix to be analysed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a fill-reducing ordering of the given sparse matrix by means of the
+// approximate minimum degree algorithm and performs the symbolic analysis of the reordered
+// matrix (see the analyze() function with explicitly given permutation). Any previously
+// computed factorization is discarded.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+void SparseCholesky<Type,LDL>::analyze( const SparseMatrix<MT,SO>& A )
+{
+   analyze( ~A, amd( ~A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix with the given fill-reducing ordering.
+//
+// \param A The sparse symmetric matrix to be analysed.
+// \param perm The fill-reducing ordering of the rows/columns of the matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function performs the symbolic analysis of the given sparse matrix, where the \a k-th
+// row/column to be eliminated is given by \a perm[k]. The permutation is refined by means of a
+// postordering of the elimination tree, which does not change the number of non-zero elements
+// of the factor but places the columns of each supernode next to each other. Subsequently the
+// number of non-zero elements of each column of the factor is determined via the row subtrees
+// of the elimination tree, the fundamental supernodes are identified, and the row patterns of
+// all supernodes are computed. The analysis only depends on the sparsity pattern of the matrix.
+// Any previously computed factorization is discarded.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+void SparseCholesky<Type,LDL>::analyze( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsSymmetric_v<MT> || IsHermitian_v<MT>, "Non-symmetric matrix type detected" );
+
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   // Validating the given permutation
+   {
+      std::vector<bool> found( n, false );
+
+      if( perm.size() != n ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+      }
+
+      for( size_t p : perm ) {
+         if( p >= n || found[p] ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+         }
+         found[p] = true;
+      }
+   }
+
+   // Refining the ordering by a postordering of the elimination tree
+   {
+      const std::vector<size_t> post( postorder( etree( ~A, perm ) ) );
+
+      perm_.resize( n );
+      iperm_.resize( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         perm_[k] = perm[post[k]];
+         iperm_[perm_[k]] = k;
+      }
+   }
+
+   const std::vector<size_t> parent( etree( ~A, perm_ ) );
+
+   // Computing the number of non-zero elements per column of L via the row subtrees
+   std::vector<size_t> count( n, 1UL );
+   std::vector<size_t> mark( n, n );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      mark[i] = i;
+
+      for( auto element=(~A).begin(perm_[i]); element!=(~A).end(perm_[i]); ++element ) {
+         for( size_t k=iperm_[element->index()]; k<i && mark[k]!=i; k=parent[k] ) {
+            ++count[k];
+            mark[k] = i;
+         }
+      }
+   }
+
+   // Identifying the fundamental supernodes
+   std::vector<size_t> children( n, 0UL );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( parent[j] != n )
+         ++children[parent[j]];
+   }
+
+   super_.assign( 1UL, 0UL );
+   superOf_.resize( n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( j > 0UL && !( parent[j-1UL] == j && children[j] == 1UL && count[j-1UL] == count[j]+1UL ) )
+         super_.push_back( j );
+      superOf_[j] = super_.size() - 1UL;
+   }
+
+   if( n > 0UL )
+      super_.push_back( n );
+
+   const size_t supernodes( super_.size() - 1UL );
+
+   // Computing the row patterns of the supernodes
+   std::vector<size_t> head( supernodes, supernodes );
+   std::vector<size_t> next( supernodes, supernodes );
+
+   for( size_t s=supernodes; s>0UL; --s ) {
+      const size_t p( parent[super_[s]-1UL] );
+      if( p != n ) {
+         next[s-1UL] = head[superOf_[p]];
+         head[superOf_[p]] = s-1UL;
+      }
+   }
+
+   rowPtr_.assign( 1UL, 0UL );
+   valPtr_.assign( 1UL, 0UL );
+   rowIdx_.clear();
+   std::fill( mark.begin(), mark.end(), n );
+
+   factorNnz_ = 0UL;
+
+   for( size_t s=0UL; s<supernodes; ++s )
+   {
+      const size_t first( super_[s] );
+      const size_t last ( super_[s+1UL] );
+      const size_t offset( rowIdx_.size() );
+
+      for( size_t j=first; j<last; ++j ) {
+         rowIdx_.push_back( j );
+         mark[j] = s;
+      }
+
+      for( size_t j=first; j<last; ++j ) {
+         for( auto element=(~A).begin(perm_[j]); element!=(~A).end(perm_[j]); ++element ) {
+            const size_t i( iperm_[element->index()] );
+            if( i >= last && mark[i] != s ) {
+               rowIdx_.push_back( i );
+               mark[i] = s;
+            }
+         }
+      }
+
+      for( size_t c=head[s]; c!=supernodes; c=next[c] ) {
+         for( size_t k=rowPtr_[c]; k<rowPtr_[c+1UL]; ++k ) {
+            const size_t i( rowIdx_[k] );
+            if( i >= last && mark[i] != s ) {
+               rowIdx_.push_back( i );
+               mark[i] = s;
+            }
+         }
+      }
+
+      std::sort( rowIdx_.begin()+offset+(last-first), rowIdx_.end() );
+
+      const size_t m( rowIdx_.size() - offset );
+      const size_t w( last - first );
+
+      BLAZE_INTERNAL_ASSERT( m == count[first], "Invalid supernode pattern detected" );
+
+      rowPtr_.push_back( rowIdx_.size() );
+      valPtr_.push_back( valPtr_.back() + m*w );
+      factorNnz_ += m*w - ( w*(w-1UL) ) / 2UL;
+   }
+
+   values_.assign( valPtr_.back(), Type() );
+   diag_.assign( LDL ? n : 0UL, Type() );
+
+   n_          = n;
+   matrixNnz_  = blaze::nonZeros( ~A );
+   factorized_ = ( n == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric factorization of the given sparse matrix.
+//
+// \param A The sparse symmetric matrix to be factorized.
+// \return void
+// \exception std::invalid_argument Matrix does not match the analysed sparsity pattern.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the numeric factorization of the given sparse matrix based on the
+// result of a previous symbolic analysis (see the analyze() function). The given matrix is
+// required to have the same sparsity pattern as the analysed matrix, only its values may
+// differ. The supernodes are factorized in a left-looking fashion: The contributions of all
+// descendant supernodes are computed as dense matrix/matrix products and subtracted from the
+// current supernode, which is then factorized column by column by means of dense matrix/vector
+// products. In case the given matrix does not match the analysed pattern, a
+// \a std::invalid_argument exception is thrown. In case a non-positive pivot is encountered
+// during the \f$ L L^H \f$ decomposition or a zero pivot during the \f$ L D L^H \f$
+// decomposition, a \a std::runtime_error exception is thrown.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of
+// an exception the factorization is invalidated and has to be recomputed before it can be used
+// for solving linear systems.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+void SparseCholesky<Type,LDL>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsSymmetric_v<MT> || IsHermitian_v<MT>, "Non-symmetric matrix type detected" );
+
+   if( (~A).rows() != n_ || (~A).columns() != n_ || blaze::nonZeros( ~A ) != matrixNnz_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix does not match the analysed sparsity pattern" );
+   }
+
+   CompositeType_t<MT> Atmp( ~A );
+
+   const size_t supernodes( super_.size() - 1UL );
+
+   std::vector<size_t> map  ( n_ );               // Position of each row within the current supernode
+   std::vector<size_t> owner( n_, supernodes );   // Supernode that last claimed each row
+   std::vector<size_t> head ( supernodes, supernodes );
+   std::vector<size_t> next ( supernodes, supernodes );
+   std::vector<size_t> pos  ( supernodes, 0UL );
+
+   DynamicMatrix<Type,columnMajor> W, T;
+   DynamicVector<Type> tmp;
+
+   factorized_ = false;
+   std::fill( values_.begin(), values_.end(), Type() );
+
+   for( size_t s=0UL; s<supernodes; ++s )
+   {
+      const size_t first( super_[s] );
+      const size_t last ( super_[s+1UL] );
+      const size_t w( last - first );
+      const size_t m( rowPtr_[s+1UL] - rowPtr_[s] );
+      const size_t* const rows( rowIdx_.data() + rowPtr_[s] );
+
+      Block B( values_.data() + valPtr_[s], m, w );
+
+      for( size_t k=0UL; k<m; ++k ) {
+         map[rows[k]] = k;
+         owner[rows[k]] = s;
+      }
+
+      // Assembling the lower part of the columns of the reordered matrix
+      for( size_t j=first; j<last; ++j ) {
+         for( auto element=Atmp.begin(perm_[j]); element!=Atmp.end(perm_[j]); ++element ) {
+            const size_t i( iperm_[element->index()] );
+            if( i < j ) continue;
+            if( owner[i] != s ) {
+               BLAZE_THROW_INVALID_ARGUMENT( "Matrix does not match the analysed sparsity pattern" );
+            }
+            B(map[i],j-first) = SO ? element->value() : conj( element->value() );
+         }
+      }
+
+      // Subtracting the contributions of all descendant supernodes
+      size_t d( head[s] );
+      head[s] = supernodes;
+
+      while( d != supernodes )
+      {
+         const size_t dnext( next[d] );
+         const size_t dfirst( super_[d] );
+         const size_t wd( super_[d+1UL] - dfirst );
+         const size_t md( rowPtr_[d+1UL] - rowPtr_[d] );
+         const size_t* const drows( rowIdx_.data() + rowPtr_[d] );
+         const size_t p( pos[d] );
+
+         size_t k1( 0UL );
+         while( p+k1 < md && drows[p+k1] < last ) {
+            ++k1;
+         }
+
+         const size_t r( md - p );
+
+         Block Ld( values_.data() + valPtr_[d], md, wd );
+
+         if( LDL ) {
+            T = submatrix( Ld, p, 0UL, k1, wd );
+            for( size_t c=0UL; c<wd; ++c ) {
+               column( T, c ) *= diag_[dfirst+c];
+            }
+            W = submatrix( Ld, p, 0UL, r, wd ) * ctrans( T );
+         }
+         else {
+            W = submatrix( Ld, p, 0UL, r, wd ) * ctrans( submatrix( Ld, p, 0UL, k1, wd ) );
+         }
+
+         for( size_t b=0UL; b<k1; ++b ) {
+            const size_t j( drows[p+b] - first );
+            for( size_t a=b; a<r; ++a ) {
+               B(map[drows[p+a]],j) -= W(a,b);
+            }
+         }
+
+         pos[d] = p + k1;
+
+         if( pos[d] < md ) {
+            const size_t t( superOf_[drows[pos[d]]] );
+            next[d] = head[t];
+            head[t] = d;
+         }
+
+         d = dnext;
+      }
+
+      // Factorizing the supernode
+      for( size_t j=0UL; j<w; ++j )
+      {
+         if( j > 0UL ) {
+            tmp.resize( j, false );
+            for( size_t k=0UL; k<j; ++k ) {
+               tmp[k] = LDL ? conj( B(j,k) ) * diag_[first+k] : conj( B(j,k) );
+            }
+            subvector( column( B, j ), j, m-j ) -= submatrix( B, j, 0UL, m-j, j ) * tmp;
+         }
+
+         const Type pivot( B(j,j) );
+
+         if( LDL ) {
+            if( !isDivisor( pivot ) ) {
+               BLAZE_THROW_RUNTIME_ERROR( "Decomposition of singular matrix failed" );
+            }
+            diag_[first+j] = pivot;
+            B(j,j) = Type(1);
+            if( j+1UL < m )
+               subvector( column( B, j ), j+1UL, m-j-1UL ) /= pivot;
+         }
+         else {
+            if( !( real( pivot ) > 0 ) ) {
+               BLAZE_THROW_RUNTIME_ERROR( "Decomposition of non-positive-definite matrix failed" );
+            }
+            const auto root( std::sqrt( real( pivot ) ) );
+            B(j,j) = root;
+            if( j+1UL < m )
+               subvector( column( B, j ), j+1UL, m-j-1UL ) /= root;
+         }
+      }
+
+      if( m > w ) {
+         const size_t t( superOf_[rows[w]] );
+         pos[s]  = w;
+         next[s] = head[t];
+         head[t] = s;
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis and numeric factorization of the given sparse matrix.
+//
+// \param A The sparse symmetric matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function is a shortcut for calling the analyze() and factorize() functions.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline void SparseCholesky<Type,LDL>::compute( const SparseMatrix<MT,SO>& A )
+{
+   analyze( ~A );
+   factorize( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*x=b \f$ by means of the factorization.
+//
+// \param x The dense solution vector.
+// \param b The dense right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Missing numeric factorization.
+//
+// This function solves the linear system of equations \f$ A*x=b \f$ by means of the computed
+// factorization, i.e. it permutes the right-hand side, performs a supernodal forward and
+// backward substitution, and permutes the result back. The solution vector is resized to the
+// size of the right-hand side, both vectors may refer to the same vector. In case the size of
+// the right-hand side doesn't match the size of the decomposed matrix, a
+// \a std::invalid_argument exception is thrown. In case no valid numeric factorization is
+// available, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+template< typename VT1   // Type of the solution vector
+        , bool TF1       // Transpose flag of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2 >     // Transpose flag of the right-hand side vector
+void SparseCholesky<Type,LDL>::solve( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b ) const
+{
+   if( !factorized_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Missing numeric factorization" );
+   }
+   else if( (~b).size() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const size_t supernodes( super_.size() - 1UL );
+
+   DynamicVector<Type> y( n_ );
+   DynamicVector<Type> g;
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      y[k] = (~b)[perm_[k]];
+   }
+
+   // Forward substitution
+   for( size_t s=0UL; s<supernodes; ++s )
+   {
+      const size_t first( super_[s] );
+      const size_t w( super_[s+1UL] - first );
+      const size_t m( rowPtr_[s+1UL] - rowPtr_[s] );
+      const size_t* const rows( rowIdx_.data() + rowPtr_[s] );
+
+      const ConstBlock B( values_.data() + valPtr_[s], m, w );
+
+      for( size_t j=0UL; j<w; ++j ) {
+         if( !LDL ) y[first+j] /= B(j,j);
+         for( size_t i=j+1UL; i<w; ++i )
+            y[first+i] -= B(i,j) * y[first+j];
+      }
+
+      if( m > w ) {
+         g = submatrix( B, w, 0UL, m-w, w ) * subvector( y, first, w );
+         for( size_t k=0UL; k<m-w; ++k )
+            y[rows[w+k]] -= g[k];
+      }
+   }
+
+   if( LDL ) {
+      for( size_t k=0UL; k<n_; ++k )
+         y[k] /= diag_[k];
+   }
+
+   // Backward substitution
+   for( size_t s=supernodes; s>0UL; --s )
+   {
+      const size_t first( super_[s-1UL] );
+      const size_t w( super_[s] - first );
+      const size_t m( rowPtr_[s] - rowPtr_[s-1UL] );
+      const size_t* const rows( rowIdx_.data() + rowPtr_[s-1UL] );
+
+      const ConstBlock B( values_.data() + valPtr_[s-1UL], m, w );
+
+      if( m > w ) {
+         g.resize( m-w, false );
+         for( size_t k=0UL; k<m-w; ++k )
+            g[k] = y[rows[w+k]];
+         subvector( y, first, w ) -= ctrans( submatrix( B, w, 0UL, m-w, w ) ) * g;
+      }
+
+      for( size_t j=w; j>0UL; --j ) {
+         for( size_t i=j; i<w; ++i )
+            y[first+j-1UL] -= conj( B(i,j-1UL) ) * y[first+i];
+         if( !LDL ) y[first+j-1UL] /= conj( B(j-1UL,j-1UL) );
+      }
+   }
+
+   resize( ~x, n_, false );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      (~x)[perm_[k]] = y[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A*X=B \f$ by means of the factorization.
+//
+// \param X The dense solution matrix.
+// \param B The dense right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Missing numeric factorization.
+//
+// This function solves the linear system of equations \f$ A*X=B \f$ for all columns of the
+// right-hand side matrix \a B by means of the computed factorization. The solution matrix is
+// resized to the size of the right-hand side. In case the number of rows of the right-hand side
+// doesn't match the size of the decomposed matrix, a \a std::invalid_argument exception is
+// thrown. In case no valid numeric factorization is available, a \a std::runtime_error exception
+// is thrown. In both cases the solution matrix remains unchanged.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+template< typename MT1   // Type of the solution matrix
+        , bool SO1       // Storage order of the solution matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void SparseCholesky<Type,LDL>::solve( DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B ) const
+{
+   if( !factorized_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Missing numeric factorization" );
+   }
+   else if( (~B).rows() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   const size_t nrhs( (~B).columns() );
+
+   DynamicVector<Type> x;
+
+   resize( ~X, n_, nrhs, false );
+
+   for( size_t j=0UL; j<nrhs; ++j ) {
+      solve( x, column( ~B, j ) );
+      column( ~X, j ) = x;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+inline size_t SparseCholesky<Type,LDL>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the factor \f$ L \f$.
+//
+// \return The number of non-zero elements of the factor \f$ L \f$ (including the diagonal).
+//
+// The number of non-zero elements of the factor is determined by the symbolic analysis and
+// includes all fill-in elements.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+inline size_t SparseCholesky<Type,LDL>::nonZeros() const noexcept
+{
+   return factorNnz_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes of the factor.
+//
+// \return The number of supernodes of the factor.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+inline size_t SparseCholesky<Type,LDL>::supernodes() const noexcept
+{
+   return super_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a valid numeric factorization is available.
+//
+// \return \a true in case a valid numeric factorization is available, \a false if not.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+inline bool SparseCholesky<Type,LDL>::isFactorized() const noexcept
+{
+   return factorized_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill-reducing ordering of the decomposition.
+//
+// \return The fill-reducing ordering of the rows/columns of the decomposed matrix.
+//
+// The \a k-th row/column of the factor corresponds to the row/column \a permutation()[k] of the
+// decomposed matrix.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL >     // Flag for the LDL^H (true) or LL^H (false) decomposition
+inline const std::vector<size_t>& SparseCholesky<Type,LDL>::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,372 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/tuning/Calibration.h
+//  \brief Header file for the calibration of thresholds on the executing machine
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TUNING_CALIBRATION_H_
+#define _BLAZE_MATH_TUNING_CALIBRATION_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <chrono>
+#include <limits>
+#include <string>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/tuning/ThresholdProfile.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CALIBRATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Calibration functions */
+//@{
+inline void calibrateThresholds();
+inline void calibrateThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Measures the runtime of the given operation.
+// \ingroup tuning
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation in seconds.
+//
+// The operation is repeated until a single measurement takes at least one millisecond. The
+// returned time is the minimum of three such measurements.
+*/
+template< typename OP >  // Type of the operation
+double calibrationTime( OP& op )
+{
+   using Clock = std::chrono::steady_clock;
+
+   op();
+
+   size_t repetitions( 1UL );
+   double minTime( std::numeric_limits<double>::max() );
+
+   for( size_t run=0UL; run<3UL; )
+   {
+      const Clock::time_point start( Clock::now() );
+
+      for( size_t i=0UL; i<repetitions; ++i ) {
+         op();
+      }
+
+      const double time( std::chrono::duration<double>( Clock::now() - start ).count() );
+
+      if( time < 1E-3 && repetitions < 1048576UL ) {
+         repetitions *= 2UL;
+         continue;
+      }
+
+      minTime = ( time / repetitions < minTime ) ? ( time / repetitions ) : ( minTime );
+      ++run;
+   }
+
+   return minTime;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates the given threshold by means of a sequence of measurements.
+// \ingroup tuning
+//
+// \param threshold The threshold to be calibrated.
+// \param smp \a true for an SMP threshold, \a false for a kernel selection threshold.
+// \param first The smallest dimension of the operands.
+// \param last The largest dimension of the operands.
+// \param square \a true in case the threshold refers to the number of matrix elements.
+// \param setup Functor that creates the operation for a given dimension.
+// \return void
+//
+// This function measures the runtime of the operation created by \a setup for the dimensions
+// \a first, 2*\a first, 4*\a first, ... up to \a last. In case of an SMP threshold the serial
+// execution (within a serial section) is compared to the parallel execution (with a threshold
+// of 0), in case of a kernel selection threshold the kernel for small operands (with a maximum
+// threshold) is compared to the kernel for large operands (with a threshold of 0), both within
+// a serial section. The threshold is set to the smallest measured size from which on the latter
+// alternative is faster for all larger sizes. In case the latter alternative is not faster for
+// the largest measured size, the threshold keeps its current value.
+*/
+template< typename ST >  // Type of the setup functor
+void calibrateThreshold( const Threshold& threshold, bool smp,
+                         size_t first, size_t last, bool square, ST setup )
+{
+   const size_t previous( threshold );
+   size_t crossover( 0UL );
+
+   try {
+      for( size_t n=first; n<=last; n*=2UL )
+      {
+         auto op( setup( n ) );
+
+         double slow( 0.0 );
+         double fast( 0.0 );
+
+         BLAZE_SERIAL_SECTION {
+            setThreshold( threshold, smp ? previous : std::numeric_limits<size_t>::max() );
+            slow = calibrationTime( op );
+         }
+
+         setThreshold( threshold, 0UL );
+
+         if( smp ) {
+            fast = calibrationTime( op );
+         }
+         else BLAZE_SERIAL_SECTION {
+            fast = calibrationTime( op );
+         }
+
+         if( fast >= slow ) {
+            crossover = 0UL;
+         }
+         else if( crossover == 0UL ) {
+            crossover = ( square ? n*n : n );
+         }
+      }
+   }
+   catch( ... ) {
+      setThreshold( threshold, previous );
+      throw;
+   }
+
+   setThreshold( threshold, ( crossover > 0UL ) ? crossover : previous );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates a threshold of a dense matrix/dense vector multiplication.
+// \ingroup tuning
+//
+// \param threshold The threshold to be calibrated.
+// \param smp \a true for the SMP threshold, \a false for the kernel selection threshold.
+// \return void
+*/
+template< bool SO >  // Storage order of the matrix
+void calibrateDMatDVecMultThreshold( const Threshold& threshold, bool smp )
+{
+   calibrateThreshold( threshold, smp, 16UL, 2048UL, !smp, []( size_t n ) {
+      DynamicMatrix<double,SO> A( n, n, 1.0 );
+      DynamicVector<double,columnVector> x( n, 1.0 ), y( n );
+      return [A,x,y]() mutable { y = A * x; };
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates a threshold of a dense vector/dense matrix multiplication.
+// \ingroup tuning
+//
+// \param threshold The threshold to be calibrated.
+// \param smp \a true for the SMP threshold, \a false for the kernel selection threshold.
+// \return void
+*/
+template< bool SO >  // Storage order of the matrix
+void calibrateTDVecDMatMultThreshold( const Threshold& threshold, bool smp )
+{
+   calibrateThreshold( threshold, smp, 16UL, 2048UL, !smp, []( size_t n ) {
+      DynamicMatrix<double,SO> A( n, n, 1.0 );
+      DynamicVector<double,rowVector> x( n, 1.0 ), y( n );
+      return [A,x,y]() mutable { y = x * A; };
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates the thresholds of a dense matrix/dense matrix multiplication.
+// \ingroup tuning
+//
+// \param threshold The threshold to be calibrated.
+// \param smp \a true for the SMP threshold, \a false for the kernel selection threshold.
+// \return void
+*/
+template< bool SO >  // Storage order of all matrices
+void calibrateDMatDMatMultThreshold( const Threshold& threshold, bool smp )
+{
+   calibrateThreshold( threshold, smp, 8UL, 512UL, true, []( size_t n ) {
+      DynamicMatrix<double,SO> A( n, n, 1.0 ), B( n, n, 1.0 ), C( n, n );
+      return [A,B,C]() mutable { C = A * B; };
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibrates the thresholds for the executing machine.
+// \ingroup tuning
+//
+// \return void
+//
+// This function measures the crossover points between the kernels for small and for large
+// operands and between the serial and the parallel execution of the most important dense vector
+// and dense matrix operations on the executing machine and replaces the current values of the
+// according thresholds by the measured crossover points. The calibrated thresholds can be
+// persisted via the blaze::saveThresholds() function and restored in later runs of the program
+// via the blaze::loadThresholds() function:
+
+   \code
+   if( std::ifstream( "blaze.profile" ) ) {
+      blaze::loadThresholds( "blaze.profile" );
+   }
+   else {
+      blaze::calibrateThresholds();
+      blaze::saveThresholds( "blaze.profile" );
+   }
+   \endcode
+
+// The following thresholds are calibrated:
+//
+//  - the kernel selection thresholds of the dense matrix/dense vector, dense vector/dense matrix
+//    and dense matrix/dense matrix multiplications of matrices with equal storage order
+//  - the SMP thresholds of the dense vector and dense matrix assignment, addition, subtraction,
+//    Schur product, multiplication, division and scaling
+//  - the SMP thresholds of the dense matrix/dense vector, dense vector/dense matrix and dense
+//    matrix/dense matrix multiplications of matrices with equal storage order
+//
+// All other thresholds (e.g. the sparse thresholds, which strongly depend on the sparsity
+// pattern) keep their current values. The SMP thresholds are only calibrated in case more than
+// a single thread is available. The measurement is based on double precision operands, takes
+// several seconds and should be performed on an otherwise idle machine. Also note that this
+// function must not be called within a serial or parallel section.
+*/
+inline void calibrateThresholds()
+{
+   calibrateDMatDVecMultThreshold<rowMajor>( DMATDVECMULT_THRESHOLD, false );
+   calibrateDMatDVecMultThreshold<columnMajor>( TDMATDVECMULT_THRESHOLD, false );
+   calibrateTDVecDMatMultThreshold<rowMajor>( TDVECDMATMULT_THRESHOLD, false );
+   calibrateTDVecDMatMultThreshold<columnMajor>( TDVECTDMATMULT_THRESHOLD, false );
+   calibrateDMatDMatMultThreshold<rowMajor>( DMATDMATMULT_THRESHOLD, false );
+   calibrateDMatDMatMultThreshold<columnMajor>( TDMATTDMATMULT_THRESHOLD, false );
+
+   if( getNumThreads() < 2UL )
+      return;
+
+   calibrateThreshold( SMP_DVECASSIGN_THRESHOLD, true, 256UL, 2097152UL, false, []( size_t n ) {
+      DynamicVector<double> a( n, 1.0 ), b( n );
+      return [a,b]() mutable { b = a; };
+   } );
+
+   calibrateThreshold( SMP_DVECSCALARMULT_THRESHOLD, true, 256UL, 2097152UL, false, []( size_t n ) {
+      DynamicVector<double> a( n, 1.0 ), b( n );
+      return [a,b]() mutable { b = a * 2.0; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECADD_THRESHOLD, true, 256UL, 2097152UL, false, []( size_t n ) {
+      DynamicVector<double> a( n, 1.0 ), b( n, 1.0 ), c( n );
+      return [a,b,c]() mutable { c = a + b; };
+   } );
+
+   setThreshold( SMP_DVECDVECSUB_THRESHOLD , SMP_DVECDVECADD_THRESHOLD );
+   setThreshold( SMP_DVECDVECMULT_THRESHOLD, SMP_DVECDVECADD_THRESHOLD );
+   setThreshold( SMP_DVECDVECDIV_THRESHOLD , SMP_DVECDVECADD_THRESHOLD );
+
+   calibrateThreshold( SMP_DMATASSIGN_THRESHOLD, true, 16UL, 2048UL, true, []( size_t n ) {
+      DynamicMatrix<double> A( n, n, 1.0 ), B( n, n );
+      return [A,B]() mutable { B = A; };
+   } );
+
+   calibrateThreshold( SMP_DMATSCALARMULT_THRESHOLD, true, 16UL, 2048UL, true, []( size_t n ) {
+      DynamicMatrix<double> A( n, n, 1.0 ), B( n, n );
+      return [A,B]() mutable { B = A * 2.0; };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATADD_THRESHOLD, true, 16UL, 2048UL, true, []( size_t n ) {
+      DynamicMatrix<double> A( n, n, 1.0 ), B( n, n, 1.0 ), C( n, n );
+      return [A,B,C]() mutable { C = A + B; };
+   } );
+
+   setThreshold( SMP_DMATDMATSUB_THRESHOLD  , SMP_DMATDMATADD_THRESHOLD );
+   setThreshold( SMP_DMATDMATSCHUR_THRESHOLD, SMP_DMATDMATADD_THRESHOLD );
+
+   calibrateDMatDVecMultThreshold<rowMajor>( SMP_DMATDVECMULT_THRESHOLD, true );
+   calibrateDMatDVecMultThreshold<columnMajor>( SMP_TDMATDVECMULT_THRESHOLD, true );
+   calibrateTDVecDMatMultThreshold<rowMajor>( SMP_TDVECDMATMULT_THRESHOLD, true );
+   calibrateTDVecDMatMultThreshold<columnMajor>( SMP_TDVECTDMATMULT_THRESHOLD, true );
+   calibrateDMatDMatMultThreshold<rowMajor>( SMP_DMATDMATMULT_THRESHOLD, true );
+   calibrateDMatDMatMultThreshold<columnMajor>( SMP_TDMATTDMATMULT_THRESHOLD, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibrates the thresholds for the executing machine and saves them to the given file.
+// \ingroup tuning
+//
+// \param file The name of the threshold profile.
+// \return void
+// \exception std::runtime_error Threshold profile could not be written.
+//
+// This function calibrates the thresholds for the executing machine (see
+// blaze::calibrateThresholds()) and writes the resulting threshold profile to the given file
+// (see blaze::saveThresholds()).
+*/
+inline void calibrateThresholds( const std::string& file )
+{
+   calibrateThresholds();
+   saveThresholds( file );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
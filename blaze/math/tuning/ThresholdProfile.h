@@ -0,0 +1,294 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/tuning/ThresholdProfile.h
+//  \brief Header file for the runtime adjustment and the persistence of thresholds
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TUNING_THRESHOLDPROFILE_H_
+#define _BLAZE_MATH_TUNING_THRESHOLDPROFILE_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Threshold functions */
+//@{
+inline size_t getThreshold( const Threshold& threshold ) noexcept;
+inline size_t getThreshold( const std::string& name );
+inline void setThreshold( const Threshold& threshold, size_t value ) noexcept;
+inline void setThreshold( const std::string& name, size_t value );
+inline void resetThresholds() noexcept;
+inline void loadThresholds( const std::string& file );
+inline void saveThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the threshold with the given name.
+// \ingroup tuning
+//
+// \param name The name of the threshold (e.g. "SMP_DVECASSIGN_THRESHOLD").
+// \return The index of the threshold or \a THRESHOLD_COUNT in case the name is unknown.
+*/
+inline size_t findThreshold( const std::string& name ) noexcept
+{
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      if( std::strcmp( ThresholdTable<>::names[i], name.c_str() ) == 0 )
+         return i;
+   }
+
+   return THRESHOLD_COUNT;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup tuning
+//
+// \param threshold The threshold to be queried (e.g. blaze::SMP_DVECASSIGN_THRESHOLD).
+// \return The current value of the threshold.
+*/
+inline size_t getThreshold( const Threshold& threshold ) noexcept
+{
+   return threshold;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the threshold with the given name.
+// \ingroup tuning
+//
+// \param name The name of the threshold (e.g. "SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Unknown threshold.
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   const size_t index( findThreshold( name ) );
+
+   if( index == THRESHOLD_COUNT ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unknown threshold" );
+   }
+
+   return ThresholdTable<>::values[index].load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replaces the current value of the given threshold.
+// \ingroup tuning
+//
+// \param threshold The threshold to be changed (e.g. blaze::SMP_DVECASSIGN_THRESHOLD).
+// \param value The new value of the threshold.
+// \return void
+//
+// This function replaces the current value of the given threshold, which affects all following
+// decisions based on this threshold. Note that operations that are already being executed are
+// not affected.
+*/
+inline void setThreshold( const Threshold& threshold, size_t value ) noexcept
+{
+   ThresholdTable<>::values[threshold.index()].store( value, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replaces the current value of the threshold with the given name.
+// \ingroup tuning
+//
+// \param name The name of the threshold (e.g. "SMP_DVECASSIGN_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Unknown threshold.
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   const size_t index( findThreshold( name ) );
+
+   if( index == THRESHOLD_COUNT ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unknown threshold" );
+   }
+
+   ThresholdTable<>::values[index].store( value, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all thresholds to their default values.
+// \ingroup tuning
+//
+// \return void
+//
+// This function resets all thresholds to the default values configured in the configuration
+// file <tt><blaze/config/Thresholds.h></tt> (or to the according debug values in case the
+// Blaze debug mode is active).
+*/
+inline void resetThresholds() noexcept
+{
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      ThresholdTable<>::values[i].store( ThresholdTable<>::defaults[i], std::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads the thresholds from the given threshold profile.
+// \ingroup tuning
+//
+// \param file The name of the threshold profile.
+// \return void
+// \exception std::runtime_error Threshold profile could not be opened.
+// \exception std::runtime_error Invalid threshold profile.
+//
+// This function replaces the current values of all thresholds listed in the given threshold
+// profile (see blaze::saveThresholds() and blaze::calibrateThresholds()). Each line of the
+// profile specifies the name and the value of a single threshold, separated by whitespace.
+// Empty lines and everything following a '#' character are ignored:
+
+   \code
+   # Threshold profile
+   SMP_DVECASSIGN_THRESHOLD  16384
+   SMP_DMATDVECMULT_THRESHOLD  128
+   \endcode
+
+// Thresholds that are not listed in the profile keep their current values, thresholds that are
+// unknown to the current version of Blaze are ignored. In case the profile cannot be opened or
+// contains an invalid line, a \a std::runtime_error exception is thrown and none of the current
+// values is changed.
+*/
+inline void loadThresholds( const std::string& file )
+{
+   std::ifstream in( file.c_str() );
+
+   if( !in ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold profile could not be opened" );
+   }
+
+   size_t values[THRESHOLD_COUNT];
+   bool   listed[THRESHOLD_COUNT] = {};
+
+   std::string line;
+
+   while( std::getline( in, line ) )
+   {
+      const size_t comment( line.find( '#' ) );
+      if( comment != std::string::npos ) {
+         line.erase( comment );
+      }
+
+      std::istringstream iss( line );
+      std::string name, rest;
+      size_t value( 0UL );
+
+      if( !( iss >> name ) )
+         continue;
+
+      if( !( iss >> value ) || ( iss >> rest ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid threshold profile" );
+      }
+
+      const size_t index( findThreshold( name ) );
+
+      if( index != THRESHOLD_COUNT ) {
+         values[index] = value;
+         listed[index] = true;
+      }
+   }
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      if( listed[i] ) {
+         ThresholdTable<>::values[i].store( values[i], std::memory_order_relaxed );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Saves the current values of all thresholds to the given threshold profile.
+// \ingroup tuning
+//
+// \param file The name of the threshold profile.
+// \return void
+// \exception std::runtime_error Threshold profile could not be written.
+//
+// This function writes the current values of all thresholds to the given file in the format
+// expected by the blaze::loadThresholds() function. An existing file is overwritten.
+*/
+inline void saveThresholds( const std::string& file )
+{
+   std::ofstream out( file.c_str() );
+
+   out << "# Blaze threshold profile\n";
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      out << ThresholdTable<>::names[i] << ' '
+          << ThresholdTable<>::values[i].load( std::memory_order_relaxed ) << '\n';
+   }
+
+   if( !out.flush() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold profile could not be written" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <blaze/system/Debugging.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
@@ -246,26 +247,6 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
-constexpr size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATDMATMULT_THRESHOLD   );
-constexpr size_t DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATSMATMULT_THRESHOLD   );
-constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
 //=================================================================================================
 //
 //  SMP THRESHOLDS
@@ -967,57 +948,488 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATTRANS_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the conversion of a sparse matrix into a compressed matrix
+// with opposite storage order can be executed in parallel. In case the number of non-zero
+// elements of the source matrix is larger or equal to this threshold, the operation is executed
+// in parallel. If the number of non-zero elements is below this threshold the operation is
+// executed single-threaded.
+*/
+constexpr size_t SMP_SMATTRANS_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATTRSV_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the rows of a single level of a level-scheduled sparse
+// triangular solve can be solved in parallel. In case the number of rows of a level is larger
+// or equal to this threshold, the rows of the level are solved in parallel. If the number of
+// rows is below this threshold the level is solved single-threaded.
+*/
+constexpr size_t SMP_SMATTRSV_DEBUG_THRESHOLD = 4UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP Krylov solver threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_KRYLOV_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the fused vector operations of the iterative Krylov solvers
+// can be executed in parallel. In case the number of elements of the vectors is larger or equal
+// to this threshold, the operations are executed in parallel. If the number of elements is
+// below this threshold the operations are executed single-threaded.
+*/
+constexpr size_t SMP_KRYLOV_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix permutation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATPERMUTE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the row and column permutation of a sparse matrix can be
+// executed in parallel. In case the number of non-zero elements of the source matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATPERMUTE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the total reduction of a dense vector can be executed in
+// parallel. In case the number of elements of the vector is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total reduction of a dense matrix can be executed
+// in parallel. In case the total number of elements of the matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The total number of runtime adjustable thresholds.
+// \ingroup config
+*/
+constexpr size_t THRESHOLD_COUNT = 67UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Names, default values and current values of all runtime adjustable thresholds.
+// \ingroup config
+//
+// The default value of each threshold is given by the according setting in the configuration
+// file <tt><blaze/config/Thresholds.h></tt> or, in case the Blaze debug mode is active, by the
+// according debug threshold. The current values are initialized with these defaults during the
+// constant initialization of the program and can be replaced at runtime (see for instance the
+// blaze::setThreshold() and blaze::loadThresholds() functions). The class template parameter
+// is only used to enable the definition of the static data members within the header file.
+*/
+template< typename T = void >  // Unused type parameter
+struct ThresholdTable
+{
+   static constexpr size_t defaults[THRESHOLD_COUNT] =
+   {
+      ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD : BLAZE_DMATDVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD : BLAZE_TDMATDVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD : BLAZE_DMATDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_DMATTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD : BLAZE_DMATSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD : BLAZE_SMP_DVECASSIGN_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECADD_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECSUB_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECDIV_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECOUTER_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATDVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATDVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATSVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATDVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATDVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATSVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATSVECMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD : BLAZE_SMP_DMATASSIGN_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATADD_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATADD_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATSUB_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSUB_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATTSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATTSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATREDUCE_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_SMATREDUCE_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATTRANS_DEBUG_THRESHOLD : BLAZE_SMP_SMATTRANS_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATTRSV_DEBUG_THRESHOLD : BLAZE_SMP_SMATTRSV_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_KRYLOV_DEBUG_THRESHOLD : BLAZE_SMP_KRYLOV_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_SMATPERMUTE_DEBUG_THRESHOLD : BLAZE_SMP_SMATPERMUTE_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DVECREDUCE_THRESHOLD )
+    , ( BLAZE_DEBUG_MODE ? SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD )
+   };
+
+   static const char* const names[THRESHOLD_COUNT];   //!< The names of all thresholds.
+   static std::atomic<size_t> values[THRESHOLD_COUNT];  //!< The current values of all thresholds.
+};
+
+template< typename T >
+constexpr size_t ThresholdTable<T>::defaults[THRESHOLD_COUNT];
+
+template< typename T >
+const char* const ThresholdTable<T>::names[THRESHOLD_COUNT] =
+{
+    "DMATDVECMULT_THRESHOLD"
+  , "TDMATDVECMULT_THRESHOLD"
+  , "TDVECDMATMULT_THRESHOLD"
+  , "TDVECTDMATMULT_THRESHOLD"
+  , "DMATDMATMULT_THRESHOLD"
+  , "DMATTDMATMULT_THRESHOLD"
+  , "TDMATDMATMULT_THRESHOLD"
+  , "TDMATTDMATMULT_THRESHOLD"
+  , "DMATSMATMULT_THRESHOLD"
+  , "TDMATSMATMULT_THRESHOLD"
+  , "TSMATDMATMULT_THRESHOLD"
+  , "TSMATTDMATMULT_THRESHOLD"
+  , "SMP_DVECASSIGN_THRESHOLD"
+  , "SMP_DVECSCALARMULT_THRESHOLD"
+  , "SMP_DVECDVECADD_THRESHOLD"
+  , "SMP_DVECDVECSUB_THRESHOLD"
+  , "SMP_DVECDVECMULT_THRESHOLD"
+  , "SMP_DVECDVECDIV_THRESHOLD"
+  , "SMP_DVECDVECOUTER_THRESHOLD"
+  , "SMP_DMATDVECMULT_THRESHOLD"
+  , "SMP_TDMATDVECMULT_THRESHOLD"
+  , "SMP_TDVECDMATMULT_THRESHOLD"
+  , "SMP_TDVECTDMATMULT_THRESHOLD"
+  , "SMP_DMATSVECMULT_THRESHOLD"
+  , "SMP_TDMATSVECMULT_THRESHOLD"
+  , "SMP_TSVECDMATMULT_THRESHOLD"
+  , "SMP_TSVECTDMATMULT_THRESHOLD"
+  , "SMP_SMATDVECMULT_THRESHOLD"
+  , "SMP_TSMATDVECMULT_THRESHOLD"
+  , "SMP_TDVECSMATMULT_THRESHOLD"
+  , "SMP_TDVECTSMATMULT_THRESHOLD"
+  , "SMP_SMATSVECMULT_THRESHOLD"
+  , "SMP_TSMATSVECMULT_THRESHOLD"
+  , "SMP_TSVECSMATMULT_THRESHOLD"
+  , "SMP_TSVECTSMATMULT_THRESHOLD"
+  , "SMP_DMATASSIGN_THRESHOLD"
+  , "SMP_DMATSCALARMULT_THRESHOLD"
+  , "SMP_DMATDMATADD_THRESHOLD"
+  , "SMP_DMATTDMATADD_THRESHOLD"
+  , "SMP_DMATDMATSUB_THRESHOLD"
+  , "SMP_DMATTDMATSUB_THRESHOLD"
+  , "SMP_DMATDMATSCHUR_THRESHOLD"
+  , "SMP_DMATTDMATSCHUR_THRESHOLD"
+  , "SMP_DMATDMATMULT_THRESHOLD"
+  , "SMP_DMATTDMATMULT_THRESHOLD"
+  , "SMP_TDMATDMATMULT_THRESHOLD"
+  , "SMP_TDMATTDMATMULT_THRESHOLD"
+  , "SMP_DMATSMATMULT_THRESHOLD"
+  , "SMP_DMATTSMATMULT_THRESHOLD"
+  , "SMP_TDMATSMATMULT_THRESHOLD"
+  , "SMP_TDMATTSMATMULT_THRESHOLD"
+  , "SMP_SMATDMATMULT_THRESHOLD"
+  , "SMP_SMATTDMATMULT_THRESHOLD"
+  , "SMP_TSMATDMATMULT_THRESHOLD"
+  , "SMP_TSMATTDMATMULT_THRESHOLD"
+  , "SMP_SMATSMATMULT_THRESHOLD"
+  , "SMP_SMATTSMATMULT_THRESHOLD"
+  , "SMP_TSMATSMATMULT_THRESHOLD"
+  , "SMP_TSMATTSMATMULT_THRESHOLD"
+  , "SMP_DMATREDUCE_THRESHOLD"
+  , "SMP_SMATREDUCE_THRESHOLD"
+  , "SMP_SMATTRANS_THRESHOLD"
+  , "SMP_SMATTRSV_THRESHOLD"
+  , "SMP_KRYLOV_THRESHOLD"
+  , "SMP_SMATPERMUTE_THRESHOLD"
+  , "SMP_DVECREDUCE_THRESHOLD"
+  , "SMP_DMATTOTALREDUCE_THRESHOLD"
+};
+
+template< typename T >
+std::atomic<size_t> ThresholdTable<T>::values[THRESHOLD_COUNT] =
+{
+    { ThresholdTable<T>::defaults[ 0UL] }
+  , { ThresholdTable<T>::defaults[ 1UL] }
+  , { ThresholdTable<T>::defaults[ 2UL] }
+  , { ThresholdTable<T>::defaults[ 3UL] }
+  , { ThresholdTable<T>::defaults[ 4UL] }
+  , { ThresholdTable<T>::defaults[ 5UL] }
+  , { ThresholdTable<T>::defaults[ 6UL] }
+  , { ThresholdTable<T>::defaults[ 7UL] }
+  , { ThresholdTable<T>::defaults[ 8UL] }
+  , { ThresholdTable<T>::defaults[ 9UL] }
+  , { ThresholdTable<T>::defaults[10UL] }
+  , { ThresholdTable<T>::defaults[11UL] }
+  , { ThresholdTable<T>::defaults[12UL] }
+  , { ThresholdTable<T>::defaults[13UL] }
+  , { ThresholdTable<T>::defaults[14UL] }
+  , { ThresholdTable<T>::defaults[15UL] }
+  , { ThresholdTable<T>::defaults[16UL] }
+  , { ThresholdTable<T>::defaults[17UL] }
+  , { ThresholdTable<T>::defaults[18UL] }
+  , { ThresholdTable<T>::defaults[19UL] }
+  , { ThresholdTable<T>::defaults[20UL] }
+  , { ThresholdTable<T>::defaults[21UL] }
+  , { ThresholdTable<T>::defaults[22UL] }
+  , { ThresholdTable<T>::defaults[23UL] }
+  , { ThresholdTable<T>::defaults[24UL] }
+  , { ThresholdTable<T>::defaults[25UL] }
+  , { ThresholdTable<T>::defaults[26UL] }
+  , { ThresholdTable<T>::defaults[27UL] }
+  , { ThresholdTable<T>::defaults[28UL] }
+  , { ThresholdTable<T>::defaults[29UL] }
+  , { ThresholdTable<T>::defaults[30UL] }
+  , { ThresholdTable<T>::defaults[31UL] }
+  , { ThresholdTable<T>::defaults[32UL] }
+  , { ThresholdTable<T>::defaults[33UL] }
+  , { ThresholdTable<T>::defaults[34UL] }
+  , { ThresholdTable<T>::defaults[35UL] }
+  , { ThresholdTable<T>::defaults[36UL] }
+  , { ThresholdTable<T>::defaults[37UL] }
+  , { ThresholdTable<T>::defaults[38UL] }
+  , { ThresholdTable<T>::defaults[39UL] }
+  , { ThresholdTable<T>::defaults[40UL] }
+  , { ThresholdTable<T>::defaults[41UL] }
+  , { ThresholdTable<T>::defaults[42UL] }
+  , { ThresholdTable<T>::defaults[43UL] }
+  , { ThresholdTable<T>::defaults[44UL] }
+  , { ThresholdTable<T>::defaults[45UL] }
+  , { ThresholdTable<T>::defaults[46UL] }
+  , { ThresholdTable<T>::defaults[47UL] }
+  , { ThresholdTable<T>::defaults[48UL] }
+  , { ThresholdTable<T>::defaults[49UL] }
+  , { ThresholdTable<T>::defaults[50UL] }
+  , { ThresholdTable<T>::defaults[51UL] }
+  , { ThresholdTable<T>::defaults[52UL] }
+  , { ThresholdTable<T>::defaults[53UL] }
+  , { ThresholdTable<T>::defaults[54UL] }
+  , { ThresholdTable<T>::defaults[55UL] }
+  , { ThresholdTable<T>::defaults[56UL] }
+  , { ThresholdTable<T>::defaults[57UL] }
+  , { ThresholdTable<T>::defaults[58UL] }
+  , { ThresholdTable<T>::defaults[59UL] }
+  , { ThresholdTable<T>::defaults[60UL] }
+  , { ThresholdTable<T>::defaults[61UL] }
+  , { ThresholdTable<T>::defaults[62UL] }
+  , { ThresholdTable<T>::defaults[63UL] }
+  , { ThresholdTable<T>::defaults[64UL] }
+  , { ThresholdTable<T>::defaults[65UL] }
+  , { ThresholdTable<T>::defaults[66UL] }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime adjustable threshold.
+// \ingroup config
+//
+// The Threshold class represents one of the thresholds that decide between the serial and the
+// parallel execution of an operation or between the kernels for small and for large operands.
+// It implicitly converts to the current value of the threshold. By default this is the value
+// configured in <tt><blaze/config/Thresholds.h></tt>, which can be replaced at runtime by a
+// value that has been calibrated for the executing machine (see blaze::calibrateThresholds()).
+// Reading the current value of a threshold amounts to a single relaxed atomic load.
+*/
+class Threshold
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Creates a threshold referring to the given entry of the threshold table.
+   //
+   // \param index The index of the threshold in the threshold table.
+   */
+   explicit constexpr Threshold( size_t index ) noexcept
+      : index_( index )  // The index of the threshold in the threshold table
+   {}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline operator size_t() const noexcept {
+      return ThresholdTable<>::values[index_].load( std::memory_order_relaxed );
+   }
+   //**********************************************************************************************
+
+   //**Index function******************************************************************************
+   /*!\brief Returns the index of the threshold in the threshold table.
+   //
+   // \return The index of the threshold.
+   */
+   constexpr size_t index() const noexcept {
+      return index_;
+   }
+   //**********************************************************************************************
+
+   //**Name function*******************************************************************************
+   /*!\brief Returns the name of the threshold (e.g. "SMP_DVECASSIGN_THRESHOLD").
+   //
+   // \return The name of the threshold.
+   */
+   inline const char* name() const noexcept {
+      return ThresholdTable<>::names[index_];
+   }
+   //**********************************************************************************************
+
+   //**DefaultValue function***********************************************************************
+   /*!\brief Returns the compile time default value of the threshold.
+   //
+   // \return The default value of the threshold.
+   */
+   constexpr size_t defaultValue() const noexcept {
+      return ThresholdTable<>::defaults[index_];
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   size_t index_;  //!< The index of the threshold in the threshold table.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
-constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
-constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    );
-constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
-constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
-constexpr size_t SMP_DVECDVECOUTER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
-constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
-constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
-constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
-constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
-constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr Threshold DMATDVECMULT_THRESHOLD      (  0UL );
+constexpr Threshold TDMATDVECMULT_THRESHOLD     (  1UL );
+constexpr Threshold TDVECDMATMULT_THRESHOLD     (  2UL );
+constexpr Threshold TDVECTDMATMULT_THRESHOLD    (  3UL );
+constexpr Threshold DMATDMATMULT_THRESHOLD      (  4UL );
+constexpr Threshold DMATTDMATMULT_THRESHOLD     (  5UL );
+constexpr Threshold TDMATDMATMULT_THRESHOLD     (  6UL );
+constexpr Threshold TDMATTDMATMULT_THRESHOLD    (  7UL );
+constexpr Threshold DMATSMATMULT_THRESHOLD      (  8UL );
+constexpr Threshold TDMATSMATMULT_THRESHOLD     (  9UL );
+constexpr Threshold TSMATDMATMULT_THRESHOLD     ( 10UL );
+constexpr Threshold TSMATTDMATMULT_THRESHOLD    ( 11UL );
+constexpr Threshold SMP_DVECASSIGN_THRESHOLD    ( 12UL );
+constexpr Threshold SMP_DVECSCALARMULT_THRESHOLD( 13UL );
+constexpr Threshold SMP_DVECDVECADD_THRESHOLD   ( 14UL );
+constexpr Threshold SMP_DVECDVECSUB_THRESHOLD   ( 15UL );
+constexpr Threshold SMP_DVECDVECMULT_THRESHOLD  ( 16UL );
+constexpr Threshold SMP_DVECDVECDIV_THRESHOLD   ( 17UL );
+constexpr Threshold SMP_DVECDVECOUTER_THRESHOLD ( 18UL );
+constexpr Threshold SMP_DMATDVECMULT_THRESHOLD  ( 19UL );
+constexpr Threshold SMP_TDMATDVECMULT_THRESHOLD ( 20UL );
+constexpr Threshold SMP_TDVECDMATMULT_THRESHOLD ( 21UL );
+constexpr Threshold SMP_TDVECTDMATMULT_THRESHOLD( 22UL );
+constexpr Threshold SMP_DMATSVECMULT_THRESHOLD  ( 23UL );
+constexpr Threshold SMP_TDMATSVECMULT_THRESHOLD ( 24UL );
+constexpr Threshold SMP_TSVECDMATMULT_THRESHOLD ( 25UL );
+constexpr Threshold SMP_TSVECTDMATMULT_THRESHOLD( 26UL );
+constexpr Threshold SMP_SMATDVECMULT_THRESHOLD  ( 27UL );
+constexpr Threshold SMP_TSMATDVECMULT_THRESHOLD ( 28UL );
+constexpr Threshold SMP_TDVECSMATMULT_THRESHOLD ( 29UL );
+constexpr Threshold SMP_TDVECTSMATMULT_THRESHOLD( 30UL );
+constexpr Threshold SMP_SMATSVECMULT_THRESHOLD  ( 31UL );
+constexpr Threshold SMP_TSMATSVECMULT_THRESHOLD ( 32UL );
+constexpr Threshold SMP_TSVECSMATMULT_THRESHOLD ( 33UL );
+constexpr Threshold SMP_TSVECTSMATMULT_THRESHOLD( 34UL );
+constexpr Threshold SMP_DMATASSIGN_THRESHOLD    ( 35UL );
+constexpr Threshold SMP_DMATSCALARMULT_THRESHOLD( 36UL );
+constexpr Threshold SMP_DMATDMATADD_THRESHOLD   ( 37UL );
+constexpr Threshold SMP_DMATTDMATADD_THRESHOLD  ( 38UL );
+constexpr Threshold SMP_DMATDMATSUB_THRESHOLD   ( 39UL );
+constexpr Threshold SMP_DMATTDMATSUB_THRESHOLD  ( 40UL );
+constexpr Threshold SMP_DMATDMATSCHUR_THRESHOLD ( 41UL );
+constexpr Threshold SMP_DMATTDMATSCHUR_THRESHOLD( 42UL );
+constexpr Threshold SMP_DMATDMATMULT_THRESHOLD  ( 43UL );
+constexpr Threshold SMP_DMATTDMATMULT_THRESHOLD ( 44UL );
+constexpr Threshold SMP_TDMATDMATMULT_THRESHOLD ( 45UL );
+constexpr Threshold SMP_TDMATTDMATMULT_THRESHOLD( 46UL );
+constexpr Threshold SMP_DMATSMATMULT_THRESHOLD  ( 47UL );
+constexpr Threshold SMP_DMATTSMATMULT_THRESHOLD ( 48UL );
+constexpr Threshold SMP_TDMATSMATMULT_THRESHOLD ( 49UL );
+constexpr Threshold SMP_TDMATTSMATMULT_THRESHOLD( 50UL );
+constexpr Threshold SMP_SMATDMATMULT_THRESHOLD  ( 51UL );
+constexpr Threshold SMP_SMATTDMATMULT_THRESHOLD ( 52UL );
+constexpr Threshold SMP_TSMATDMATMULT_THRESHOLD ( 53UL );
+constexpr Threshold SMP_TSMATTDMATMULT_THRESHOLD( 54UL );
+constexpr Threshold SMP_SMATSMATMULT_THRESHOLD  ( 55UL );
+constexpr Threshold SMP_SMATTSMATMULT_THRESHOLD ( 56UL );
+constexpr Threshold SMP_TSMATSMATMULT_THRESHOLD ( 57UL );
+constexpr Threshold SMP_TSMATTSMATMULT_THRESHOLD( 58UL );
+constexpr Threshold SMP_DMATREDUCE_THRESHOLD    ( 59UL );
+constexpr Threshold SMP_SMATREDUCE_THRESHOLD    ( 60UL );
+constexpr Threshold SMP_SMATTRANS_THRESHOLD     ( 61UL );
+constexpr Threshold SMP_SMATTRSV_THRESHOLD      ( 62UL );
+constexpr Threshold SMP_KRYLOV_THRESHOLD        ( 63UL );
+constexpr Threshold SMP_SMATPERMUTE_THRESHOLD   ( 64UL );
+constexpr Threshold SMP_DVECREDUCE_THRESHOLD    ( 65UL );
+constexpr Threshold SMP_DMATTOTALREDUCE_THRESHOLD( 66UL );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1036,64 +1448,70 @@ constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATRED
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
-
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD.defaultValue()   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD.defaultValue()  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD.defaultValue()  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD.defaultValue() > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD.defaultValue()   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD.defaultValue()  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD.defaultValue()  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD.defaultValue() > 0UL );
+
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue()     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD.defaultValue()    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD.defaultValue()    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD.defaultValue()    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD.defaultValue()     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD.defaultValue()    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD.defaultValue()    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD.defaultValue()   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD.defaultValue()  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD.defaultValue() >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD.defaultValue()     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD.defaultValue()     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRANS_THRESHOLD.defaultValue()      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRSV_THRESHOLD.defaultValue()       >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_KRYLOV_THRESHOLD.defaultValue()         >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATPERMUTE_THRESHOLD.defaultValue()    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD.defaultValue()     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTOTALREDUCE_THRESHOLD.defaultValue() >= 0UL );
 
 }
 /*! \endcond */
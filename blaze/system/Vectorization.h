@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/config/Vectorization.h>
+#include <blaze/system/Compiler.h>
 #include <blaze/util/StaticAssert.h>
 
 
@@ -353,6 +354,62 @@
 
 
 
+//=================================================================================================
+//
+//  PORTABLE SIMD MATH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the portable SIMD math mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the portable SIMD math mode. In case the portable
+// SIMD math mode is enabled (i.e. in case SSE2, AVX, or AVX-512 are available, the SVML is
+// not available, and the portable elementary functions are not deactivated by means of the
+// BLAZE_USE_PORTABLE_SIMD_MATH switch) the Blaze library vectorizes the exponential function,
+// the logarithm, the sine and cosine, the hyperbolic tangent, the error function, and the
+// power function by means of polynomial approximations. Otherwise the Blaze library chooses
+// the SVML (if available) or default, non-vectorized functionality for these operations.
+*/
+#if BLAZE_USE_PORTABLE_SIMD_MATH && BLAZE_SSE2_MODE && !BLAZE_SVML_MODE && !BLAZE_MIC_MODE
+#  define BLAZE_PORTABLE_SIMD_MATH_MODE 1
+#else
+#  define BLAZE_PORTABLE_SIMD_MATH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case the runtime dispatch is not deactivated by means of
+// the BLAZE_USE_RUNTIME_DISPATCH switch, the GNU or Clang compiler is used on an x86-64
+// platform, and Blaze is not compiled for AVX-512) selected compute kernels are additionally
+// compiled for AVX2/FMA and AVX-512 and selected at runtime according to the capabilities of
+// the CPU. Otherwise the Blaze library exclusively uses the compile time instruction set.
+*/
+#if BLAZE_USE_RUNTIME_DISPATCH && BLAZE_USE_VECTORIZATION && defined(__x86_64__) && \
+    ( BLAZE_GNU_COMPILER || BLAZE_CLANG_COMPILER ) && !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -40,16 +40,23 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Latch.h>
+#include <blaze/util/threadpool/Pause.h>
 #include <blaze/util/threadpool/Task.h>
-#include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
 #include <blaze/util/Types.h>
 
 
@@ -193,6 +200,63 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_stealing Work stealing and batches
+//
+// Every thread of the pool owns a lock-free work-stealing deque. Tasks scheduled by a thread
+// of the pool (for instance nested parallel operations) are pushed to the deque of this thread
+// and are executed in LIFO order by the owning thread, whereas idle threads steal the oldest
+// tasks from the other deques. Tasks scheduled by any other thread are distributed round-robin
+// among the threads of the pool. In contrast to a single, shared task queue, this strategy
+// avoids the contention of all threads on a single lock.
+//
+// In case several tasks belong together, they can be collected in a batch, which is handed to
+// the thread pool at once and which can be awaited independently of any other task:
+
+   \code
+   StdThreadPool threadpool( 4 );
+   StdThreadPool::Batch batch;
+
+   for( int i=0; i<8; ++i ) {
+      batch.add( Functor2(), i, 2*i );
+   }
+
+   // Scheduling all tasks of the batch at once
+   threadpool.submit( batch );
+
+   // Waiting for the completion of the tasks of the batch only
+   threadpool.wait( batch );
+   \endcode
+
+// A batch must not be modified or destroyed before its completion. Afterwards the batch can be
+// cleared and reused without any further dynamic memory allocation. While waiting for a batch,
+// the calling thread takes part in the execution of the scheduled tasks.
+//
+// By default, idle threads go to sleep immediately. Since waking a sleeping thread takes
+// considerably longer than picking up a task by an actively waiting thread, the time idle
+// threads spin before going to sleep can be configured via the setSpinTime() function or the
+// constructor of the thread pool.
+//
+//
+// \section threadpool_affinity Thread affinity
+//
+// The tasks of a batch submitted by a thread outside of the pool are always distributed in the
+// same way: the \a i-th task of the batch is assigned to the \a i-th thread of the pool (modulo
+// the number of threads). Via the setAffinity() function or the constructor of the thread pool
+// the threads can additionally be pinned to specific CPUs, which keeps the data processed by
+// the \a i-th task local to the same core and NUMA node across repeated batches:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   // Pinning the four threads of the pool to the CPUs 0, 8, 16, and 24
+   threadpool.setAffinity( { 0, 8, 16, 24 } );
+   \endcode
+
+// As long as the threads are pinned, a thread waiting for a batch does not take part in the
+// execution of the tasks, since this would move tasks away from their designated thread.
+// Thread pinning is currently only supported on Linux systems.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -319,17 +383,215 @@ class ThreadPool
    //! Type of the thread container.
    using Threads = std::vector< std::unique_ptr<ManagedThread> >;
 
-   using TaskQueue = threadpool::TaskQueue;  //!< Type of the task queue.
-   using Mutex     = MT;                     //!< Type of the mutex.
-   using Lock      = LT;                     //!< Type of a locking object.
-   using Condition = CT;                     //!< Condition variable type.
+   using Mutex     = MT;  //!< Type of the mutex.
+   using Lock      = LT;  //!< Type of a locking object.
+   using Condition = CT;  //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using Latch = threadpool::Latch<MT,LT,CT>;  //!< Type of the completion latch of a batch.
+   //**********************************************************************************************
+
+ private:
+   //**Job struct definition***********************************************************************
+   /*!\brief A single scheduled task together with its bookkeeping information.
+   */
+   struct Job
+   {
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the Job struct.
+      */
+      inline Job()
+         : task  ()           // The task to be executed
+         , latch ( nullptr )  // The completion latch of the surrounding batch
+         , pooled( false )    // Flag for a job recycled by the thread pool
+      {}
+
+      /*!\brief Constructor for the Job struct.
+      //
+      // \param func The callable to be executed.
+      */
+      template< typename Callable >
+      explicit inline Job( Callable&& func )
+         : task  ( std::forward<Callable>( func ) )  // The task to be executed
+         , latch ( nullptr )                         // The completion latch of the batch
+         , pooled( false )                           // Flag for a job recycled by the pool
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      threadpool::Task task;    //!< The task to be executed.
+      Latch*           latch;   //!< The completion latch of the surrounding batch (if any).
+      bool             pooled;  //!< \a true if the job is recycled after its execution.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Slot struct definition**********************************************************************
+   /*!\brief The task containers of a single worker thread.
+   //
+   // Every worker thread owns a lock-free work-stealing deque for its own tasks and an inbox
+   // for the tasks scheduled by threads outside the pool. The inbox is drained into the deque
+   // by the owning worker, from where any idle worker can steal the tasks. Tasks are removed
+   // from the front of the inbox by advancing the index of its first task, the processed tasks
+   // are discarded as soon as they make up at least half of the inbox.
+   */
+   struct Slot
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Slot struct.
+      //
+      // \param p The managing thread pool.
+      // \param i The index of the slot.
+      */
+      explicit inline Slot( ThreadPool* p, size_t i )
+         : pool      ( p )      // The managing thread pool
+         , index     ( i )      // The index of the slot
+         , used      ( false )  // Flag for a slot that is assigned to a running thread
+         , deque     ()         // The work-stealing deque of the owning worker
+         , inboxMutex()         // Synchronization mutex for the inbox
+         , inbox     ()         // Tasks scheduled by threads outside of the thread pool
+         , inboxHead ( 0UL )    // The index of the first task in the inbox
+         , inboxSize ( 0UL )    // The current number of tasks in the inbox
+         , affinity  ( 0UL )    // The version of the affinity applied by the owning worker
+      {}
+      //*******************************************************************************************
+
+      //**Pop function*****************************************************************************
+      /*!\brief Removing the given number of tasks from the front of the inbox.
+      //
+      // \param n The number of tasks to be removed.
+      // \return void
+      //
+      // This function must only be called while holding the inbox mutex. The removal of a task
+      // has an amortized constant complexity and does not release the memory of the inbox.
+      */
+      inline void popInbox( size_t n ) {
+         inboxHead += n;
+         if( 2UL*inboxHead >= inbox.size() ) {
+            inbox.erase( inbox.begin(), inbox.begin()+inboxHead );
+            inboxHead = 0UL;
+         }
+         inboxSize.fetch_sub( n );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      ThreadPool*                          pool;        //!< The managing thread pool.
+      size_t                               index;       //!< The index of the slot.
+      std::atomic<bool>                    used;        //!< The slot is assigned to a thread.
+      threadpool::WorkStealingDeque<Job*>  deque;       //!< The deque of the owning worker.
+      Mutex                                inboxMutex;  //!< Synchronization mutex for the inbox.
+      std::vector<Job*>                    inbox;       //!< Tasks scheduled from outside.
+      size_t                               inboxHead;   //!< Index of the first inbox task.
+      std::atomic<size_t>                  inboxSize;   //!< The current size of the inbox.
+      size_t                               affinity;    //!< The applied affinity version.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Slots = std::vector<Slot*>;  //!< Type of an immutable list of slots.
    //**********************************************************************************************
 
  public:
+   //**Batch class definition**********************************************************************
+   /*!\brief A batch of tasks that is scheduled at once and completed via a latch.
+   //
+   // The Batch class collects a number of tasks, which are handed to the thread pool by a
+   // single call to ThreadPool::submit(). The completion of all tasks of the batch can be
+   // awaited via ThreadPool::wait(Batch&), independent of any other task of the thread pool.
+   // After the completion the batch can be cleared and reused. Since the internal storage is
+   // kept, reusing a batch does not require any further dynamic memory allocation.
+
+      \code
+      StdThreadPool::Batch batch;
+
+      for( int i=0; i<8; ++i ) {
+         batch.add( Functor2(), i, 2*i );
+      }
+
+      threadpool.submit( batch );
+      threadpool.wait( batch );
+      batch.clear();
+      \endcode
+   */
+   class Batch
+      : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the Batch class.
+      */
+      inline Batch()
+         : jobs_     ()         // The tasks of the batch
+         , latch_    ()         // The completion latch of the batch
+         , submitted_( false )  // Flag for a submitted, not yet awaited batch
+      {}
+      //*******************************************************************************************
+
+      //**Get functions****************************************************************************
+      /*!\brief Returns the number of tasks in the batch.
+      //
+      // \return The number of tasks in the batch.
+      */
+      inline size_t size() const noexcept {
+         return jobs_.size();
+      }
+
+      /*!\brief Returns whether the batch is empty.
+      //
+      // \return \a true in case the batch is empty, \a false if not.
+      */
+      inline bool isEmpty() const noexcept {
+         return jobs_.empty();
+      }
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Adding the given function/functor to the batch.
+      //
+      // \param func The given function/functor.
+      // \param args The arguments for the function/functor.
+      // \return void
+      */
+      template< typename Callable, typename... Args >
+      inline void add( Callable func, Args&&... args ) {
+         BLAZE_USER_ASSERT( !submitted_, "Modification of a submitted batch detected" );
+         jobs_.emplace_back( std::bind<void>( func, std::forward<Args>( args )... ) );
+      }
+
+      /*!\brief Removing all tasks from the batch.
+      //
+      // \return void
+      */
+      inline void clear() {
+         BLAZE_USER_ASSERT( !submitted_, "Modification of a submitted batch detected" );
+         jobs_.clear();
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      std::vector<Job> jobs_;       //!< The tasks of the batch.
+      Latch            latch_;      //!< The completion latch of the batch.
+      bool             submitted_;  //!< Flag for a submitted, not yet awaited batch.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      friend class ThreadPool;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, size_t spinTime=0UL,
+                        std::vector<size_t> cpus=std::vector<size_t>() );
    //@}
    //**********************************************************************************************
 
@@ -347,6 +609,9 @@ class ThreadPool
    inline size_t size()    const;
    inline size_t active()  const;
    inline size_t ready()   const;
+   inline size_t spinTime() const;
+
+   inline std::vector<size_t> affinity() const;
    //@}
    //**********************************************************************************************
 
@@ -355,6 +620,8 @@ class ThreadPool
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   void submit( Batch& batch );
    //@}
    //**********************************************************************************************
 
@@ -363,7 +630,10 @@ class ThreadPool
    //@{
    void resize( size_t n, bool block=false );
    void wait();
+   void wait( Batch& batch );
    void clear();
+   void setSpinTime( size_t microseconds );
+   void setAffinity( std::vector<size_t> cpus );
    //@}
    //**********************************************************************************************
 
@@ -376,6 +646,28 @@ class ThreadPool
    //@}
    //**********************************************************************************************
 
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   inline Slot* acquireSlot();
+   inline Job*  findJob( Slot* self );
+   inline Job*  stealJob( Slot* self );
+
+   template< typename Callable >
+   inline Job*  acquireJob( Callable&& func );
+
+   inline void  execute( Job* job );
+   inline void  discard( Job* job );
+   inline void  notify( size_t n );
+   inline void  pin( Slot* self );
+
+   template< typename Predicate >
+   inline bool spin( Predicate predicate ) const;
+
+   static inline Slot*& currentSlot() noexcept;
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -384,8 +676,30 @@ class ThreadPool
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
    volatile size_t active_;    //!< Number of currently active/busy threads.
+   bool shutdown_;             //!< Flag for the destruction of the thread pool.
    Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
+
+   std::vector< std::unique_ptr<Slot> > slotStorage_;  //!< All slots of the thread pool.
+   std::vector< std::unique_ptr<Slots> > slotLists_;   //!< All published lists of slots.
+   std::atomic<const Slots*> slots_;                   //!< The current list of slots.
+   std::vector<Slot*> pendingSlots_;                   //!< Slots of not yet started threads.
+
+   std::atomic<size_t> queued_;       //!< Number of scheduled tasks not yet started.
+   std::atomic<size_t> outstanding_;  //!< Number of scheduled tasks not yet completed.
+   std::atomic<size_t> sleeping_;     //!< Number of idle threads waiting for a task.
+   std::atomic<size_t> waiting_;      //!< Number of threads waiting in wait().
+   std::atomic<size_t> next_;         //!< Rotating start slot for external scheduling.
+   std::atomic<size_t> spinTime_;     //!< Time in microseconds idle threads actively wait.
+   std::atomic<size_t> affinity_;     //!< Version of the current thread affinity.
+   std::atomic<bool>   pinned_;       //!< Flag for threads pinned to specific CPUs.
+
+   std::vector<size_t> cpus_;     //!< The CPUs the threads are pinned to.
+   std::vector<size_t> allCpus_;  //!< The CPUs available to unpinned threads.
+
+   std::vector< std::unique_ptr<Job> > jobStorage_;  //!< All jobs created by schedule().
+   std::vector<Job*> freeJobs_;                      //!< Jobs available for reuse.
+   Mutex jobMutex_;                                  //!< Synchronization mutex for the jobs.
+
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
@@ -413,6 +727,8 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param spinTime The time in microseconds idle threads actively wait for new tasks.
+// \param cpus The CPUs the threads are pinned to (see setAffinity()).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
 // initially idle until a task is scheduled.
@@ -421,16 +737,40 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
-   : total_   ( 0UL )  // Total number of threads in the thread pool
-   , expected_( 0UL )  // Expected number of threads in the thread pool
-   , active_  ( 0UL )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, size_t spinTime, std::vector<size_t> cpus )
+   : total_         ( 0UL )       // Total number of threads in the thread pool
+   , expected_      ( 0UL )       // Expected number of threads in the thread pool
+   , active_        ( 0UL )       // Number of currently active/busy threads
+   , shutdown_      ( false )     // Flag for the destruction of the thread pool
+   , threads_       ()            // The threads contained in the thread pool
+   , slotStorage_   ()            // All slots of the thread pool
+   , slotLists_     ()            // All published lists of slots
+   , slots_         ( nullptr )   // The current list of slots
+   , pendingSlots_  ()            // Slots of not yet started threads
+   , queued_        ( 0UL )       // Number of scheduled tasks not yet started
+   , outstanding_   ( 0UL )       // Number of scheduled tasks not yet completed
+   , sleeping_      ( 0UL )       // Number of idle threads waiting for a task
+   , waiting_       ( 0UL )       // Number of threads waiting in wait()
+   , next_          ( 0UL )       // Rotating start slot for external scheduling
+   , spinTime_      ( spinTime )  // Time in microseconds idle threads actively wait
+   , affinity_      ( 0UL )       // Version of the current thread affinity
+   , pinned_        ( false )     // Flag for threads pinned to specific CPUs
+   , cpus_          ()            // The CPUs the threads are pinned to
+   , allCpus_       ( threadpool::availableCpus() )  // The CPUs available to unpinned threads
+   , jobStorage_    ()            // All jobs created by schedule()
+   , freeJobs_      ()            // Jobs available for reuse
+   , jobMutex_      ()            // Synchronization mutex for the jobs
+   , mutex_         ()            // Synchronization mutex
+   , waitForTask_   ()            // Wait condition for idle threads
+   , waitForThread_ ()            // Wait condition for the thread management
 {
+   slotLists_.emplace_back( new Slots() );
+   slots_.store( slotLists_.back().get(), std::memory_order_release );
+
+   if( !cpus.empty() ) {
+      setAffinity( std::move( cpus ) );
+   }
+
    resize( n );
 }
 //*************************************************************************************************
@@ -447,7 +787,7 @@ ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
 //*************************************************************************************************
 /*!\brief Destructor for the ThreadPool class.
 //
-// The destructor clears all remaining tasks from the task queue and waits for the currently
+// The destructor clears all remaining tasks from the task queues and waits for the currently
 // active threads to complete their tasks.
 */
 template< typename TT    // Type of the encapsulated thread
@@ -456,29 +796,32 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 ThreadPool<TT,MT,LT,CT>::~ThreadPool()
 {
-   Lock lock( mutex_ );
+   {
+      Lock lock( mutex_ );
 
-   // Removing all currently queued tasks
-   taskqueue_.clear();
+      // Setting the expected number of threads
+      shutdown_ = true;
+      expected_ = 0UL;
 
-   // Setting the expected number of threads
-   expected_ = 0UL;
+      // Notifying all idle threads
+      waitForTask_.notify_all();
 
-   // Notifying all idle threads
-   waitForTask_.notify_all();
+      // Waiting for all threads to terminate
+      while( total_ != 0UL ) {
+         waitForThread_.wait( lock );
+      }
 
-   // Waiting for all threads to terminate
-   while( total_ != 0UL ) {
-      waitForThread_.wait( lock );
-   }
+      // Joining all threads
+      for( auto const& thread : threads_ ) {
+         thread->join();
+      }
 
-   // Joining all threads
-   for( auto const& thread : threads_ ) {
-      thread->join();
+      // Destroying all threads
+      threads_.clear();
    }
 
-   // Destroying all threads
-   threads_.clear();
+   // Removing all remaining tasks
+   clear();
 }
 //*************************************************************************************************
 
@@ -502,8 +845,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return queued_.load() == 0UL;
 }
 //*************************************************************************************************
 
@@ -559,6 +901,39 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the time idle threads actively wait for new tasks.
+//
+// \return The spin time in microseconds.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadPool<TT,MT,LT,CT>::spinTime() const
+{
+   return spinTime_.load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs the threads of the pool are pinned to.
+//
+// \return The CPUs of the threads (empty in case the threads are not pinned).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadPool<TT,MT,LT,CT>::affinity() const
+{
+   Lock lock( mutex_ );
+   return cpus_;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -576,7 +951,11 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //
 // This function schedules the given function/functor for execution. The given function/functor
 // must be copyable, must be callable with the given type and number of arguments and must return
-// \c void.
+// \c void. In case the function is called by a thread of the pool, the task is pushed to the
+// work-stealing deque of the calling thread, else it is placed in the inbox of one of the
+// threads of the pool. Small functions/functors are stored without any dynamic memory
+// allocation (see threadpool::Task) and the bookkeeping of the task is recycled, i.e. in the
+// steady state scheduling a task does not allocate memory.
 */
 template< typename TT         // Type of the encapsulated thread
         , typename MT         // Type of the synchronization mutex
@@ -586,9 +965,129 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
-   waitForTask_.notify_one();
+   Job* job( acquireJob( std::bind<void>( func, std::forward<Args>( args )... ) ) );
+
+   outstanding_.fetch_add( 1UL );
+   queued_.fetch_add( 1UL );
+
+   Slot* self( currentSlot() );
+
+   if( self != nullptr && self->pool == this ) {
+      self->deque.push( job );
+   }
+   else
+   {
+      const Slots& slots( *slots_.load( std::memory_order_acquire ) );
+      const size_t n( slots.size() );
+      const size_t start( next_.fetch_add( 1UL, std::memory_order_relaxed ) );
+
+      Slot* target( nullptr );
+      for( size_t i=0UL; i<n; ++i ) {
+         if( slots[(start+i)%n]->used.load( std::memory_order_relaxed ) ) {
+            target = slots[(start+i)%n];
+            break;
+         }
+      }
+
+      if( target == nullptr ) {
+         queued_.fetch_sub( 1UL );
+         execute( job );
+         return;
+      }
+
+      Lock lock( target->inboxMutex );
+      target->inbox.push_back( job );
+      target->inboxSize.fetch_add( 1UL );
+   }
+
+   notify( 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling all tasks of the given batch for execution.
+//
+// \param batch The batch of tasks to be scheduled.
+// \return void
+//
+// This function schedules all tasks of the given batch at once. In case the function is called
+// by a thread of the pool, all tasks are pushed to the work-stealing deque of the calling
+// thread. Otherwise the tasks are distributed round-robin among the inboxes of all threads,
+// which requires a single lock per thread instead of a single lock per task. The distribution
+// always starts with the first thread of the pool, i.e. the \a i-th task of two batches of the
+// same size is assigned to the same thread (see setAffinity()). The completion
+// of the batch can be awaited via wait(Batch&). The batch must not be modified or destroyed
+// before its completion.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::submit( Batch& batch )
+{
+   BLAZE_USER_ASSERT( !batch.submitted_, "Batch has already been submitted" );
+
+   const size_t n( batch.jobs_.size() );
+
+   batch.latch_.reset( n );
+   batch.submitted_ = true;
+
+   if( n == 0UL )
+      return;
+
+   for( Job& job : batch.jobs_ ) {
+      job.latch = &batch.latch_;
+      job.pooled = false;
+   }
+
+   outstanding_.fetch_add( n );
+   queued_.fetch_add( n );
+
+   Slot* self( currentSlot() );
+
+   if( self != nullptr && self->pool == this )
+   {
+      for( size_t i=n; i>0UL; --i ) {
+         self->deque.push( &batch.jobs_[i-1UL] );
+      }
+   }
+   else
+   {
+      const Slots& slots( *slots_.load( std::memory_order_acquire ) );
+
+      size_t targets( 0UL );
+      for( Slot* slot : slots ) {
+         if( slot->used.load( std::memory_order_relaxed ) ) ++targets;
+      }
+
+      if( targets == 0UL ) {
+         queued_.fetch_sub( n );
+         for( Job& job : batch.jobs_ ) {
+            execute( &job );
+         }
+         return;
+      }
+
+      size_t target( 0UL );
+      for( size_t i=0UL; i<slots.size() && target<n; ++i )
+      {
+         Slot* slot( slots[i] );
+
+         if( !slot->used.load( std::memory_order_relaxed ) )
+            continue;
+
+         Lock lock( slot->inboxMutex );
+         size_t count( 0UL );
+         for( size_t j=target; j<n; j+=targets, ++count ) {
+            slot->inbox.push_back( &batch.jobs_[j] );
+         }
+         slot->inboxSize.fetch_add( count );
+         ++target;
+      }
+   }
+
+   notify( n );
 }
 //*************************************************************************************************
 
@@ -702,9 +1201,70 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 {
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
+   waiting_.fetch_add( 1UL );
+
+   while( outstanding_.load() > 0UL ) {
       waitForThread_.wait( lock );
    }
+
+   waiting_.fetch_sub( 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the given batch to be completed.
+//
+// \param batch The submitted batch of tasks.
+// \return void
+//
+// This function blocks until all tasks of the given batch have been completed. In contrast to
+// wait() it does not wait for any other task of the thread pool. Afterwards the batch can be
+// cleared, reused, or destroyed.
+//
+// Instead of blocking right away, the calling thread takes part in the execution of scheduled
+// tasks. Only if no task is available, it actively waits for the completion of the batch for
+// the given spin time (see setSpinTime()) and afterwards goes to sleep. In case the threads of
+// the pool are pinned to specific CPUs (see setAffinity()), a thread outside of the pool does
+// not execute any tasks in order to keep all tasks on their designated threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::wait( Batch& batch )
+{
+   Latch& latch( batch.latch_ );
+
+   Slot* self( currentSlot() );
+   if( self != nullptr && self->pool != this ) {
+      self = nullptr;
+   }
+
+   const bool help( self != nullptr || !pinned_.load( std::memory_order_relaxed ) );
+
+   while( latch.count() > 0UL )
+   {
+      Job* job( !help ? nullptr : self != nullptr ? findJob( self ) : stealJob( nullptr ) );
+
+      if( job != nullptr ) {
+         queued_.fetch_sub( 1UL );
+         execute( job );
+         continue;
+      }
+
+      // A thread that does not take part in the execution of tasks only waits for the batch
+      const auto available = [this,&latch,help]() {
+         return latch.count() == 0UL ||
+                ( help && queued_.load( std::memory_order_relaxed ) > 0UL );
+      };
+
+      if( !spin( available ) )
+         break;
+   }
+
+   latch.wait();
+   batch.submitted_ = false;
 }
 //*************************************************************************************************
 
@@ -715,16 +1275,92 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 // \return void
 //
 // This function removes all currently scheduled tasks from the thread pool. The total number
-// of threads remains unchanged and all active threads continue completing their tasks.
+// of threads remains unchanged and all active threads continue completing their tasks. Tasks
+// belonging to a batch are counted as completed, i.e. a thread waiting for the batch resumes.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::clear()
+{
+   const Slots& slots( *slots_.load( std::memory_order_acquire ) );
+
+   for( Slot* slot : slots )
+   {
+      while( !slot->deque.isEmpty() ) {
+         if( Job* job = slot->deque.steal() ) {
+            queued_.fetch_sub( 1UL );
+            discard( job );
+         }
+      }
+
+      std::vector<Job*> inbox;
+      size_t head( 0UL );
+      {
+         Lock lock( slot->inboxMutex );
+         inbox.swap( slot->inbox );
+         head = slot->inboxHead;
+         slot->inboxHead = 0UL;
+         slot->inboxSize.store( 0UL );
+      }
+
+      for( size_t i=head; i<inbox.size(); ++i ) {
+         queued_.fetch_sub( 1UL );
+         discard( inbox[i] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the time idle threads actively wait for new tasks.
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// This function sets the time an idle thread of the pool actively waits for new tasks before
+// it goes to sleep. Waking a sleeping thread requires a system call and takes considerably
+// longer than picking up a task by an actively waiting thread. The same time is used by a
+// thread waiting for the completion of a batch. A spin time of 0 (the default) puts idle
+// threads to sleep immediately.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setSpinTime( size_t microseconds )
+{
+   spinTime_.store( microseconds, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pinning the threads of the pool to the given CPUs.
+//
+// \param cpus The CPUs the threads are pinned to (empty to unpin the threads).
+// \return void
+//
+// This function pins the \a i-th thread of the pool to the CPU \a cpus[i % cpus.size()]. In
+// combination with the fixed assignment of the tasks of a batch to the threads of the pool
+// this keeps the data of repeated operations local to the same core and NUMA node. The threads
+// apply the new affinity before they execute their next task. An empty list of CPUs unpins
+// the threads. Thread pinning is currently only supported on Linux systems; on all other
+// systems the CPUs are stored, but the threads are not pinned.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setAffinity( std::vector<size_t> cpus )
 {
    Lock lock( mutex_ );
-   taskqueue_.clear();
+
+   cpus_.swap( cpus );
+   pinned_.store( !cpus_.empty() );
+   affinity_.fetch_add( 1UL, std::memory_order_release );
 }
 //*************************************************************************************************
 
@@ -741,6 +1377,10 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// This function assigns a free slot to the new thread, or creates a new slot in case all
+// existing slots are in use. The slot is registered before the thread is started, such that
+// tasks can be scheduled for the thread right away.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -748,6 +1388,28 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
+   Slot* slot( nullptr );
+
+   for( auto const& s : slotStorage_ ) {
+      if( !s->used.load() ) {
+         slot = s.get();
+         break;
+      }
+   }
+
+   if( slot == nullptr )
+   {
+      slotStorage_.emplace_back( new Slot( this, slotStorage_.size() ) );
+      slot = slotStorage_.back().get();
+
+      slotLists_.emplace_back( new Slots( *slots_.load( std::memory_order_relaxed ) ) );
+      slotLists_.back()->push_back( slot );
+      slots_.store( slotLists_.back().get(), std::memory_order_release );
+   }
+
+   slot->used.store( true );
+   pendingSlots_.push_back( slot );
+
    threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
    ++total_;
    ++expected_;
@@ -762,8 +1424,10 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// The thread first takes tasks from its own work-stealing deque and its inbox. In case both
+// are empty, it tries to steal a task from any other thread of the pool. In case there is no
+// task available at all, the thread actively waits for the given spin time (see setSpinTime())
+// and afterwards blocks and waits for a new task to be scheduled.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -771,34 +1435,381 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 bool ThreadPool<TT,MT,LT,CT>::executeTask()
 {
-   threadpool::Task task;
+   Slot*& self( currentSlot() );
+
+   if( self == nullptr ) {
+      self = acquireSlot();
+   }
+
+   // Applying a changed thread affinity
+   if( self->affinity != affinity_.load( std::memory_order_acquire ) ) {
+      pin( self );
+   }
+
+   // Acquiring and executing a scheduled task
+   if( Job* job = findJob( self ) ) {
+      queued_.fetch_sub( 1UL );
+      execute( job );
+      return true;
+   }
+
+   // Actively waiting for a new task
+   if( spin( [this]() { return queued_.load( std::memory_order_relaxed ) > 0UL; } ) ) {
+      return true;
+   }
+
+   // Waiting for a new task
+   Lock lock( mutex_ );
+
+   if( shutdown_ ||
+       ( total_ > expected_ && self->deque.isEmpty() && self->inboxSize.load() == 0UL ) ) {
+      self->used.store( false );
+      self = nullptr;
+      --total_;
+      --active_;
+      waitForThread_.notify_all();
+      return false;
+   }
+
+   sleeping_.fetch_add( 1UL );
+
+   if( queued_.load() == 0UL ) {
+      --active_;
+      waitForTask_.wait( lock );
+      ++active_;
+   }
+
+   sleeping_.fetch_sub( 1UL );
+
+   return true;
+}
+//*************************************************************************************************
+
+
 
-   // Acquiring a scheduled task
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assigning one of the registered slots to the calling thread.
+//
+// \return The assigned slot.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadPool<TT,MT,LT,CT>::Slot* ThreadPool<TT,MT,LT,CT>::acquireSlot()
+{
+   Lock lock( mutex_ );
+
+   BLAZE_INTERNAL_ASSERT( !pendingSlots_.empty(), "No registered slot detected" );
+
+   Slot* slot( pendingSlots_.back() );
+   pendingSlots_.pop_back();
+   slot->affinity = 0UL;
+   return slot;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searching a scheduled task for the given slot.
+//
+// \param self The slot of the calling thread.
+// \return The acquired task, or \a nullptr in case no task is available.
+//
+// This function first pops a task from the deque of the calling thread. In case the deque is
+// empty, the inbox of the calling thread is moved to its deque. In order to avoid a growth of
+// the deque, at most as many tasks as fit into the current buffer of the deque are moved.
+// Finally the function tries to steal a task from the deques and inboxes of all other threads,
+// starting with the neighbour of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadPool<TT,MT,LT,CT>::Job* ThreadPool<TT,MT,LT,CT>::findJob( Slot* self )
+{
+   if( Job* job = self->deque.pop() ) {
+      return job;
+   }
+
+   if( self->inboxSize.load( std::memory_order_relaxed ) > 0UL )
    {
-      Lock lock( mutex_ );
+      Lock lock( self->inboxMutex );
 
-      while( taskqueue_.isEmpty() )
-      {
-         --active_;
-         waitForThread_.notify_all();
+      const size_t head( self->inboxHead );
+      const size_t n( min( self->inbox.size()-head, self->deque.capacity() ) );
 
-         if( total_ > expected_ ) {
-            --total_;
-            return false;
-         }
+      for( size_t i=n; i>0UL; --i ) {
+         self->deque.push( self->inbox[head+i-1UL] );
+      }
 
-         waitForTask_.wait( lock );
-         ++active_;
+      self->popInbox( n );
+   }
+
+   if( Job* job = self->deque.pop() ) {
+      return job;
+   }
+
+   return stealJob( self );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing a scheduled task from the threads of the pool.
+//
+// \param self The slot of the calling thread (\a nullptr for threads outside of the pool).
+// \return The stolen task, or \a nullptr in case no task is available.
+//
+// This function tries to steal a task from the deques and inboxes of all threads except the
+// calling thread, starting with the neighbour of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadPool<TT,MT,LT,CT>::Job* ThreadPool<TT,MT,LT,CT>::stealJob( Slot* self )
+{
+   const Slots& slots( *slots_.load( std::memory_order_acquire ) );
+   const size_t n( slots.size() );
+   const size_t first( self != nullptr ? self->index+1UL : 0UL );
+   const size_t count( self != nullptr ? n-1UL : n );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      Slot* other( slots[(first+i)%n] );
+      if( Job* job = other->deque.steal() ) {
+         return job;
       }
+   }
+
+   for( size_t i=0UL; i<count; ++i )
+   {
+      Slot* other( slots[(first+i)%n] );
+
+      if( other->inboxSize.load( std::memory_order_relaxed ) == 0UL )
+         continue;
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+      Lock lock( other->inboxMutex );
+
+      if( other->inboxHead < other->inbox.size() ) {
+         Job* job( other->inbox[other->inboxHead] );
+         other->popInbox( 1UL );
+         return job;
+      }
    }
 
-   // Executing the task
-   task();
+   return nullptr;
+}
+//*************************************************************************************************
 
-   return true;
+
+//*************************************************************************************************
+/*!\brief Acquiring a job for the given callable.
+//
+// \param func The callable to be executed.
+// \return The acquired job.
+//
+// This function reuses a previously completed job in case one is available. Only if all jobs
+// are currently in use, a new job is created.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the callable
+inline typename ThreadPool<TT,MT,LT,CT>::Job*
+   ThreadPool<TT,MT,LT,CT>::acquireJob( Callable&& func )
+{
+   Job* job( nullptr );
+
+   {
+      Lock lock( jobMutex_ );
+
+      if( freeJobs_.empty() ) {
+         jobStorage_.emplace_back( new Job() );
+         job = jobStorage_.back().get();
+      }
+      else {
+         job = freeJobs_.back();
+         freeJobs_.pop_back();
+      }
+   }
+
+   job->task   = threadpool::Task( std::forward<Callable>( func ) );
+   job->latch  = nullptr;
+   job->pooled = true;
+
+   return job;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the given task.
+//
+// \param job The task to be executed.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadPool<TT,MT,LT,CT>::execute( Job* job )
+{
+   job->task();
+   discard( job );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marking the given task as completed.
+//
+// \param job The completed (or removed) task.
+// \return void
+//
+// This function recycles the given task and signals its completion to the surrounding batch
+// and to all threads waiting for the completion of all tasks. Note that the task must not be
+// accessed after the completion has been signaled to the batch.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadPool<TT,MT,LT,CT>::discard( Job* job )
+{
+   Latch* latch( job->latch );
+
+   if( job->pooled ) {
+      job->task = threadpool::Task();
+      Lock lock( jobMutex_ );
+      freeJobs_.push_back( job );
+   }
+
+   if( latch != nullptr ) {
+      latch->countDown();
+   }
+
+   if( outstanding_.fetch_sub( 1UL ) == 1UL && waiting_.load() > 0UL ) {
+      Lock lock( mutex_ );
+      waitForThread_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waking up idle threads for the given number of new tasks.
+//
+// \param n The number of new tasks.
+// \return void
+//
+// The mutex is only acquired in case any thread is actually waiting for a task.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadPool<TT,MT,LT,CT>::notify( size_t n )
+{
+   if( sleeping_.load() == 0UL )
+      return;
+
+   Lock lock( mutex_ );
+
+   if( n == 1UL ) waitForTask_.notify_one();
+   else waitForTask_.notify_all();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applying the current thread affinity to the calling thread.
+//
+// \param self The slot of the calling thread.
+// \return void
+//
+// This function pins the calling thread to the CPU associated with its slot. In case the
+// threads of the pool are not pinned, the calling thread is allowed to run on all available
+// CPUs again. Threads that have never been pinned are not affected.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadPool<TT,MT,LT,CT>::pin( Slot* self )
+{
+   Lock lock( mutex_ );
+
+   const bool pinned( self->affinity != 0UL );
+
+   self->affinity = affinity_.load( std::memory_order_relaxed );
+
+   if( !cpus_.empty() ) {
+      threadpool::pinThread( cpus_[self->index % cpus_.size()] );
+   }
+   else if( pinned ) {
+      threadpool::unpinThread( allCpus_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Actively waiting until the given predicate is fulfilled.
+//
+// \param predicate The predicate to be fulfilled.
+// \return \a true if the predicate is fulfilled, \a false if the spin time has elapsed.
+*/
+template< typename TT           // Type of the encapsulated thread
+        , typename MT           // Type of the synchronization mutex
+        , typename LT           // Type of the mutex lock
+        , typename CT >         // Type of the condition variable
+template< typename Predicate >  // Type of the predicate
+inline bool ThreadPool<TT,MT,LT,CT>::spin( Predicate predicate ) const
+{
+   using Clock = std::chrono::steady_clock;
+
+   const size_t duration( spinTime_.load( std::memory_order_relaxed ) );
+
+   if( duration == 0UL )
+      return predicate();
+
+   const Clock::time_point end( Clock::now() + std::chrono::microseconds( duration ) );
+
+   do {
+      for( size_t i=0UL; i<64UL; ++i ) {
+         if( predicate() ) return true;
+         threadpool::pause();
+      }
+   }
+   while( Clock::now() < end );
+
+   return predicate();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the slot of the calling thread.
+//
+// \return Reference to the slot of the calling thread (\a nullptr for non-pool threads).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadPool<TT,MT,LT,CT>::Slot*& ThreadPool<TT,MT,LT,CT>::currentSlot() noexcept
+{
+   static thread_local Slot* slot( nullptr );
+   return slot;
 }
 //*************************************************************************************************
 
@@ -0,0 +1,397 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Header file for the thread affinity functionality of the thread pool
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+#include <cctype>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CPU LIST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parsing a list of CPUs in the Linux list format.
+// \ingroup threads
+//
+// \param list The list of CPUs (e.g. "0-3,8,10-11").
+// \param cpus The resulting CPU numbers.
+// \return \a true in case the list could be parsed, \a false if not.
+//
+// This function parses a comma-separated list of CPU numbers and CPU ranges as used by the
+// \c taskset command and the Linux \c sysfs file system. Trailing whitespace is ignored. In
+// case the list cannot be parsed, \a cpus is not modified.
+*/
+inline bool parseCpuList( const std::string& list, std::vector<size_t>& cpus )
+{
+   const auto isDigit = []( char c ) { return std::isdigit( static_cast<unsigned char>( c ) ); };
+
+   const std::string::size_type end( list.find_last_not_of( " \t\r\n" ) );
+
+   if( end == std::string::npos )
+      return false;
+
+   std::vector<size_t> result;
+   size_t pos( 0UL );
+
+   const auto parseNumber = [&]( size_t& number ) -> bool
+   {
+      if( pos > end || !isDigit( list[pos] ) )
+         return false;
+
+      number = 0UL;
+      while( pos <= end && isDigit( list[pos] ) ) {
+         number = 10UL*number + static_cast<size_t>( list[pos] - '0' );
+         ++pos;
+      }
+      return true;
+   };
+
+   while( true )
+   {
+      size_t first( 0UL );
+      size_t last ( 0UL );
+
+      if( !parseNumber( first ) )
+         return false;
+
+      last = first;
+
+      if( pos <= end && list[pos] == '-' ) {
+         ++pos;
+         if( !parseNumber( last ) || last < first )
+            return false;
+      }
+
+      for( size_t cpu=first; cpu<=last; ++cpu ) {
+         result.push_back( cpu );
+      }
+
+      if( pos > end )
+         break;
+
+      if( list[pos] != ',' )
+         return false;
+
+      ++pos;
+   }
+
+   cpus.swap( result );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs the calling process is allowed to run on.
+// \ingroup threads
+//
+// \return The CPU numbers in ascending order.
+//
+// On Linux systems this function returns the CPUs of the affinity mask of the calling thread,
+// which respects restrictions imposed via \c taskset or control groups. On all other systems
+// it returns the CPUs \f$[0..N)\f$, where \f$ N \f$ is the number of hardware threads.
+*/
+inline std::vector<size_t> availableCpus()
+{
+   std::vector<size_t> cpus;
+
+#if defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+      for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+         if( CPU_ISSET( cpu, &set ) )
+            cpus.push_back( cpu );
+      }
+   }
+#endif
+
+   if( cpus.empty() ) {
+      const size_t n( std::thread::hardware_concurrency() );
+      for( size_t cpu=0UL; cpu<n; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the available CPUs grouped by NUMA nodes.
+// \ingroup threads
+//
+// \return The available CPUs of all NUMA nodes.
+//
+// On Linux systems this function determines the NUMA topology via the \c sysfs file system.
+// Only NUMA nodes that contain at least one available CPU (see availableCpus()) are returned.
+// In case the topology cannot be determined, a single node containing all available CPUs is
+// returned.
+*/
+inline std::vector< std::vector<size_t> > numaNodes()
+{
+   const std::vector<size_t> available( availableCpus() );
+   std::vector< std::vector<size_t> > nodes;
+
+#if defined(__linux__)
+   const std::string sysfs( "/sys/devices/system/node/" );
+
+   std::string line;
+   std::vector<size_t> ids;
+
+   std::ifstream online( sysfs + "online" );
+
+   if( std::getline( online, line ) && parseCpuList( line, ids ) )
+   {
+      for( size_t id : ids )
+      {
+         std::ifstream file( sysfs + "node" + std::to_string( id ) + "/cpulist" );
+         std::vector<size_t> cpus;
+         std::vector<size_t> node;
+
+         if( !std::getline( file, line ) || !parseCpuList( line, cpus ) )
+            continue;
+
+         for( size_t cpu : cpus ) {
+            for( size_t a : available ) {
+               if( a == cpu ) {
+                  node.push_back( cpu );
+                  break;
+               }
+            }
+         }
+
+         if( !node.empty() )
+            nodes.push_back( node );
+      }
+   }
+#endif
+
+   if( nodes.empty() ) {
+      nodes.push_back( available );
+   }
+
+   return nodes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the available CPUs in compact order.
+// \ingroup threads
+//
+// \return The available CPUs, NUMA node by NUMA node.
+//
+// Threads pinned to consecutive CPUs of the returned list fill one NUMA node before the next
+// NUMA node is used.
+*/
+inline std::vector<size_t> compactCpus()
+{
+   std::vector<size_t> cpus;
+
+   for( const std::vector<size_t>& node : numaNodes() ) {
+      cpus.insert( cpus.end(), node.begin(), node.end() );
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the available CPUs in spread order.
+// \ingroup threads
+//
+// \return The available CPUs, alternating between the NUMA nodes.
+//
+// Threads pinned to consecutive CPUs of the returned list are distributed round-robin across
+// all NUMA nodes, which maximizes the available memory bandwidth for small numbers of threads.
+*/
+inline std::vector<size_t> spreadCpus()
+{
+   const std::vector< std::vector<size_t> > nodes( numaNodes() );
+   std::vector<size_t> cpus;
+
+   for( size_t i=0UL, added=1UL; added>0UL; ++i )
+   {
+      added = 0UL;
+
+      for( const std::vector<size_t>& node : nodes ) {
+         if( i < node.size() ) {
+            cpus.push_back( node[i] );
+            ++added;
+         }
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Translating an affinity specification into a list of CPUs.
+// \ingroup threads
+//
+// \param spec The affinity specification.
+// \param cpus The resulting list of CPUs (empty in case the threads should not be pinned).
+// \return \a true in case the specification is valid, \a false if not.
+//
+// The following affinity specifications are supported:
+//
+//  - \c "none" (or an empty string): The threads are not pinned.
+//  - \c "compact": The threads are pinned to the CPUs in the order of compactCpus().
+//  - \c "spread": The threads are pinned to the CPUs in the order of spreadCpus().
+//  - A list of CPUs in the format of parseCpuList() (e.g. "0-7,16-23").
+//
+// The \a i-th thread of a thread pool is pinned to the CPU \f$ i \bmod N \f$ of the resulting
+// list of \f$ N \f$ CPUs. In case the specification is invalid, \a cpus is not modified.
+*/
+inline bool parseAffinity( const std::string& spec, std::vector<size_t>& cpus )
+{
+   if( spec.empty() || spec == "none" ) {
+      cpus.clear();
+      return true;
+   }
+   else if( spec == "compact" ) {
+      cpus = compactCpus();
+      return true;
+   }
+   else if( spec == "spread" ) {
+      cpus = spreadCpus();
+      return true;
+   }
+   else {
+      return parseCpuList( spec, cpus );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PINNING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pinning the calling thread to the given CPU.
+// \ingroup threads
+//
+// \param cpu The CPU the calling thread is restricted to.
+// \return \a true in case the thread has been pinned, \a false if not.
+//
+// Thread pinning is currently only supported on Linux systems. On all other systems the
+// function has no effect and returns \a false.
+*/
+inline bool pinThread( size_t cpu ) noexcept
+{
+#if defined(__linux__)
+   if( cpu >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+
+   return sched_setaffinity( 0, sizeof( set ), &set ) == 0;
+#else
+   MAYBE_UNUSED( cpu );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allowing the calling thread to run on all given CPUs.
+// \ingroup threads
+//
+// \param cpus The CPUs the calling thread is allowed to run on.
+// \return \a true in case the affinity has been changed, \a false if not.
+//
+// This function reverts the effect of pinThread(). Thread pinning is currently only supported
+// on Linux systems. On all other systems the function has no effect and returns \a false.
+*/
+inline bool unpinThread( const std::vector<size_t>& cpus ) noexcept
+{
+#if defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   for( size_t cpu : cpus ) {
+      if( cpu < CPU_SETSIZE )
+         CPU_SET( cpu, &set );
+   }
+
+   return sched_setaffinity( 0, sizeof( set ), &set ) == 0;
+#else
+   MAYBE_UNUSED( cpus );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,258 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Latch.h
+//  \brief Completion latch for the thread pool
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_LATCH_H_
+#define _BLAZE_UTIL_THREADPOOL_LATCH_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Single-use completion latch for a batch of tasks.
+// \ingroup threads
+//
+// The Latch class template represents a countdown latch that allows a thread to wait for the
+// completion of a specific set of tasks, independent of any other task executed by the thread
+// pool. The latch is armed with the number of tasks via reset(). Every completed task calls
+// countDown(), which is a single atomic decrement. Only the task completing last acquires the
+// mutex in order to wake up the waiting thread. Via the three template parameters the latch
+// uses the same synchronization primitives as the managing thread pool:
+//
+//  - MT: specifies the type of the used synchronization mutex.
+//  - LT: specifies the type of lock used in combination with the given mutex type.
+//  - CT: specifies the type of the used condition variable.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class Latch
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Latch( size_t count = 0UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t count()   const noexcept;
+   inline bool   isReady() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void reset( size_t count );
+   inline void countDown();
+   inline void wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> count_;  //!< The number of outstanding tasks.
+   bool ready_;                 //!< Completion flag, protected by the mutex.
+   mutable MT mutex_;           //!< Synchronization mutex.
+   CT condition_;               //!< Wait condition for the completion of all tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Latch class.
+//
+// \param count The initial number of outstanding tasks.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline Latch<MT,LT,CT>::Latch( size_t count )
+   : count_    ( count )         // The number of outstanding tasks
+   , ready_    ( count == 0UL )  // Completion flag, protected by the mutex
+   , mutex_    ()                // Synchronization mutex
+   , condition_()                // Wait condition for the completion of all tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of outstanding tasks.
+//
+// \return The number of outstanding tasks.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t Latch<MT,LT,CT>::count() const noexcept
+{
+   return count_.load( std::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all tasks have been completed.
+//
+// \return \a true in case all tasks have been completed, \a false otherwise.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool Latch<MT,LT,CT>::isReady() const
+{
+   LT lock( mutex_ );
+   return ready_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Arming the latch with the given number of outstanding tasks.
+//
+// \param count The number of outstanding tasks.
+// \return void
+//
+// This function must not be called while any task of a previous use is still outstanding.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void Latch<MT,LT,CT>::reset( size_t count )
+{
+   LT lock( mutex_ );
+   count_.store( count, std::memory_order_release );
+   ready_ = ( count == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Signaling the completion of a single task.
+//
+// \return void
+//
+// Note that the latch may be destroyed by the waiting thread as soon as the last call to this
+// function returns. Therefore the completion flag is set while holding the mutex, after which
+// the latch is not accessed anymore.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void Latch<MT,LT,CT>::countDown()
+{
+   if( count_.fetch_sub( 1UL, std::memory_order_acq_rel ) == 1UL ) {
+      LT lock( mutex_ );
+      ready_ = true;
+      condition_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks to be completed.
+//
+// \return void
+//
+// This function blocks until countDown() has been called for every outstanding task.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void Latch<MT,LT,CT>::wait()
+{
+   LT lock( mutex_ );
+
+   while( !ready_ ) {
+      condition_.wait( lock );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -1,7 +1,7 @@
 //=================================================================================================
 /*!
 //  \file blaze/util/threadpool/Task.h
-//  \brief Header file for the Task base class
+//  \brief Header file for the Task class
 //
 //  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
 //
@@ -32,6 +32,7 @@
 */
 //=================================================================================================
 
+
 #ifndef _BLAZE_UTIL_THREADPOOL_TASK_H_
 #define _BLAZE_UTIL_THREADPOOL_TASK_H_
 
@@ -40,7 +41,17 @@
 // Includes
 //*************************************************************************************************
 
-#include <functional>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -49,15 +60,439 @@ namespace threadpool {
 
 //=================================================================================================
 //
-//  TYPE DEFINITIONS
+//  CLASS DEFINITION
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*!\brief Handle for a single, executable task.
 // \ingroup threads
+//
+// The Task class represents a type-erased, move-only handle for a callable without arguments.
+// In contrast to \c std::function, callables up to a size of \a capacity bytes are stored in
+// an internal buffer of the task, i.e. creating, moving, and destroying such a task does not
+// require any dynamic memory allocation. The internal buffer is aligned to \a alignment bytes,
+// which covers all SIMD types (and therefore all callables referring to SIMD-aligned operands).
+// Only larger or stronger aligned callables (or callables that cannot be moved without throwing)
+// are allocated on the heap, in which case their alignment is respected as well.
+
+   \code
+   using blaze::threadpool::Task;
+
+   Task task( [](){ std::cout << "Hello world!\n"; } );
+
+   if( task.isInline() )  // No dynamic memory has been allocated
+      task();             // Executes the stored callable
+   \endcode
+*/
+class Task
+{
+ public:
+   //**Constants***********************************************************************************
+   //! Size of the internal buffer for callables in bytes.
+   static constexpr size_t capacity = 256UL;
+
+   //! Alignment of the internal buffer for callables in bytes.
+   static constexpr size_t alignment = 64UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline Task() noexcept;
+
+   template< typename Callable
+           , typename = DisableIf_t< IsSame_v< Decay_t<Callable>, Task > > >
+   inline Task( Callable&& func );
+
+   inline Task( Task&& task ) noexcept;
+
+   Task( const Task& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Task();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline Task& operator=( Task&& task ) noexcept;
+
+   Task& operator=( const Task& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   inline void operator()();
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline explicit operator bool() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isInline() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Table struct definition*********************************************************************
+   /*!\brief Function table for the management of a stored callable.
+   */
+   struct Table
+   {
+      void (*invoke) ( void* storage );         //!< Invokes the stored callable.
+      void (*move)   ( void* to, void* from );  //!< Moves the callable to another buffer.
+      void (*destroy)( void* storage );         //!< Destroys the stored callable.
+      bool inlined;                             //!< The callable is stored internally.
+   };
+   //**********************************************************************************************
+
+   //**Inline struct definition********************************************************************
+   /*!\brief Management of a callable stored in the internal buffer.
+   */
+   template< typename F >  // Type of the callable
+   struct Inline
+   {
+      static void invoke( void* storage ) {
+         (*static_cast<F*>( storage ))();
+      }
+
+      static void move( void* to, void* from ) {
+         ::new( to ) F( std::move( *static_cast<F*>( from ) ) );
+         static_cast<F*>( from )->~F();
+      }
+
+      static void destroy( void* storage ) {
+         static_cast<F*>( storage )->~F();
+      }
+
+      static const Table* table() noexcept {
+         static const Table t = { &invoke, &move, &destroy, true };
+         return &t;
+      }
+   };
+   //**********************************************************************************************
+
+   //**Heap struct definition**********************************************************************
+   /*!\brief Management of a dynamically allocated callable.
+   */
+   template< typename F >  // Type of the callable
+   struct Heap
+   {
+      static void invoke( void* storage ) {
+         (**static_cast<F**>( storage ))();
+      }
+
+      static void move( void* to, void* from ) {
+         ::new( to ) F*( *static_cast<F**>( from ) );
+      }
+
+      static void destroy( void* storage ) {
+         F* const ptr( *static_cast<F**>( storage ) );
+         ptr->~F();
+         deallocate_backend( ptr );
+      }
+
+      static const Table* table() noexcept {
+         static const Table t = { &invoke, &move, &destroy, false };
+         return &t;
+      }
+   };
+   //**********************************************************************************************
+
+   //**Type trait IsInlineStorable*****************************************************************
+   /*!\brief Evaluates whether the given callable is stored in the internal buffer.
+   */
+   template< typename F >  // Type of the callable
+   using IsInlineStorable =
+      BoolConstant< sizeof(F) <= capacity &&
+                    alignof(F) <= alignment &&
+                    std::is_nothrow_move_constructible<F>::value >;
+   //**********************************************************************************************
+
+   //**Construction functions**********************************************************************
+   /*!\name Construction functions */
+   //@{
+   template< typename Callable >
+   inline void construct( Callable&& func, TrueType );
+
+   template< typename Callable >
+   inline void construct( Callable&& func, FalseType );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void* buffer() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   //! Buffer for the callable (including the space for its alignment).
+   alignas( std::max_align_t ) unsigned char storage_[capacity+alignment];
+   const Table* table_;  //!< Function table for the stored callable (\a nullptr if empty).
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the Task class.
+//
+// The default constructor creates an empty task.
+*/
+inline Task::Task() noexcept
+   : table_( nullptr )  // Function table for the stored callable
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the Task class.
+//
+// \param func The callable to be stored.
+//
+// This constructor stores the given callable, which must be callable without arguments. In case
+// the callable fits into the internal buffer, no dynamic memory allocation is performed.
+*/
+template< typename Callable  // Type of the callable
+        , typename >         // Type restriction
+inline Task::Task( Callable&& func )
+   : table_( nullptr )  // Function table for the stored callable
+{
+   construct( std::forward<Callable>( func ), IsInlineStorable< Decay_t<Callable> >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for the Task class.
+//
+// \param task The task to be moved into this instance.
+*/
+inline Task::Task( Task&& task ) noexcept
+   : table_( task.table_ )  // Function table for the stored callable
+{
+   if( table_ != nullptr ) {
+      table_->move( buffer(), task.buffer() );
+      task.table_ = nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for the Task class.
+*/
+inline Task::~Task()
+{
+   if( table_ != nullptr ) {
+      table_->destroy( buffer() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for the Task class.
+//
+// \param task The task to be moved into this instance.
+// \return Reference to the assigned task.
+*/
+inline Task& Task::operator=( Task&& task ) noexcept
+{
+   if( &task == this )
+      return *this;
+
+   if( table_ != nullptr ) {
+      table_->destroy( buffer() );
+   }
+
+   table_ = task.table_;
+
+   if( table_ != nullptr ) {
+      table_->move( buffer(), task.buffer() );
+      task.table_ = nullptr;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Executes the stored callable.
+//
+// \return void
+*/
+inline void Task::operator()()
+{
+   BLAZE_USER_ASSERT( table_ != nullptr, "Execution of an empty task" );
+
+   table_->invoke( buffer() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the task stores a callable.
+//
+// \return \a true if the task stores a callable, \a false if the task is empty.
+*/
+inline Task::operator bool() const noexcept
+{
+   return table_ != nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the callable is stored in the internal buffer of the task.
+//
+// \return \a true if no dynamic memory has been allocated for the callable, \a false if not.
+*/
+inline bool Task::isInline() const noexcept
+{
+   return table_ == nullptr || table_->inlined;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the properly aligned address of the callable within the internal buffer.
+//
+// \return Pointer to the first \a alignment byte aligned address in the internal buffer.
+//
+// Since the task itself is only aligned to the alignment of \c std::max_align_t (which allows
+// its use in standard containers and in combination with \c new prior to C++17), the callable
+// is placed at the first suitably aligned address within the (accordingly enlarged) buffer.
 */
-using Task = std::function<void(void)>;
+inline void* Task::buffer() noexcept
+{
+   const size_t address( reinterpret_cast<size_t>( storage_ ) );
+   return storage_ + ( ( alignment - ( address % alignment ) ) % alignment );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores the given callable in the internal buffer.
+//
+// \param func The callable to be stored.
+// \return void
+*/
+template< typename Callable >  // Type of the callable
+inline void Task::construct( Callable&& func, TrueType )
+{
+   using F = Decay_t<Callable>;
+
+   ::new( buffer() ) F( std::forward<Callable>( func ) );
+   table_ = Inline<F>::table();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given callable in dynamically allocated memory.
+//
+// \param func The callable to be stored.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// The memory for the callable is allocated with respect to the alignment of the callable, which
+// is not guaranteed by \c new for over-aligned types prior to C++17.
+*/
+template< typename Callable >  // Type of the callable
+inline void Task::construct( Callable&& func, FalseType )
+{
+   using F = Decay_t<Callable>;
+
+   byte_t* const raw( allocate_backend( sizeof(F), alignof(F) ) );
+
+   try {
+      ::new( buffer() ) F*( ::new( raw ) F( std::forward<Callable>( func ) ) );
+   }
+   catch( ... ) {
+      deallocate_backend( raw );
+      throw;
+   }
+
+   table_ = Heap<F>::table();
+}
 //*************************************************************************************************
 
 } // namespace threadpool
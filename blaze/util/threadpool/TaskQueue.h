@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <deque>
+#include <utility>
 #include <blaze/util/threadpool/Task.h>
 
 
@@ -224,7 +225,7 @@ inline bool TaskQueue::isEmpty() const
 */
 inline void TaskQueue::push( Task task )
 {
-   tasks_.push_back( task );
+   tasks_.push_back( std::move( task ) );
 }
 //*************************************************************************************************
 
@@ -236,7 +237,7 @@ inline void TaskQueue::push( Task task )
 */
 inline Task TaskQueue::pop()
 {
-   const Task task( tasks_.front() );
+   Task task( std::move( tasks_.front() ) );
    tasks_.pop_front();
    return task;
 }
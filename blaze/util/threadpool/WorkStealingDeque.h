@@ -0,0 +1,391 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingDeque.h
+//  \brief Work-stealing deque for the thread pool
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing deque for the thread pool.
+// \ingroup threads
+//
+// The WorkStealingDeque class template represents the task container of a single worker thread
+// of a thread pool. It implements the dynamic circular work-stealing deque by Chase and Lev [1]
+// in the formulation for the C++11 memory model given by Le et al. [2]: the owning thread pushes
+// and pops elements at the bottom end of the deque in LIFO order, whereas any other thread may
+// concurrently steal elements from the top end in FIFO order. None of the three operations
+// acquires a lock. The owner only synchronizes with thieves in case both compete for the very
+// last element.
+//
+// The deque stores pointers (\a Type must be a pointer type). Whenever the circular buffer is
+// full, it is replaced by a buffer of twice the capacity. Since concurrent thieves may still
+// read from the previous buffer, all retired buffers are kept until the deque is destroyed.
+// Due to the doubling strategy their total size is bounded by the size of the current buffer.
+//
+// [1] D. Chase, Y. Lev: Dynamic Circular Work-Stealing Deque, SPAA 2005\n
+// [2] N.M. Le, A. Pop, A. Cohen, F. Zappa Nardelli: Correct and Efficient Work-Stealing for
+//     Weak Memory Models, PPoPP 2013\n
+*/
+template< typename Type >  // Type of the stored pointers
+class WorkStealingDeque
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Circular buffer of the work-stealing deque.
+   */
+   struct Buffer
+   {
+      explicit Buffer( size_t capacity )
+         : mask_( capacity - 1UL )                     // Bit mask for the index wrap-around
+         , data_( new std::atomic<Type>[capacity] )  // The buffer elements
+      {}
+
+      size_t capacity() const noexcept { return mask_ + 1UL; }
+
+      Type get( ptrdiff_t i ) const noexcept {
+         return data_[i & mask_].load( std::memory_order_relaxed );
+      }
+
+      void put( ptrdiff_t i, Type value ) noexcept {
+         data_[i & mask_].store( value, std::memory_order_relaxed );
+      }
+
+      size_t mask_;                                  //!< Bit mask for the index wrap-around.
+      std::unique_ptr< std::atomic<Type>[] > data_;  //!< The buffer elements.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingDeque( size_t capacity = 64UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size()     const noexcept;
+   inline size_t capacity() const noexcept;
+   inline bool   isEmpty()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void push ( Type value );
+   inline Type pop  () noexcept;
+   inline Type steal() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   Buffer* grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<ptrdiff_t> top_;                      //!< Index of the top element (steal end).
+   char padding_[64UL-sizeof(ptrdiff_t)];            //!< Separates the indices in memory.
+                                                     /*!< The padding avoids false sharing
+                                                          between the owner and the thieves
+                                                          without requiring an over-aligned
+                                                          deque. */
+   std::atomic<ptrdiff_t> bottom_;                   //!< Index past the bottom element (owner end).
+   std::atomic<Buffer*> buffer_;                     //!< The current circular buffer.
+   std::vector< std::unique_ptr<Buffer> > buffers_;  //!< All buffers allocated by the deque.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_POINTER_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingDeque class.
+//
+// \param capacity The initial capacity of the deque (rounded up to a power of two).
+*/
+template< typename Type >  // Type of the stored pointers
+inline WorkStealingDeque<Type>::WorkStealingDeque( size_t capacity )
+   : top_    ( 0 )        // Index of the top element (steal end)
+   , bottom_ ( 0 )        // Index one past the bottom element (owner end)
+   , buffer_ ( nullptr )  // The current circular buffer
+   , buffers_()           // All buffers allocated by the deque
+{
+   size_t n( 1UL );
+   while( n < capacity ) n *= 2UL;
+
+   buffers_.emplace_back( new Buffer( n ) );
+   buffer_.store( buffers_.back().get(), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of elements in the deque.
+//
+// \return The number of elements in the deque.
+//
+// Note that in the presence of concurrent thieves the returned value is only a snapshot.
+*/
+template< typename Type >  // Type of the stored pointers
+inline size_t WorkStealingDeque<Type>::size() const noexcept
+{
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( std::memory_order_relaxed ) );
+   return ( bottom > top )?( static_cast<size_t>( bottom - top ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements the deque can hold without growing.
+//
+// \return The capacity of the current circular buffer.
+*/
+template< typename Type >  // Type of the stored pointers
+inline size_t WorkStealingDeque<Type>::capacity() const noexcept
+{
+   return buffer_.load( std::memory_order_relaxed )->capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the deque is empty.
+//
+// \return \a true in case the deque is empty, \a false otherwise.
+*/
+template< typename Type >  // Type of the stored pointers
+inline bool WorkStealingDeque<Type>::isEmpty() const noexcept
+{
+   return size() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding an element at the bottom end of the deque.
+//
+// \param value The element to be added.
+// \return void
+//
+// This function must only be called by the thread owning the deque.
+*/
+template< typename Type >  // Type of the stored pointers
+inline void WorkStealingDeque<Type>::push( Type value )
+{
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( std::memory_order_acquire ) );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+
+   if( bottom - top > static_cast<ptrdiff_t>( buffer->capacity() ) - 1 ) {
+      buffer = grow( buffer, top, bottom );
+   }
+
+   buffer->put( bottom, value );
+   std::atomic_thread_fence( std::memory_order_release );
+   bottom_.store( bottom + 1, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the bottom element of the deque.
+//
+// \return The removed element, or \a nullptr in case the deque is empty.
+//
+// This function must only be called by the thread owning the deque.
+*/
+template< typename Type >  // Type of the stored pointers
+inline Type WorkStealingDeque<Type>::pop() noexcept
+{
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) - 1 );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+   bottom_.store( bottom, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   ptrdiff_t top( top_.load( std::memory_order_relaxed ) );
+
+   Type value( nullptr );
+
+   if( top <= bottom )
+   {
+      value = buffer->get( bottom );
+
+      if( top == bottom ) {
+         if( !top_.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed ) ) {
+            value = nullptr;
+         }
+         bottom_.store( bottom + 1, std::memory_order_relaxed );
+      }
+   }
+   else {
+      bottom_.store( bottom + 1, std::memory_order_relaxed );
+   }
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing the top element of the deque.
+//
+// \return The stolen element, or \a nullptr in case the deque is empty or the steal failed.
+//
+// This function can be called by any thread. In case of a concurrent pop() or steal() of the
+// same element the function fails and returns \a nullptr even though the deque may not be empty.
+*/
+template< typename Type >  // Type of the stored pointers
+inline Type WorkStealingDeque<Type>::steal() noexcept
+{
+   ptrdiff_t top( top_.load( std::memory_order_acquire ) );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_acquire ) );
+
+   if( top >= bottom )
+      return nullptr;
+
+   Buffer* buffer( buffer_.load( std::memory_order_acquire ) );
+   Type value( buffer->get( top ) );
+
+   if( !top_.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed ) ) {
+      return nullptr;
+   }
+
+   return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Replacing the given circular buffer by a buffer of twice the capacity.
+//
+// \param buffer The current circular buffer.
+// \param top The current top index.
+// \param bottom The current bottom index.
+// \return The new circular buffer.
+*/
+template< typename Type >  // Type of the stored pointers
+typename WorkStealingDeque<Type>::Buffer*
+   WorkStealingDeque<Type>::grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom )
+{
+   buffers_.emplace_back( new Buffer( 2UL * buffer->capacity() ) );
+   Buffer* newBuffer( buffers_.back().get() );
+
+   for( ptrdiff_t i=top; i<bottom; ++i ) {
+      newBuffer->put( i, buffer->get( i ) );
+   }
+
+   buffer_.store( newBuffer, std::memory_order_release );
+   return newBuffer;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
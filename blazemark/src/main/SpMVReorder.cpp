@@ -0,0 +1,238 @@
+//=================================================================================================
+/*!
+//  \file src/main/SpMVReorder.cpp
+//  \brief Source file for the sparse matrix reordering benchmark
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/timing/WcTimer.h>
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the randomly numbered 7-point stencil of a 3D mesh.
+//
+// \param N The number of grid points per dimension.
+// \return The resulting \f$ N^3 \times N^3 \f$ sparse matrix.
+*/
+blaze::CompressedMatrix<double,blaze::rowMajor> mesh( std::size_t N )
+{
+   const std::size_t n( N*N*N );
+
+   std::vector<std::size_t> number( n );
+   std::iota( number.begin(), number.end(), 0UL );
+   std::random_shuffle( number.begin(), number.end() );
+
+   std::vector<std::size_t> nonzeros( n, 0UL );
+   std::vector< std::vector<std::size_t> > columns( n );
+
+   for( std::size_t z=0UL; z<N; ++z ) {
+      for( std::size_t y=0UL; y<N; ++y ) {
+         for( std::size_t x=0UL; x<N; ++x )
+         {
+            const std::size_t k( ( z*N + y )*N + x );
+            std::vector<std::size_t>& row( columns[number[k]] );
+
+            row.push_back( number[k] );
+            if( z > 0UL   ) row.push_back( number[k-N*N] );
+            if( y > 0UL   ) row.push_back( number[k-N]   );
+            if( x > 0UL   ) row.push_back( number[k-1UL] );
+            if( x+1UL < N ) row.push_back( number[k+1UL] );
+            if( y+1UL < N ) row.push_back( number[k+N]   );
+            if( z+1UL < N ) row.push_back( number[k+N*N] );
+
+            std::sort( row.begin(), row.end() );
+            nonzeros[number[k]] = row.size();
+         }
+      }
+   }
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( n, n, nonzeros );
+
+   for( std::size_t i=0UL; i<n; ++i ) {
+      for( std::size_t j : columns[i] ) {
+         A.append( i, j, ( i == j )?( 6.0 ):( -1.0 ) );
+      }
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given sparse matrix.
+//
+// \param A The sparse matrix.
+// \return The maximum distance of a non-zero element from the diagonal.
+*/
+std::size_t bandwidth( const blaze::CompressedMatrix<double,blaze::rowMajor>& A )
+{
+   std::size_t result( 0UL );
+
+   for( std::size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const std::size_t j( element->index() );
+         result = std::max( result, ( i > j )?( i-j ):( j-i ) );
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the sparse matrix/vector multiplication with the given matrix.
+//
+// \param name The name of the ordering.
+// \param A The sparse matrix.
+// \param steps The number of multiplications per measurement.
+// \return void
+//
+// This function measures the time of the sparse matrix/vector multiplication and prints the
+// effective memory bandwidth based on the minimum amount of transferred data, i.e. the values
+// and column indices of all non-zero elements, the row offsets, and the two vectors.
+*/
+void benchmark( const std::string& name, const blaze::CompressedMatrix<double,blaze::rowMajor>& A,
+                std::size_t steps )
+{
+   const std::size_t reps( 5UL );
+
+   blaze::DynamicVector<double> x( A.columns() ), y( A.rows() );
+   blaze::randomize( x );
+
+   ::blaze::timing::WcTimer timer;
+
+   for( std::size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( std::size_t step=0UL; step<steps; ++step ) {
+         y = A * x;
+      }
+      timer.end();
+
+      if( y.size() != A.rows() )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+   }
+
+   const double bytes( A.nonZeros() * ( sizeof(double) + sizeof(std::size_t) ) +
+                       ( A.rows() + 1UL ) * sizeof(std::size_t) +
+                       ( A.rows() + A.columns() ) * sizeof(double) );
+
+   std::cout << "   " << std::left << std::setw(20) << name << std::right
+             << std::setw(12) << bandwidth( A )
+             << std::setw(12) << std::fixed << std::setprecision(6) << timer.min() / steps
+             << std::setw(12) << std::setprecision(3) << ( bytes * steps ) / timer.min() / 1E9
+             << "\n";
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the sparse matrix reordering benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// This benchmark compares the performance of the sparse matrix/vector multiplication with a
+// randomly numbered 3D mesh before and after the reordering via the rcm(), nestedDissection()
+// and rowLocalityOrder() functions. For each ordering it prints the bandwidth of the matrix,
+// the time per multiplication in seconds and the effective memory bandwidth in GB/s.
+*/
+int main( int argc, char** argv )
+{
+   if( argc < 2 || argc > 3 ) {
+      std::cerr << " Invalid use of program 'SpMVReorder'!\n"
+                << "   Use: ./spmvreorder <grid_points_per_dimension> [<steps>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::size_t N    ( static_cast<std::size_t>( atoi( argv[1] ) ) );
+   const std::size_t steps( ( argc == 3 )?( static_cast<std::size_t>( atoi( argv[2] ) ) )
+                                         :( 10UL ) );
+
+   if( N == 0UL || steps == 0UL ) {
+      std::cerr << " Invalid number of grid points or steps!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( mesh( N ) );
+
+   std::vector<std::size_t> identity( A.columns() );
+   std::iota( identity.begin(), identity.end(), 0UL );
+
+   std::cout << "\n Sparse matrix/vector multiplication with a randomly numbered "
+             << N << "x" << N << "x" << N << " mesh\n"
+             << "   (" << A.rows() << " rows, " << A.nonZeros() << " non-zero elements)\n\n"
+             << "   Ordering               Bandwidth    Time [s]      GB/s\n";
+
+   benchmark( "Random", A, steps );
+   benchmark( "Row locality", blaze::permute( A, blaze::rowLocalityOrder( A ), identity ), steps );
+   benchmark( "RCM", blaze::permute( A, blaze::rcm( A ) ), steps );
+   benchmark( "Nested dissection", blaze::permute( A, blaze::nestedDissection( A ) ), steps );
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
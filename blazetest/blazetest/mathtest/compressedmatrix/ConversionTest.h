@@ -0,0 +1,269 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrix/ConversionTest.h
+//  \brief Header file for the CompressedMatrix storage order conversion test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_CONVERSIONTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_CONVERSIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/Tuning.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the storage order conversion of the CompressedMatrix.
+//
+// This class represents a test suite for the assignment of a sparse matrix with opposite storage
+// order to a CompressedMatrix, which is also used for the assignment of transposed matrices. In
+// order to exercise the parallel conversion, all tests are run with the SMP threshold of the
+// conversion set to zero and with several numbers of threads.
+*/
+class ConversionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ConversionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConversion( size_t m, size_t n, size_t nonzeros,
+                        size_t rowStride=1UL, size_t columnStride=1UL );
+
+   template< typename MT1, typename MT2 >
+   void checkConversion( const std::string& operation, const MT1& A, const MT2& B,
+                         bool transposed ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& A, size_t nonzeros, size_t rowStride, size_t columnStride );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The initial number of threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a storage order conversion.
+//
+// \param operation The name of the conversion operation.
+// \param A The original matrix.
+// \param B The converted matrix.
+// \param transposed \a true in case \a B is expected to be the transpose of \a A.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size and all elements of the converted matrix and that the indices
+// of the elements in each row (or column) of the converted matrix are strictly increasing.
+*/
+template< typename MT1    // Type of the original matrix
+        , typename MT2 >  // Type of the converted matrix
+void ConversionTest::checkConversion( const std::string& operation, const MT1& A, const MT2& B,
+                                      bool transposed ) const
+{
+   const blaze::DynamicMatrix<int> D( A );
+
+   const size_t m( transposed ? A.columns() : A.rows()    );
+   const size_t n( transposed ? A.rows()    : A.columns() );
+
+   bool failed( !isIntact( B ) || B.rows() != m || B.columns() != n ||
+                B.nonZeros() != A.nonZeros() );
+
+   for( size_t i=0UL; !failed && i<m; ++i ) {
+      for( size_t j=0UL; !failed && j<n; ++j ) {
+         failed = ( B(i,j) != ( transposed ? D(j,i) : D(i,j) ) );
+      }
+   }
+
+   const size_t lines( blaze::IsRowMajorMatrix_v<MT2> ? B.rows() : B.columns() );
+
+   for( size_t k=0UL; !failed && k<lines; ++k ) {
+      for( auto element=B.begin(k); !failed && element!=B.end(k); ++element ) {
+         const auto next( element+1UL );
+         failed = ( next != B.end(k) && next->index() <= element->index() );
+      }
+   }
+
+   if( failed ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << operation << " failed\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n"
+          << "   Original matrix:\n" << A << "\n"
+          << "   Converted matrix:\n" << B << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given matrix.
+//
+// \param A The sparse matrix to be initialized.
+// \param nonzeros The number of elements to be inserted.
+// \param rowStride The distance between two rows that may contain elements.
+// \param columnStride The distance between two columns that may contain elements.
+// \return void
+//
+// This function inserts up to \a nonzeros random elements into every \a rowStride-th row and
+// every \a columnStride-th column of the given matrix, i.e. all other rows and columns remain
+// empty.
+*/
+template< typename MT >  // Type of the sparse matrix
+void ConversionTest::initialize( MT& A, size_t nonzeros, size_t rowStride, size_t columnStride )
+{
+   A.reset();
+
+   if( A.rows() == 0UL || A.columns() == 0UL )
+      return;
+
+   const size_t rows   ( ( A.rows()    - 1UL ) / rowStride    + 1UL );
+   const size_t columns( ( A.columns() - 1UL ) / columnStride + 1UL );
+
+   for( size_t k=0UL; k<nonzeros; ++k ) {
+      const size_t i( blaze::rand<size_t>( 0UL, rows    - 1UL )*rowStride    );
+      const size_t j( blaze::rand<size_t>( 0UL, columns - 1UL )*columnStride );
+      A(i,j) = blaze::rand<int>( 1, 9 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the storage order conversion of the CompressedMatrix class.
+//
+// \return void
+*/
+void runTest()
+{
+   ConversionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix storage order conversion test.
+*/
+#define RUN_COMPRESSEDMATRIX_CONVERSION_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
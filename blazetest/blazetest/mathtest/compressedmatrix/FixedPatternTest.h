@@ -0,0 +1,496 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrix/FixedPatternTest.h
+//  \brief Header file for the CompressedMatrix fixed pattern test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_FIXEDPATTERNTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_FIXEDPATTERNTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blazetest/system/Types.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <thread>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the fixed pattern interface of the CompressedMatrix.
+//
+// This class represents a test suite for the FixedPattern class template and the freeze()
+// function. It repeatedly assembles the stiffness matrix of a two-dimensional grid of bilinear
+// elements via precomputed slot maps and compares the result to a dense reference matrix.
+*/
+class FixedPatternTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FixedPatternTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >
+   void testAccess();
+
+   template< bool SO >
+   void testAssembly( size_t n );
+
+   template< bool SO >
+   void testAtomicAssembly( size_t n );
+
+   void testErrors();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   void setup( blaze::CompressedMatrix<double,SO>& A, size_t n );
+
+   std::vector<size_t> dofs( size_t n, size_t e ) const;
+
+   blaze::DynamicMatrix<double> element( size_t e ) const;
+
+   template< typename MT >
+   void checkAssembly( const MT& A, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the element access functions of the FixedPattern class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order
+void FixedPatternTest::testAccess()
+{
+   test_ = ( SO ? "Column-major FixedPattern access" : "Row-major FixedPattern access" );
+
+   // Setting up the matrix with excessive capacity in all rows/columns
+   blaze::CompressedMatrix<double,SO> A( 4UL, 4UL, 20UL );
+   for( size_t i=0UL; i<4UL; ++i ) {
+      A.reserve( i, 5UL );
+   }
+   A(0,0) = 1.0;
+   A(1,2) = 2.0;
+   A(2,1) = 3.0;
+   A(3,0) = 4.0;
+   A(3,3) = 5.0;
+
+   const blaze::DynamicMatrix<double,SO> ref( A );
+
+   auto pattern = freeze( A );
+
+   if( pattern.size() != 5UL || !pattern.isIntact() || A != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Freezing the matrix failed\n"
+          << " Details:\n"
+          << "   Number of slots: " << pattern.size() << "\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Checking the slots of all non-zero elements
+   for( size_t i=0UL; i<4UL; ++i ) {
+      size_t k( pattern.offset(i) );
+      for( auto element=A.begin(i); element!=A.end(i); ++element, ++k ) {
+         const size_t row( SO ? element->index() : i );
+         const size_t col( SO ? i : element->index() );
+         if( pattern.slot( row, col ) != k || &pattern[k] != &element->value() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid slot detected\n"
+                << " Details:\n"
+                << "   Element: (" << row << "," << col << ")\n"
+                << "   Slot         : " << pattern.slot( row, col ) << "\n"
+                << "   Expected slot: " << k << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+      if( k != pattern.offset(i+1UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid offset detected\n"
+             << " Details:\n"
+             << "   Row/column: " << i+1UL << "\n"
+             << "   Offset         : " << pattern.offset(i+1UL) << "\n"
+             << "   Expected offset: " << k << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Updating the values via the slots
+   for( size_t k=0UL; k<pattern.size(); ++k ) {
+      pattern[k] *= 2.0;
+   }
+   pattern.add( pattern.slot( 3UL, 3UL ), 1.0 );
+   pattern.atomicAdd( pattern.slot( 1UL, 2UL ), 1.0 );
+
+   if( A(0,0) != 2.0 || A(1,2) != 5.0 || A(2,1) != 6.0 || A(3,0) != 8.0 || A(3,3) != 11.0 ||
+       A.nonZeros() != 5UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Updating the values failed\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resetting the values
+   pattern.reset();
+
+   if( A.nonZeros() != 5UL || A(1,2) != 0.0 || A.find( 1UL, 2UL ) == A.end( SO ? 2UL : 1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the values failed\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the repeated assembly via precomputed slot maps.
+//
+// \param n The number of elements in each direction of the grid.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO >  // Storage order
+void FixedPatternTest::testAssembly( size_t n )
+{
+   test_ = ( SO ? "Column-major FixedPattern assembly" : "Row-major FixedPattern assembly" );
+
+   blaze::CompressedMatrix<double,SO> A;
+   setup( A, n );
+
+   auto pattern = freeze( A );
+
+   std::vector< std::vector<size_t> > maps( n*n );
+   for( size_t e=0UL; e<n*n; ++e ) {
+      const std::vector<size_t> indices( dofs( n, e ) );
+      maps[e] = pattern.slots( indices, indices );
+   }
+
+   for( size_t step=0UL; step<3UL; ++step )
+   {
+      pattern.reset();
+
+      for( size_t e=0UL; e<n*n; ++e ) {
+         pattern.scatterAdd( maps[e], element( e ) );
+      }
+
+      checkAssembly( A, n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread-safe assembly via precomputed slot maps.
+//
+// \param n The number of elements in each direction of the grid.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assembles the grid matrix by means of the atomicScatterAdd() function. In case
+// the test is compiled with OpenMP or C++11 thread parallelization, the element matrices are
+// added concurrently.
+*/
+template< bool SO >  // Storage order
+void FixedPatternTest::testAtomicAssembly( size_t n )
+{
+   test_ = ( SO ? "Column-major FixedPattern atomic assembly"
+                : "Row-major FixedPattern atomic assembly" );
+
+   blaze::CompressedMatrix<double,SO> A;
+   setup( A, n );
+
+   auto pattern = freeze( A );
+
+   std::vector< std::vector<size_t> > maps( n*n );
+   for( size_t e=0UL; e<n*n; ++e ) {
+      const std::vector<size_t> indices( dofs( n, e ) );
+      maps[e] = pattern.slots( indices, indices );
+   }
+
+   pattern.reset();
+
+   const int elements( static_cast<int>( n*n ) );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   const size_t threads( 4UL );
+   std::vector<std::thread> workers;
+   for( size_t t=0UL; t<threads; ++t ) {
+      workers.emplace_back( [&,t]() {
+         for( int e=static_cast<int>( t ); e<elements; e+=static_cast<int>( threads ) )
+            pattern.atomicScatterAdd( maps[e], element( e ) );
+      } );
+   }
+   for( std::thread& worker : workers ) {
+      worker.join();
+   }
+#else
+#pragma omp parallel for schedule(dynamic)
+   for( int e=0; e<elements; ++e ) {
+      pattern.atomicScatterAdd( maps[e], element( e ) );
+   }
+#endif
+
+   checkAssembly( A, n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting up the sparsity pattern of the grid matrix.
+//
+// \param A The matrix to be set up.
+// \param n The number of elements in each direction of the grid.
+// \return void
+//
+// This function sets up the sparsity pattern of the matrix of a two-dimensional grid of
+// \f$ n \times n \f$ bilinear elements, i.e. each node is coupled to all nodes of the
+// surrounding elements. All elements are initialized with the value 1.
+*/
+template< bool SO >  // Storage order
+void FixedPatternTest::setup( blaze::CompressedMatrix<double,SO>& A, size_t n )
+{
+   const size_t nodes( n+1UL );
+
+   A.resize( nodes*nodes, nodes*nodes, false );
+   A.reserve( 9UL*nodes*nodes );
+
+   for( size_t i=0UL; i<nodes*nodes; ++i )
+   {
+      const size_t x( i % nodes );
+      const size_t y( i / nodes );
+
+      for( size_t y2=( y > 0UL ? y-1UL : 0UL ); y2<=y+1UL && y2<nodes; ++y2 ) {
+         for( size_t x2=( x > 0UL ? x-1UL : 0UL ); x2<=x+1UL && x2<nodes; ++x2 ) {
+            const size_t j( y2*nodes+x2 );
+            A.append( ( SO ? j : i ), ( SO ? i : j ), 1.0 );
+         }
+      }
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the node indices of the given element of the grid.
+//
+// \param n The number of elements in each direction of the grid.
+// \param e The index of the element.
+// \return The indices of the four nodes of the element.
+*/
+inline std::vector<size_t> FixedPatternTest::dofs( size_t n, size_t e ) const
+{
+   const size_t nodes( n+1UL );
+   const size_t first( ( e / n ) * nodes + e % n );
+
+   return std::vector<size_t>{ first, first+1UL, first+nodes, first+nodes+1UL };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the element matrix of the given element.
+//
+// \param e The index of the element.
+// \return The element matrix.
+//
+// The element matrix has the element index plus 3 as diagonal elements and -1 as off-diagonal
+// elements.
+*/
+inline blaze::DynamicMatrix<double> FixedPatternTest::element( size_t e ) const
+{
+   blaze::DynamicMatrix<double> Ke( 4UL, 4UL, -1.0 );
+
+   for( size_t a=0UL; a<4UL; ++a ) {
+      Ke(a,a) = static_cast<double>( e+3UL );
+   }
+
+   return Ke;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the assembled grid matrix.
+//
+// \param A The assembled matrix.
+// \param n The number of elements in each direction of the grid.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the assembled matrix
+void FixedPatternTest::checkAssembly( const MT& A, size_t n ) const
+{
+   const size_t nodes( n+1UL );
+
+   blaze::DynamicMatrix<double> ref( nodes*nodes, nodes*nodes, 0.0 );
+
+   for( size_t e=0UL; e<n*n; ++e ) {
+      const std::vector<size_t> indices( dofs( n, e ) );
+      const blaze::DynamicMatrix<double> Ke( element( e ) );
+      for( size_t a=0UL; a<4UL; ++a )
+         for( size_t b=0UL; b<4UL; ++b )
+            ref(indices[a],indices[b]) += Ke(a,b);
+   }
+
+   if( A != ref || A.nonZeros() != nonZeros( ref ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assembly failed\n"
+          << " Details:\n"
+          << "   Grid size: " << n << "x" << n << "\n"
+          << "   Number of non-zeros         : " << A.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << nonZeros( ref ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the fixed pattern interface of the CompressedMatrix class.
+//
+// \return void
+*/
+void runTest()
+{
+   FixedPatternTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix fixed pattern test.
+*/
+#define RUN_COMPRESSEDMATRIX_FIXEDPATTERN_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
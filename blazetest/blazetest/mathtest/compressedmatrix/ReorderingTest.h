@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrix/ReorderingTest.h
+//  \brief Header file for the CompressedMatrix reordering test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_REORDERINGTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_REORDERINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Elements.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the reordering functions of the CompressedMatrix class.
+//
+// This class represents a test suite for the rcm(), nestedDissection(), rowLocalityOrder(), and
+// permute() functions. It reorders randomly numbered mesh matrices and random rectangular
+// matrices and checks the resulting permutations and permuted matrices.
+*/
+class ReorderingTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ReorderingTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testRCM( size_t n );
+   void testNestedDissection( size_t n );
+   void testRowLocality( size_t m, size_t n );
+   void testPermute( size_t m, size_t n );
+   void testErrors();
+
+   template< typename MT >
+   void checkPermutation( const std::vector<size_t>& perm, const MT& A, size_t n );
+
+   template< typename MT1, typename MT2 >
+   void checkPermute( const MT1& A, const MT2& B,
+                      const std::vector<size_t>& rowPerm, const std::vector<size_t>& colPerm );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void mesh( MT& A, size_t n, size_t components );
+   template< typename MT > size_t bandwidth( const MT& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given permutation.
+//
+// \param perm The permutation to be checked.
+// \param A The ordered matrix.
+// \param n The expected size of the permutation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the ordered matrix
+void ReorderingTest::checkPermutation( const std::vector<size_t>& perm, const MT& A, size_t n )
+{
+   std::vector<bool> found( n, false );
+
+   for( size_t k=0UL; k<perm.size(); ++k ) {
+      if( perm.size() != n || perm[k] >= n || found[perm[k]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation detected\n"
+             << " Details:\n"
+             << "   Position: " << k << "\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      found[perm[k]] = true;
+   }
+
+   if( perm.size() != n ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation size detected\n"
+          << " Details:\n"
+          << "   Size: " << perm.size() << "\n"
+          << "   Expected size: " << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given permuted matrix.
+//
+// \param A The original matrix.
+// \param B The permuted matrix.
+// \param rowPerm The row permutation.
+// \param colPerm The column permutation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the original matrix
+        , typename MT2 >  // Type of the permuted matrix
+void ReorderingTest::checkPermute( const MT1& A, const MT2& B,
+                                   const std::vector<size_t>& rowPerm,
+                                   const std::vector<size_t>& colPerm )
+{
+   const blaze::DynamicMatrix<double> D( A );
+
+   bool failed( B.rows() != A.rows() || B.columns() != A.columns() ||
+                B.nonZeros() != D.nonZeros() );
+
+   for( size_t i=0UL; !failed && i<B.rows(); ++i ) {
+      for( size_t j=0UL; !failed && j<B.columns(); ++j ) {
+         failed = ( B(i,j) != D(rowPerm[i],colPerm[j]) );
+      }
+   }
+
+   if( failed ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Permutation failed\n"
+          << " Details:\n"
+          << "   Original matrix:\n" << A << "\n"
+          << "   Permuted matrix:\n" << B << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with randomly numbered 2D meshes.
+//
+// \param A The sparse matrix to be initialized.
+// \param n The number of grid points per dimension of each mesh.
+// \param components The number of disconnected meshes.
+// \return void
+//
+// This function initializes the given matrix with the 5-point stencil of \a components
+// disconnected \f$ n \times n \f$ meshes, whose nodes are numbered randomly.
+*/
+template< typename MT >  // Type of the sparse matrix
+void ReorderingTest::mesh( MT& A, size_t n, size_t components )
+{
+   const size_t N( components*n*n );
+
+   std::vector<size_t> number( N );
+   std::iota( number.begin(), number.end(), 0UL );
+   std::random_shuffle( number.begin(), number.end() );
+
+   A.reset();
+   A.resize( N, N, false );
+
+   for( size_t c=0UL; c<components; ++c ) {
+      for( size_t row=0UL; row<n; ++row ) {
+         for( size_t col=0UL; col<n; ++col )
+         {
+            const size_t k( c*n*n + row*n + col );
+            const size_t i( number[k] );
+
+            A(i,i) = 4.0;
+            if( row > 0UL     ) A(i,number[k-n])   = -1.0;
+            if( col > 0UL     ) A(i,number[k-1UL]) = -1.0;
+            if( col+1UL < n   ) A(i,number[k+1UL]) = -1.0;
+            if( row+1UL < n   ) A(i,number[k+n])   = -1.0;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given sparse matrix.
+//
+// \param A The sparse row-major matrix.
+// \return The maximum distance of a non-zero element from the diagonal.
+*/
+template< typename MT >  // Type of the sparse matrix
+size_t ReorderingTest::bandwidth( const MT& A )
+{
+   size_t result( 0UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         result = std::max( result, ( i > j )?( i-j ):( j-i ) );
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the reordering functions of the CompressedMatrix class.
+//
+// \return void
+*/
+void runTest()
+{
+   ReorderingTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix reordering test.
+*/
+#define RUN_COMPRESSEDMATRIX_REORDERING_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
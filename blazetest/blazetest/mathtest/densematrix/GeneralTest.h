@@ -125,6 +125,8 @@ class GeneralTest
    void testNot();
    void testAnd();
    void testOr();
+   void testSelect();
+   void testMaskedAssign();
    void testGenerate();
    void testUniform();
    void testZero();
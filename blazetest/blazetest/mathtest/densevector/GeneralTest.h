@@ -98,6 +98,8 @@ class GeneralTest
    void testLpNorm();
    void testLinfNorm();
    void testLength();
+   void testSum();
+   void testDot();
    void testMean();
    void testVar();
    void testStdDev();
@@ -110,6 +112,8 @@ class GeneralTest
    void testNot();
    void testAnd();
    void testOr();
+   void testSelect();
+   void testMaskedAssign();
    void testGenerate();
    void testLinspace();
    void testLogspace();
@@ -0,0 +1,248 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dispatch/DispatchTest.h
+//  \brief Header file for the runtime dispatch test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DISPATCH_DISPATCHTEST_H_
+#define _BLAZETEST_MATHTEST_DISPATCH_DISPATCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Dispatch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime dispatch of compute kernels.
+//
+// This class represents a test suite for the runtime dispatch of the compute kernels of the
+// Blaze library. It performs a series of tests of the instruction set selection and compares
+// the results of all dispatched operations for all instruction sets supported by the CPU with
+// the results of the compile time kernels. In order to allow an exact comparison, all operands
+// are initialized with small integral values.
+*/
+class DispatchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DispatchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSelection();
+
+   template< typename T > void testVectorOperations();
+   template< typename T > void testMatVecMult();
+   template< typename T > void testMatMatMult();
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT, bool TF > void initialize( blaze::DenseVector<VT,TF>& v ) const;
+   template< typename MT, bool SO > void initialize( blaze::DenseMatrix<MT,SO>& A ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;           //!< Label of the currently performed test.
+   blaze::InstructionSet isa_;  //!< The currently tested instruction set.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a dispatched operation.
+//
+// \param result The result of the dispatched operation.
+// \param expected The result of the compile time kernels.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type1    // Type of the result
+        , typename Type2 >  // Type of the expected result
+void DispatchTest::checkResult( const Type1& result, const Type2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of dispatched operation\n"
+          << " Details:\n"
+          << "   Instruction set : " << static_cast<int>( isa_ ) << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense vector with small integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void DispatchTest::initialize( blaze::DenseVector<VT,TF>& v ) const
+{
+   using ET = blaze::ElementType_t<VT>;
+
+   for( size_t i=0UL; i<(~v).size(); ++i ) {
+      (~v)[i] = static_cast<ET>( blaze::rand<int>( -4, 4 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense matrix with small integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void DispatchTest::initialize( blaze::DenseMatrix<MT,SO>& A ) const
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i ) {
+      for( size_t j=0UL; j<(~A).columns(); ++j ) {
+         (~A)(i,j) = static_cast<ET>( blaze::rand<int>( -4, 4 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime dispatch of compute kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   DispatchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime dispatch test.
+*/
+#define RUN_DISPATCH_TEST \
+   blazetest::mathtest::dispatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
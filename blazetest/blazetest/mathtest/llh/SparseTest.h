@@ -0,0 +1,819 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/llh/SparseTest.h
+//  \brief Header file for the sparse matrix LLH test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LLH_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_LLH_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace llh {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse matrix LLH tests.
+//
+// This class represents a test suite for the sparse matrix Cholesky decomposition functionality.
+// It performs a series of \f$ L L^H \f$ and \f$ L D L^H \f$ decompositions of sparse symmetric
+// and Hermitian matrices and solves the resulting linear systems. Additionally, it tests the
+// incomplete Cholesky decomposition of sparse matrices.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT > void testLaplace( size_t N );
+   template< typename MT > void testRandom ( size_t N );
+
+   template< typename MT > void testIncomplete( size_t N );
+
+   void testHermitian();
+   void testOrdering();
+   void testErrors();
+
+   template< typename MT >
+   void checkDecomposition( const MT& A );
+
+   template< typename Type, bool LDL, typename MT >
+   void checkSolve( const blaze::SparseCholesky<Type,LDL>& chol, const MT& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void laplace( MT& A, size_t N );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using cdouble = blaze::complex<double>;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sparse Cholesky decomposition with a two-dimensional Laplace operator.
+//
+// \param N The number of grid points in each dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse Cholesky decomposition with the 5-point discretization of the
+// Laplace operator on an \f$ N \times N \f$ grid. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::testLaplace( size_t N )
+{
+   test_ = "Laplace operator";
+
+   MT A;
+   laplace( A, N );
+
+   checkDecomposition( A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse Cholesky decomposition with random positive definite matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse Cholesky decomposition with random sparse, diagonally dominant
+// \f$ N \times N \f$ matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::testRandom( size_t N )
+{
+   test_ = "Random positive definite matrix";
+
+   using Type = blaze::ElementType_t<MT>;
+
+   MT A( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      A(i,i) = Type(1);
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=i+1UL; j<N; ++j ) {
+         if( blaze::rand<size_t>( 0UL, N ) < 3UL ) {
+            const Type value( blaze::rand<Type>( -1, 1 ) );
+            A(i,j)  = value;
+            A(i,i) += std::abs( value );
+            A(j,j) += std::abs( value );
+         }
+      }
+   }
+
+   checkDecomposition( A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the incomplete Cholesky decomposition.
+//
+// \param N The number of grid points in each dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the ic0() function and the IC(0) preconditioner with the 5-point
+// discretization of the Laplace operator on an \f$ N \times N \f$ grid. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::testIncomplete( size_t N )
+{
+   using blaze::CompressedMatrix;
+
+   using Type = blaze::ElementType_t<MT>;
+   using SO   = blaze::StorageOrder<MT>;
+
+   test_ = "IC(0) decomposition";
+
+   blaze::SymmetricMatrix< CompressedMatrix<Type,SO::value> > S;
+   laplace( S, N );
+
+   const CompressedMatrix<Type,SO::value> A( S );
+
+   const blaze::IncompleteCholesky<Type,SO::value> ic( A );
+
+   if( ic.nonZeros() != A.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: IC(0) decomposition changed the sparsity pattern\n"
+          << " Details:\n"
+          << "   Non-zeros of the matrix: " << A.nonZeros() << "\n"
+          << "   Non-zeros of the factors: " << ic.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   CompressedMatrix<Type,SO::value> L( A.rows(), A.columns() );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         if( !blaze::isDefault<blaze::strict>( ic.factors()(i,j) ) )
+            L(i,j) = ic.factors()(i,j);
+      }
+   }
+
+   const CompressedMatrix<Type,SO::value> LLH( L * ctrans( L ) );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( !blaze::isDefault<blaze::strict>( A(i,j) ) && !blaze::equal( LLH(i,j), A(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: IC(0) decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Position: (" << i << "," << j << ")\n"
+                << "   Matrix element: " << A(i,j) << "\n"
+                << "   Product element: " << LLH(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   blaze::DynamicVector<Type> b( A.rows() );
+   randomize( b );
+
+   const blaze::DynamicVector<Type> y( ic( b ) );
+
+   if( L * ( ctrans( L ) * y ) != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Application of IC(0) preconditioner failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Vector:\n" << b << "\n"
+          << "   Result:\n" << y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse Cholesky decomposition with complex Hermitian matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse Cholesky decomposition with sparse complex Hermitian positive
+// definite matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testHermitian()
+{
+   using blaze::HermitianMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Hermitian matrix";
+
+   for( size_t N : { 1UL, 2UL, 10UL, 50UL } )
+   {
+      HermitianMatrix< CompressedMatrix<cdouble,rowMajor> > A( N );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         A(i,i) = cdouble( 1.0 );
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=i+1UL; j<N; ++j ) {
+            if( blaze::rand<size_t>( 0UL, N ) < 3UL ) {
+               const cdouble value( blaze::rand<double>( -1.0, 1.0 ), blaze::rand<double>( -1.0, 1.0 ) );
+               A(i,j)  = value;
+               A(i,i) += std::abs( value );
+               A(j,j) += std::abs( value );
+            }
+         }
+      }
+
+      checkDecomposition( A );
+      checkDecomposition( HermitianMatrix< CompressedMatrix<cdouble,columnMajor> >( A ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fill-reducing ordering and the elimination tree.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the amd(), etree(), and postorder() functions. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testOrdering()
+{
+   using blaze::SymmetricMatrix;
+   using blaze::CompressedMatrix;
+
+   test_ = "Fill-reducing ordering";
+
+   SymmetricMatrix< CompressedMatrix<double> > A;
+   laplace( A, 12UL );
+
+   const size_t n( A.rows() );
+
+   const std::vector<size_t> perm  ( blaze::amd( A ) );
+   const std::vector<size_t> parent( blaze::etree( A, perm ) );
+   const std::vector<size_t> post  ( blaze::postorder( parent ) );
+
+   std::vector<bool> found( n, false ), found2( n, false );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      if( perm[k] >= n || found[perm[k]] || post[k] >= n || found2[post[k]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation detected\n"
+             << " Details:\n"
+             << "   Position: " << k << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( parent[k] != n && parent[k] <= k ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid elimination tree detected\n"
+             << " Details:\n"
+             << "   Node: " << k << "\n"
+             << "   Parent: " << parent[k] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      found[perm[k]] = true;
+      found2[post[k]] = true;
+   }
+
+   // The fill of the factor must not be larger than the fill of the natural ordering
+   std::vector<size_t> natural( n );
+   for( size_t k=0UL; k<n; ++k ) {
+      natural[k] = k;
+   }
+
+   blaze::SparseCholesky<double> chol1, chol2;
+   chol1.analyze( A );
+   chol2.analyze( A, natural );
+
+   if( chol1.nonZeros() > chol2.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fill-reducing ordering increases the fill\n"
+          << " Details:\n"
+          << "   Non-zeros with fill-reducing ordering: " << chol1.nonZeros() << "\n"
+          << "   Non-zeros with natural ordering: " << chol2.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // The etree of a tridiagonal matrix in natural ordering is a path
+   SymmetricMatrix< CompressedMatrix<double> > T( 5UL );
+   for( size_t i=0UL; i<5UL; ++i ) {
+      T(i,i) = 2.0;
+      if( i > 0UL ) T(i,i-1UL) = -1.0;
+   }
+
+   const std::vector<size_t> path( blaze::etree( T ) );
+
+   if( path != std::vector<size_t>{ 1UL, 2UL, 3UL, 4UL, 5UL } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid elimination tree of tridiagonal matrix detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse Cholesky decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the error handling of the sparse Cholesky decomposition and the incomplete
+// Cholesky decomposition for indefinite matrices, non-matching sparsity patterns, invalid
+// permutations and right-hand sides, and a missing numeric factorization.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testErrors()
+{
+   using blaze::SymmetricMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::SparseCholesky;
+
+   {
+      test_ = "Indefinite matrix";
+
+      SymmetricMatrix< CompressedMatrix<double> > A( 3UL );
+      A(0,0) =  1.0;
+      A(1,1) = -2.0;
+      A(2,2) =  3.0;
+      A(0,1) =  1.0;
+
+      bool failed( false );
+
+      try {
+         SparseCholesky<double> chol( A );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LLH decomposition of indefinite matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // The LDLH decomposition succeeds for this quasi-definite matrix
+      SparseCholesky<double,true> ldl( A );
+      checkSolve( ldl, A );
+   }
+
+   {
+      test_ = "IC(0) of indefinite matrix";
+
+      CompressedMatrix<double> A( 2UL, 2UL );
+      A(0,0) = 1.0;
+      A(0,1) = 2.0;
+      A(1,0) = 2.0;
+      A(1,1) = 1.0;
+
+      bool failed( false );
+
+      try {
+         blaze::ic0( A );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: IC(0) decomposition of indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "IC(0) with non-symmetric sparsity pattern";
+
+      CompressedMatrix<double> A( 2UL, 2UL );
+      A(0,0) = 4.0;
+      A(0,1) = 1.0;
+      A(1,1) = 4.0;
+
+      try {
+         blaze::ic0( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: IC(0) decomposition with non-symmetric sparsity pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Non-matching sparsity pattern";
+
+      SymmetricMatrix< CompressedMatrix<double> > A( 3UL );
+      A(0,0) = 4.0;
+      A(1,1) = 4.0;
+      A(2,2) = 4.0;
+      A(0,1) = 1.0;
+
+      SparseCholesky<double> chol( A );
+
+      A.erase( 0UL, 1UL );
+      A(0,2) = 1.0;
+
+      try {
+         chol.factorize( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Refactorization with different sparsity pattern succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( chol.isFactorized() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed refactorization did not invalidate the factorization\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Invalid permutation";
+
+      SymmetricMatrix< CompressedMatrix<double> > A( 3UL );
+      A(0,0) = 4.0;
+      A(1,1) = 4.0;
+      A(2,2) = 4.0;
+
+      SparseCholesky<double> chol;
+
+      try {
+         chol.analyze( A, std::vector<size_t>{ 0UL, 1UL, 1UL } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Analysis with invalid permutation succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Non-matching right-hand side";
+
+      SymmetricMatrix< CompressedMatrix<double> > A( 3UL );
+      A(0,0) = 4.0;
+      A(1,1) = 4.0;
+      A(2,2) = 4.0;
+
+      const SparseCholesky<double> chol( A );
+      const DynamicVector<double> b( 2UL, 1.0 );
+      DynamicVector<double> x;
+
+      try {
+         chol.solve( x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with invalid right-hand side succeeded\n"
+             << " Details:\n"
+             << "   Right-hand side (b):\n" << b << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Missing numeric factorization";
+
+      SymmetricMatrix< CompressedMatrix<double> > A( 3UL );
+      A(0,0) = 4.0;
+      A(1,1) = 4.0;
+      A(2,2) = 4.0;
+
+      SparseCholesky<double> chol;
+      chol.analyze( A );
+
+      const DynamicMatrix<double> B( 3UL, 2UL, 1.0 );
+      const DynamicMatrix<double> ref( 2UL, 4UL, 2.0 );
+      DynamicMatrix<double> X( ref );
+
+      bool failed( false );
+
+      try {
+         chol.solve( X, B );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE without numeric factorization succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( X != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed solve modified the solution matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << X << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the \f$ L L^H \f$ and \f$ L D L^H \f$ decompositions of the given matrix.
+//
+// \param A The sparse symmetric positive definite matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes both decompositions of the given matrix, solves linear systems with a
+// single and with multiple right-hand sides, and checks the numeric-only refactorization with
+// modified values. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::checkDecomposition( const MT& A )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   blaze::SparseCholesky<Type>      llh( A );
+   blaze::SparseCholesky<Type,true> ldl( A );
+
+   checkSolve( llh, A );
+   checkSolve( ldl, A );
+
+   // Numeric-only refactorization with modified values
+   MT B( A );
+   for( size_t i=0UL; i<B.rows(); ++i ) {
+      B(i,i) *= Type(2);
+   }
+
+   llh.factorize( B );
+   ldl.factorize( B );
+
+   checkSolve( llh, B );
+   checkSolve( ldl, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of linear systems with the given decomposition.
+//
+// \param chol The sparse Cholesky decomposition of the given matrix.
+// \param A The decomposed sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the factor
+        , bool LDL       // Flag for the LDL^H decomposition
+        , typename MT >  // Type of the sparse matrix
+void SparseTest::checkSolve( const blaze::SparseCholesky<Type,LDL>& chol, const MT& A )
+{
+   using blaze::columnMajor;
+
+   const size_t N( A.rows() );
+
+   blaze::DynamicVector<Type> b( N ), x;
+   randomize( b );
+
+   chol.solve( x, b );
+
+   if( A*x != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving LSE failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   LDLH decomposition: " << LDL << "\n"
+          << "   System matrix (A):\n" << A << "\n"
+          << "   Right-hand side (b):\n" << b << "\n"
+          << "   Solution (x):\n" << x << "\n"
+          << "   A * x =\n" << ( A * x ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::DynamicMatrix<Type,columnMajor> B( N, 3UL ), X;
+   randomize( B );
+
+   chol.solve( X, B );
+
+   if( A*X != B ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving LSE with multiple right-hand sides failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   LDLH decomposition: " << LDL << "\n"
+          << "   System matrix (A):\n" << A << "\n"
+          << "   Right-hand side (B):\n" << B << "\n"
+          << "   Solution (X):\n" << X << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the 5-point discretization of the Laplace operator.
+//
+// \param A The sparse symmetric matrix to be initialized.
+// \param N The number of grid points in each dimension.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::laplace( MT& A, size_t N )
+{
+   A.resize( N*N, false );
+   A.reset();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         const size_t k( i*N+j );
+         A(k,k) = 4;
+         if( j+1UL < N ) A(k,k+1UL) = -1;
+         if( i+1UL < N ) A(k,k+N)   = -1;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix LLH decomposition.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix LLH test.
+*/
+#define RUN_LLH_SPARSE_TEST \
+   blazetest::mathtest::llh::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace llh
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,746 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lse/KrylovTest.h
+//  \brief Header file for the Krylov solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LSE_KRYLOVTEST_H_
+#define _BLAZETEST_MATHTEST_LSE_KRYLOVTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Krylov.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lse {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all Krylov solver tests.
+//
+// This class represents a test suite for the iterative Krylov solvers of the Blaze library. It
+// solves discretized diffusion and convection-diffusion problems of various sizes with all
+// solvers, with and without preconditioner, and with both matrices and user-defined linear
+// operators.
+*/
+class KrylovTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KrylovTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testCG         ( size_t n );
+   template< typename Type > void testMINRES     ( size_t n );
+   template< typename Type > void testBiCGSTAB   ( size_t n );
+   template< typename Type > void testGMRES      ( size_t n );
+   template< typename Type > void testOperator   ( size_t n );
+   template< typename Type > void testInitialGuess();
+   template< typename Type > void testErrors     ();
+
+   template< typename MT, typename VT >
+   void checkSolution( const MT& A, const VT& x, const VT& b,
+                       const blaze::SolverStatistics& stats, const std::string& solver );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void initialize( MT& A, size_t n, double shift, double convection );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conjugate gradient method.
+//
+// \param n The number of grid points per dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the cg() function by means of the 2D Laplace operator on a \f$ n \times n
+// \f$ grid, both without preconditioner and with a Jacobi and an incomplete Cholesky
+// preconditioner. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testCG( size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::IncompleteCholesky;
+   using blaze::JacobiPreconditioner;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "CG";
+
+   CompressedMatrix<Type,rowMajor> A1;
+   initialize( A1, n, 0.0, 0.0 );
+
+   const CompressedMatrix<Type,columnMajor> A2( A1 );
+
+   DynamicVector<Type> b( n*n );
+   randomize( b );
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A1, x, b, cg( A1, x, b ), "Row-major CG" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A2, x, b, cg( A2, x, b ), "Column-major CG" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      const JacobiPreconditioner<Type> M( A1 );
+      checkSolution( A1, x, b, cg( A1, x, b, M ), "Jacobi preconditioned CG" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      const IncompleteCholesky<Type> M( A1 );
+      checkSolution( A1, x, b, cg( A1, x, b, M ), "IC(0) preconditioned CG" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      const IncompleteCholesky<Type,columnMajor> M( A2 );
+      checkSolution( A2, x, b, cg( A2, x, b, M ), "IC(0) preconditioned column-major CG" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the minimal residual method.
+//
+// \param n The number of grid points per dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the minres() function by means of the shifted, indefinite 2D Laplace
+// operator on a \f$ n \times n \f$ grid, both without and with a Jacobi preconditioner. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testMINRES( size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::JacobiPreconditioner;
+   using blaze::rowMajor;
+
+   test_ = "MINRES";
+
+   CompressedMatrix<Type,rowMajor> A;
+   initialize( A, n, 1.5, 0.0 );
+
+   DynamicVector<Type> b( n*n );
+   randomize( b );
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A, x, b, minres( A, x, b ), "MINRES" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      const JacobiPreconditioner<Type> M( A );
+      checkSolution( A, x, b, minres( A, x, b, M ), "Jacobi preconditioned MINRES" );
+   }
+
+   if( n > 1UL )
+   {
+      initialize( A, n, 0.0, 0.0 );
+
+      DynamicVector<Type> x;
+      checkSolution( A, x, b, minres( A, x, b ), "Positive definite MINRES" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the biconjugate gradient stabilized method.
+//
+// \param n The number of grid points per dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the bicgstab() function by means of a 2D convection-diffusion operator
+// on a \f$ n \times n \f$ grid, both without and with an incomplete LU preconditioner. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testBiCGSTAB( size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::IncompleteLU;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "BiCGSTAB";
+
+   CompressedMatrix<Type,rowMajor> A1;
+   initialize( A1, n, 0.0, 0.5 );
+
+   const CompressedMatrix<Type,columnMajor> A2( A1 );
+
+   DynamicVector<Type> b( n*n );
+   randomize( b );
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A1, x, b, bicgstab( A1, x, b ), "Row-major BiCGSTAB" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A2, x, b, bicgstab( A2, x, b ), "Column-major BiCGSTAB" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      const IncompleteLU<Type> M( A1 );
+      checkSolution( A1, x, b, bicgstab( A1, x, b, M ), "ILU(0) preconditioned BiCGSTAB" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      const IncompleteLU<Type> M( A1, 1E-3, 5UL );
+      checkSolution( A1, x, b, bicgstab( A1, x, b, M ), "ILUT preconditioned BiCGSTAB" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restarted generalized minimal residual method.
+//
+// \param n The number of grid points per dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the gmres() function by means of a 2D convection-diffusion operator on
+// a \f$ n \times n \f$ grid, both without and with an incomplete LU preconditioner and with
+// different restart lengths. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void KrylovTest::testGMRES( size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::IncompleteLU;
+   using blaze::SolverSettings;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "GMRES";
+
+   CompressedMatrix<Type,rowMajor> A1;
+   initialize( A1, n, 0.0, 0.5 );
+
+   const CompressedMatrix<Type,columnMajor> A2( A1 );
+
+   DynamicVector<Type> b( n*n );
+   randomize( b );
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A1, x, b, gmres( A1, x, b ), "GMRES(30)" );
+   }
+
+   {
+      SolverSettings settings;
+      settings.restart = 5UL;
+      settings.maxIterations = 5000UL;
+
+      DynamicVector<Type> x;
+      checkSolution( A2, x, b, gmres( A2, x, b, settings ), "Column-major GMRES(5)" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      const IncompleteLU<Type> M( A1 );
+      checkSolution( A1, x, b, gmres( A1, x, b, M ), "ILU(0) preconditioned GMRES(30)" );
+   }
+
+   {
+      SolverSettings settings;
+      settings.restart = 3UL;
+
+      DynamicVector<Type> x;
+      const IncompleteLU<Type,columnMajor> M( A2, 1E-3, 5UL );
+      checkSolution( A2, x, b, gmres( A2, x, b, M, settings ), "ILUT preconditioned GMRES(3)" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Krylov solvers with user-defined linear operators.
+//
+// \param n The number of grid points per dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Krylov solvers with a matrix-free linear operator given as lambda
+// and with a dense system matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testOperator( size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   test_ = "User-defined linear operator";
+
+   CompressedMatrix<Type,rowMajor> A, C;
+   initialize( A, n, 0.0, 0.0 );
+   initialize( C, n, 0.0, 0.5 );
+
+   const auto op1 = [&A]( DynamicVector<Type>& y, const DynamicVector<Type>& x ) { y = A * x; };
+   const auto op2 = [&C]( DynamicVector<Type>& y, const DynamicVector<Type>& x ) { y = C * x; };
+
+   DynamicVector<Type> b( n*n );
+   randomize( b );
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A, x, b, cg( op1, x, b ), "Matrix-free CG" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( A, x, b, minres( op1, x, b ), "Matrix-free MINRES" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( C, x, b, bicgstab( op2, x, b ), "Matrix-free BiCGSTAB" );
+   }
+
+   {
+      DynamicVector<Type> x;
+      checkSolution( C, x, b, gmres( op2, x, b ), "Matrix-free GMRES" );
+   }
+
+   {
+      const DynamicMatrix<Type,rowMajor> D( C );
+
+      DynamicVector<Type> x;
+      checkSolution( D, x, b, gmres( D, x, b ), "Dense GMRES" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Krylov solvers with an initial guess and a zero right-hand side.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the Krylov solvers use the given solution vector as initial guess
+// and that a zero right-hand side results in a zero solution. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testInitialGuess()
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   CompressedMatrix<Type,rowMajor> A;
+   initialize( A, 10UL, 0.0, 0.0 );
+
+   {
+      test_ = "Exact initial guess";
+
+      DynamicVector<Type> x( 100UL ), b;
+      randomize( x );
+      b = A * x;
+
+      const DynamicVector<Type> x0( x );
+
+      const blaze::SolverStatistics stats( cg( A, x, b ) );
+
+      if( !stats.converged || stats.iterations != 0UL || x != x0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Exact initial guess was modified\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Iterations: " << stats.iterations << "\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n" << x0 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Zero right-hand side";
+
+      DynamicVector<Type> x( 100UL ), b( 100UL, Type(0) );
+      randomize( x );
+
+      const blaze::SolverStatistics stats( gmres( A, x, b ) );
+
+      if( !stats.converged || !isZero( x ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with zero right-hand side failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error detection of the Krylov solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the Krylov solvers and preconditioners detect invalid arguments.
+// In case an error is not detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testErrors()
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::JacobiPreconditioner;
+   using blaze::rowMajor;
+
+   {
+      test_ = "Non-square system matrix";
+
+      const CompressedMatrix<Type,rowMajor> A( 3UL, 4UL );
+      const DynamicVector<Type> b( 3UL, Type(1) );
+      DynamicVector<Type> x;
+
+      try {
+         cg( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with non-square system matrix succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Non-matching right-hand side";
+
+      CompressedMatrix<Type,rowMajor> A;
+      initialize( A, 2UL, 0.0, 0.0 );
+
+      const DynamicVector<Type> b( 3UL, Type(1) );
+      DynamicVector<Type> x;
+
+      try {
+         gmres( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with invalid right-hand side succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Zero diagonal element";
+
+      CompressedMatrix<Type,rowMajor> A( 2UL, 2UL );
+      A(0,0) = Type(1);
+      A(0,1) = Type(1);
+      A(1,0) = Type(1);
+
+      try {
+         const JacobiPreconditioner<Type> M( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Jacobi preconditioner with zero diagonal element succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Indefinite preconditioner";
+
+      CompressedMatrix<Type,rowMajor> A, B;
+      initialize( A, 3UL, 0.0, 0.0 );
+      B = -A;
+
+      const JacobiPreconditioner<Type> M( B );
+      const DynamicVector<Type> b( 9UL, Type(1) );
+      DynamicVector<Type> x;
+
+      try {
+         minres( A, x, b, M );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: MINRES with indefinite preconditioner succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution computed by a Krylov solver.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param stats The statistics of the solver run.
+// \param solver The label of the solver.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver has converged and that the relative residual of the
+// computed solution is close to the default tolerance. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT    // Type of the system matrix
+        , typename VT >  // Type of the vectors
+void KrylovTest::checkSolution( const MT& A, const VT& x, const VT& b,
+                                const blaze::SolverStatistics& stats, const std::string& solver )
+{
+   using Type = blaze::ElementType_t<VT>;
+
+   const double bnorm( blaze::real( norm( b ) ) );
+   const double residual( bnorm == 0.0 ? 0.0 : blaze::real( norm( b - A*x ) ) / bnorm );
+
+   if( !stats.converged || residual > 1E-7 ||
+       stats.history.size() != stats.iterations || stats.products < stats.iterations ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << solver << " failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Number of rows: " << A.rows() << "\n"
+          << "   Converged: " << stats.converged << "\n"
+          << "   Iterations: " << stats.iterations << "\n"
+          << "   Operator applications: " << stats.products << "\n"
+          << "   Reported residual: " << stats.residual << "\n"
+          << "   Actual residual: " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a 2D convection-diffusion operator.
+//
+// \param A The sparse matrix to be initialized.
+// \param n The number of grid points per dimension.
+// \param shift The shift subtracted from the diagonal.
+// \param convection The strength of the convection in both dimensions.
+// \return void
+//
+// This function initializes the given matrix with the 5-point finite difference discretization
+// of the 2D Laplace operator on a \f$ n \times n \f$ grid, shifted by \a shift and with an
+// upwind discretization of a constant convection. A zero convection results in a symmetric
+// matrix, a shift larger than the smallest eigenvalue results in an indefinite matrix.
+*/
+template< typename MT >  // Type of the sparse matrix
+void KrylovTest::initialize( MT& A, size_t n, double shift, double convection )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   const size_t N( n*n );
+
+   A.reset();
+   A.resize( N, N, false );
+   A.reserve( 5UL*N );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const size_t row( i / n );
+      const size_t col( i % n );
+
+      if( row > 0UL )
+         A.append( i, i-n, Type( -1.0-convection ) );
+      if( col > 0UL )
+         A.append( i, i-1UL, Type( -1.0-convection ) );
+      A.append( i, i, Type( 4.0+2.0*convection-shift ) );
+      if( col+1UL < n )
+         A.append( i, i+1UL, Type( -1.0 ) );
+      if( row+1UL < n )
+         A.append( i, i+n, Type( -1.0 ) );
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Krylov solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   KrylovTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Krylov solver test.
+*/
+#define RUN_LSE_KRYLOV_TEST \
+   blazetest::mathtest::lse::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lse
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,665 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lse/SparseTest.h
+//  \brief Header file for the sparse matrix LSE test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LSE_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_LSE_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/UniUpperMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lse {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse matrix LSE tests.
+//
+// This class represents a test suite for the sparse triangular LSE kernels. It solves a series
+// of LSEs with various sizes and sparsity patterns on all sparse triangular matrix types of the
+// Blaze library, both by plain substitution and by means of a level schedule.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testLower   ( size_t N );
+   template< typename Type > void testUniLower( size_t N );
+   template< typename Type > void testUpper   ( size_t N );
+   template< typename Type > void testUniUpper( size_t N );
+   template< typename Type > void testDiagonal( size_t N );
+   template< typename Type > void testDecl    ( size_t N );
+   template< typename Type > void testErrors  ();
+
+   template< typename MT1, typename MT2 >
+   void checkLSE( const MT1& A1, const MT2& A2 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void initialize( MT& A, bool lower, bool unit );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the LSE kernels with random \f$ N \times N \f$ sparse lower matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix LSE kernels for random \f$ N \times N \f$ lower
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testLower( size_t N )
+{
+   using blaze::LowerMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Lower LSE";
+
+   LowerMatrix< CompressedMatrix<Type,rowMajor> > A1( N );
+   initialize( A1, true, false );
+
+   const LowerMatrix< CompressedMatrix<Type,columnMajor> > A2( A1 );
+
+   checkLSE( A1, A2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LSE kernels with random \f$ N \times N \f$ sparse unilower matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix LSE kernels for random \f$ N \times N \f$ unilower
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testUniLower( size_t N )
+{
+   using blaze::UniLowerMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "UniLower LSE";
+
+   UniLowerMatrix< CompressedMatrix<Type,rowMajor> > A1( N );
+   initialize( A1, true, true );
+
+   const UniLowerMatrix< CompressedMatrix<Type,columnMajor> > A2( A1 );
+
+   checkLSE( A1, A2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LSE kernels with random \f$ N \times N \f$ sparse upper matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix LSE kernels for random \f$ N \times N \f$ upper
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testUpper( size_t N )
+{
+   using blaze::UpperMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Upper LSE";
+
+   UpperMatrix< CompressedMatrix<Type,rowMajor> > A1( N );
+   initialize( A1, false, false );
+
+   const UpperMatrix< CompressedMatrix<Type,columnMajor> > A2( A1 );
+
+   checkLSE( A1, A2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LSE kernels with random \f$ N \times N \f$ sparse uniupper matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix LSE kernels for random \f$ N \times N \f$ uniupper
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testUniUpper( size_t N )
+{
+   using blaze::UniUpperMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "UniUpper LSE";
+
+   UniUpperMatrix< CompressedMatrix<Type,rowMajor> > A1( N );
+   initialize( A1, false, true );
+
+   const UniUpperMatrix< CompressedMatrix<Type,columnMajor> > A2( A1 );
+
+   checkLSE( A1, A2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LSE kernels with random \f$ N \times N \f$ sparse diagonal matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix LSE kernels for random \f$ N \times N \f$ diagonal
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testDiagonal( size_t N )
+{
+   using blaze::DiagonalMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Diagonal LSE";
+
+   DiagonalMatrix< CompressedMatrix<Type,rowMajor> > A1( N );
+   initialize( A1, true, false );
+
+   const DiagonalMatrix< CompressedMatrix<Type,columnMajor> > A2( A1 );
+
+   checkLSE( A1, A2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LSE kernels with declared \f$ N \times N \f$ sparse triangular matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix LSE kernels for general \f$ N \times N \f$ compressed
+// matrices that are declared as lower or upper matrices via the decllow() and declupp()
+// operations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testDecl( size_t N )
+{
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   {
+      test_ = "Declared lower LSE";
+
+      CompressedMatrix<Type,rowMajor> A1( N, N );
+      initialize( A1, true, false );
+
+      const CompressedMatrix<Type,columnMajor> A2( A1 );
+
+      checkLSE( decllow( A1 ), decllow( A2 ) );
+   }
+
+   {
+      test_ = "Declared upper LSE";
+
+      CompressedMatrix<Type,rowMajor> A1( N, N );
+      initialize( A1, false, false );
+
+      const CompressedMatrix<Type,columnMajor> A2( A1 );
+
+      checkLSE( declupp( A1 ), declupp( A2 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse matrix LSE kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the error handling of the sparse matrix LSE kernels for singular system
+// matrices, non-matching right-hand side vectors, and non-matching level schedules. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testErrors()
+{
+   using blaze::LowerMatrix;
+   using blaze::UpperMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::LevelSchedule;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::solve;
+
+   {
+      test_ = "Singular lower LSE (row-major)";
+
+      LowerMatrix< CompressedMatrix<Type,rowMajor> > A( 3UL );
+      A(0,0) = Type(1);
+      A(2,1) = Type(2);
+      A(2,2) = Type(3);
+
+      const DynamicVector<Type> b( 3UL, Type(1) );
+      DynamicVector<Type> x;
+
+      bool failed( false );
+
+      try {
+         solve( A, x, b );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with singular system matrix succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Singular upper LSE (column-major)";
+
+      UpperMatrix< CompressedMatrix<Type,columnMajor> > A( 3UL );
+      A(0,0) = Type(1);
+      A(0,2) = Type(2);
+      A(2,2) = Type(3);
+
+      const DynamicVector<Type> b( 3UL, Type(1) );
+      DynamicVector<Type> x;
+
+      bool failed( false );
+
+      try {
+         solve( A, x, b, LevelSchedule( A ) );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with singular system matrix succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Lower LSE (non-matching right-hand side)";
+
+      LowerMatrix< CompressedMatrix<Type,rowMajor> > A( 2UL );
+      A(0,0) = Type(1);
+      A(1,1) = Type(1);
+
+      const DynamicVector<Type> b( 3UL );
+      DynamicVector<Type> x;
+
+      try {
+         solve( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with invalid right-hand side succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Lower LSE (non-matching level schedule)";
+
+      LowerMatrix< CompressedMatrix<Type,rowMajor> > A( 3UL );
+      A(0,0) = Type(1);
+      A(1,1) = Type(1);
+      A(2,2) = Type(1);
+
+      const LevelSchedule schedule( A );
+
+      A(2,0) = Type(2);
+
+      const DynamicVector<Type> b( 3UL, Type(1) );
+      DynamicVector<Type> x;
+
+      try {
+         solve( A, x, b, schedule );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with invalid level schedule succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Lower LSE (level schedule of a column-major matrix)";
+
+      LowerMatrix< CompressedMatrix<Type,rowMajor> > A( 2UL );
+      A(0,0) = Type(1);
+      A(1,1) = Type(1);
+
+      const LowerMatrix< CompressedMatrix<Type,columnMajor> > B( A );
+      const LevelSchedule schedule( B );
+
+      const DynamicVector<Type> b( 2UL, Type(1) );
+      DynamicVector<Type> x;
+
+      try {
+         solve( A, x, b, schedule );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with invalid level schedule succeeded\n"
+             << " Details:\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the LSE with the given row-major and column-major system matrices.
+//
+// \param A1 The row-major system matrix.
+// \param A2 The column-major system matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves the LSE with the given row-major and column-major system matrices both
+// by plain substitution and by means of a level schedule and checks the resulting solutions.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the row-major system matrix
+        , typename MT2 >  // Type of the column-major system matrix
+void SparseTest::checkLSE( const MT1& A1, const MT2& A2 )
+{
+   using blaze::DynamicVector;
+   using blaze::LevelSchedule;
+   using blaze::solve;
+
+   using Type = blaze::ElementType_t<MT1>;
+
+   const size_t N( A1.rows() );
+
+   DynamicVector<Type> b( N );
+   randomize( b );
+
+   const LevelSchedule schedule1( A1 );
+   const LevelSchedule schedule2( A2 );
+
+   DynamicVector<Type> x1, x2, x3, x4;
+
+   solve( A1, x1, b );
+   solve( A2, x2, b );
+   solve( A1, x3, b, schedule1 );
+   solve( A2, x4, b, schedule2 );
+
+   if( A1*x1 != b || A2*x2 != b || A1*x3 != b || A2*x4 != b ||
+       x1 != x2 || x1 != x3 || x1 != x4 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving LSE failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   System matrix (A):\n" << A1 << "\n"
+          << "   Right-hand side (b):\n" << b << "\n"
+          << "   Row-major solution (x1):\n" << x1 << "\n"
+          << "   Column-major solution (x2):\n" << x2 << "\n"
+          << "   Scheduled row-major solution (x3):\n" << x3 << "\n"
+          << "   Scheduled column-major solution (x4):\n" << x4 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( schedule1.levels() != schedule2.levels() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inconsistent level schedules detected\n"
+          << " Details:\n"
+          << "   System matrix (A):\n" << A1 << "\n"
+          << "   Number of row-major levels: " << schedule1.levels() << "\n"
+          << "   Number of column-major levels: " << schedule2.levels() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Solving the LSE in-place
+   x1 = b;
+   solve( A1, x1, x1, schedule1 );
+
+   if( x1 != x3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving LSE in-place failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   System matrix (A):\n" << A1 << "\n"
+          << "   Right-hand side (b):\n" << b << "\n"
+          << "   Result:\n" << x1 << "\n"
+          << "   Expected result:\n" << x3 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given sparse triangular matrix with a random sparsity pattern.
+//
+// \param A The sparse matrix to be initialized.
+// \param lower \a true to fill the lower part of the matrix, \a false for the upper part.
+// \param unit \a true in case the diagonal of the matrix must not be modified.
+// \return void
+//
+// This function initializes the given matrix with on average three random off-diagonal
+// elements per row and a diagonal that dominates the off-diagonal elements.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::initialize( MT& A, bool lower, bool unit )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   const size_t N( A.rows() );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( !unit ) {
+         A(i,i) = Type(4) + blaze::rand<Type>();
+      }
+      if( !blaze::IsDiagonal_v<MT> ) {
+         for( size_t j=( lower ? 0UL : i+1UL ); j<( lower ? i : N ); ++j ) {
+            if( blaze::rand<size_t>( 0UL, N ) < 3UL )
+               A(i,j) = blaze::rand<Type>();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix LSE kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix LSE test.
+*/
+#define RUN_LSE_SPARSE_TEST \
+   blazetest::mathtest::lse::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lse
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,559 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lu/SparseTest.h
+//  \brief Header file for the sparse matrix LU test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LU_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_LU_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lu {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse matrix LU tests.
+//
+// This class represents a test suite for the incomplete LU decomposition of sparse matrices.
+// It performs a series of ILU(0) and ILUT decompositions and applies the resulting
+// preconditioners.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT > void testILU0( size_t N );
+   template< typename MT > void testTridiagonal( size_t N );
+   template< typename MT > void testILUT( size_t N );
+   template< typename MT > void testErrors();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void convection( MT& A, size_t N );
+   template< typename MT > void random( MT& A, size_t N );
+   template< typename MT > void split( const MT& F, MT& L, MT& U );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ILU(0) decomposition.
+//
+// \param N The number of grid points in each dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the ilu0() function and the ILU(0) preconditioner with a non-symmetric
+// convection-diffusion operator on an \f$ N \times N \f$ grid. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::testILU0( size_t N )
+{
+   using Type = blaze::ElementType_t<MT>;
+   using SO   = blaze::StorageOrder<MT>;
+
+   test_ = "ILU(0) decomposition";
+
+   MT A;
+   convection( A, N );
+
+   MT F( A );
+   blaze::ilu0( F );
+
+   if( F.nonZeros() != A.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: ILU(0) decomposition changed the sparsity pattern\n"
+          << " Details:\n"
+          << "   Non-zeros of the matrix: " << A.nonZeros() << "\n"
+          << "   Non-zeros of the factors: " << F.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   MT L, U;
+   split( F, L, U );
+
+   const MT LU( L * U );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( A.find( i, j ) != A.end( SO::value ? j : i ) && !blaze::equal( LU(i,j), A(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: ILU(0) decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Position: (" << i << "," << j << ")\n"
+                << "   Matrix element: " << A(i,j) << "\n"
+                << "   Product element: " << LU(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   const blaze::IncompleteLU<Type,SO::value> ilu( A );
+
+   blaze::DynamicVector<Type> b( A.rows() );
+   randomize( b );
+
+   const blaze::DynamicVector<Type> y( ilu( b ) );
+
+   if( L * ( U * y ) != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Application of ILU(0) preconditioner failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Vector:\n" << b << "\n"
+          << "   Result:\n" << y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ILU(0) preconditioner with tridiagonal matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the ILU(0) preconditioner with tridiagonal matrices, for which the ILU(0)
+// decomposition is identical to the complete LU decomposition. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::testTridiagonal( size_t N )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   test_ = "ILU(0) of tridiagonal matrix";
+
+   MT A( N, N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      A(i,i) = Type(4);
+      if( i > 0UL ) A(i,i-1UL) = blaze::rand<Type>( -1, 1 );
+      if( i+1UL < N ) A(i,i+1UL) = blaze::rand<Type>( -1, 1 );
+   }
+
+   const blaze::IncompleteLU<Type,blaze::StorageOrder<MT>::value> ilu( A );
+
+   blaze::DynamicVector<Type> b( N ), y( b );
+   randomize( b );
+
+   ilu.apply( y, b );
+
+   if( A * y != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving tridiagonal LSE failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   System matrix (A):\n" << A << "\n"
+          << "   Right-hand side (b):\n" << b << "\n"
+          << "   Solution (y):\n" << y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ILUT decomposition.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the ILUT decomposition with random, diagonally dominant matrices. Without
+// dropping the ILUT decomposition has to be identical to the complete LU decomposition, with
+// dropping the number of elements of the factors has to be bounded by the fill parameter. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::testILUT( size_t N )
+{
+   using Type = blaze::ElementType_t<MT>;
+   using SO   = blaze::StorageOrder<MT>;
+
+   test_ = "ILUT decomposition";
+
+   MT A;
+   random( A, N );
+
+   blaze::DynamicVector<Type> b( N ), y;
+   randomize( b );
+
+   {
+      const blaze::IncompleteLU<Type,SO::value> ilut( A, 0.0, N );
+      ilut.apply( y, b );
+
+      if( A * y != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: ILUT decomposition without dropping failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Solution (y):\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const size_t fill( 2UL );
+      const blaze::IncompleteLU<Type,SO::value> ilut( A, 1E-2, fill );
+
+      if( ilut.nonZeros() > N*( 2UL*fill + 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: ILUT decomposition exceeds the fill limit\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Non-zeros of the factors: " << ilut.nonZeros() << "\n"
+             << "   Limit: " << N*( 2UL*fill + 1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      MT L, U;
+      split( ilut.factors(), L, U );
+
+      y = ilut( b );
+
+      if( L * ( U * y ) != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Application of ILUT preconditioner failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Vector:\n" << b << "\n"
+             << "   Result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the incomplete LU decompositions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the error handling of the incomplete LU decompositions for non-square
+// matrices, missing diagonal elements, and invalid drop tolerances. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::testErrors()
+{
+   {
+      test_ = "ILU(0) of non-square matrix";
+
+      MT A( 2UL, 3UL );
+      A(0,0) = 1;
+      A(1,1) = 1;
+
+      try {
+         blaze::ilu0( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: ILU(0) decomposition of non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "ILU(0) with missing diagonal element";
+
+      MT A( 2UL, 2UL );
+      A(0,1) = 1;
+      A(1,0) = 1;
+      A(1,1) = 1;
+
+      bool failed( false );
+
+      try {
+         blaze::ilu0( A );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: ILU(0) decomposition of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "ILUT with invalid drop tolerance";
+
+      MT A( 2UL, 2UL );
+      A(0,0) = 1;
+      A(1,1) = 1;
+
+      try {
+         blaze::ilut( A, -1.0, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: ILUT decomposition with negative drop tolerance succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a non-symmetric convection-diffusion operator.
+//
+// \param A The sparse matrix to be initialized.
+// \param N The number of grid points in each dimension.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::convection( MT& A, size_t N )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   A.resize( N*N, N*N, false );
+   A.reset();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         const size_t k( i*N+j );
+         A(k,k) = Type(4);
+         if( j+1UL < N ) {
+            A(k,k+1UL) = Type(-0.8);
+            A(k+1UL,k) = Type(-1.2);
+         }
+         if( i+1UL < N ) {
+            A(k,k+N) = Type(-0.9);
+            A(k+N,k) = Type(-1.1);
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a random, diagonally dominant sparse matrix.
+//
+// \param A The sparse matrix to be initialized.
+// \param N The number of rows and columns of the matrix.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::random( MT& A, size_t N )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   A.resize( N, N, false );
+   A.reset();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      A(i,i) = Type(1);
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i != j && blaze::rand<size_t>( 0UL, N ) < 3UL ) {
+            const Type value( blaze::rand<Type>( -1, 1 ) );
+            A(i,j)  = value;
+            A(i,i) += std::abs( value );
+            A(j,j) += std::abs( value );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Splitting the combined factors into the unit lower factor L and the upper factor U.
+//
+// \param F The combined factors.
+// \param L The resulting unit lower factor.
+// \param U The resulting upper factor.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparseTest::split( const MT& F, MT& L, MT& U )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   const size_t N( F.rows() );
+
+   L.resize( N, N, false );
+   U.resize( N, N, false );
+   L.reset();
+   U.reset();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( blaze::isDefault<blaze::strict>( F(i,j) ) ) continue;
+         if( j < i ) L(i,j) = F(i,j);
+         else        U(i,j) = F(i,j);
+      }
+      L(i,i) = Type(1);
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix LU decomposition.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix LU test.
+*/
+#define RUN_LU_SPARSE_TEST \
+   blazetest::mathtest::lu::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lu
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -98,7 +98,9 @@
 #include <blaze/math/typetraits/HasSIMDBitor.h>
 #include <blaze/math/typetraits/HasSIMDBitxor.h>
 #include <blaze/math/typetraits/HasSIMDCbrt.h>
+#include <blaze/math/typetraits/HasSIMDBlend.h>
 #include <blaze/math/typetraits/HasSIMDCeil.h>
+#include <blaze/math/typetraits/HasSIMDCompare.h>
 #include <blaze/math/typetraits/HasSIMDConj.h>
 #include <blaze/math/typetraits/HasSIMDCos.h>
 #include <blaze/math/typetraits/HasSIMDCosh.h>
@@ -116,6 +118,7 @@
 #include <blaze/math/typetraits/HasSIMDLog.h>
 #include <blaze/math/typetraits/HasSIMDLog2.h>
 #include <blaze/math/typetraits/HasSIMDLog10.h>
+#include <blaze/math/typetraits/HasSIMDMaskload.h>
 #include <blaze/math/typetraits/HasSIMDMax.h>
 #include <blaze/math/typetraits/HasSIMDMin.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
@@ -200,6 +203,8 @@ class OperationTest : private blaze::NonCopyable
    void testStoreu        ( size_t offset );
    void testStream        ();
    void testSet           ();
+   void testMaskload      ( blaze::TrueType  );
+   void testMaskload      ( blaze::FalseType );
 
    void testEquality      ( blaze::TrueType , blaze::TrueType  );
    void testEquality      ( blaze::TrueType , blaze::FalseType );
@@ -244,6 +249,11 @@ class OperationTest : private blaze::NonCopyable
    void testMax           ( blaze::TrueType  );
    void testMax           ( blaze::FalseType );
 
+   void testCompare       ( blaze::TrueType  );
+   void testCompare       ( blaze::FalseType );
+   void testBlend         ( blaze::TrueType  );
+   void testBlend         ( blaze::FalseType );
+
    void testAbs           ( blaze::TrueType  );
    void testAbs           ( blaze::FalseType );
    void testSign          ( blaze::TrueType  );
@@ -402,6 +412,7 @@ OperationTest<T>::OperationTest()
 
    testStream        ();
    testSet           ();
+   testMaskload      ( blaze::HasSIMDMaskload<T>() );
 
    testEquality      ( blaze::HasSIMDEqual<T,T>(), blaze::IsFloatingPoint<T>() );
    testInequality    ( blaze::HasSIMDEqual<T,T>(), blaze::IsFloatingPoint<T>() );
@@ -425,6 +436,9 @@ OperationTest<T>::OperationTest()
    testMin           ( blaze::HasSIMDMin<T,T>() );
    testMax           ( blaze::HasSIMDMax<T,T>() );
 
+   testCompare       ( blaze::HasSIMDCompare<T,T>() );
+   testBlend         ( blaze::HasSIMDBlend<T,T>() );
+
    testAbs           ( blaze::HasSIMDAbs < T >() );
    testSign          ( blaze::HasSIMDSign< T >() );
 
@@ -593,6 +607,66 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked load and store operations.
+//
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked load and store operations by copying the first elements of
+// one array to another via masked load and store. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskload( blaze::TrueType )
+{
+   using blaze::loadu;
+   using blaze::maskload;
+   using blaze::maskstore;
+   using blaze::storeu;
+
+   test_  = "maskload() and maskstore() operations";
+
+   for( size_t n=0UL; n<=SIMDSIZE; ++n )
+   {
+      initialize();
+
+      for( size_t i=0UL; i<N; ++i ) {
+         c_[i] = ( i < n )?( a_[i] ):( b_[i] );
+         e_[i] = ( i < n )?( a_[i] ):( T() );
+      }
+
+      maskstore( b_, maskload( a_, n ), n );
+      compare( c_, b_ );
+
+      for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+         storeu( d_+i, maskload( a_+i, n ) );
+      }
+
+      for( size_t i=SIMDSIZE; i<N; ++i ) {
+         e_[i] = ( i % SIMDSIZE < n )?( a_[i] ):( T() );
+      }
+
+      compare( e_, d_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the masked load and store operations.
+//
+// \return void
+//
+// This function is called in case the masked load and store operations are not available for
+// the given data type \a T.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testMaskload( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the set operation.
 //
@@ -1703,6 +1777,239 @@ void OperationTest<T>::testMax( blaze::FalseType )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the comparison operations.
+//
+// \return void
+// \exception std::runtime_error Error in comparison operation detected.
+//
+// This function tests the comparison operations by comparing the results of vectorized and
+// scalar selections based on the six relational operators. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testCompare( blaze::TrueType )
+{
+   using blaze::loada;
+   using blaze::storea;
+   using blaze::select;
+   using blaze::cmpeq;
+   using blaze::cmpneq;
+   using blaze::cmplt;
+   using blaze::cmple;
+   using blaze::cmpgt;
+   using blaze::cmpge;
+
+   initialize();
+
+   for( size_t i=0UL; i<N; i+=3UL ) {
+      b_[i] = a_[i];
+   }
+
+
+   //=====================================================================================
+   // Equality comparison
+   //=====================================================================================
+
+   test_ = "Equality comparison";
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( a_[i] == b_[i] )?( a_[i] ):( e_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, select( cmpeq( loada( a_+i ), loada( b_+i ) ),
+                            loada( a_+i ), loada( e_+i ) ) );
+   }
+
+   compare( c_, d_ );
+
+
+   //=====================================================================================
+   // Inequality comparison
+   //=====================================================================================
+
+   test_ = "Inequality comparison";
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( a_[i] != b_[i] )?( a_[i] ):( e_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, select( cmpneq( loada( a_+i ), loada( b_+i ) ),
+                            loada( a_+i ), loada( e_+i ) ) );
+   }
+
+   compare( c_, d_ );
+
+
+   //=====================================================================================
+   // Less-than comparison
+   //=====================================================================================
+
+   test_ = "Less-than comparison";
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( a_[i] < b_[i] )?( a_[i] ):( e_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, select( cmplt( loada( a_+i ), loada( b_+i ) ),
+                            loada( a_+i ), loada( e_+i ) ) );
+   }
+
+   compare( c_, d_ );
+
+
+   //=====================================================================================
+   // Less-or-equal-than comparison
+   //=====================================================================================
+
+   test_ = "Less-or-equal-than comparison";
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( a_[i] <= b_[i] )?( a_[i] ):( e_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, select( cmple( loada( a_+i ), loada( b_+i ) ),
+                            loada( a_+i ), loada( e_+i ) ) );
+   }
+
+   compare( c_, d_ );
+
+
+   //=====================================================================================
+   // Greater-than comparison
+   //=====================================================================================
+
+   test_ = "Greater-than comparison";
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( a_[i] > b_[i] )?( a_[i] ):( e_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, select( cmpgt( loada( a_+i ), loada( b_+i ) ),
+                            loada( a_+i ), loada( e_+i ) ) );
+   }
+
+   compare( c_, d_ );
+
+
+   //=====================================================================================
+   // Greater-or-equal-than comparison
+   //=====================================================================================
+
+   test_ = "Greater-or-equal-than comparison";
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( a_[i] >= b_[i] )?( a_[i] ):( e_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, select( cmpge( loada( a_+i ), loada( b_+i ) ),
+                            loada( a_+i ), loada( e_+i ) ) );
+   }
+
+   compare( c_, d_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the comparison operations.
+//
+// \return void
+//
+// This function is called in case the comparison operations are not available for the given
+// data type \a T.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testCompare( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the blend operation.
+//
+// \return void
+// \exception std::runtime_error Error in blend operation detected.
+//
+// This function tests the blend operation by comparing the results of a vectorized and a
+// scalar blend operation. In case any error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testBlend( blaze::TrueType )
+{
+   using blaze::loada;
+   using blaze::storea;
+   using blaze::blend;
+   using blaze::select;
+   using blaze::cmplt;
+
+
+   //=====================================================================================
+   // Blend operation
+   //=====================================================================================
+
+   test_ = "Blend operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( a_[i] < b_[i] )?( b_[i] ):( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, blend( loada( a_+i ), loada( b_+i ),
+                           cmplt( loada( a_+i ), loada( b_+i ) ) ) );
+   }
+
+   compare( c_, d_ );
+
+
+   //=====================================================================================
+   // Selection based on a vector of conditions
+   //=====================================================================================
+
+   test_ = "Selection operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; i+=2UL ) {
+      e_[i] = T();
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ( e_[i] != T() )?( a_[i] ):( b_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, select( loada( e_+i ), loada( a_+i ), loada( b_+i ) ) );
+   }
+
+   compare( c_, d_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the blend operation.
+//
+// \return void
+//
+// This function is called in case the blend operation is not available for the given data
+// type \a T.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testBlend( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the absolute value operation.
 //
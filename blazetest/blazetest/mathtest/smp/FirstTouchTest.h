@@ -0,0 +1,468 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/FirstTouchTest.h
+//  \brief Header file for the parallel first-touch initialization test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_FIRSTTOUCHTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_FIRSTTOUCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <initializer_list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/Tuning.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the parallel first-touch initialization.
+//
+// This class represents a test suite for the parallel first-touch initialization of dense
+// vectors and matrices (see the \c BLAZE_SMP_FIRST_TOUCH switch). It checks the values of all
+// elements and all padding elements of row-major and column-major vectors and matrices of
+// various sizes after their construction and after resizing them, for several numbers of
+// threads. The first-touch mode is selected by the according test source file.
+*/
+template< typename Type >  // Data type of the elements
+class FirstTouchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FirstTouchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testVector();
+   void testMatrix();
+
+   template< bool TF >
+   void checkVector( const blaze::DynamicVector<Type,TF>& v, size_t preserved,
+                     const Type& value, bool initialized ) const;
+
+   template< bool SO >
+   void checkMatrix( const blaze::DynamicMatrix<Type,SO>& A, size_t rows, size_t columns,
+                     const Type& value, bool initialized ) const;
+
+   void checkElement( size_t index, const Type& element, const Type& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The initial number of threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the FirstTouchTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+template< typename Type >  // Data type of the elements
+FirstTouchTest<Type>::FirstTouchTest()
+   : test_   ()
+   , threads_( blaze::getNumThreads() )
+{
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 1UL );
+   blaze::setThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 1UL );
+
+   try {
+      for( size_t t : { 2UL, 3UL, 4UL, 7UL } )
+      {
+#if !BLAZE_HPX_PARALLEL_MODE
+         blaze::setNumThreads( t );
+#endif
+
+         testVector();
+         testMatrix();
+      }
+   }
+   catch( ... ) {
+#if !BLAZE_HPX_PARALLEL_MODE
+      blaze::setNumThreads( threads_ );
+#endif
+      blaze::resetThresholds();
+      throw;
+   }
+
+#if !BLAZE_HPX_PARALLEL_MODE
+   blaze::setNumThreads( threads_ );
+#endif
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel first-touch initialization of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the elements and the padding elements of dense vectors of various
+// sizes after their construction and after increasing their size.
+*/
+template< typename Type >  // Data type of the elements
+void FirstTouchTest<Type>::testVector()
+{
+   const bool active( blaze::getNumThreads() > 1UL );
+   const Type init( 2 );
+
+   for( size_t n : { 1UL, 7UL, 15UL, 16UL, 17UL, 63UL, 64UL, 1000UL, 10007UL, 100000UL } )
+   {
+      {
+         test_ = "Construction of a dense vector without initial value";
+
+         const blaze::DynamicVector<Type,blaze::columnVector> v( n );
+         checkVector( v, 0UL, Type(), active );
+      }
+
+      {
+         test_ = "Construction of a dense vector with initial value";
+
+         const blaze::DynamicVector<Type,blaze::rowVector> v( n, init );
+         checkVector( v, n, init, true );
+      }
+
+      {
+         test_ = "Resizing a dense vector (preserving the elements)";
+
+         blaze::DynamicVector<Type,blaze::columnVector> v( n/3UL, init );
+         v.resize( n, true );
+         checkVector( v, n/3UL, init, active );
+      }
+
+      {
+         test_ = "Resizing a dense vector (without preserving the elements)";
+
+         blaze::DynamicVector<Type,blaze::rowVector> v;
+         v.resize( n, false );
+         checkVector( v, 0UL, Type(), active );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel first-touch initialization of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the elements and the padding elements of row-major and column-major
+// dense matrices of various sizes after their construction and after increasing their size.
+*/
+template< typename Type >  // Data type of the elements
+void FirstTouchTest<Type>::testMatrix()
+{
+   const bool active( blaze::getNumThreads() > 1UL );
+   const Type init( 3 );
+
+   const std::initializer_list< std::pair<size_t,size_t> > sizes =
+      { { 1UL, 1UL }, { 1UL, 100UL }, { 100UL, 1UL }, { 3UL, 17UL }, { 16UL, 16UL },
+        { 17UL, 33UL }, { 64UL, 7UL }, { 257UL, 129UL }, { 1000UL, 300UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size.first  );
+      const size_t n( size.second );
+
+      {
+         test_ = "Construction of a row-major dense matrix without initial value";
+
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n );
+         checkMatrix( A, 0UL, 0UL, Type(), active );
+      }
+
+      {
+         test_ = "Construction of a column-major dense matrix without initial value";
+
+         const blaze::DynamicMatrix<Type,blaze::columnMajor> A( m, n );
+         checkMatrix( A, 0UL, 0UL, Type(), active );
+      }
+
+      {
+         test_ = "Construction of a row-major dense matrix with initial value";
+
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n, init );
+         checkMatrix( A, m, n, init, true );
+      }
+
+      {
+         test_ = "Construction of a column-major dense matrix with initial value";
+
+         const blaze::DynamicMatrix<Type,blaze::columnMajor> A( m, n, init );
+         checkMatrix( A, m, n, init, true );
+      }
+
+      {
+         test_ = "Resizing a row-major dense matrix (preserving the elements)";
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> A( m/2UL, n/3UL, init );
+         A.resize( m, n, true );
+         checkMatrix( A, m/2UL, n/3UL, init, active );
+      }
+
+      {
+         test_ = "Resizing a column-major dense matrix (preserving the elements)";
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> A( m/3UL, n/2UL, init );
+         A.resize( m, n, true );
+         checkMatrix( A, m/3UL, n/2UL, init, active );
+      }
+
+      {
+         test_ = "Resizing a row-major dense matrix (without preserving the elements)";
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> A( m/2UL, n/3UL, init );
+         A.resize( m, n, false );
+         checkMatrix( A, 0UL, 0UL, Type(), active );
+      }
+
+      {
+         test_ = "Resizing a column-major dense matrix (without preserving the elements)";
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> A( m/3UL, n/2UL, init );
+         A.resize( m, n, false );
+         checkMatrix( A, 0UL, 0UL, Type(), active );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements and the padding elements of the given dense vector.
+//
+// \param v The dense vector to be checked.
+// \param preserved The number of leading elements that are expected to be equal to \a value.
+// \param value The expected value of the leading \a preserved elements.
+// \param initialized \a true if the remaining elements are expected to be default initialized.
+// \return void
+// \exception std::runtime_error Invalid element detected.
+*/
+template< typename Type >  // Data type of the elements
+template< bool TF >        // Transpose flag
+void FirstTouchTest<Type>::checkVector( const blaze::DynamicVector<Type,TF>& v, size_t preserved,
+                                        const Type& value, bool initialized ) const
+{
+   const Type* const data( v.data() );
+
+   for( size_t i=0UL; i<preserved; ++i ) {
+      checkElement( i, data[i], value );
+   }
+
+   if( initialized ) {
+      for( size_t i=preserved; i<v.size(); ++i ) {
+         checkElement( i, data[i], Type() );
+      }
+   }
+
+   for( size_t i=v.size(); i<v.capacity(); ++i ) {
+      checkElement( i, data[i], Type() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements and the padding elements of the given dense matrix.
+//
+// \param A The dense matrix to be checked.
+// \param rows The number of leading rows of the block expected to be equal to \a value.
+// \param columns The number of leading columns of the block expected to be equal to \a value.
+// \param value The expected value of all elements of the leading block.
+// \param initialized \a true if the remaining elements are expected to be default initialized.
+// \return void
+// \exception std::runtime_error Invalid element detected.
+*/
+template< typename Type >  // Data type of the elements
+template< bool SO >        // Storage order
+void FirstTouchTest<Type>::checkMatrix( const blaze::DynamicMatrix<Type,SO>& A, size_t rows,
+                                        size_t columns, const Type& value,
+                                        bool initialized ) const
+{
+   const Type* const data( A.data() );
+
+   const size_t outer( SO ? A.columns() : A.rows()    );
+   const size_t inner( SO ? A.rows()    : A.columns() );
+
+   const size_t outerBlock( blaze::min( SO ? columns : rows, outer ) );
+   const size_t innerBlock( blaze::min( SO ? rows : columns, inner ) );
+
+   for( size_t i=0UL; i<outer; ++i )
+   {
+      const size_t begin( i*A.spacing() );
+
+      for( size_t j=0UL; j<inner; ++j ) {
+         if( i < outerBlock && j < innerBlock )
+            checkElement( begin+j, data[begin+j], value );
+         else if( initialized )
+            checkElement( begin+j, data[begin+j], Type() );
+      }
+
+      for( size_t j=inner; j<A.spacing(); ++j ) {
+         checkElement( begin+j, data[begin+j], Type() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a single element of the underlying array of a dense vector or matrix.
+//
+// \param index The index of the element within the underlying array.
+// \param element The element to be checked.
+// \param expected The expected value of the element.
+// \return void
+// \exception std::runtime_error Invalid element detected.
+*/
+template< typename Type >  // Data type of the elements
+void FirstTouchTest<Type>::checkElement( size_t index, const Type& element,
+                                         const Type& expected ) const
+{
+   if( element != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid element detected\n"
+          << " Details:\n"
+          << "   Element type       : " << typeid( Type ).name() << "\n"
+          << "   Number of threads  : " << blaze::getNumThreads() << "\n"
+          << "   Index              : " << index << "\n"
+          << "   Element            : " << element << "\n"
+          << "   Expected value     : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel first-touch initialization for the given element type.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+void runTest()
+{
+   FirstTouchTest<Type>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the parallel first-touch initialization test.
+*/
+#define RUN_SMP_FIRSTTOUCH_TEST( TYPE ) \
+   blazetest::mathtest::smp::runTest<TYPE>()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,1194 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/adaptivevector/ClassTest.cpp
+//  \brief Source file for the AdaptiveVector class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blazetest/mathtest/adaptivevector/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace adaptivevector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AdaptiveVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAt();
+   testSet();
+   testAdd();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testApply();
+   testResize();
+   testReset();
+   testClear();
+   testSwap();
+   testThresholds();
+   testTinyValues();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the AdaptiveVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the AdaptiveVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "AdaptiveVector default constructor";
+
+      const VT vec;
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+      checkDense   ( vec, false );
+   }
+
+   {
+      test_ = "AdaptiveVector size constructor";
+
+      const VT vec( 100UL );
+
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 0UL );
+      checkDense   ( vec, false );
+   }
+
+   {
+      test_ = "AdaptiveVector sparse vector constructor (sparse result)";
+
+      SVT sv( 100UL );
+      sv[3] = 1;
+      sv[50] = 2;
+
+      const VT vec( sv );
+
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 2UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( sv ) );
+   }
+
+   {
+      test_ = "AdaptiveVector sparse vector constructor (dense result)";
+
+      SVT sv( 20UL );
+      sv[3] = 1;
+      sv[5] = 2;
+
+      const VT vec( sv );
+
+      checkSize    ( vec, 20UL );
+      checkNonZeros( vec, 2UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, DVT( sv ) );
+   }
+
+   {
+      test_ = "AdaptiveVector dense vector constructor (sparse result)";
+
+      DVT dv( 100UL, 0 );
+      dv[7] = 4;
+
+      const VT vec( dv );
+
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 1UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, dv );
+   }
+
+   {
+      test_ = "AdaptiveVector dense vector constructor (dense result)";
+
+      DVT dv( 100UL, 0 );
+      for( size_t i=0UL; i<100UL; i+=10UL )
+         dv[i] = int( i+1UL );
+
+      const VT vec( dv );
+
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 10UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, dv );
+   }
+
+   {
+      test_ = "AdaptiveVector copy constructor";
+
+      DVT dv( 100UL, 0 );
+      for( size_t i=0UL; i<100UL; i+=10UL )
+         dv[i] = int( i+1UL );
+
+      const VT vec1( dv );
+      const VT vec2( vec1 );
+
+      checkSize    ( vec2, 100UL );
+      checkNonZeros( vec2, 10UL );
+      checkDense   ( vec2, true );
+      checkValues  ( vec2, dv );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the checked element access of the AdaptiveVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "AdaptiveVector::at()";
+
+   VT vec( 10UL );
+   vec.set( 2UL, 5 );
+
+   if( vec.at(2UL) != 5 || vec.at(3UL) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      vec.at(10UL);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() and \c erase() member functions of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of setting and erasing elements of the AdaptiveVector class
+// template. It checks that the vector switches to the dense representation as soon as the
+// fill exceeds 5% and back to the sparse representation as soon as the fill falls below 2%.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSet()
+{
+   test_ = "AdaptiveVector::set()";
+
+   VT vec( 100UL );
+   DVT ref( 100UL, 0 );
+
+   // Filling the vector up to 5%
+   for( size_t i=0UL; i<5UL; ++i ) {
+      vec.set( i*7UL, int( i+1UL ) );
+      ref[i*7UL] = int( i+1UL );
+   }
+
+   checkNonZeros( vec, 5UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, ref );
+
+   // Overwriting an existing element
+   vec.set( 7UL, 9 );
+   ref[7UL] = 9;
+
+   checkNonZeros( vec, 5UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, ref );
+
+   // Exceeding a fill of 5%
+   vec.set( 99UL, 6 );
+   ref[99UL] = 6;
+
+   checkNonZeros( vec, 6UL );
+   checkDense   ( vec, true );
+   checkValues  ( vec, ref );
+
+   // Erasing elements down to a fill of 2%
+   vec.erase( 0UL );
+   vec.set( 7UL, 0 );
+   vec.erase( 14UL );
+   vec.erase( 21UL );
+   ref[0UL] = ref[7UL] = ref[14UL] = ref[21UL] = 0;
+
+   checkNonZeros( vec, 2UL );
+   checkDense   ( vec, true );
+   checkValues  ( vec, ref );
+
+   // Falling below a fill of 2%
+   vec.erase( 28UL );
+   ref[28UL] = 0;
+
+   checkNonZeros( vec, 1UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, ref );
+
+   // Erasing a non-existing element
+   vec.erase( 50UL );
+
+   checkNonZeros( vec, 1UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, ref );
+
+   // Out-of-bounds access
+   try {
+      vec.set( 100UL, 1 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c add() member function of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c add() member function of the AdaptiveVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAdd()
+{
+   test_ = "AdaptiveVector::add()";
+
+   VT vec( 50UL );
+   DVT ref( 50UL, 0 );
+
+   vec.add( 3UL, 2 );
+   vec.add( 3UL, 3 );
+   ref[3UL] = 5;
+
+   checkNonZeros( vec, 1UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, ref );
+
+   for( size_t i=10UL; i<13UL; ++i ) {
+      vec.add( i, 1 );
+      ref[i] = 1;
+   }
+
+   checkNonZeros( vec, 4UL );
+   checkDense   ( vec, true );
+   checkValues  ( vec, ref );
+
+   vec.add( 10UL, 1 );
+   vec.add( 11UL, -1 );
+   vec.add( 12UL, -1 );
+   vec.add( 3UL, -5 );
+   ref[10UL] = 2;
+   ref[11UL] = ref[12UL] = ref[3UL] = 0;
+
+   checkNonZeros( vec, 1UL );
+   checkDense   ( vec, true );
+   checkValues  ( vec, ref );
+
+   vec.add( 10UL, -2 );
+   ref[10UL] = 0;
+
+   checkNonZeros( vec, 0UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AdaptiveVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the AdaptiveVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "AdaptiveVector dense vector assignment";
+
+      DVT dv( 100UL, 0 );
+      dv[10] = 1;
+      dv[20] = 2;
+
+      VT vec( 10UL );
+      vec = dv;
+
+      // A fill between both thresholds preserves the dense representation
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 2UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, dv );
+
+      dv[20] = 0;
+      vec = dv;
+
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 1UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, dv );
+
+      dv = 3;
+      vec = dv;
+
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 100UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, dv );
+   }
+
+   {
+      test_ = "AdaptiveVector sparse vector assignment";
+
+      DVT dv( 30UL, 1 );
+      VT vec( dv );
+
+      SVT sv( 40UL );
+      sv[39] = 7;
+      vec = sv;
+
+      checkSize    ( vec, 40UL );
+      checkNonZeros( vec, 1UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( sv ) );
+   }
+
+   {
+      test_ = "AdaptiveVector self assignment via the active representation";
+
+      SVT sv( 100UL );
+      sv[1] = 1;
+      sv[2] = 2;
+
+      VT vec( sv );
+      vec = vec.sparse() * 2;
+
+      sv *= 2;
+
+      checkSize    ( vec, 100UL );
+      checkNonZeros( vec, 2UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( sv ) );
+   }
+
+   {
+      test_ = "AdaptiveVector copy assignment";
+
+      DVT dv( 10UL, 2 );
+
+      const VT vec1( dv );
+      VT vec2;
+      vec2 = vec1;
+
+      checkSize    ( vec2, 10UL );
+      checkNonZeros( vec2, 10UL );
+      checkDense   ( vec2, true );
+      checkValues  ( vec2, dv );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AdaptiveVector addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the AdaptiveVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "AdaptiveVector sparse vector addition assignment (sparse representation)";
+
+      SVT sv1( 100UL );
+      sv1[1] = 1;
+      SVT sv2( 100UL );
+      sv2[1] = 2;
+      sv2[2] = 3;
+
+      VT vec( sv1 );
+      vec += sv2;
+
+      checkNonZeros( vec, 2UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( sv1 + sv2 ) );
+   }
+
+   {
+      test_ = "AdaptiveVector sparse vector addition assignment (dense representation)";
+
+      DVT dv( 100UL, 0 );
+      for( size_t i=0UL; i<10UL; ++i )
+         dv[i] = 1;
+
+      SVT sv( 100UL );
+      sv[0] = -1;
+      sv[1] = -1;
+      sv[50] = 5;
+
+      VT vec( dv );
+      vec += sv;
+
+      checkNonZeros( vec, 9UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, dv + sv );
+   }
+
+   {
+      test_ = "AdaptiveVector sparse vector addition assignment (switch to dense)";
+
+      SVT sv( 100UL );
+      for( size_t i=0UL; i<20UL; ++i )
+         sv[i*5UL] = 1;
+
+      VT vec( 100UL );
+      vec += sv;
+
+      checkNonZeros( vec, 20UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, DVT( sv ) );
+   }
+
+   {
+      test_ = "AdaptiveVector sparse vector addition assignment (switch to sparse)";
+
+      DVT dv( 100UL, 0 );
+      for( size_t i=0UL; i<10UL; ++i )
+         dv[i] = 1;
+
+      SVT sv( 100UL );
+      for( size_t i=1UL; i<10UL; ++i )
+         sv[i] = -1;
+
+      VT vec( dv );
+      vec += sv;
+
+      checkNonZeros( vec, 1UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, dv + sv );
+   }
+
+   {
+      test_ = "AdaptiveVector dense vector addition assignment";
+
+      SVT sv( 100UL );
+      sv[4] = 2;
+
+      DVT dv( 100UL, 1 );
+
+      VT vec( sv );
+      vec += dv;
+
+      checkNonZeros( vec, 100UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, sv + dv );
+   }
+
+   {
+      test_ = "AdaptiveVector dense vector addition assignment (aliasing)";
+
+      SVT sv( 100UL );
+      sv[4] = 2;
+
+      DVT dv( 100UL, 1 );
+
+      VT vec( sv );
+      vec += dv + vec.sparse();
+
+      checkNonZeros( vec, 100UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, dv + 2*sv );
+   }
+
+   {
+      test_ = "AdaptiveVector addition assignment (size mismatch)";
+
+      VT vec( 10UL );
+
+      try {
+         vec += SVT( 11UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of vector with invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AdaptiveVector subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the AdaptiveVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   {
+      test_ = "AdaptiveVector sparse vector subtraction assignment (dense representation)";
+
+      DVT dv( 100UL, 2 );
+
+      SVT sv( 100UL );
+      sv[0] = 2;
+      sv[99] = 1;
+
+      VT vec( dv );
+      vec -= sv;
+
+      checkNonZeros( vec, 99UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, dv - sv );
+   }
+
+   {
+      test_ = "AdaptiveVector sparse vector subtraction assignment (sparse representation)";
+
+      SVT sv1( 100UL );
+      sv1[10] = 1;
+      SVT sv2( 100UL );
+      sv2[20] = 1;
+
+      VT vec( sv1 );
+      vec -= sv2;
+
+      checkNonZeros( vec, 2UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( sv1 - sv2 ) );
+   }
+
+   {
+      test_ = "AdaptiveVector dense vector subtraction assignment";
+
+      DVT dv( 100UL, 3 );
+
+      VT vec( dv );
+      vec -= dv;
+
+      checkNonZeros( vec, 0UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( 100UL, 0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AdaptiveVector multiplication assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scaling of the AdaptiveVector class template. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   {
+      test_ = "AdaptiveVector scaling (sparse representation)";
+
+      SVT sv( 100UL );
+      sv[10] = 1;
+
+      VT vec( sv );
+      vec *= 3;
+
+      checkNonZeros( vec, 1UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( sv*3 ) );
+   }
+
+   {
+      test_ = "AdaptiveVector scaling (dense representation)";
+
+      DVT dv( 100UL, 2 );
+
+      VT vec( dv );
+      vec *= -2;
+
+      checkNonZeros( vec, 100UL );
+      checkDense   ( vec, true );
+      checkValues  ( vec, dv*(-2) );
+
+      vec *= 0;
+
+      checkNonZeros( vec, 0UL );
+      checkDense   ( vec, false );
+      checkValues  ( vec, DVT( 100UL, 0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c apply() member function and the \c visit() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of operations on the active representation of the
+// AdaptiveVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testApply()
+{
+   test_ = "AdaptiveVector::apply()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> A( 60UL, 100UL );
+   for( size_t i=0UL; i<60UL; ++i ) {
+      A(i,i) = 2;
+      A(i,i+40UL) = -1;
+   }
+
+   DVT y( 100UL, 1 );
+
+   for( size_t nonzeros : { 2UL, 50UL } )
+   {
+      VT x( 100UL );
+      DVT ref( 100UL, 0 );
+
+      for( size_t i=0UL; i<nonzeros; ++i ) {
+         x.set( i*2UL, int( i+1UL ) );
+         ref[i*2UL] = int( i+1UL );
+      }
+
+      DVT z;
+      x.apply( [&]( const auto& v ) { z = A * v; } );
+
+      const int d( visit( x, [&]( const auto& v ) { return dot( v, y ); } ) );
+
+      if( z != A * ref || d != dot( ref, y ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation on the active representation failed\n"
+             << " Details:\n"
+             << "   Dense representation: " << x.isDense() << "\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n" << A * ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the AdaptiveVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "AdaptiveVector::resize()";
+
+   DVT dv( 10UL, 0 );
+   dv[1] = 1;
+
+   VT vec( dv );
+
+   checkDense( vec, true );
+
+   // Enlarging the vector
+   vec.resize( 100UL );
+   dv.resize( 100UL );
+   for( size_t i=10UL; i<100UL; ++i )
+      dv[i] = 0;
+
+   checkSize    ( vec, 100UL );
+   checkNonZeros( vec, 1UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, dv );
+
+   // Shrinking the vector
+   vec.set( 99UL, 2 );
+   vec.resize( 50UL );
+   dv.resize( 50UL );
+
+   checkSize    ( vec, 50UL );
+   checkNonZeros( vec, 1UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, dv );
+
+   // Resizing without preserving the values
+   vec.resize( 20UL, false );
+
+   checkSize    ( vec, 20UL );
+   checkNonZeros( vec, 0UL );
+   checkDense   ( vec, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the AdaptiveVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "AdaptiveVector::reset()";
+
+   VT vec( DVT( 30UL, 4 ) );
+
+   checkDense( vec, true );
+
+   reset( vec );
+
+   checkSize    ( vec, 30UL );
+   checkNonZeros( vec, 0UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, DVT( 30UL, 0 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the AdaptiveVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "AdaptiveVector::clear()";
+
+   VT vec( DVT( 30UL, 4 ) );
+
+   clear( vec );
+
+   checkSize    ( vec, 0UL );
+   checkNonZeros( vec, 0UL );
+   checkDense   ( vec, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the AdaptiveVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "AdaptiveVector swap";
+
+   const DVT dv( 10UL, 1 );
+   SVT sv( 100UL );
+   sv[5] = 2;
+
+   VT vec1( dv );
+   VT vec2( sv );
+
+   swap( vec1, vec2 );
+
+   checkSize    ( vec1, 100UL );
+   checkNonZeros( vec1, 1UL );
+   checkDense   ( vec1, false );
+   checkValues  ( vec1, DVT( sv ) );
+
+   checkSize    ( vec2, 10UL );
+   checkNonZeros( vec2, 10UL );
+   checkDense   ( vec2, true );
+   checkValues  ( vec2, dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c setThresholds() member function of the AdaptiveVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c setThresholds() member function of the AdaptiveVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testThresholds()
+{
+   test_ = "AdaptiveVector::setThresholds()";
+
+   SVT sv( 100UL );
+   for( size_t i=0UL; i<4UL; ++i )
+      sv[i*10UL] = 1;
+
+   VT vec( sv );
+
+   checkDense( vec, false );
+
+   vec.setThresholds( 0.01, 0.03 );
+
+   checkNonZeros( vec, 4UL );
+   checkDense   ( vec, true );
+   checkValues  ( vec, DVT( sv ) );
+
+   vec.setThresholds( 0.5, 0.9 );
+
+   checkNonZeros( vec, 4UL );
+   checkDense   ( vec, false );
+   checkValues  ( vec, DVT( sv ) );
+
+   if( vec.sparsifyThreshold() != 0.5 || vec.densifyThreshold() != 0.9 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting the thresholds failed\n"
+          << " Details:\n"
+          << "   Sparsify threshold: " << vec.sparsifyThreshold() << "\n"
+          << "   Densify threshold : " << vec.densifyThreshold() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      vec.setThresholds( 0.2, 0.1 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting invalid thresholds succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the handling of tiny non-zero values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that values of tiny magnitude are neither dropped nor ignored by the
+// non-zero count, both in the dense and the sparse representation and across the switches
+// between both representations. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testTinyValues()
+{
+   test_ = "AdaptiveVector with tiny values";
+
+   using TVT = blaze::AdaptiveVector<double,blaze::columnVector>;
+
+   TVT vec( 100UL );
+   vec.setThresholds( 0.1, 0.2 );
+
+   blaze::DynamicVector<double,blaze::columnVector> ref( 100UL, 0.0 );
+
+   // Sparse representation
+   vec.set( 3UL, 1E-9 );
+   vec.set( 50UL, 1E-300 );
+   vec.set( 10UL, 1.0 );
+   ref[3UL] = 1E-9;
+   ref[50UL] = 1E-300;
+   ref[10UL] = 1.0;
+
+   checkTinyValues( vec, ref, 3UL, false );
+
+   // Sparse to dense switch
+   vec.setThresholds( 0.01, 0.02 );
+
+   checkTinyValues( vec, ref, 3UL, true );
+
+   // Dense representation
+   vec.set( 70UL, -1E-9 );
+   vec.set( 71UL, 1E-300 );
+   vec.set( 10UL, 0.0 );
+   ref[70UL] = -1E-9;
+   ref[71UL] = 1E-300;
+   ref[10UL] = 0.0;
+
+   checkTinyValues( vec, ref, 4UL, true );
+
+   // Dense to sparse switch
+   vec.setThresholds( 0.5, 0.9 );
+
+   checkTinyValues( vec, ref, 4UL, false );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given adaptive vector.
+//
+// \param vec The adaptive vector to be checked.
+// \param expectedSize The expected size of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkSize( const VT& vec, size_t expectedSize ) const
+{
+   if( vec.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << vec.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the representation of the given adaptive vector.
+//
+// \param vec The adaptive vector to be checked.
+// \param expectedDense \a true in case the dense representation is expected, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkDense( const VT& vec, bool expectedDense ) const
+{
+   if( vec.isDense() != expectedDense || vec.isSparse() == expectedDense ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid representation detected\n"
+          << " Details:\n"
+          << "   Fill                   : " << vec.fill() << "\n"
+          << "   Representation         : " << ( vec.isDense() ? "dense" : "sparse" ) << "\n"
+          << "   Expected representation: " << ( expectedDense ? "dense" : "sparse" ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given adaptive vector.
+//
+// \param vec The adaptive vector to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkNonZeros( const VT& vec, size_t expectedNonZeros ) const
+{
+   if( nonZeros( vec ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( vec ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the values of the given adaptive vector.
+//
+// \param vec The adaptive vector to be checked.
+// \param ref The reference vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkValues( const VT& vec, const DVT& ref ) const
+{
+   bool equal( vec.size() == ref.size() );
+
+   for( size_t i=0UL; equal && i<ref.size(); ++i ) {
+      equal = ( vec[i] == ref[i] );
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector values detected\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the representation, non-zero count and values of an adaptive vector.
+//
+// \param vec The adaptive vector to be checked.
+// \param ref The reference vector.
+// \param expectedNonZeros The expected number of non-zero elements.
+// \param expectedDense \a true in case the dense representation is expected, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename TVT     // Type of the adaptive vector
+        , typename TDVT >  // Type of the reference vector
+void ClassTest::checkTinyValues( const TVT& vec, const TDVT& ref, size_t expectedNonZeros,
+                                 bool expectedDense ) const
+{
+   bool equal( vec.size() == ref.size() );
+
+   for( size_t i=0UL; equal && i<ref.size(); ++i ) {
+      equal = ( vec[i] == ref[i] );
+   }
+
+   if( !equal || vec.nonZeros() != expectedNonZeros || vec.isDense() != expectedDense ) {
+      std::ostringstream oss;
+      oss.precision( 17 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid handling of tiny values detected\n"
+          << " Details:\n"
+          << "   Dense representation         : " << vec.isDense() << "\n"
+          << "   Expected dense representation: " << expectedDense << "\n"
+          << "   Number of non-zeros          : " << vec.nonZeros() << "\n"
+          << "   Expected number of non-zeros : " << expectedNonZeros << "\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace adaptivevector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running AdaptiveVector class test..." << std::endl;
+
+   try
+   {
+      RUN_ADAPTIVEVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during AdaptiveVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,255 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrix/ConversionTest.cpp
+//  \brief Source file for the CompressedMatrix storage order conversion test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/compressedmatrix/ConversionTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix storage order conversion test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ConversionTest::ConversionTest()
+   : test_   ()
+   , threads_( blaze::getNumThreads() )
+{
+   blaze::setThreshold( blaze::SMP_SMATTRANS_THRESHOLD, 0UL );
+
+   try {
+      for( size_t t : { 1UL, 2UL, 3UL, 4UL, 7UL, 16UL } )
+      {
+#if !BLAZE_HPX_PARALLEL_MODE
+         blaze::setNumThreads( t );
+#endif
+
+         // Empty matrices
+         testConversion(   0UL,   0UL,    0UL );
+         testConversion(   0UL,   5UL,    0UL );
+         testConversion(   5UL,   0UL,    0UL );
+         testConversion(  10UL,  10UL,    0UL );
+
+         // Empty rows and columns
+         testConversion(  20UL,  30UL,  100UL, 3UL, 1UL );
+         testConversion(  20UL,  30UL,  100UL, 1UL, 4UL );
+         testConversion(  50UL,  40UL,  300UL, 7UL, 5UL );
+
+         // More threads than rows (or columns)
+         testConversion(   1UL,  50UL,   50UL );
+         testConversion(  50UL,   1UL,   50UL );
+         testConversion(   2UL,   2UL,    4UL );
+         testConversion(   3UL, 100UL,  300UL );
+         testConversion( 100UL,   3UL,  300UL );
+
+         // Less non-zero elements than rows (or columns)
+         testConversion( 100UL, 100UL,    5UL );
+         testConversion( 100UL,  10UL,   20UL );
+         testConversion(  10UL, 100UL,   20UL );
+
+         // Random matrices
+         testConversion(  64UL,  64UL,  512UL );
+         testConversion( 200UL, 150UL, 3000UL );
+         testConversion( 997UL,  37UL, 5000UL );
+      }
+   }
+   catch( ... ) {
+#if !BLAZE_HPX_PARALLEL_MODE
+      blaze::setNumThreads( threads_ );
+#endif
+      blaze::resetThresholds();
+      throw;
+   }
+
+#if !BLAZE_HPX_PARALLEL_MODE
+   blaze::setNumThreads( threads_ );
+#endif
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the storage order conversion of the CompressedMatrix class.
+//
+// \param m The number of rows of the original matrix.
+// \param n The number of columns of the original matrix.
+// \param nonzeros The number of elements to be inserted into the original matrix.
+// \param rowStride The distance between two rows that may contain elements.
+// \param columnStride The distance between two columns that may contain elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction from and the assignment of row-major and column-major
+// sparse matrices with opposite storage order and of transposed sparse matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ConversionTest::testConversion( size_t m, size_t n, size_t nonzeros,
+                                     size_t rowStride, size_t columnStride )
+{
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   CompressedMatrix<int,rowMajor> A( m, n );
+   initialize( A, nonzeros, rowStride, columnStride );
+
+   CompressedMatrix<int,columnMajor> B( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element )
+         B(i,element->index()) = element->value();
+   }
+
+
+   //=====================================================================================
+   // Row-major to column-major conversion
+   //=====================================================================================
+
+   {
+      test_ = "Row-major/column-major conversion";
+
+      const CompressedMatrix<int,columnMajor> C( A );
+      checkConversion( "Construction", A, C, false );
+
+      CompressedMatrix<int,columnMajor> D( 3UL, 4UL, 5UL );
+      D(1,2) = 1;
+      D = A;
+      checkConversion( "Assignment", A, D, false );
+   }
+
+   {
+      test_ = "Row-major/column-major transpose conversion";
+
+      const CompressedMatrix<int,columnMajor> C( trans( B ) );
+      checkConversion( "Construction", B, C, true );
+
+      CompressedMatrix<int,columnMajor> D( 3UL, 4UL, 5UL );
+      D(1,2) = 1;
+      D = trans( B );
+      checkConversion( "Assignment", B, D, true );
+   }
+
+
+   //=====================================================================================
+   // Column-major to row-major conversion
+   //=====================================================================================
+
+   {
+      test_ = "Column-major/row-major conversion";
+
+      const CompressedMatrix<int,rowMajor> C( B );
+      checkConversion( "Construction", B, C, false );
+
+      CompressedMatrix<int,rowMajor> D( 3UL, 4UL, 5UL );
+      D(1,2) = 1;
+      D = B;
+      checkConversion( "Assignment", B, D, false );
+   }
+
+   {
+      test_ = "Column-major/row-major transpose conversion";
+
+      const CompressedMatrix<int,rowMajor> C( trans( A ) );
+      checkConversion( "Construction", A, C, true );
+
+      CompressedMatrix<int,rowMajor> D( 3UL, 4UL, 5UL );
+      D(1,2) = 1;
+      D = trans( A );
+      checkConversion( "Assignment", A, D, true );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix storage order conversion test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_CONVERSION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix storage order conversion test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
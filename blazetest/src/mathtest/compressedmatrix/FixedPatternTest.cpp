@@ -0,0 +1,193 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrix/FixedPatternTest.cpp
+//  \brief Source file for the CompressedMatrix fixed pattern test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/compressedmatrix/FixedPatternTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix fixed pattern test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+FixedPatternTest::FixedPatternTest()
+{
+   testAccess<blaze::rowMajor>();
+   testAccess<blaze::columnMajor>();
+   testAssembly<blaze::rowMajor>( 1UL );
+   testAssembly<blaze::rowMajor>( 12UL );
+   testAssembly<blaze::columnMajor>( 1UL );
+   testAssembly<blaze::columnMajor>( 12UL );
+   testAtomicAssembly<blaze::rowMajor>( 30UL );
+   testAtomicAssembly<blaze::columnMajor>( 30UL );
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the FixedPattern class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void FixedPatternTest::testErrors()
+{
+   test_ = "FixedPattern error handling";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+   A(0,0) = 1.0;
+   A(1,1) = 2.0;
+   A(2,2) = 3.0;
+
+   auto pattern = freeze( A );
+
+   try {
+      pattern.slot( 0UL, 1UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Slot of element outside the sparsity pattern computed\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      pattern.slot( 3UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Slot of out-of-bounds element computed\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      pattern.at( 3UL ) = 4.0;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds slot access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      const std::vector<size_t> indices{ 0UL, 1UL };
+      const std::vector<size_t> map{ pattern.slot( 0UL, 0UL ), pattern.slot( 1UL, 1UL ) };
+      pattern.scatterAdd( map, blaze::DynamicMatrix<double>( 2UL, 2UL, 1.0 ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scatter-add with invalid slot map succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   A(0,1) = 5.0;
+
+   if( pattern.isIntact() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Modified sparsity pattern not detected\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix fixed pattern test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_FIXEDPATTERN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix fixed pattern test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,451 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrix/ReorderingTest.cpp
+//  \brief Source file for the CompressedMatrix reordering test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/compressedmatrix/ReorderingTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix reordering test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReorderingTest::ReorderingTest()
+{
+   testRCM( 1UL );
+   testRCM( 7UL );
+   testRCM( 40UL );
+   testNestedDissection( 1UL );
+   testNestedDissection( 7UL );
+   testNestedDissection( 40UL );
+   testRowLocality( 1UL, 1UL );
+   testRowLocality( 50UL, 30UL );
+   testRowLocality( 200UL, 500UL );
+   testPermute( 1UL, 1UL );
+   testPermute( 40UL, 25UL );
+   testPermute( 300UL, 300UL );
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reverse Cuthill-McKee ordering.
+//
+// \param n The number of grid points per dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rcm() function by means of randomly numbered 2D meshes with one and
+// two components. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::testRCM( size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Reverse Cuthill-McKee ordering";
+
+   for( size_t components=1UL; components<=2UL; ++components )
+   {
+      CompressedMatrix<double,rowMajor> A;
+      mesh( A, n, components );
+
+      const CompressedMatrix<double,columnMajor> TA( A );
+
+      const std::vector<size_t> p1( blaze::rcm( A  ) );
+      const std::vector<size_t> p2( blaze::rcm( TA ) );
+
+      checkPermutation( p1, A, A.rows() );
+
+      if( p1 != p2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inconsistent row-major and column-major orderings detected\n"
+             << " Details:\n"
+             << "   Number of rows: " << A.rows() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const CompressedMatrix<double,rowMajor> B( blaze::permute( A, p1 ) );
+
+      checkPermute( A, B, p1, p1 );
+
+      // The bandwidth of a reverse Cuthill-McKee ordered n x n mesh is bounded by 2n
+      if( bandwidth( B ) > 2UL*n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth reduction failed\n"
+             << " Details:\n"
+             << "   Number of rows: " << A.rows() << "\n"
+             << "   Original bandwidth: " << bandwidth( A ) << "\n"
+             << "   Reordered bandwidth: " << bandwidth( B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nested dissection ordering.
+//
+// \param n The number of grid points per dimension.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the nestedDissection() function by means of randomly numbered 2D meshes
+// with one and two components and various leaf sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::testNestedDissection( size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Nested dissection ordering";
+
+   for( size_t components=1UL; components<=2UL; ++components )
+   {
+      CompressedMatrix<double,rowMajor> A;
+      mesh( A, n, components );
+
+      const CompressedMatrix<double,columnMajor> TA( A );
+
+      for( size_t leafSize : { 1UL, 4UL, 256UL } )
+      {
+         const std::vector<size_t> p1( blaze::nestedDissection( A , leafSize ) );
+         const std::vector<size_t> p2( blaze::nestedDissection( TA, leafSize ) );
+
+         checkPermutation( p1, A, A.rows() );
+
+         if( p1 != p2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inconsistent row-major and column-major orderings detected\n"
+                << " Details:\n"
+                << "   Number of rows: " << A.rows() << "\n"
+                << "   Leaf size: " << leafSize << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const CompressedMatrix<double,columnMajor> B( blaze::permute( TA, p2 ) );
+
+         checkPermute( TA, B, p2, p2 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the locality-improving row ordering.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rowLocalityOrder() function by means of random \f$ m \times n \f$
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::testRowLocality( size_t m, size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Row locality ordering";
+
+   CompressedMatrix<double,rowMajor> A( m, n );
+   randomize( A, std::min( m*n, 3UL*m ) );
+
+   const CompressedMatrix<double,columnMajor> TA( A );
+
+   const std::vector<size_t> p1( blaze::rowLocalityOrder( A  ) );
+   const std::vector<size_t> p2( blaze::rowLocalityOrder( TA ) );
+
+   checkPermutation( p1, A, m );
+
+   std::vector<size_t> q( n );
+   std::iota( q.begin(), q.end(), 0UL );
+
+   const CompressedMatrix<double,rowMajor> B( blaze::permute( A, p1, q ) );
+
+   checkPermute( A, B, p1, q );
+
+   double previous( -1.0 );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      if( B.nonZeros( i ) == 0UL ) continue;
+
+      double mean( 0.0 );
+      for( auto element=B.begin(i); element!=B.end(i); ++element )
+         mean += element->index();
+      mean /= B.nonZeros( i );
+
+      if( p1 != p2 || mean < previous ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid row ordering detected\n"
+             << " Details:\n"
+             << "   Row: " << i << "\n"
+             << "   Mean column index: " << mean << "\n"
+             << "   Previous mean column index: " << previous << "\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      previous = mean;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the permutation of general matrices.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the permute() function with random \f$ m \times n \f$ matrices and random
+// row and column permutations. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ReorderingTest::testPermute( size_t m, size_t n )
+{
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Permutation";
+
+   CompressedMatrix<double,rowMajor> A( m, n );
+   randomize( A, std::min( m*n, 4UL*m ) );
+
+   const CompressedMatrix<double,columnMajor> TA( A );
+
+   std::vector<size_t> p( m ), q( n );
+   std::iota( p.begin(), p.end(), 0UL );
+   std::iota( q.begin(), q.end(), 0UL );
+
+   {
+      const CompressedMatrix<double,rowMajor> B( blaze::permute( A, p, q ) );
+      checkPermute( A, B, p, q );
+   }
+
+   std::random_shuffle( p.begin(), p.end() );
+   std::random_shuffle( q.begin(), q.end() );
+
+   {
+      const CompressedMatrix<double,rowMajor> B( blaze::permute( A, p, q ) );
+      checkPermute( A, B, p, q );
+   }
+
+   {
+      const CompressedMatrix<double,columnMajor> B( blaze::permute( TA, p, q ) );
+      checkPermute( TA, B, p, q );
+   }
+
+   {
+      const CompressedMatrix<double,rowMajor> B( blaze::permute( 2.0 * A, p, q ) );
+      checkPermute( 2.0 * A, B, p, q );
+   }
+
+   // Permuted sparse matrix/vector multiplication
+   if( m == n )
+   {
+      DynamicVector<double> x( n ), y1( m ), y2( m );
+      randomize( x );
+
+      const CompressedMatrix<double,rowMajor> B( blaze::permute( A, p ) );
+
+      y1 = A * x;
+      elements( y2, p ) = B * elements( x, p );
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permuted multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y2 << "\n"
+             << "   Expected result:\n" << y1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error detection of the reordering functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the reordering functions detect invalid arguments. In case an
+// error is not detected, a \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::testErrors()
+{
+   using blaze::CompressedMatrix;
+
+   {
+      test_ = "Reverse Cuthill-McKee ordering of a non-square matrix";
+
+      const CompressedMatrix<double> A( 2UL, 3UL );
+
+      try {
+         blaze::rcm( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Ordering of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Nested dissection ordering of a non-square matrix";
+
+      const CompressedMatrix<double> A( 3UL, 2UL );
+
+      try {
+         blaze::nestedDissection( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Ordering of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Permutation with invalid permutations";
+
+      const CompressedMatrix<double> A( 3UL, 3UL );
+
+      const std::vector< std::vector<size_t> > perms{ { 0UL, 1UL },
+                                                      { 0UL, 1UL, 1UL },
+                                                      { 0UL, 1UL, 3UL } };
+
+      for( const auto& perm : perms )
+      {
+         try {
+            blaze::permute( A, perm );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Permutation with invalid permutation succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix reordering test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_REORDERING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix reordering test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1325 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/customcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the CustomCompressedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blazetest/mathtest/customcompressedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace customcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CustomCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testIsIntact();
+   testOperations();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CustomCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CustomCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomCompressedMatrix default constructor";
+
+      const MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major array constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomCompressedMatrix array constructor";
+
+      int values[] = { 1, 2, 3, 4, 5 };
+      const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+      const MT mat( values, indices, offsets, 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 2 || mat(0,3) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 0 || mat(1,3) != 3 ||
+          mat(2,0) != 4 || mat(2,1) != 5 || mat(2,2) != 0 || mat(2,3) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 0 )\n( 0 0 0 3 )\n( 4 5 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( values != &mat.begin(0UL)->value() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction copied the array of values\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomCompressedMatrix array constructor (offset arrays)";
+
+      const int values[] = { 0, 1, 2, 3, 4, 5 };
+      const size_t indices[] = { 0UL, 0UL, 2UL, 3UL, 0UL, 1UL };
+      const size_t offsets[] = { 1UL, 3UL, 4UL, 6UL };
+
+      using MatrixType = blaze::CustomCompressedMatrix<const int,blaze::rowMajor>;
+
+      const MatrixType mat( values, indices, offsets, 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 2 || mat(0,3) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 0 || mat(1,3) != 3 ||
+          mat(2,0) != 4 || mat(2,1) != 5 || mat(2,2) != 0 || mat(2,3) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 0 )\n( 0 0 0 3 )\n( 4 5 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomCompressedMatrix array constructor (empty matrix)";
+
+      const unsigned int offsets[] = { 0U, 0U, 0U };
+
+      const MT mat( nullptr, nullptr, offsets, 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+   }
+
+   {
+      test_ = "Row-major CustomCompressedMatrix array constructor (invalid arrays)";
+
+      int values[] = { 1, 2, 3, 4, 5 };
+      const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+      const unsigned int decreasing[] = { 5U, 2U, 3U, 0U };
+
+      try {
+         const MT mat( values, indices, nullptr, 3UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with missing array of offsets succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const MT mat( values, indices, decreasing, 3UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with invalid array of offsets succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const MT mat( nullptr, indices, offsets, 3UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with missing array of values succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const MT mat( values, nullptr, offsets, 3UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with missing array of indices succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Row-major copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomCompressedMatrix copy constructor";
+
+      int values[] = { 1, 2, 3, 4, 5 };
+      const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+      MT mat1( values, indices, offsets, 3UL, 4UL );
+      const MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 5UL );
+
+      mat1.begin(2UL)->value() = 6;
+
+      if( mat2(2,0) != 6 || mat2(2,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 0 )\n( 0 0 0 3 )\n( 6 5 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomCompressedMatrix default constructor";
+
+      const OMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major array constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomCompressedMatrix array constructor";
+
+      int values[] = { 1, 2, 3, 4, 5 };
+      const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+      const OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 4 ||
+          mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 5 ||
+          mat(2,0) != 2 || mat(2,1) != 0 || mat(2,2) != 0 ||
+          mat(3,0) != 0 || mat(3,1) != 3 || mat(3,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 4 )\n( 0 0 5 )\n( 2 0 0 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix array constructor (invalid arrays)";
+
+      const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+      try {
+         const OMT mat( nullptr, indices, offsets, 4UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with missing array of values succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 1, 0, 2, 0 },
+                                                       { 0, 0, 0, 3 },
+                                                       { 4, 5, 0, 0 } };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::operator()";
+
+      const MT mat( values, indices, offsets, 3UL, 4UL );
+
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( mat(i,j) != ref(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Function call operator failed\n"
+                   << " Details:\n"
+                   << "   Position: (" << i << "," << j << ")\n"
+                   << "   Result:\n" << mat << "\n"
+                   << "   Expected result:\n" << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::operator()";
+
+      const OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( mat(i,j) != ref(j,i) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Function call operator failed\n"
+                   << " Details:\n"
+                   << "   Position: (" << i << "," << j << ")\n"
+                   << "   Result:\n" << mat << "\n"
+                   << "   Expected result:\n" << trans( ref ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the \c at() member function
+// of the CustomCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::at()";
+
+      const MT mat( values, indices, offsets, 3UL, 4UL );
+
+      if( mat.at(0,2) != 2 || mat.at(1,3) != 3 || mat.at(2,1) != 5 || mat.at(2,3) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 0 )\n( 0 0 0 3 )\n( 4 5 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at(3,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         mat.at(0,4);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::at()";
+
+      const OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      if( mat.at(2,0) != 2 || mat.at(3,1) != 3 || mat.at(1,2) != 5 || mat.at(3,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 4 )\n( 0 0 5 )\n( 2 0 0 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at(4,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      using Iterator      = MT::Iterator;
+      using ConstIterator = MT::ConstIterator;
+
+      int values[] = { 1, 2, 3, 4, 5 };
+      const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+      MT mat( values, indices, offsets, 3UL, 4UL );
+
+      // Testing the Iterator default constructor
+      {
+         test_ = "Row-major Iterator default constructor";
+
+         Iterator it{};
+
+         if( it != Iterator() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed iterator default constructor\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing conversion from Iterator to ConstIterator
+      {
+         test_ = "Row-major Iterator/ConstIterator conversion";
+
+         ConstIterator it( begin( mat, 1UL ) );
+
+         if( it == end( mat, 1UL ) || it->value() != 3 || it->index() != 3UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed iterator conversion detected\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Counting the number of elements in 0th row via Iterator (end-begin)
+      {
+         test_ = "Row-major Iterator subtraction (end-begin)";
+
+         const ptrdiff_t number( end( mat, 0UL ) - begin( mat, 0UL ) );
+
+         if( number != 2L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing read-only access via ConstIterator
+      {
+         test_ = "Row-major read-only access via ConstIterator";
+
+         ConstIterator it ( cbegin( mat, 2UL ) );
+         ConstIterator end( cend( mat, 2UL ) );
+
+         if( it == end || it->value() != 4 || it->index() != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid initial iterator detected\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         ++it;
+
+         if( it == end || it->value() != 5 || it->index() != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator pre-increment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         --it;
+
+         if( it == end || it->value() != 4 || it->index() != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator pre-decrement failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it++;
+
+         if( it == end || (*it).value() != 5 || (*it).index() != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator post-increment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it += 1L;
+
+         if( it != end || it - 2L != cbegin( mat, 2UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator addition assignment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing assignment to the values via Iterator
+      {
+         test_ = "Row-major assignment via Iterator";
+
+         int value = 7;
+
+         for( Iterator it=begin( mat, 0UL ); it!=end( mat, 0UL ); ++it ) {
+            it->value() = value++;
+         }
+
+         if( mat(0,0) != 7 || mat(0,2) != 8 || values[0] != 7 || values[1] != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment via iterator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 7 0 8 0 )\n( 0 0 0 3 )\n( 4 5 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      using Iterator      = OMT::Iterator;
+      using ConstIterator = OMT::ConstIterator;
+
+      int values[] = { 1, 2, 3, 4, 5 };
+      const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+      OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      // Counting the number of elements in 2nd column via ConstIterator (end-begin)
+      {
+         test_ = "Column-major ConstIterator subtraction (end-begin)";
+
+         const ptrdiff_t number( cend( mat, 2UL ) - cbegin( mat, 2UL ) );
+
+         if( number != 2L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing assignment to the values via Iterator
+      {
+         test_ = "Column-major assignment via Iterator";
+
+         for( Iterator it=begin( mat, 2UL ); it!=end( mat, 2UL ); ++it ) {
+            it->value() *= 2;
+         }
+
+         ConstIterator it( cbegin( mat, 2UL ) );
+
+         if( it->value() != 8 || it->index() != 0UL || mat(1,2) != 10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment via iterator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 1 0 8 )\n( 0 0 10 )\n( 2 0 0 )\n( 0 3 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   int values[] = { 1, 0, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::nonZeros()";
+
+      const MT mat( values, indices, offsets, 3UL, 4UL );
+
+      // The explicitly stored zero element is counted as non-zero element
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::nonZeros()";
+
+      const OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   using blaze::reset;
+
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::reset()";
+
+      MT mat( values, indices, offsets, 3UL, 4UL );
+
+      // Resetting a single row
+      reset( mat, 2UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 1 || mat(0,2) != 2 || mat(1,3) != 3 || mat(2,0) != 0 || mat(2,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 0 )\n( 0 0 0 3 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Resetting the entire matrix
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 0 || mat(0,2) != 0 || mat(1,3) != 0 || values[2] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::reset()";
+
+      int values2[] = { 1, 2, 3, 4, 5 };
+
+      OMT mat( values2, indices, offsets, 4UL, 3UL );
+
+      reset( mat, 0UL );
+
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 0 || mat(2,0) != 0 || mat(3,1) != 3 || mat(0,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 4 )\n( 0 0 5 )\n( 0 0 0 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   using blaze::clear;
+
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::clear()";
+
+      MT mat( values, indices, offsets, 3UL, 4UL );
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+
+      if( values[0] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Clear operation modified the array of values\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::clear()";
+
+      OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the CustomCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   int values1[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices1[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets1[] = { 0U, 2U, 3U, 5U };
+
+   int values2[] = { 6 };
+   const unsigned int indices2[] = { 1U };
+   const unsigned int offsets2[] = { 0U, 1U, 1U };
+
+   {
+      test_ = "Row-major CustomCompressedMatrix swap";
+
+      MT mat1( values1, indices1, offsets1, 3UL, 4UL );
+      MT mat2( values2, indices2, offsets2, 2UL, 2UL );
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 2UL );
+      checkColumns ( mat1, 2UL );
+      checkNonZeros( mat1, 1UL );
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 5UL );
+
+      if( mat1(0,1) != 6 || mat2(2,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the matrices failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 0 6 )\n( 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix swap";
+
+      OMT mat1( values1, indices1, offsets1, 4UL, 3UL );
+      OMT mat2( values2, indices2, offsets2, 2UL, 2UL );
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 2UL );
+      checkColumns ( mat1, 2UL );
+      checkNonZeros( mat1, 1UL );
+      checkRows    ( mat2, 4UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 5UL );
+
+      if( mat1(1,0) != 6 || mat2(1,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the matrices failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 0 0 )\n( 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::find()";
+
+      MT mat( values, indices, offsets, 3UL, 4UL );
+      const MT& cmat( mat );
+
+      MT::Iterator pos1( mat.find( 0UL, 2UL ) );
+      MT::ConstIterator pos2( cmat.find( 2UL, 1UL ) );
+
+      if( pos1 == mat.end( 0UL ) || pos1->index() != 2UL || pos1->value() != 2 ||
+          pos2 == cmat.end( 2UL ) || pos2->index() != 1UL || pos2->value() != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element could not be found\n"
+             << " Details:\n"
+             << "   Required positions = (0,2) and (2,1)\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.find( 0UL, 1UL ) != mat.end( 0UL ) || cmat.find( 1UL, 0UL ) != cmat.end( 1UL ) ||
+          cmat.find( 2UL, 3UL ) != cmat.end( 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-existing element could be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::find()";
+
+      const OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      OMT::ConstIterator pos( mat.find( 3UL, 1UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 3UL || pos->value() != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element could not be found\n"
+             << " Details:\n"
+             << "   Required position = (3,1)\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.find( 1UL, 0UL ) != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-existing element could be found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// CustomCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::lowerBound()";
+
+      const MT mat( values, indices, offsets, 3UL, 4UL );
+
+      const MT::ConstIterator pos1( mat.lowerBound( 0UL, 0UL ) );
+      const MT::ConstIterator pos2( mat.lowerBound( 0UL, 1UL ) );
+      const MT::ConstIterator pos3( mat.lowerBound( 0UL, 3UL ) );
+
+      if( pos1 == mat.end( 0UL ) || pos1->index() != 0UL ||
+          pos2 == mat.end( 0UL ) || pos2->index() != 2UL ||
+          pos3 != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::lowerBound()";
+
+      const OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      const OMT::ConstIterator pos1( mat.lowerBound( 1UL, 0UL ) );
+      const OMT::ConstIterator pos2( mat.lowerBound( 1UL, 2UL ) );
+
+      if( pos1 == mat.end( 0UL ) || pos1->index() != 2UL ||
+          pos2 == mat.end( 2UL ) || pos2->index() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// CustomCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major CustomCompressedMatrix::upperBound()";
+
+      const MT mat( values, indices, offsets, 3UL, 4UL );
+
+      const MT::ConstIterator pos1( mat.upperBound( 0UL, 0UL ) );
+      const MT::ConstIterator pos2( mat.upperBound( 0UL, 2UL ) );
+      const MT::ConstIterator pos3( mat.upperBound( 2UL, 0UL ) );
+
+      if( pos1 == mat.end( 0UL ) || pos1->index() != 2UL ||
+          pos2 != mat.end( 0UL ) ||
+          pos3 == mat.end( 2UL ) || pos3->index() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CustomCompressedMatrix::upperBound()";
+
+      const OMT mat( values, indices, offsets, 4UL, 3UL );
+
+      const OMT::ConstIterator pos1( mat.upperBound( 0UL, 0UL ) );
+      const OMT::ConstIterator pos2( mat.upperBound( 3UL, 1UL ) );
+
+      if( pos1 == mat.end( 0UL ) || pos1->index() != 2UL || pos2 != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound could not be determined\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   int values[] = { 0, 0, 0, 0, 0 };
+   const unsigned int indices[] = { 0U, 2U, 3U, 0U, 1U };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major isDefault() function";
+
+      const MT mat1;
+      const MT mat2( values, indices, offsets, 3UL, 4UL );
+
+      if( isDefault( mat1 ) != true || isDefault( mat2 ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major isDefault() function";
+
+      const OMT mat1;
+      const OMT mat2( values, indices, offsets, 4UL, 3UL );
+
+      if( isDefault( mat1 ) != true || isDefault( mat2 ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isIntact() function with the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isIntact() function with the CustomCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsIntact()
+{
+   int values[] = { 1, 2, 3, 4, 5 };
+   const unsigned int offsets[] = { 0U, 2U, 3U, 5U };
+
+   {
+      test_ = "Row-major isIntact() function";
+
+      const unsigned int valid    [] = { 0U, 2U, 3U, 0U, 1U };
+      const unsigned int unsorted [] = { 2U, 0U, 3U, 0U, 1U };
+      const unsigned int duplicate[] = { 0U, 2U, 3U, 1U, 1U };
+      const unsigned int range    [] = { 0U, 2U, 4U, 0U, 1U };
+      const unsigned int offsets2 [] = { 0U, 3U, 2U, 5U };
+
+      if( !isIntact( MT( values, valid, offsets, 3UL, 4UL ) ) ||
+          isIntact( MT( values, unsorted, offsets, 3UL, 4UL ) ) ||
+          isIntact( MT( values, duplicate, offsets, 3UL, 4UL ) ) ||
+          isIntact( MT( values, range, offsets, 3UL, 4UL ) ) ||
+          isIntact( MT( values, valid, offsets2, 3UL, 4UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isIntact evaluation\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major isIntact() function";
+
+      const int valid   [] = { 0, 2, 3, 0, 1 };
+      const int negative[] = { 0, 2, -1, 0, 1 };
+      const int offsets2[] = { 0, 2, 3, 5 };
+
+      using MatrixType = blaze::CustomCompressedMatrix<int,blaze::columnMajor,int>;
+
+      if( !isIntact( MatrixType( values, valid, offsets2, 4UL, 3UL ) ) ||
+          isIntact( MatrixType( values, valid, offsets2, 3UL, 3UL ) ) ||
+          isIntact( MatrixType( values, negative, offsets2, 4UL, 3UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isIntact evaluation\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of operations with the CustomCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of sparse matrix operations with the CustomCompressedMatrix
+// class template for several index types. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testOperations()
+{
+   testOperations<int>( 0UL, 0UL, 0UL );
+   testOperations<int>( 7UL, 13UL, 20UL );
+   testOperations<unsigned int>( 31UL, 17UL, 100UL );
+   testOperations<size_t>( 64UL, 64UL, 600UL );
+   testOperations<long>( 400UL, 300UL, 4000UL );
+}
+//*************************************************************************************************
+
+} // namespace customcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CustomCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_CUSTOMCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CustomCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -107,6 +107,8 @@ GeneralTest::GeneralTest()
    testNot();
    testAnd();
    testOr();
+   testSelect();
+   testMaskedAssign();
    testGenerate();
    testUniform();
    testZero();
@@ -10876,6 +10878,414 @@ void GeneralTest::testOr()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c select() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c select() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSelect()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major select() function";
+
+      // Selection based on a boolean matrix
+      {
+         blaze::DynamicMatrix<bool,blaze::rowMajor> cond{ { true, false, true, false, true },
+                                                          { false, true, false, true, false },
+                                                          { true, true, false, false, true } };
+         blaze::DynamicMatrix<int,blaze::rowMajor> A{ {  1,  2,  3,  4,  5 },
+                                                      {  6,  7,  8,  9, 10 },
+                                                      { 11, 12, 13, 14, 15 } };
+         blaze::DynamicMatrix<int,blaze::rowMajor> B( 3UL, 5UL, 0 );
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> C( select( cond, A, B ) );
+
+         checkRows    ( C,  3UL );
+         checkColumns ( C,  5UL );
+         checkCapacity( C, 15UL );
+         checkNonZeros( C,  8UL );
+
+         if( C(0,0) !=  1 || C(0,1) !=  0 || C(0,2) != 3 || C(0,3) != 0 || C(0,4) !=  5 ||
+             C(1,0) !=  0 || C(1,1) !=  7 || C(1,2) != 0 || C(1,3) != 9 || C(1,4) !=  0 ||
+             C(2,0) != 11 || C(2,1) != 12 || C(2,2) != 0 || C(2,3) != 0 || C(2,4) != 15 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Selection failed\n"
+                << " Details:\n"
+                << "   Result:\n" << C << "\n"
+                << "   Expected result:\n(  1  0  3  0  5 )\n"
+                                        "(  0  7  0  9  0 )\n"
+                                        "( 11 12  0  0 15 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Selection based on an elementwise comparison
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> X{ { 1.0, 5.0, 3.0, 7.0, 2.0 },
+                                                         { 9.0, 4.0, 8.0, 0.0, 6.0 },
+                                                         { 3.0, 3.0, 5.0, 5.0, 4.0 } };
+         blaze::DynamicMatrix<double,blaze::rowMajor> Y( 3UL, 5UL, 4.0 );
+
+         blaze::DynamicMatrix<double,blaze::rowMajor> C(
+            select( map( X, Y, blaze::Greater() ), X, 0.0*Y ) );
+
+         checkRows    ( C,  3UL );
+         checkColumns ( C,  5UL );
+         checkCapacity( C, 15UL );
+         checkNonZeros( C,  7UL );
+
+         if( C(0,0) != 0.0 || C(0,1) != 5.0 || C(0,2) != 0.0 || C(0,3) != 7.0 || C(0,4) != 0.0 ||
+             C(1,0) != 9.0 || C(1,1) != 0.0 || C(1,2) != 8.0 || C(1,3) != 0.0 || C(1,4) != 6.0 ||
+             C(2,0) != 0.0 || C(2,1) != 0.0 || C(2,2) != 5.0 || C(2,3) != 5.0 || C(2,4) != 0.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Selection failed\n"
+                << " Details:\n"
+                << "   Result:\n" << C << "\n"
+                << "   Expected result:\n( 0 5 0 7 0 )\n"
+                                        "( 9 0 8 0 6 )\n"
+                                        "( 0 0 5 5 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major select() function";
+
+      // Selection based on a boolean matrix
+      {
+         blaze::DynamicMatrix<bool,blaze::columnMajor> cond{ { true, false, true, false, true },
+                                                             { false, true, false, true, false },
+                                                             { true, true, false, false, true } };
+         blaze::DynamicMatrix<int,blaze::columnMajor> A{ {  1,  2,  3,  4,  5 },
+                                                         {  6,  7,  8,  9, 10 },
+                                                         { 11, 12, 13, 14, 15 } };
+         blaze::DynamicMatrix<int,blaze::columnMajor> B( 3UL, 5UL, 0 );
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> C( select( cond, A, B ) );
+
+         checkRows    ( C,  3UL );
+         checkColumns ( C,  5UL );
+         checkCapacity( C, 15UL );
+         checkNonZeros( C,  8UL );
+
+         if( C(0,0) !=  1 || C(0,1) !=  0 || C(0,2) != 3 || C(0,3) != 0 || C(0,4) !=  5 ||
+             C(1,0) !=  0 || C(1,1) !=  7 || C(1,2) != 0 || C(1,3) != 9 || C(1,4) !=  0 ||
+             C(2,0) != 11 || C(2,1) != 12 || C(2,2) != 0 || C(2,3) != 0 || C(2,4) != 15 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Selection failed\n"
+                << " Details:\n"
+                << "   Result:\n" << C << "\n"
+                << "   Expected result:\n(  1  0  3  0  5 )\n"
+                                        "(  0  7  0  9  0 )\n"
+                                        "( 11 12  0  0 15 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Selection based on an elementwise comparison
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> X{ { 1.0, 5.0, 3.0, 7.0, 2.0 },
+                                                            { 9.0, 4.0, 8.0, 0.0, 6.0 },
+                                                            { 3.0, 3.0, 5.0, 5.0, 4.0 } };
+         blaze::DynamicMatrix<double,blaze::columnMajor> Y( 3UL, 5UL, 4.0 );
+
+         blaze::DynamicMatrix<double,blaze::columnMajor> C(
+            select( map( X, Y, blaze::Greater() ), X, 0.0*Y ) );
+
+         checkRows    ( C,  3UL );
+         checkColumns ( C,  5UL );
+         checkCapacity( C, 15UL );
+         checkNonZeros( C,  7UL );
+
+         if( C(0,0) != 0.0 || C(0,1) != 5.0 || C(0,2) != 0.0 || C(0,3) != 7.0 || C(0,4) != 0.0 ||
+             C(1,0) != 9.0 || C(1,1) != 0.0 || C(1,2) != 8.0 || C(1,3) != 0.0 || C(1,4) != 6.0 ||
+             C(2,0) != 0.0 || C(2,1) != 0.0 || C(2,2) != 5.0 || C(2,3) != 5.0 || C(2,4) != 0.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Selection failed\n"
+                << " Details:\n"
+                << "   Result:\n" << C << "\n"
+                << "   Expected result:\n( 0 5 0 7 0 )\n"
+                                        "( 9 0 8 0 6 )\n"
+                                        "( 0 0 5 5 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c maskedAssign() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c maskedAssign() function for dense matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMaskedAssign()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major maskedAssign() function";
+
+      // Masked assignment based on an elementwise comparison
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> A{ { 1.0, -2.0, 3.0, -4.0, 5.0 },
+                                                         { -6.0, 7.0, -8.0, 9.0, -1.0 },
+                                                         { 2.0, 3.0, -4.0, -5.0, 6.0 } };
+         blaze::DynamicMatrix<double,blaze::rowMajor> B( 3UL, 5UL, 0.0 );
+
+         maskedAssign( A, map( A, B, blaze::Less() ), B );
+
+         checkRows    ( A,  3UL );
+         checkColumns ( A,  5UL );
+         checkCapacity( A, 15UL );
+         checkNonZeros( A,  8UL );
+
+         if( A(0,0) != 1.0 || A(0,1) != 0.0 || A(0,2) != 3.0 || A(0,3) != 0.0 || A(0,4) != 5.0 ||
+             A(1,0) != 0.0 || A(1,1) != 7.0 || A(1,2) != 0.0 || A(1,3) != 9.0 || A(1,4) != 0.0 ||
+             A(2,0) != 2.0 || A(2,1) != 3.0 || A(2,2) != 0.0 || A(2,3) != 0.0 || A(2,4) != 6.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment failed\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n"
+                << "   Expected result:\n( 1 0 3 0 5 )\n"
+                                        "( 0 7 0 9 0 )\n"
+                                        "( 2 3 0 0 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Masked assignment to a submatrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> A{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+         blaze::DynamicMatrix<bool,blaze::rowMajor> cond{ { true, false }, { false, true } };
+         blaze::DynamicMatrix<int,blaze::rowMajor> B( 2UL, 2UL, 0 );
+
+         auto sm = submatrix( A, 1UL, 1UL, 2UL, 2UL );
+         maskedAssign( sm, cond, B );
+
+         checkRows    ( A, 3UL );
+         checkColumns ( A, 3UL );
+         checkCapacity( A, 9UL );
+         checkNonZeros( A, 7UL );
+
+         if( A(0,0) != 1 || A(0,1) != 2 || A(0,2) != 3 ||
+             A(1,0) != 4 || A(1,1) != 0 || A(1,2) != 6 ||
+             A(2,0) != 7 || A(2,1) != 8 || A(2,2) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment to submatrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n"
+                << "   Expected result:\n( 1 2 3 )\n"
+                                        "( 4 0 6 )\n"
+                                        "( 7 8 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Masked assignment with an overlapping submatrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> A( 21UL, 21UL );
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               A(i,j) = static_cast<int>( i*100UL + j );
+            }
+         }
+
+         const blaze::DynamicMatrix<bool,blaze::rowMajor> cond( 20UL, 20UL, true );
+
+         auto sm = submatrix( A, 1UL, 1UL, 20UL, 20UL );
+         maskedAssign( sm, cond, submatrix( A, 0UL, 0UL, 20UL, 20UL ) );
+
+         checkRows   ( A, 21UL );
+         checkColumns( A, 21UL );
+
+         bool failed( false );
+         for( size_t i=0UL; !failed && i<A.rows(); ++i ) {
+            for( size_t j=0UL; !failed && j<A.columns(); ++j ) {
+               const size_t k( ( i == 0UL || j == 0UL )?( i*100UL + j ):( (i-1UL)*100UL + j-1UL ) );
+               failed = ( A(i,j) != static_cast<int>( k ) );
+            }
+         }
+
+         if( failed ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment with overlapping submatrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Masked assignment with non-matching matrix sizes
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> A( 2UL, 3UL, 1.0 );
+         blaze::DynamicMatrix<double,blaze::rowMajor> B( 3UL, 2UL, 0.0 );
+
+         try {
+            maskedAssign( A, map( B, B, blaze::Less() ), B );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment with non-matching sizes succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major maskedAssign() function";
+
+      // Masked assignment based on an elementwise comparison
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> A{ { 1.0, -2.0, 3.0, -4.0, 5.0 },
+                                                            { -6.0, 7.0, -8.0, 9.0, -1.0 },
+                                                            { 2.0, 3.0, -4.0, -5.0, 6.0 } };
+         blaze::DynamicMatrix<double,blaze::columnMajor> B( 3UL, 5UL, 0.0 );
+
+         maskedAssign( A, map( A, B, blaze::Less() ), B );
+
+         checkRows    ( A,  3UL );
+         checkColumns ( A,  5UL );
+         checkCapacity( A, 15UL );
+         checkNonZeros( A,  8UL );
+
+         if( A(0,0) != 1.0 || A(0,1) != 0.0 || A(0,2) != 3.0 || A(0,3) != 0.0 || A(0,4) != 5.0 ||
+             A(1,0) != 0.0 || A(1,1) != 7.0 || A(1,2) != 0.0 || A(1,3) != 9.0 || A(1,4) != 0.0 ||
+             A(2,0) != 2.0 || A(2,1) != 3.0 || A(2,2) != 0.0 || A(2,3) != 0.0 || A(2,4) != 6.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment failed\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n"
+                << "   Expected result:\n( 1 0 3 0 5 )\n"
+                                        "( 0 7 0 9 0 )\n"
+                                        "( 2 3 0 0 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Masked assignment to a submatrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> A{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+         blaze::DynamicMatrix<bool,blaze::columnMajor> cond{ { true, false }, { false, true } };
+         blaze::DynamicMatrix<int,blaze::columnMajor> B( 2UL, 2UL, 0 );
+
+         auto sm = submatrix( A, 1UL, 1UL, 2UL, 2UL );
+         maskedAssign( sm, cond, B );
+
+         checkRows    ( A, 3UL );
+         checkColumns ( A, 3UL );
+         checkCapacity( A, 9UL );
+         checkNonZeros( A, 7UL );
+
+         if( A(0,0) != 1 || A(0,1) != 2 || A(0,2) != 3 ||
+             A(1,0) != 4 || A(1,1) != 0 || A(1,2) != 6 ||
+             A(2,0) != 7 || A(2,1) != 8 || A(2,2) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment to submatrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n"
+                << "   Expected result:\n( 1 2 3 )\n"
+                                        "( 4 0 6 )\n"
+                                        "( 7 8 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Masked assignment with an overlapping submatrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> A( 21UL, 21UL );
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               A(i,j) = static_cast<int>( i*100UL + j );
+            }
+         }
+
+         const blaze::DynamicMatrix<bool,blaze::columnMajor> cond( 20UL, 20UL, true );
+
+         auto sm = submatrix( A, 1UL, 1UL, 20UL, 20UL );
+         maskedAssign( sm, cond, submatrix( A, 0UL, 0UL, 20UL, 20UL ) );
+
+         checkRows   ( A, 21UL );
+         checkColumns( A, 21UL );
+
+         bool failed( false );
+         for( size_t i=0UL; !failed && i<A.rows(); ++i ) {
+            for( size_t j=0UL; !failed && j<A.columns(); ++j ) {
+               const size_t k( ( i == 0UL || j == 0UL )?( i*100UL + j ):( (i-1UL)*100UL + j-1UL ) );
+               failed = ( A(i,j) != static_cast<int>( k ) );
+            }
+         }
+
+         if( failed ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment with overlapping submatrix failed\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Masked assignment with non-matching matrix sizes
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> A( 2UL, 3UL, 1.0 );
+         blaze::DynamicMatrix<double,blaze::columnMajor> B( 3UL, 2UL, 0.0 );
+
+         try {
+            maskedAssign( A, map( B, B, blaze::Less() ), B );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Masked assignment with non-matching sizes succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c generate() functions for dense matrices.
 //
@@ -85,6 +85,8 @@ GeneralTest::GeneralTest()
    testLpNorm();
    testLinfNorm();
    testLength();
+   testSum();
+   testDot();
    testMean();
    testVar();
    testStdDev();
@@ -97,6 +99,8 @@ GeneralTest::GeneralTest()
    testNot();
    testAnd();
    testOr();
+   testSelect();
+   testMaskedAssign();
    testGenerate();
    testLinspace();
    testLogspace();
@@ -1343,6 +1347,193 @@ void GeneralTest::testLength()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function with summation flag for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the pairwise and the compensated \c sum() function for dense
+// vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSum()
+{
+   test_ = "sum() function with summation flag";
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> vec;
+
+      const double pairwise   ( blaze::sum<blaze::pairwise>( vec ) );
+      const double compensated( blaze::sum<blaze::compensated>( vec ) );
+
+      if( pairwise != 0.0 || compensated != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation of empty vector failed\n"
+             << " Details:\n"
+             << "   Pairwise result: " << pairwise << "\n"
+             << "   Compensated result: " << compensated << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t n : { 1UL, 7UL, 100UL, 1001UL, 10007UL } )
+   {
+      blaze::DynamicVector<double,blaze::columnVector> vec( n );
+      for( size_t i=0UL; i<n; ++i ) {
+         vec[i] = static_cast<double>( i % 17UL ) - 8.0;
+      }
+
+      const double expected( blaze::sum( vec ) );
+      const double pairwise   ( blaze::sum<blaze::pairwise>( vec ) );
+      const double compensated( blaze::sum<blaze::compensated>( vec ) );
+
+      if( pairwise != expected || compensated != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation failed\n"
+             << " Details:\n"
+             << "   Size: " << n << "\n"
+             << "   Pairwise result: " << pairwise << "\n"
+             << "   Compensated result: " << compensated << "\n"
+             << "   Expected result: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::rowVector> vec( 1001UL, 1.0 );
+      vec[0UL   ] =  1E16;
+      vec[1000UL] = -1E16;
+
+      const double compensated( blaze::sum<blaze::compensated>( vec ) );
+
+      if( compensated != 999.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compensated summation failed\n"
+             << " Details:\n"
+             << "   Result: " << compensated << "\n"
+             << "   Expected result: 999\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<float,blaze::columnVector> vec( 1000000UL, 0.1F );
+
+      const double expected( 1000000.0 * static_cast<double>( 0.1F ) );
+      const float pairwise   ( blaze::sum<blaze::pairwise>( vec ) );
+      const float compensated( blaze::sum<blaze::compensated>( vec ) );
+
+      if( std::fabs( pairwise    - expected ) > 1E-6 * expected ||
+          std::fabs( compensated - expected ) > 1E-6 * expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation of single precision values failed\n"
+             << " Details:\n"
+             << "   Pairwise result: " << pairwise << "\n"
+             << "   Compensated result: " << compensated << "\n"
+             << "   Expected result: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<int,blaze::columnVector> vec{ 1, 4, 3, 6, 7 };
+
+      const int pairwise   ( blaze::sum<blaze::pairwise>( vec ) );
+      const int compensated( blaze::sum<blaze::compensated>( vec ) );
+
+      if( pairwise != 21 || compensated != 21 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation of integral vector failed\n"
+             << " Details:\n"
+             << "   Pairwise result: " << pairwise << "\n"
+             << "   Compensated result: " << compensated << "\n"
+             << "   Expected result: 21\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c dot() function with summation flag for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the pairwise and the compensated \c dot() function for dense
+// vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testDot()
+{
+   test_ = "dot() function with summation flag";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 100UL, 1001UL, 10007UL } )
+   {
+      blaze::DynamicVector<double,blaze::columnVector> a( n ), b( n );
+      for( size_t i=0UL; i<n; ++i ) {
+         a[i] = static_cast<double>( i % 13UL ) - 6.0;
+         b[i] = static_cast<double>( i %  5UL ) - 2.0;
+      }
+
+      const double expected( blaze::dot( a, b ) );
+      const double pairwise   ( blaze::dot<blaze::pairwise>( a, b ) );
+      const double compensated( blaze::dot<blaze::compensated>( trans( a ), b ) );
+
+      if( pairwise != expected || compensated != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scalar product failed\n"
+             << " Details:\n"
+             << "   Size: " << n << "\n"
+             << "   Pairwise result: " << pairwise << "\n"
+             << "   Compensated result: " << compensated << "\n"
+             << "   Expected result: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> a( 1001UL, 0.5 ), b( 1001UL, 2.0 );
+      a[0UL   ] =  1E16;
+      a[1000UL] = -1E16;
+
+      const double compensated( blaze::dot<blaze::compensated>( a, b ) );
+
+      if( compensated != 999.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compensated scalar product failed\n"
+             << " Details:\n"
+             << "   Result: " << compensated << "\n"
+             << "   Expected result: 999\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      blaze::DynamicVector<double,blaze::columnVector> a( 3UL ), b( 4UL );
+
+      const double compensated( blaze::dot<blaze::compensated>( a, b ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scalar product of vectors with different sizes succeeded\n"
+          << " Details:\n"
+          << "   Result: " << compensated << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c mean() function for dense vectors.
 //
@@ -2453,6 +2644,341 @@ void GeneralTest::testOr()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c select() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c select() function for dense vectors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSelect()
+{
+   //=====================================================================================
+   // Selection based on a boolean vector
+   //=====================================================================================
+
+   {
+      test_ = "select() function (boolean conditions)";
+
+      blaze::DynamicVector<bool> cond{ true, false, true, false, false, true, true, false, true };
+      blaze::DynamicVector<int> a{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      blaze::DynamicVector<int> b{ -1, -2, -3, -4, -5, -6, -7, -8, -9 };
+
+      blaze::DynamicVector<int> c( select( cond, a, b ) );
+
+      checkSize    ( c, 9UL );
+      checkCapacity( c, 9UL );
+      checkNonZeros( c, 9UL );
+
+      if( c[0] != 1 || c[1] != -2 || c[2] != 3 || c[3] != -4 || c[4] != -5 ||
+          c[5] != 6 || c[6] != 7 || c[7] != -8 || c[8] != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selection failed\n"
+             << " Details:\n"
+             << "   Result:\n" << c << "\n"
+             << "   Expected result:\n( 1 -2 3 -4 -5 6 7 -8 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Selection based on a floating point vector
+   //=====================================================================================
+
+   {
+      test_ = "select() function (floating point conditions)";
+
+      blaze::DynamicVector<double> cond{ 1.0, 0.0, -2.0, 0.0, 0.0, 0.5, 3.0, 0.0, 1.0 };
+      blaze::DynamicVector<double> a{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 };
+      blaze::DynamicVector<double> b{ -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0 };
+
+      blaze::DynamicVector<double> c( select( cond, a, b ) );
+
+      checkSize    ( c, 9UL );
+      checkCapacity( c, 9UL );
+      checkNonZeros( c, 9UL );
+
+      if( c[0] != 1.0 || c[1] != -2.0 || c[2] != 3.0 || c[3] != -4.0 || c[4] != -5.0 ||
+          c[5] != 6.0 || c[6] != 7.0 || c[7] != -8.0 || c[8] != 9.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selection failed\n"
+             << " Details:\n"
+             << "   Result:\n" << c << "\n"
+             << "   Expected result:\n( 1 -2 3 -4 -5 6 7 -8 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Selection based on an elementwise comparison
+   //=====================================================================================
+
+   {
+      test_ = "select() function (elementwise comparison)";
+
+      blaze::DynamicVector<double> x{ 1.0, 5.0, 3.0, 7.0, 2.0, 9.0, 4.0, 8.0, 0.0 };
+      blaze::DynamicVector<double> y{ 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0 };
+
+      blaze::DynamicVector<double> c( select( map( x, y, blaze::Less() ), x, y ) );
+      blaze::DynamicVector<double> d( select( map( x, y, blaze::GreaterEqual() ), x, 2.0*y ) );
+
+      checkSize    ( c, 9UL );
+      checkCapacity( c, 9UL );
+      checkNonZeros( c, 8UL );
+      checkSize    ( d, 9UL );
+      checkCapacity( d, 9UL );
+      checkNonZeros( d, 9UL );
+
+      if( c[0] != 1.0 || c[1] != 4.0 || c[2] != 3.0 || c[3] != 4.0 || c[4] != 2.0 ||
+          c[5] != 4.0 || c[6] != 4.0 || c[7] != 4.0 || c[8] != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Less-than selection failed\n"
+             << " Details:\n"
+             << "   Result:\n" << c << "\n"
+             << "   Expected result:\n( 1 4 3 4 2 4 4 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( d[0] != 8.0 || d[1] != 5.0 || d[2] != 8.0 || d[3] != 7.0 || d[4] != 8.0 ||
+          d[5] != 9.0 || d[6] != 4.0 || d[7] != 8.0 || d[8] != 8.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Greater-or-equal-than selection failed\n"
+             << " Details:\n"
+             << "   Result:\n" << d << "\n"
+             << "   Expected result:\n( 8 5 8 7 8 9 4 8 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Selection with non-matching vector sizes
+   //=====================================================================================
+
+   {
+      test_ = "select() function (non-matching sizes)";
+
+      blaze::DynamicVector<double> x{ 1.0, 5.0, 3.0 };
+      blaze::DynamicVector<double> y{ 4.0, 4.0, 4.0, 4.0 };
+
+      try {
+         blaze::DynamicVector<double> c( select( map( x, x, blaze::Less() ), x, y ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Selection with non-matching sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << c << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c maskedAssign() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c maskedAssign() function for dense vectors. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMaskedAssign()
+{
+   //=====================================================================================
+   // Masked assignment based on a boolean vector
+   //=====================================================================================
+
+   {
+      test_ = "maskedAssign() function (boolean conditions)";
+
+      blaze::DynamicVector<bool> cond{ true, false, true, false, false, true, true, false, true };
+      blaze::DynamicVector<int> a{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      blaze::DynamicVector<int> b( 9UL, 0 );
+
+      maskedAssign( a, cond, b );
+
+      checkSize    ( a, 9UL );
+      checkCapacity( a, 9UL );
+      checkNonZeros( a, 4UL );
+
+      if( a[0] != 0 || a[1] != 2 || a[2] != 0 || a[3] != 4 || a[4] != 5 ||
+          a[5] != 0 || a[6] != 0 || a[7] != 8 || a[8] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n"
+             << "   Expected result:\n( 0 2 0 4 5 0 0 8 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Masked assignment based on an elementwise comparison
+   //=====================================================================================
+
+   {
+      test_ = "maskedAssign() function (elementwise comparison)";
+
+      blaze::DynamicVector<double> a{ 1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0 };
+      blaze::DynamicVector<double> b( 9UL, 0.0 );
+
+      maskedAssign( a, map( a, b, blaze::Less() ), b );
+
+      checkSize    ( a, 9UL );
+      checkCapacity( a, 9UL );
+      checkNonZeros( a, 5UL );
+
+      if( a[0] != 1.0 || a[1] != 0.0 || a[2] != 3.0 || a[3] != 0.0 || a[4] != 5.0 ||
+          a[5] != 0.0 || a[6] != 7.0 || a[7] != 0.0 || a[8] != 9.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n"
+             << "   Expected result:\n( 1 0 3 0 5 0 7 0 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Masked assignment to a subvector
+   //=====================================================================================
+
+   {
+      test_ = "maskedAssign() function (subvector)";
+
+      blaze::DynamicVector<double> a{ 1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0 };
+      blaze::DynamicVector<double> b( 5UL, 0.0 );
+
+      auto sv = subvector( a, 2UL, 5UL );
+      maskedAssign( sv, map( sv, b, blaze::Greater() ), b );
+
+      checkSize    ( a, 9UL );
+      checkCapacity( a, 9UL );
+      checkNonZeros( a, 6UL );
+
+      if( a[0] != 1.0 || a[1] != -2.0 || a[2] != 0.0 || a[3] != -4.0 || a[4] != 0.0 ||
+          a[5] != -6.0 || a[6] != 0.0 || a[7] != -8.0 || a[8] != 9.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n"
+             << "   Expected result:\n( 1 -2 0 -4 0 -6 0 -8 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Masked assignment with overlapping subvectors
+   //=====================================================================================
+
+   {
+      test_ = "maskedAssign() function (overlapping right-hand side subvector)";
+
+      blaze::DynamicVector<int> a( 41UL );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = static_cast<int>( i );
+      }
+
+      const blaze::DynamicVector<bool> cond( 40UL, true );
+
+      auto sv = subvector( a, 1UL, 40UL );
+      maskedAssign( sv, cond, subvector( a, 0UL, 40UL ) );
+
+      checkSize( a, 41UL );
+
+      bool failed( a[0] != 0 );
+      for( size_t i=1UL; !failed && i<a.size(); ++i ) {
+         failed = ( a[i] != static_cast<int>( i-1UL ) );
+      }
+
+      if( failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << trans( a ) << "\n"
+             << "   Expected result:\n( 0 0 1 2 ... 39 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "maskedAssign() function (overlapping condition subvector)";
+
+      blaze::DynamicVector<int> a( 41UL );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = ( i % 2UL == 0UL )?( 1 ):( -1 );
+      }
+
+      const blaze::DynamicVector<int> zero( 40UL, 0 );
+      const blaze::DynamicVector<int> b( 40UL, 5 );
+
+      auto sv = subvector( a, 1UL, 40UL );
+      maskedAssign( sv, map( subvector( a, 0UL, 40UL ), zero, blaze::Greater() ), b );
+
+      checkSize( a, 41UL );
+
+      bool failed( a[0] != 1 );
+      for( size_t i=1UL; !failed && i<a.size(); ++i ) {
+         failed = ( a[i] != ( ( i % 2UL == 1UL )?( 5 ):( 1 ) ) );
+      }
+
+      if( failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << trans( a ) << "\n"
+             << "   Expected result:\n( 1 5 1 5 ... 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Masked assignment with non-matching vector sizes
+   //=====================================================================================
+
+   {
+      test_ = "maskedAssign() function (non-matching sizes)";
+
+      blaze::DynamicVector<double> a{ 1.0, -2.0, 3.0 };
+      blaze::DynamicVector<double> b( 4UL, 0.0 );
+
+      try {
+         maskedAssign( a, map( b, b, blaze::Less() ), b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked assignment with non-matching sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c generate() functions for dense vectors.
 //
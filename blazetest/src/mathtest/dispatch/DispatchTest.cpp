@@ -0,0 +1,413 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dispatch/DispatchTest.cpp
+//  \brief Source file for the runtime dispatch test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/Subvector.h>
+#include <blazetest/mathtest/dispatch/DispatchTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DispatchTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+DispatchTest::DispatchTest()
+   : test_()
+   , isa_( blaze::InstructionSet::baseline )
+{
+   testSelection();
+
+   testVectorOperations<float>();
+   testVectorOperations<double>();
+   testMatVecMult<float>();
+   testMatVecMult<double>();
+   testMatMatMult<float>();
+   testMatMatMult<double>();
+
+   blaze::resetInstructionSet();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the selection of the instruction set.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the selected instruction set never exceeds the capabilities of the
+// CPU and that the compile time kernels are used in case the CPU doesn't provide an instruction
+// set that is more capable than the compile time instruction set.
+*/
+void DispatchTest::testSelection()
+{
+   test_ = "Instruction set selection";
+
+   using blaze::InstructionSet;
+
+   const InstructionSet detected( blaze::detectInstructionSet() );
+
+   blaze::resetInstructionSet();
+   const InstructionSet initial( blaze::getInstructionSet() );
+
+   if( initial > detected ||
+       ( initial != InstructionSet::baseline && initial <= blaze::compiledInstructionSet() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid initial instruction set\n"
+          << " Details:\n"
+          << "   Detected instruction set : " << static_cast<int>( detected ) << "\n"
+          << "   Selected instruction set : " << static_cast<int>( initial ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setInstructionSet( InstructionSet::baseline );
+
+   if( blaze::getInstructionSet() != InstructionSet::baseline ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Restricting the instruction set failed\n"
+          << " Details:\n"
+          << "   Selected instruction set : "
+          << static_cast<int>( blaze::getInstructionSet() ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setInstructionSet( InstructionSet::avx2 );
+
+   if( blaze::getInstructionSet() > InstructionSet::avx2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Instruction set limit is not considered\n"
+          << " Details:\n"
+          << "   Selected instruction set : "
+          << static_cast<int>( blaze::getInstructionSet() ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetInstructionSet();
+
+   if( blaze::getInstructionSet() != initial ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the instruction set failed\n"
+          << " Details:\n"
+          << "   Selected instruction set : "
+          << static_cast<int>( blaze::getInstructionSet() ) << "\n"
+          << "   Expected instruction set : " << static_cast<int>( initial ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched vector operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the dispatched vector addition, subtraction and
+// multiplication, of the dispatched reductions, and of the dispatched sparse matrix/dense
+// vector multiplication with the results of the compile time kernels.
+*/
+template< typename T >  // Element type of the operands
+void DispatchTest::testVectorOperations()
+{
+   using blaze::InstructionSet;
+
+   const InstructionSet sets[] = { InstructionSet::avx2, InstructionSet::avx512 };
+
+   for( size_t n : { 1UL, 7UL, 33UL, 1000UL } )
+   {
+      blaze::DynamicVector<T> a( n ), b( n );
+      initialize( a );
+      initialize( b );
+
+      blaze::CompressedMatrix<T> S( 20UL, n );
+      for( size_t i=0UL; i<S.rows(); ++i ) {
+         for( size_t j=i%3UL; j<n; j+=3UL ) {
+            S(i,j) = static_cast<T>( 1 + ( i+j ) % 5UL );
+         }
+      }
+
+      blaze::setInstructionSet( InstructionSet::baseline );
+
+      const blaze::DynamicVector<T> add( a + b ), sub( a - b ), mult( a * b );
+      const blaze::DynamicVector<T> view( subvector( a, 1UL, n-1UL ) + subvector( b, 0UL, n-1UL ) );
+      const blaze::DynamicVector<T> spmv( S * a );
+      const T total( sum( a ) ), inner( dot( a, b ) );
+
+      for( InstructionSet isa : sets )
+      {
+         blaze::setInstructionSet( isa );
+         isa_ = blaze::getInstructionSet();
+
+         blaze::DynamicVector<T> c;
+
+         test_ = "Dense vector addition";
+         c = a + b;
+         checkResult( c, add );
+
+         test_ = "Dense vector subtraction";
+         c = a - b;
+         checkResult( c, sub );
+
+         test_ = "Dense vector multiplication";
+         c = a * b;
+         checkResult( c, mult );
+
+         test_ = "Unaligned dense vector addition";
+         c = subvector( a, 1UL, n-1UL ) + subvector( b, 0UL, n-1UL );
+         checkResult( c, view );
+
+         test_ = "Sparse matrix/dense vector multiplication";
+         c = S * a;
+         checkResult( c, spmv );
+
+         test_ = "Dense vector reduction";
+         checkResult( sum( a ), total );
+
+         test_ = "Dense vector inner product";
+         checkResult( dot( a, b ), inner );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the dispatched row-major and column-major dense
+// matrix/dense vector multiplication with the results of the compile time kernels.
+*/
+template< typename T >  // Element type of the operands
+void DispatchTest::testMatVecMult()
+{
+   using blaze::InstructionSet;
+
+   const InstructionSet sets[] = { InstructionSet::avx2, InstructionSet::avx512 };
+   const size_t sizes[][2] = { { 1UL, 3UL }, { 5UL, 17UL }, { 67UL, 129UL }, { 300UL, 400UL } };
+
+   for( const auto& size : sizes )
+   {
+      blaze::DynamicMatrix<T,blaze::rowMajor> A( size[0], size[1] );
+      blaze::DynamicVector<T> x( size[1] ), y0( size[0] );
+      initialize( A );
+      initialize( x );
+      initialize( y0 );
+
+      const blaze::DynamicMatrix<T,blaze::columnMajor> B( A );
+
+      blaze::setInstructionSet( InstructionSet::baseline );
+
+      const blaze::DynamicVector<T> assign( A * x );
+      const blaze::DynamicVector<T> addAssign( y0 + A * x );
+      const blaze::DynamicVector<T> subAssign( y0 - A * x );
+
+      for( InstructionSet isa : sets )
+      {
+         blaze::setInstructionSet( isa );
+         isa_ = blaze::getInstructionSet();
+
+         blaze::DynamicVector<T> y;
+
+         test_ = "Row-major dense matrix/dense vector multiplication";
+         y = A * x;
+         checkResult( y, assign );
+         y = y0;
+         y += A * x;
+         checkResult( y, addAssign );
+         y = y0;
+         y -= A * x;
+         checkResult( y, subAssign );
+
+         test_ = "Column-major dense matrix/dense vector multiplication";
+         y = B * x;
+         checkResult( y, assign );
+         y = y0;
+         y += B * x;
+         checkResult( y, addAssign );
+         y = y0;
+         y -= B * x;
+         checkResult( y, subAssign );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatched dense matrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the dispatched dense matrix/dense matrix multiplication
+// for all combinations of storage orders with the results of the compile time kernels.
+*/
+template< typename T >  // Element type of the operands
+void DispatchTest::testMatMatMult()
+{
+   using blaze::InstructionSet;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const InstructionSet sets[] = { InstructionSet::avx2, InstructionSet::avx512 };
+   const size_t sizes[][3] = { { 3UL, 5UL, 1UL }, { 67UL, 130UL, 33UL }, { 200UL, 300UL, 190UL } };
+
+   for( const auto& size : sizes )
+   {
+      blaze::DynamicMatrix<T,rowMajor> A ( size[0], size[1] );
+      blaze::DynamicMatrix<T,rowMajor> B ( size[1], size[2] );
+      blaze::DynamicMatrix<T,rowMajor> C0( size[0], size[2] );
+      initialize( A );
+      initialize( B );
+      initialize( C0 );
+
+      const blaze::DynamicMatrix<T,columnMajor> TA( A ), TB( B );
+
+      blaze::setInstructionSet( InstructionSet::baseline );
+
+      const blaze::DynamicMatrix<T,rowMajor> assign( A * B );
+      const blaze::DynamicMatrix<T,rowMajor> addAssign( C0 + A * B );
+      const blaze::DynamicMatrix<T,rowMajor> subAssign( C0 - A * B );
+
+      for( InstructionSet isa : sets )
+      {
+         blaze::setInstructionSet( isa );
+         isa_ = blaze::getInstructionSet();
+
+         blaze::DynamicMatrix<T,rowMajor> C;
+         blaze::DynamicMatrix<T,columnMajor> TC;
+
+         test_ = "Row-major dense matrix/row-major dense matrix multiplication";
+         C = A * B;
+         checkResult( C, assign );
+         C = C0;
+         C += A * B;
+         checkResult( C, addAssign );
+         C = C0;
+         C -= A * B;
+         checkResult( C, subAssign );
+
+         test_ = "Row-major dense matrix/column-major dense matrix multiplication";
+         C = A * TB;
+         checkResult( C, assign );
+
+         test_ = "Column-major dense matrix/row-major dense matrix multiplication";
+         TC = TA * B;
+         checkResult( TC, assign );
+
+         test_ = "Column-major dense matrix/column-major dense matrix multiplication";
+         TC = TA * TB;
+         checkResult( TC, assign );
+         TC = C0;
+         TC += TA * TB;
+         checkResult( TC, addAssign );
+         TC = C0;
+         TC -= TA * TB;
+         checkResult( TC, subAssign );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime dispatch test..." << std::endl;
+
+   try
+   {
+      RUN_DISPATCH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime dispatch test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
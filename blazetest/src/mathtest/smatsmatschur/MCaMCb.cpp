@@ -89,6 +89,11 @@ int main()
       RUN_SMATSMATSCHUR_OPERATION_TEST( CMCa(  67UL, 127UL, 13UL ), CMCb(  67UL, 127UL, 13UL ) );
       RUN_SMATSMATSCHUR_OPERATION_TEST( CMCa( 128UL,  64UL,  8UL ), CMCb( 128UL,  64UL,  8UL ) );
       RUN_SMATSMATSCHUR_OPERATION_TEST( CMCa( 128UL, 128UL, 16UL ), CMCb( 128UL, 128UL, 16UL ) );
+
+      // Running tests with skewed matrices
+      RUN_SMATSMATSCHUR_OPERATION_TEST( CMCa( 32UL, 500UL,   32UL ), CMCb( 32UL, 500UL, 9600UL ) );
+      RUN_SMATSMATSCHUR_OPERATION_TEST( CMCa( 32UL, 500UL, 9600UL ), CMCb( 32UL, 500UL,   32UL ) );
+      RUN_SMATSMATSCHUR_OPERATION_TEST( CMCa( 32UL, 500UL, 9600UL ), CMCb( 32UL, 500UL, 9600UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during sparse matrix/sparse matrix Schur product:\n"
@@ -0,0 +1,326 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/AsyncTest.cpp
+//  \brief Source file for the asynchronous evaluation test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/StaticVector.h>
+#include <blazetest/mathtest/smp/AsyncTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AsyncTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AsyncTest::AsyncTest()
+   : test_()
+{
+   testFuture();
+   testAssign();
+   testDependency();
+   testException();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Future class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the state of default constructed and of completed futures.
+*/
+void AsyncTest::testFuture()
+{
+   test_ = "Future class";
+
+   const blaze::Future empty;
+
+   if( empty.valid() || !empty.ready() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid state of a default constructed future\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   empty.wait();
+
+   std::atomic<int> value( 0 );
+   const blaze::Future future( blaze::asyncCall( [&value]() { value = 1; } ) );
+   future.wait();
+   future.wait();
+
+   if( !future.valid() || !future.ready() || value != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid state of a completed future\n"
+          << " Details:\n"
+          << "   Valid : " << future.valid() << "\n"
+          << "   Ready : " << future.ready() << "\n"
+          << "   Value : " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts several independent asynchronous assignments at once and compares the
+// results with the according synchronous assignments.
+*/
+void AsyncTest::testAssign()
+{
+   test_ = "Independent asynchronous assignments";
+
+   const size_t N( 150UL );
+
+   blaze::DynamicMatrix<double> A( N, N ), B( N, N ), X, Xref;
+   blaze::DynamicVector<double> x( N ), y, yref;
+   std::vector< blaze::DynamicVector<double> > z( 8UL );
+
+   blaze::randomize( A );
+   blaze::randomize( B );
+   blaze::randomize( x );
+
+   std::vector<blaze::Future> futures;
+   futures.push_back( blaze::asyncAssign( X, A * B ) );
+   futures.push_back( blaze::asyncAssign( y, A * x ) );
+   for( blaze::DynamicVector<double>& v : z ) {
+      futures.push_back( blaze::asyncAssign( v, trans( A ) * x ) );
+   }
+
+   for( const blaze::Future& future : futures ) {
+      future.wait();
+   }
+
+   Xref = A * B;
+   yref = A * x;
+
+   if( X != Xref || y != yref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of an asynchronous assignment\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   yref = trans( A ) * x;
+
+   for( const blaze::DynamicVector<double>& v : z ) {
+      if( v != yref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result of concurrent asynchronous assignments\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of dependent asynchronous evaluations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that an asynchronous evaluation is started only after all of its
+// dependencies have been completed.
+*/
+void AsyncTest::testDependency()
+{
+   test_ = "Dependent asynchronous evaluations";
+
+   const size_t N( 150UL );
+
+   blaze::DynamicMatrix<double> A( N, N ), B( N, N ), X;
+   blaze::DynamicVector<double> x( N ), y, z, zref;
+
+   blaze::randomize( A );
+   blaze::randomize( B );
+   blaze::randomize( x );
+
+   for( size_t i=0UL; i<10UL; ++i )
+   {
+      X.clear();
+      y.clear();
+
+      const blaze::Future fx( blaze::asyncAssign( X, A * B ) );
+      const blaze::Future fy( blaze::asyncAssign( y, A * x ) );
+      const blaze::Future fz( blaze::asyncCall( [&]() { z = X * y; }, { fx, fy } ) );
+
+      fz.wait();
+
+      zref = ( A * B ) * ( A * x );
+
+      if( z.size() != N || blaze::max( blaze::abs( z - zref ) ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result of a dependent asynchronous evaluation\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that an exception thrown by an asynchronous evaluation is rethrown by
+// the according future and that it is propagated to all dependent evaluations, which are not
+// executed.
+*/
+void AsyncTest::testException()
+{
+   test_ = "Exception propagation";
+
+   blaze::StaticVector<double,3UL> a;
+   const blaze::DynamicVector<double> b( 5UL, 1.0 );
+   std::atomic<int> executed( 0 );
+
+   const blaze::Future fa( blaze::asyncAssign( a, b ) );
+   const blaze::Future fb( blaze::asyncCall( [&executed]() { ++executed; }, { fa } ) );
+
+   bool thrown( false );
+
+   try {
+      fb.wait();
+   }
+   catch( std::invalid_argument& ) {
+      thrown = true;
+   }
+
+   if( !thrown || executed != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid exception propagation\n"
+          << " Details:\n"
+          << "   Exception thrown    : " << thrown << "\n"
+          << "   Dependent executed  : " << executed << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      fa.wait();
+      thrown = false;
+   }
+   catch( std::invalid_argument& ) {}
+
+   if( !thrown ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Exception not rethrown by the failed evaluation\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous evaluation test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_ASYNC_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous evaluation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
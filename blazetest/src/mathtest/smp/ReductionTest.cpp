@@ -0,0 +1,292 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ReductionTest.cpp
+//  \brief Source file for the parallel reduction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Tuning.h>
+#include <blazetest/mathtest/smp/ReductionTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ReductionTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReductionTest::ReductionTest()
+   : test_()
+{
+   blaze::setThreshold( blaze::SMP_DVECREDUCE_THRESHOLD, 64UL );
+   blaze::setThreshold( blaze::SMP_DMATTOTALREDUCE_THRESHOLD, 64UL );
+
+   try {
+      testVector();
+      testInteger();
+      testMatrix();
+   }
+   catch( ... ) {
+      blaze::resetThresholds();
+      throw;
+   }
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reductions of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the total reductions, norms and inner products of
+// dense vectors of various sizes with the results of the according serial operations.
+*/
+void ReductionTest::testVector()
+{
+   test_ = "Parallel reduction of dense vectors";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 63UL, 64UL, 65UL, 1000UL, 10007UL } )
+   {
+      blaze::DynamicVector<double> a( n ), b( n ), c( n );
+      blaze::randomize( a, 0.5, 1.5 );
+      blaze::randomize( b, -1.0, 1.0 );
+      blaze::randomize( c, 0.999, 1.001 );
+
+      double sum{}, prod{}, min{}, max{}, norm{}, l1{}, dot{}, expr{};
+
+      BLAZE_SERIAL_SECTION
+      {
+         sum  = blaze::sum( a );
+         prod = blaze::prod( c );
+         min  = blaze::min( a );
+         max  = blaze::max( a );
+         norm = blaze::norm( a );
+         l1   = blaze::l1Norm( b );
+         dot  = blaze::dot( a, b );
+         expr = blaze::sum( a + b );
+      }
+
+      checkResult( "sum()"     , n, blaze::sum( a )     , sum , false );
+      checkResult( "prod()"    , n, blaze::prod( c )    , prod, false );
+      checkResult( "min()"     , n, blaze::min( a )     , min , true  );
+      checkResult( "max()"     , n, blaze::max( a )     , max , true  );
+      checkResult( "norm()"    , n, blaze::norm( a )    , norm, false );
+      checkResult( "l1Norm()"  , n, blaze::l1Norm( b )  , l1  , false );
+      checkResult( "dot()"     , n, blaze::dot( a, b )  , dot , false );
+      checkResult( "sum(a+b)"  , n, blaze::sum( a + b ) , expr, false );
+      checkResult( "repeated sum()", n, blaze::sum( a ), blaze::sum( a ), true );
+      checkResult( "repeated dot()", n, blaze::dot( a, b ), blaze::dot( a, b ), true );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reductions of integral dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the parallel reductions of integral dense vectors yield exactly
+// the results of the according serial operations.
+*/
+void ReductionTest::testInteger()
+{
+   test_ = "Parallel reduction of integral dense vectors";
+
+   for( size_t n : { 1UL, 65UL, 10007UL } )
+   {
+      blaze::DynamicVector<int> a( n ), b( n );
+      blaze::randomize( a, -10, 10 );
+      blaze::randomize( b, -10, 10 );
+
+      int sum{}, min{}, max{}, dot{};
+
+      BLAZE_SERIAL_SECTION
+      {
+         sum = blaze::sum( a );
+         min = blaze::min( a );
+         max = blaze::max( a );
+         dot = blaze::dot( a, b );
+      }
+
+      checkResult( "sum()", n, blaze::sum( a )   , sum, true );
+      checkResult( "min()", n, blaze::min( a )   , min, true );
+      checkResult( "max()", n, blaze::max( a )   , max, true );
+      checkResult( "dot()", n, blaze::dot( a, b ), dot, true );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reductions of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the total reductions of row-major and column-major
+// dense matrices of various sizes with the results of the according serial operations.
+*/
+void ReductionTest::testMatrix()
+{
+   test_ = "Parallel total reduction of dense matrices";
+
+   for( size_t m : { 0UL, 1UL, 5UL, 33UL, 200UL } )
+   {
+      const size_t n( m % 7UL + 13UL );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( m, n );
+      blaze::randomize( A );
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> B( A );
+
+      double sum{}, min{}, max{};
+
+      BLAZE_SERIAL_SECTION
+      {
+         sum = blaze::sum( A );
+         min = blaze::min( A );
+         max = blaze::max( A );
+      }
+
+      checkResult( "sum() (row-major)"   , m*n, blaze::sum( A )    , sum    , false );
+      checkResult( "min() (row-major)"   , m*n, blaze::min( A )    , min    , true  );
+      checkResult( "max() (row-major)"   , m*n, blaze::max( A )    , max    , true  );
+      checkResult( "sum() (column-major)", m*n, blaze::sum( B )    , sum    , false );
+      checkResult( "max() (column-major)", m*n, blaze::max( B )    , max    , true  );
+      checkResult( "sum() (expression)"  , m*n, blaze::sum( A + B ), 2.0*sum, false );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a parallel reduction with the expected result.
+//
+// \param operation The name of the reduction operation.
+// \param size The number of reduced elements.
+// \param result The result of the parallel reduction.
+// \param expected The expected result.
+// \param exact \a true in case the results have to be identical, \a false if they may differ
+//              by rounding errors.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void ReductionTest::checkResult( const std::string& operation, size_t size,
+                                 const T1& result, const T2& expected, bool exact ) const
+{
+   if( exact ? result != expected : !blaze::equal( result, expected ) ) {
+      std::ostringstream oss;
+      oss.precision( 17 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << operation << " operation\n"
+          << " Details:\n"
+          << "   Number of elements : " << size << "\n"
+          << "   Result             : " << result << "\n"
+          << "   Expected result    : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel reduction test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_REDUCTION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,272 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ReproducibleReductionTest.cpp
+//  \brief Source file for the reproducible parallel reduction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+#define BLAZE_SMP_REPRODUCIBLE_REDUCTION 1
+#define BLAZE_SMP_REDUCTION_BLOCK_SIZE 256
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Tuning.h>
+#include <blazetest/mathtest/smp/ReproducibleReductionTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ReproducibleReductionTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReproducibleReductionTest::ReproducibleReductionTest()
+   : test_   ()
+   , threads_( blaze::getNumThreads() )
+{
+   blaze::setThreshold( blaze::SMP_DVECREDUCE_THRESHOLD, 64UL );
+   blaze::setThreshold( blaze::SMP_DMATTOTALREDUCE_THRESHOLD, 64UL );
+
+   try {
+      testVector();
+      testMatrix();
+   }
+   catch( ... ) {
+      blaze::resetThresholds();
+      throw;
+   }
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reproducible parallel reductions of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the total reductions, norms and inner products of dense vectors
+// of various sizes yield bitwise identical results for serial execution and for any number of
+// threads.
+*/
+void ReproducibleReductionTest::testVector()
+{
+   test_ = "Reproducible parallel reduction of dense vectors";
+
+   for( size_t n : { 1UL, 63UL, 255UL, 256UL, 257UL, 1000UL, 10007UL, 100003UL } )
+   {
+      blaze::DynamicVector<double> a( n ), b( n );
+      blaze::randomize( a, -1.0, 1.0 );
+      blaze::randomize( b, -1.0, 1.0 );
+
+      double sum{}, norm{}, l1{}, dot{}, expr{};
+
+      BLAZE_SERIAL_SECTION
+      {
+         sum  = blaze::sum( a );
+         norm = blaze::norm( a );
+         l1   = blaze::l1Norm( b );
+         dot  = blaze::dot( a, b );
+         expr = blaze::sum( a + b );
+      }
+
+      for( size_t t=threads_; t>0UL; --t )
+      {
+#if !BLAZE_HPX_PARALLEL_MODE
+         blaze::setNumThreads( t );
+#endif
+
+         checkResult( "sum()"   , n, t, blaze::sum( a )    , sum  );
+         checkResult( "norm()"  , n, t, blaze::norm( a )   , norm );
+         checkResult( "l1Norm()", n, t, blaze::l1Norm( b ) , l1   );
+         checkResult( "dot()"   , n, t, blaze::dot( a, b ) , dot  );
+         checkResult( "sum(a+b)", n, t, blaze::sum( a + b ), expr );
+      }
+
+#if !BLAZE_HPX_PARALLEL_MODE
+      blaze::setNumThreads( threads_ );
+#endif
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reproducible parallel total reductions of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the total reductions of row-major and column-major dense matrices
+// of various sizes yield bitwise identical results for serial execution and for any number of
+// threads.
+*/
+void ReproducibleReductionTest::testMatrix()
+{
+   test_ = "Reproducible parallel total reduction of dense matrices";
+
+   for( size_t m : { 1UL, 5UL, 33UL, 200UL, 1000UL } )
+   {
+      const size_t n( m % 7UL + 13UL );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( m, n );
+      blaze::randomize( A, -1.0, 1.0 );
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> B( A );
+
+      double rowSum{}, columnSum{};
+
+      BLAZE_SERIAL_SECTION
+      {
+         rowSum    = blaze::sum( A );
+         columnSum = blaze::sum( B );
+      }
+
+      for( size_t t=threads_; t>0UL; --t )
+      {
+#if !BLAZE_HPX_PARALLEL_MODE
+         blaze::setNumThreads( t );
+#endif
+
+         checkResult( "sum() (row-major)"   , m*n, t, blaze::sum( A ), rowSum    );
+         checkResult( "sum() (column-major)", m*n, t, blaze::sum( B ), columnSum );
+      }
+
+#if !BLAZE_HPX_PARALLEL_MODE
+      blaze::setNumThreads( threads_ );
+#endif
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise comparison of the result of a parallel reduction with the expected result.
+//
+// \param operation The name of the reduction operation.
+// \param size The number of reduced elements.
+// \param threads The number of threads used for the parallel reduction.
+// \param result The result of the parallel reduction.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+void ReproducibleReductionTest::checkResult( const std::string& operation, size_t size,
+                                             size_t threads, double result,
+                                             double expected ) const
+{
+   if( std::memcmp( &result, &expected, sizeof( double ) ) != 0 ) {
+      std::ostringstream oss;
+      oss.precision( 17 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-reproducible result of the " << operation << " operation\n"
+          << " Details:\n"
+          << "   Number of elements : " << size << "\n"
+          << "   Number of threads  : " << threads << "\n"
+          << "   Result             : " << result << "\n"
+          << "   Expected result    : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running reproducible parallel reduction test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_REPRODUCIBLEREDUCTION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during reproducible parallel reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,289 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/TeamTest.cpp
+//  \brief Source file for the thread team test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/SMP.h>
+#include <blazetest/mathtest/smp/TeamTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TeamTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+TeamTest::TeamTest()
+   : test_()
+{
+   testSetup();
+   testSection();
+   testConcurrent();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the setup of thread teams.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size of a thread team and the rejection of invalid arguments.
+*/
+void TeamTest::testSetup()
+{
+   test_ = "Setup of thread teams";
+
+   const blaze::ThreadTeam team( 3UL );
+
+   if( team.size() != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid team size\n"
+          << " Details:\n"
+          << "   Result          : " << team.size() << "\n"
+          << "   Expected result : 3\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      const blaze::ThreadTeam invalid( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Creating a team without threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      const blaze::ThreadTeam invalid( 2UL, "invalid" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Creating a team with an invalid thread affinity succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the team section.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the number of threads within a (nested) team section corresponds
+// to the size of the team and that the previous number of threads is restored afterwards.
+*/
+void TeamTest::testSection()
+{
+   test_ = "Team section";
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || \
+    BLAZE_OPENMP_PARALLEL_MODE
+   const size_t threads( blaze::getNumThreads() );
+
+   blaze::ThreadTeam outer( 3UL );
+   blaze::ThreadTeam inner( 2UL );
+
+   size_t outerSize( 0UL ), innerSize( 0UL ), restoredSize( 0UL );
+
+   BLAZE_TEAM_SECTION( outer )
+   {
+      outerSize = blaze::getNumThreads();
+
+      BLAZE_TEAM_SECTION( inner ) {
+         innerSize = blaze::getNumThreads();
+      }
+
+      restoredSize = blaze::getNumThreads();
+   }
+
+   if( outerSize != 3UL || innerSize != 2UL || restoredSize != 3UL ||
+       blaze::getNumThreads() != threads ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads within a team section\n"
+          << " Details:\n"
+          << "   Outer team    : " << outerSize << " (expected 3)\n"
+          << "   Inner team    : " << innerSize << " (expected 2)\n"
+          << "   Restored team : " << restoredSize << " (expected 3)\n"
+          << "   No team       : " << blaze::getNumThreads() << " (expected " << threads << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of concurrent parallel operations within separate teams.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs the same parallel operations concurrently in several threads, each within
+// its own team, and compares the results with the result computed outside of any team.
+*/
+void TeamTest::testConcurrent()
+{
+   test_ = "Concurrent operations within separate teams";
+
+   const size_t N( 200UL );
+
+   blaze::DynamicMatrix<double> A( N, N ), B( N, N );
+   blaze::DynamicVector<double> x( N );
+
+   blaze::randomize( A );
+   blaze::randomize( B );
+   blaze::randomize( x );
+
+   const blaze::DynamicMatrix<double> Cref( A * B );
+   const blaze::DynamicVector<double> yref( A * x );
+
+   std::atomic<size_t> errors( 0UL );
+
+   const auto compute = [&]()
+   {
+      blaze::ThreadTeam team( 2UL );
+      blaze::DynamicMatrix<double> C;
+      blaze::DynamicVector<double> y;
+
+      BLAZE_TEAM_SECTION( team )
+      {
+         for( size_t i=0UL; i<10UL; ++i )
+         {
+            C = A * B;
+            y = A * x;
+
+            if( C != Cref || y != yref ) {
+               ++errors;
+            }
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for( size_t i=0UL; i<3UL; ++i ) {
+      threads.emplace_back( compute );
+   }
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   if( errors != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of a parallel operation within a team\n"
+          << " Details:\n"
+          << "   Number of errors : " << errors << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread team test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_TEAM_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread team test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
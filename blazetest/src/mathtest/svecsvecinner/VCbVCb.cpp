@@ -82,6 +82,11 @@ int main()
       // Running tests with large vectors
       RUN_SVECSVECINNER_OPERATION_TEST( CVCb( 127UL, 13UL ), CVCb( 127UL, 13UL ) );
       RUN_SVECSVECINNER_OPERATION_TEST( CVCb( 128UL, 16UL ), CVCb( 128UL, 16UL ) );
+
+      // Running tests with skewed vectors
+      RUN_SVECSVECINNER_OPERATION_TEST( CVCb( 1000UL,  10UL ), CVCb( 1000UL, 600UL ) );
+      RUN_SVECSVECINNER_OPERATION_TEST( CVCb( 1000UL, 600UL ), CVCb( 1000UL,  10UL ) );
+      RUN_SVECSVECINNER_OPERATION_TEST( CVCb( 1000UL, 600UL ), CVCb( 1000UL, 600UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during sparse vector/sparse vector inner product:\n"
@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/tuning/ThresholdTest.cpp
+//  \brief Source file for the runtime threshold test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/tuning/ThresholdTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace tuning {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThresholdTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ThresholdTest::ThresholdTest()
+   : test_()
+   , file_( "ThresholdTest.profile" )
+{
+   testDefaults();
+   testAdjustment();
+   testDispatch();
+   testProfile();
+   testErrors();
+
+   std::remove( file_.c_str() );
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the default values of the thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all thresholds are initialized with their default values and that
+// all thresholds can be accessed by name.
+*/
+void ThresholdTest::testDefaults()
+{
+   test_ = "Default values";
+
+   using Table = blaze::ThresholdTable<>;
+
+   for( size_t i=0UL; i<blaze::THRESHOLD_COUNT; ++i )
+   {
+      if( Table::values[i] != Table::defaults[i] ||
+          blaze::getThreshold( Table::names[i] ) != Table::defaults[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initial threshold value\n"
+             << " Details:\n"
+             << "   Threshold         : " << Table::names[i] << "\n"
+             << "   Result            : " << Table::values[i] << "\n"
+             << "   Expected result   : " << Table::defaults[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkValue( blaze::DMATDVECMULT_THRESHOLD, blaze::DMATDVECMULT_THRESHOLD.defaultValue() );
+   checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() );
+   checkValue( blaze::SMP_SMATPERMUTE_THRESHOLD, blaze::SMP_SMATPERMUTE_THRESHOLD.defaultValue() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the runtime adjustment of the thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ThresholdTest::testAdjustment()
+{
+   test_ = "Runtime adjustment";
+
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 123UL );
+   checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, 123UL );
+
+   blaze::setThreshold( "SMP_DMATASSIGN_THRESHOLD", 456UL );
+   checkValue( blaze::SMP_DMATASSIGN_THRESHOLD, 456UL );
+
+   if( blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" ) != 123UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Query by name failed\n"
+          << " Details:\n"
+          << "   Result          : " << blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" ) << "\n"
+          << "   Expected result : 123\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThresholds();
+   checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() );
+   checkValue( blaze::SMP_DMATASSIGN_THRESHOLD, blaze::SMP_DMATASSIGN_THRESHOLD.defaultValue() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the runtime dispatch based on the current threshold values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ThresholdTest::testDispatch()
+{
+   test_ = "Runtime dispatch";
+
+   const blaze::DynamicVector<double> a( 100UL, 1.0 );
+   const blaze::DynamicMatrix<double> A( 10UL, 10UL, 1.0 );
+
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 0UL );
+   blaze::setThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, 0UL );
+
+   if( !a.canSMPAssign() || !A.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Lowered threshold is not considered\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, std::numeric_limits<size_t>::max() );
+   blaze::setThreshold( blaze::SMP_DMATASSIGN_THRESHOLD, std::numeric_limits<size_t>::max() );
+
+   if( a.canSMPAssign() || A.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Raised threshold is not considered\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThresholds();
+
+   blaze::DynamicVector<double> b;
+   b = a * 2.0;
+
+   if( b.size() != 100UL || b[0] != 2.0 || b[99] != 2.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << b << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loading and saving of threshold profiles.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ThresholdTest::testProfile()
+{
+   //=====================================================================================
+   // Saving and loading a complete profile
+   //=====================================================================================
+
+   {
+      test_ = "Saving and loading a complete profile";
+
+      blaze::setThreshold( blaze::TDMATDVECMULT_THRESHOLD, 1000UL );
+      blaze::setThreshold( blaze::SMP_DMATDVECMULT_THRESHOLD, 2000UL );
+      blaze::saveThresholds( file_ );
+
+      blaze::resetThresholds();
+      checkValue( blaze::TDMATDVECMULT_THRESHOLD, blaze::TDMATDVECMULT_THRESHOLD.defaultValue() );
+
+      blaze::loadThresholds( file_ );
+      checkValue( blaze::TDMATDVECMULT_THRESHOLD, 1000UL );
+      checkValue( blaze::SMP_DMATDVECMULT_THRESHOLD, 2000UL );
+      checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() );
+   }
+
+
+   //=====================================================================================
+   // Loading a partial profile
+   //=====================================================================================
+
+   {
+      test_ = "Loading a partial profile";
+
+      {
+         std::ofstream out( file_.c_str() );
+         out << "# Partial profile\n"
+             << "\n"
+             << "   SMP_DVECASSIGN_THRESHOLD   77   # Comment\n"
+             << "UNKNOWN_THRESHOLD 5\n";
+      }
+
+      blaze::loadThresholds( file_ );
+      checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, 77UL );
+      checkValue( blaze::TDMATDVECMULT_THRESHOLD, 1000UL );
+   }
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the threshold functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ThresholdTest::testErrors()
+{
+   //=====================================================================================
+   // Unknown threshold
+   //=====================================================================================
+
+   {
+      test_ = "Unknown threshold";
+
+      try {
+         blaze::setThreshold( "UNKNOWN_THRESHOLD", 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting an unknown threshold succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Invalid profile
+   //=====================================================================================
+
+   {
+      test_ = "Invalid profile";
+
+      {
+         std::ofstream out( file_.c_str() );
+         out << "SMP_DVECASSIGN_THRESHOLD 5\n"
+             << "SMP_DMATASSIGN_THRESHOLD five\n";
+      }
+
+      try {
+         blaze::loadThresholds( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading an invalid profile succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+
+      checkValue( blaze::SMP_DVECASSIGN_THRESHOLD, blaze::SMP_DVECASSIGN_THRESHOLD.defaultValue() );
+   }
+
+
+   //=====================================================================================
+   // Missing profile
+   //=====================================================================================
+
+   {
+      test_ = "Missing profile";
+
+      std::remove( file_.c_str() );
+
+      try {
+         blaze::loadThresholds( file_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a missing profile succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the current value of the given threshold.
+//
+// \param threshold The threshold to be checked.
+// \param expected The expected value of the threshold.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ThresholdTest::checkValue( const blaze::Threshold& threshold, size_t expected ) const
+{
+   if( static_cast<size_t>( threshold ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold value\n"
+          << " Details:\n"
+          << "   Threshold       : " << threshold.name() << "\n"
+          << "   Result          : " << static_cast<size_t>( threshold ) << "\n"
+          << "   Expected result : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace tuning
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime threshold test..." << std::endl;
+
+   try
+   {
+      RUN_TUNING_THRESHOLD_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime threshold test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,864 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+// GCC reports the replaced allocation functions as mismatched in case they are inlined
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#  pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+
+//*************************************************************************************************
+/*!\brief The total number of dynamic memory allocations of the test.
+*/
+std::atomic<size_t> allocations( 0UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacement of the global allocation function for counting all allocations.
+//
+// \param size The number of bytes to be allocated.
+// \return Pointer to the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+*/
+void* operator new( std::size_t size )
+{
+   allocations.fetch_add( 1UL );
+
+   if( void* ptr = std::malloc( size > 0UL ? size : 1UL ) )
+      return ptr;
+
+   throw std::bad_alloc();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacement of the global deallocation function.
+//
+// \param ptr Pointer to the memory to be deallocated.
+// \return void
+*/
+void operator delete( void* ptr ) noexcept
+{
+   std::free( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacement of the global sized deallocation function.
+//
+// \param ptr Pointer to the memory to be deallocated.
+// \return void
+*/
+void operator delete( void* ptr, std::size_t ) noexcept
+{
+   ::operator delete( ptr );
+}
+//*************************************************************************************************
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding the given value to the given atomic sum.
+//
+// \param sum The atomic sum.
+// \param value The value to be added.
+// \return void
+*/
+void add( std::atomic<long>* sum, long value )
+{
+   sum->fetch_add( value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testSchedule();
+   testBatch();
+   testNested();
+   testResize();
+   testClear();
+   testSpinning();
+   testAffinity();
+   testTask();
+   testAllocation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of individual tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the schedule() and wait() functions of the ThreadPool class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchedule()
+{
+   test_ = "ThreadPool::schedule()";
+
+   ThreadPool pool( threads );
+   std::atomic<long> sum( 0L );
+
+   for( long i=0L; i<tasks; ++i ) {
+      pool.schedule( add, &sum, i );
+   }
+
+   pool.wait();
+
+   checkSum( sum.load(), tasks*(tasks-1L)/2L );
+
+   if( !pool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty thread pool detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the submission of batches of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the submit() and wait() functions for batches of tasks. The
+// same batch is submitted several times in order to test the reuse of a completed batch. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBatch()
+{
+   test_ = "ThreadPool::submit()";
+
+   ThreadPool pool( threads );
+   ThreadPool::Batch batch;
+   std::atomic<long> sum( 0L );
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      sum.store( 0L );
+
+      for( long i=0L; i<tasks; ++i ) {
+         batch.add( add, &sum, i );
+      }
+
+      if( batch.size() != static_cast<size_t>( tasks ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch size detected\n"
+             << " Details:\n"
+             << "   Size         : " << batch.size() << "\n"
+             << "   Expected size: " << tasks << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      pool.submit( batch );
+      pool.wait( batch );
+
+      checkSum( sum.load(), tasks*(tasks-1L)/2L );
+
+      batch.clear();
+   }
+
+   // Submitting an empty batch
+   pool.submit( batch );
+   pool.wait( batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks from within the threads of the pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of tasks that schedule further tasks and submit and await
+// nested batches. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNested()
+{
+   test_ = "Nested scheduling";
+
+   ThreadPool pool( threads );
+   std::atomic<long> sum( 0L );
+
+   // Nested scheduling of individual tasks
+   {
+      for( long i=0L; i<10L; ++i ) {
+         pool.schedule( [&pool,&sum]( long k ) {
+            for( long j=0L; j<tasks/10L; ++j )
+               pool.schedule( add, &sum, k*(tasks/10L)+j );
+         }, i );
+      }
+
+      pool.wait();
+
+      checkSum( sum.load(), tasks*(tasks-1L)/2L );
+   }
+
+   // Nested submission of batches
+   {
+      sum.store( 0L );
+
+      ThreadPool::Batch outer;
+
+      for( long i=0L; i<2L; ++i ) {
+         outer.add( [&pool,&sum]( long k ) {
+            ThreadPool::Batch inner;
+            for( long j=0L; j<tasks/2L; ++j )
+               inner.add( add, &sum, k*(tasks/2L)+j );
+            pool.submit( inner );
+            pool.wait( inner );
+         }, i );
+      }
+
+      pool.submit( outer );
+      pool.wait( outer );
+
+      checkSum( sum.load(), tasks*(tasks-1L)/2L );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function while tasks are scheduled.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "ThreadPool::resize()";
+
+   ThreadPool pool( threads );
+   std::atomic<long> sum( 0L );
+
+   for( size_t n : { 1UL, 6UL, 2UL, 3UL } )
+   {
+      sum.store( 0L );
+
+      for( long i=0L; i<tasks; ++i ) {
+         pool.schedule( add, &sum, i );
+      }
+
+      pool.resize( n, true );
+      pool.wait();
+
+      checkSum( sum.load(), tasks*(tasks-1L)/2L );
+
+      if( pool.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid thread pool size detected\n"
+             << " Details:\n"
+             << "   Size         : " << pool.size() << "\n"
+             << "   Expected size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() member function of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() member function. The single thread of the pool
+// is blocked while tasks are scheduled, which are subsequently removed. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "ThreadPool::clear()";
+
+   ThreadPool pool( 1UL );
+   std::atomic<bool> started( false );
+   std::atomic<bool> release( false );
+   std::atomic<long> sum( 0L );
+
+   pool.schedule( [&started,&release]() {
+      started.store( true );
+      while( !release.load() ) { std::this_thread::yield(); }
+   } );
+
+   while( !started.load() ) { std::this_thread::yield(); }
+
+   ThreadPool::Batch batch;
+   for( long i=0L; i<tasks; ++i ) {
+      pool.schedule( add, &sum, 1L );
+      batch.add( add, &sum, 1L );
+   }
+   pool.submit( batch );
+
+   pool.clear();
+   release.store( true );
+
+   pool.wait( batch );
+   pool.wait();
+
+   checkSum( sum.load(), 0L );
+
+   if( !pool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the thread pool failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of actively waiting threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of a thread pool with a non-zero spin time, i.e. with threads
+// that actively wait for new tasks. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSpinning()
+{
+   test_ = "ThreadPool::setSpinTime()";
+
+   ThreadPool pool( threads, 100UL );
+   ThreadPool::Batch batch;
+   std::atomic<long> sum( 0L );
+
+   if( pool.spinTime() != 100UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid spin time detected\n"
+          << " Details:\n"
+          << "   Spin time         : " << pool.spinTime() << "\n"
+          << "   Expected spin time: 100\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t spinTime : { 100UL, 1000UL, 0UL } )
+   {
+      pool.setSpinTime( spinTime );
+
+      for( size_t rep=0UL; rep<10UL; ++rep )
+      {
+         sum.store( 0L );
+
+         for( long i=0L; i<tasks; ++i ) {
+            pool.schedule( add, &sum, i );
+         }
+
+         pool.wait();
+
+         for( long i=0L; i<tasks; ++i ) {
+            batch.add( add, &sum, i );
+         }
+
+         pool.submit( batch );
+         pool.wait( batch );
+         batch.clear();
+
+         checkSum( sum.load(), tasks*(tasks-1L) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread affinity functionality.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parsing of thread affinities and of threads pinned to
+// specific CPUs. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAffinity()
+{
+   using blaze::threadpool::parseAffinity;
+   using blaze::threadpool::parseCpuList;
+
+   //=====================================================================================
+   // Parsing of CPU lists
+   //=====================================================================================
+
+   {
+      test_ = "parseCpuList()";
+
+      std::vector<size_t> cpus;
+
+      if( !parseCpuList( "0-3,8,10-11\n", cpus ) ||
+          cpus != std::vector<size_t>{ 0, 1, 2, 3, 8, 10, 11 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing a valid CPU list failed\n"
+             << " Details:\n"
+             << "   List: \"0-3,8,10-11\"\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( const std::string list : { "", "a", "1-", "3-1", "1,", ",1", "1;2" } )
+      {
+         if( parseCpuList( list, cpus ) || parseAffinity( list.empty() ? "x" : list, cpus ) ||
+             cpus.size() != 7UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Parsing an invalid CPU list succeeded\n"
+                << " Details:\n"
+                << "   List: \"" << list << "\"\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( !parseAffinity( "none", cpus ) || !cpus.empty() ||
+          !parseAffinity( "compact", cpus ) || cpus.empty() ||
+          !parseAffinity( "spread", cpus ) || cpus.empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing a predefined thread affinity failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Pinned threads
+   //=====================================================================================
+
+   {
+      test_ = "ThreadPool::setAffinity()";
+
+      const size_t cpu( blaze::threadpool::availableCpus().front() );
+
+      ThreadPool pool( threads, 0UL, std::vector<size_t>{ cpu } );
+      ThreadPool::Batch batch;
+      std::atomic<long> sum( 0L );
+      std::atomic<size_t> misplaced( 0UL );
+
+      if( pool.affinity() != std::vector<size_t>{ cpu } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid thread affinity detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t rep=0UL; rep<2UL; ++rep )
+      {
+         sum.store( 0L );
+
+         for( long i=0L; i<tasks; ++i ) {
+            batch.add( [&sum,&misplaced,cpu]( long j ) {
+#if defined(__linux__)
+               if( sched_getcpu() != static_cast<int>( cpu ) ) ++misplaced;
+#endif
+               add( &sum, j );
+            }, i );
+         }
+
+         pool.submit( batch );
+         pool.wait( batch );
+         batch.clear();
+
+         checkSum( sum.load(), tasks*(tasks-1L)/2L );
+
+         if( misplaced.load() != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Task executed on an invalid CPU\n"
+                << " Details:\n"
+                << "   Number of misplaced tasks: " << misplaced.load() << "\n"
+                << "   Expected CPU             : " << cpu << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         pool.setAffinity( std::vector<size_t>() );
+
+         if( !pool.affinity().empty() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Unpinning the threads failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         pool.setAffinity( std::vector<size_t>{ cpu } );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Task class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the small buffer optimization of the Task class, including
+// the alignment of over-aligned callables. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testTask()
+{
+   using blaze::threadpool::Task;
+
+   // Small callable
+   {
+      test_ = "Task with small callable";
+
+      std::atomic<long> sum( 0L );
+
+      const size_t before( allocations.load() );
+      Task task( [&sum]() { add( &sum, 1L ); } );
+      Task moved( std::move( task ) );
+      moved();
+      const size_t after( allocations.load() );
+
+      checkSum( sum.load(), 1L );
+
+      if( !moved.isInline() || after != before || task ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage of a small callable detected\n"
+             << " Details:\n"
+             << "   Allocations: " << ( after - before ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Large callable
+   {
+      test_ = "Task with large callable";
+
+      std::atomic<long> sum( 0L );
+      std::array<long,Task::capacity> values{};
+      values.back() = 2L;
+
+      Task task( [&sum,values]() { add( &sum, values.back() ); } );
+      Task moved;
+      moved = std::move( task );
+      moved();
+
+      checkSum( sum.load(), 2L );
+
+      if( moved.isInline() || task ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage of a large callable detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Over-aligned callable
+   {
+      test_ = "Task with over-aligned callable";
+
+      struct alignas( Task::alignment ) Callable {
+         void operator()() {
+            *aligned = ( reinterpret_cast<size_t>( this ) % alignof(Callable) == 0UL );
+         }
+         bool* aligned;
+      };
+
+      bool aligned( false );
+
+      const size_t before( allocations.load() );
+      Task task( Callable{ &aligned } );
+      Task moved( std::move( task ) );
+      moved();
+      const size_t after( allocations.load() );
+
+      if( !moved.isInline() || after != before || !aligned ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage of an over-aligned callable detected\n"
+             << " Details:\n"
+             << "   Allocations: " << ( after - before ) << "\n"
+             << "   Aligned    : " << aligned << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Large over-aligned callable
+   {
+      test_ = "Task with large over-aligned callable";
+
+      struct alignas( 2UL*Task::alignment ) Callable {
+         void operator()() {
+            *aligned = ( reinterpret_cast<size_t>( this ) % alignof(Callable) == 0UL );
+         }
+         bool* aligned;
+      };
+
+      bool aligned( false );
+
+      Task task( Callable{ &aligned } );
+      Task moved;
+      moved = std::move( task );
+      moved();
+
+      if( moved.isInline() || !aligned ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage of a large over-aligned callable detected\n"
+             << " Details:\n"
+             << "   Aligned: " << aligned << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dynamic memory allocations during the scheduling of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that, after a warm-up phase, neither the scheduling of individual tasks
+// nor the submission of a reused batch performs any dynamic memory allocation. During the
+// warm-up phase all threads are blocked while the tasks are scheduled, which results in the
+// maximum number of simultaneously scheduled tasks. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocation()
+{
+   test_ = "Allocation-free scheduling";
+
+   ThreadPool pool( threads );
+   ThreadPool::Batch batch;
+   std::atomic<long> sum( 0L );
+
+   // Functor of the size of a typical SMP assignment task
+   std::array<char,128UL> data{};
+   auto task = [&sum,data]( long i ) { add( &sum, i + data.front() ); };
+
+   // Warm-up phase with blocked threads
+   {
+      std::atomic<size_t> blocked( 0UL );
+      std::atomic<bool> release( false );
+
+      for( size_t i=0UL; i<threads; ++i ) {
+         pool.schedule( [&blocked,&release]() {
+            ++blocked;
+            while( !release.load() ) { std::this_thread::yield(); }
+         } );
+      }
+
+      while( blocked.load() != threads ) { std::this_thread::yield(); }
+
+      for( long i=0L; i<tasks; ++i ) {
+         pool.schedule( task, i );
+         batch.add( task, i );
+      }
+
+      pool.submit( batch );
+      release.store( true );
+
+      pool.wait();
+      pool.wait( batch );
+      batch.clear();
+
+      checkSum( sum.load(), tasks*(tasks-1L) );
+   }
+
+   const size_t before( allocations.load() );
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      sum.store( 0L );
+
+      for( long i=0L; i<tasks; ++i ) {
+         pool.schedule( task, i );
+      }
+
+      pool.wait();
+
+      for( long i=0L; i<tasks; ++i ) {
+         batch.add( task, i );
+      }
+
+      pool.submit( batch );
+      pool.wait( batch );
+      batch.clear();
+
+      checkSum( sum.load(), tasks*(tasks-1L) );
+   }
+
+   const size_t after( allocations.load() );
+
+   if( after != before ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dynamic memory allocation detected\n"
+          << " Details:\n"
+          << "   Allocations: " << ( after - before ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of the scheduled tasks.
+//
+// \param sum The sum computed by the scheduled tasks.
+// \param expectedSum The expected sum.
+// \return void
+// \exception std::runtime_error Invalid sum detected.
+*/
+void ClassTest::checkSum( long sum, long expectedSum ) const
+{
+   if( sum != expectedSum ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the scheduled tasks detected\n"
+          << " Details:\n"
+          << "   Result         : " << sum << "\n"
+          << "   Expected result: " << expectedSum << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************